@@ -138,4 +138,6 @@ $FRONT --mode=write -DT=bfloat16 \
 $FRONT --mode=compute -DT=bfloat16 \
     $TANTO/unpack_untilize_math.cpp >$METAL/unpack_untilize_math.cpp
 
+$FRONT --mode=read -DT=bfloat16 \
+    $TANTO/global_block_reader.cpp >$METAL/global_block_reader.cpp
 
@@ -69,3 +69,7 @@ void compare(const std::vector<float> &got, const std::vector<float> &want) {
     printf("PCC: %g\n", pcc);
 }
 
+void report(const char *check, bool ok) {
+    printf("%s = %s\n", check, ok ? "OK" : "FAIL");
+}
+
@@ -16,13 +16,20 @@ enum class Algo {
     REDUCE,
     TRANSPOSE_WH,
     UNPACK_TILIZE,
-    UNPACK_UNTILIZE
+    UNPACK_UNTILIZE,
+    GLOBAL_RANGE,
+    PIPE_RESIZE,
+    LOCAL_ARENA,
+    TRACE_REPLAY,
+    GLOBAL_BLOCK,
+    GRAPH_CHAIN
 };
 
 std::vector<uint16_t> float_to_u16b(const std::vector<float> &x);
 std::vector<float> u16b_to_float(const std::vector<uint16_t> &x);
 
 void compare(const std::vector<float> &got, const std::vector<float> &want);
+void report(const char *check, bool ok);
 
 void main_eltwise_binary();
 void main_eltwise_sfpu();
@@ -33,4 +40,10 @@ void main_reduce();
 void main_transpose_wh();
 void main_unpack_tilize();
 void main_unpack_untilize();
+void main_global_range();
+void main_pipe_resize();
+void main_local_arena();
+void main_trace_replay();
+void main_global_block();
+void main_graph_chain();
 
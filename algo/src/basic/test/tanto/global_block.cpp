@@ -0,0 +1,78 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdio>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <map>
+
+#include "host/core/api.hpp"
+
+#include "test/tanto/common.hpp"
+
+namespace core = ronin::tanto::host;
+
+namespace {
+
+constexpr core::DataFormat T = core::DataFormat::BFLOAT16;
+constexpr uint32_t PAGE_ITEMS = 1024;
+
+std::vector<uint16_t> make_data(uint32_t size, uint32_t seed) {
+    std::vector<uint16_t> data(size);
+    for (uint32_t i = 0; i < size; i++) {
+        data[i] = uint16_t(i * 7 + seed);
+    }
+    return data;
+}
+
+// copy block distributed gx to linear gy page by page on core (0, 0)
+core::Program make_program(
+        const core::Device &device,
+        const core::Global &gx,
+        const core::Global &gy,
+        uint32_t num_pages) {
+    core::Program program(device);
+    core::Grid grid(program, 0, 0);
+    core::Local lx(program, grid, T, PAGE_ITEMS);
+    std::string base_path = "algo/basic/device/metal";
+    std::map<std::string, std::string> defines = {{"T", "bfloat16"}};
+    core::Kernel reader(
+        program,
+        grid,
+        core::KernelKind::READER,
+        core::KernelFormat::METAL,
+        base_path + "/global_block_reader.cpp",
+        {},
+        defines);
+    reader.set_args(grid, {gx, gy, lx, num_pages, PAGE_ITEMS});
+    return program;
+}
+
+} // namespace
+
+void main_global_block() {
+    core::Platform platform = core::Platform::get_default();
+    core::Device device(platform, 0);
+    core::Queue queue(device, 0);
+    // page count is not multiple of bank count: last bank is partially filled
+    core::Global gx(device, T, core::GlobalDist::BLOCK, 100 * PAGE_ITEMS, PAGE_ITEMS);
+    // buffer is padded to whole number of pages per bank
+    uint32_t size = gx.bytes() / sizeof(uint16_t);
+    uint32_t num_pages = size / PAGE_ITEMS;
+    uint32_t log2_page_size = 10; // 2 ^ 10 = 1024
+    core::Global gy(device, T, size, log2_page_size);
+    core::Program program = make_program(device, gx, gy, num_pages);
+    std::vector<uint16_t> data = make_data(size, 1);
+    queue.enqueue_write(gx, data.data(), false);
+    std::vector<uint16_t> got(size);
+    queue.enqueue_read(gx, got.data(), true);
+    report("Host round trip", (got == data));
+    queue.enqueue_program(program, false);
+    queue.enqueue_read(gy, got.data(), true);
+    report("Device page order", (got == data));
+    queue.finish();
+    device.close();
+}
+
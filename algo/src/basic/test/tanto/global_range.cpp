@@ -0,0 +1,115 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "host/core/api.hpp"
+
+#include "test/tanto/common.hpp"
+
+namespace core = ronin::tanto::host;
+
+namespace {
+
+constexpr uint32_t PAGE_BYTES = 1024;
+constexpr uint32_t PAGE_ITEMS = PAGE_BYTES / sizeof(uint16_t);
+
+struct PageRange {
+    uint32_t first_page;
+    uint32_t page_count;
+};
+
+// page ranges starting past first 16 pages (width of relay start page field)
+// and in banks above 16 for L1 with more banks
+std::vector<PageRange> page_config = {
+    {0, 1},
+    {15, 2},
+    {16, 1},
+    {17, 20},
+    {31, 70},
+    {100, 40},
+    {130, 126}
+};
+
+std::vector<uint16_t> make_data(uint32_t size, uint32_t seed) {
+    std::vector<uint16_t> data(size);
+    for (uint32_t i = 0; i < size; i++) {
+        data[i] = uint16_t(i * 7 + seed);
+    }
+    return data;
+}
+
+bool read_pages(
+        const core::Queue &queue,
+        const core::Global &global,
+        const std::vector<uint16_t> &want) {
+    bool ok = true;
+    for (const PageRange &range: page_config) {
+        std::vector<uint16_t> got(range.page_count * PAGE_ITEMS);
+        queue.enqueue_read_pages(global, range.first_page, range.page_count, got.data(), true);
+        const uint16_t *ref = want.data() + range.first_page * PAGE_ITEMS;
+        if (memcmp(got.data(), ref, got.size() * sizeof(uint16_t)) != 0) {
+            printf("Mismatch at pages [%u, %u)\n",
+                range.first_page, range.first_page + range.page_count);
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+bool read_bytes(
+        const core::Queue &queue,
+        const core::Global &global,
+        const std::vector<uint16_t> &want) {
+    // unaligned range starting at page 16 and crossing bank round
+    uint32_t offset = 16 * PAGE_BYTES + 6;
+    uint32_t bytes = 150 * PAGE_BYTES + 10;
+    std::vector<uint8_t> got(bytes);
+    queue.enqueue_read(global, offset, bytes, got.data(), true);
+    const uint8_t *ref = reinterpret_cast<const uint8_t *>(want.data()) + offset;
+    return (memcmp(got.data(), ref, bytes) == 0);
+}
+
+bool write_pages(
+        const core::Queue &queue,
+        const core::Global &global,
+        std::vector<uint16_t> &want) {
+    uint32_t first_page = 40;
+    uint32_t page_count = 60;
+    std::vector<uint16_t> src = make_data(page_count * PAGE_ITEMS, 5);
+    queue.enqueue_write_pages(global, first_page, page_count, src.data(), false);
+    memcpy(want.data() + first_page * PAGE_ITEMS, src.data(), src.size() * sizeof(uint16_t));
+    std::vector<uint16_t> got(want.size());
+    queue.enqueue_read(global, got.data(), true);
+    return (got == want);
+}
+
+void run(bool is_dram) {
+    printf("---- %s\n", is_dram ? "DRAM" : "L1");
+    uint32_t num_pages = 256;
+    uint32_t size = num_pages * PAGE_ITEMS;
+    core::Platform platform = core::Platform::get_default();
+    core::Device device(platform, 0);
+    core::Queue queue(device, 0);
+    uint32_t log2_page_size = 10; // 2 ^ 10 = 1024
+    core::Global global(device, core::DataFormat::BFLOAT16, is_dram, size, log2_page_size);
+    std::vector<uint16_t> data = make_data(size, 1);
+    queue.enqueue_write(global, data.data(), false);
+    report("Read pages", read_pages(queue, global, data));
+    report("Read bytes", read_bytes(queue, global, data));
+    report("Write pages", write_pages(queue, global, data));
+    queue.finish();
+    device.close();
+}
+
+} // namespace
+
+void main_global_range() {
+    run(false);
+    run(true);
+}
+
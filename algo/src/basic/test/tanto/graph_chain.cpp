@@ -0,0 +1,136 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdio>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <map>
+
+#include "host/core/api.hpp"
+
+#include "test/util/gen.hpp"
+
+#include "test/tanto/common.hpp"
+
+using namespace ronin::algo::basic::test;
+
+namespace core = ronin::tanto::host;
+
+namespace {
+
+constexpr core::DataFormat T = core::DataFormat::BFLOAT16;
+constexpr uint32_t TILE_SIZE = 1024;
+
+// c = a <op> b on core (x, 0), one tile per block
+core::Program make_program(
+        const core::Device &device,
+        uint32_t x,
+        const std::string &math_name,
+        const core::Global &ga,
+        const core::Global &gb,
+        const core::Global &gc,
+        uint32_t N) {
+    uint32_t num_blocks = N / TILE_SIZE;
+    uint32_t block_tiles = 1;
+    core::Program program(device);
+    core::Grid grid(program, x, 0);
+    core::Pipe pa(program, grid, core::PipeKind::INPUT, T, 2, 1);
+    core::Pipe pb(program, grid, core::PipeKind::INPUT, T, 2, 1);
+    core::Pipe pc(program, grid, core::PipeKind::OUTPUT, T, 2, 1);
+    std::string base_path = "algo/basic/device/metal";
+    std::map<std::string, std::string> defines = {{"T", "bfloat16"}};
+    core::Kernel reader(
+        program,
+        grid,
+        core::KernelKind::READER,
+        core::KernelFormat::METAL,
+        base_path + "/eltwise_binary_reader.cpp",
+        {},
+        defines);
+    core::Kernel writer(
+        program,
+        grid,
+        core::KernelKind::WRITER,
+        core::KernelFormat::METAL,
+        base_path + "/eltwise_binary_writer.cpp",
+        {},
+        defines);
+    core::Kernel math(
+        program,
+        grid,
+        core::KernelKind::MATH,
+        core::KernelFormat::METAL,
+        base_path + "/" + math_name + ".cpp",
+        {},
+        defines);
+    reader.set_args(grid, {ga, gb, pa, pb, uint32_t(0), uint32_t(0), num_blocks, block_tiles});
+    writer.set_args(grid, {gc, pc, uint32_t(0), num_blocks, block_tiles});
+    math.set_args(grid, {pa, pb, pc, num_blocks, block_tiles});
+    return program;
+}
+
+std::vector<uint16_t> run_graph(
+        const core::Queue &queue,
+        const core::Graph &graph,
+        const core::Global &global,
+        uint32_t N) {
+    std::vector<uint16_t> result(N);
+    queue.enqueue_graph(graph, false);
+    queue.enqueue_read(global, result.data(), true);
+    return result;
+}
+
+} // namespace
+
+void main_graph_chain() {
+    core::Platform platform = core::Platform::get_default();
+    core::Device device(platform, 0);
+    core::Queue queue(device, 0);
+    uint32_t N = 16 * TILE_SIZE;
+    uint32_t log2_page_size = 10; // 2 ^ 10 = 1024 (one tile)
+    core::Global ga(device, T, N, log2_page_size);
+    core::Global gb(device, T, N, log2_page_size);
+    core::Global gc(device, T, N, log2_page_size);
+    core::Global gd(device, T, N, log2_page_size);
+    core::Global ge(device, T, N, log2_page_size);
+    util::manual_seed(1234);
+    std::vector<uint16_t> a = float_to_u16b(util::normal(0.0f, 0.1f, N));
+    std::vector<uint16_t> b = float_to_u16b(util::normal(0.0f, 0.1f, N));
+    queue.enqueue_write(ga, a.data(), false);
+    queue.enqueue_write(gb, b.data(), false);
+    // c = a + b, d = a * b: disjoint cores, inputs shared read-only
+    core::Program add = make_program(device, 0, "eltwise_add_math", ga, gb, gc, N);
+    core::Program mul = make_program(device, 1, "eltwise_mul_math", ga, gb, gd, N);
+    // e = c * b: reads output of add
+    core::Program dep = make_program(device, 2, "eltwise_mul_math", gc, gb, ge, N);
+    // reference results of sequential runs
+    std::vector<uint16_t> want_d(N);
+    std::vector<uint16_t> want_e(N);
+    queue.enqueue_program(add, false);
+    queue.enqueue_program(mul, false);
+    queue.enqueue_program(dep, false);
+    queue.enqueue_read(gd, want_d.data(), false);
+    queue.enqueue_read(ge, want_e.data(), true);
+    // independent programs
+    core::Graph independent(device);
+    independent.add_program(add);
+    independent.add_program(mul);
+    report("Independent programs in one batch", (independent.batch_count() == 1));
+    report("Independent programs result", (run_graph(queue, independent, gd, N) == want_d));
+    // dependent pair: add writes c, dep reads it
+    core::Graph dependent(device);
+    dependent.add_program(add);
+    dependent.add_program(dep);
+    report("Dependent programs separated by barrier", (dependent.batch_count() == 2));
+    report("Dependent programs result", (run_graph(queue, dependent, ge, N) == want_e));
+    // write after read: add reads a, program writing a runs after it
+    core::Program overwrite = make_program(device, 1, "eltwise_mul_math", gb, gb, ga, N);
+    core::Graph war(device);
+    war.add_program(add);
+    war.add_program(overwrite);
+    report("Write after read separated by barrier", (war.batch_count() == 2));
+    queue.finish();
+    device.close();
+}
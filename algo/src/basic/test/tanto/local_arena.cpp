@@ -0,0 +1,153 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdio>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <map>
+
+#include "host/core/api.hpp"
+
+#include "test/tanto/common.hpp"
+
+namespace core = ronin::tanto::host;
+
+namespace {
+
+constexpr core::DataFormat T = core::DataFormat::BFLOAT16;
+constexpr uint32_t TILE_SIZE = 1024;
+
+//
+//    Elementwise addition c = a + b on one core
+//
+
+class EltwiseAdd {
+public:
+    EltwiseAdd(
+        const core::Device &device,
+        uint32_t x,
+        uint32_t y,
+        uint32_t N,
+        uint32_t frame_size);
+public:
+    core::Program &program() {
+        return m_program;
+    }
+    core::Grid &grid() {
+        return m_grid;
+    }
+    bool run(const std::vector<float> &a, const std::vector<float> &b);
+private:
+    core::Device m_device;
+    uint32_t m_N;
+    core::Program m_program;
+    core::Grid m_grid;
+    core::Global m_ga;
+    core::Global m_gb;
+    core::Global m_gc;
+};
+
+EltwiseAdd::EltwiseAdd(
+        const core::Device &device,
+        uint32_t x,
+        uint32_t y,
+        uint32_t N,
+        uint32_t frame_size):
+            m_device(device),
+            m_N(N) {
+    uint32_t num_blocks = N / (frame_size * TILE_SIZE);
+    uint32_t log2_page_size = 10; // 2 ^ 10 = 1024 (one tile)
+    m_program = core::Program(device);
+    m_grid = core::Grid(m_program, x, y);
+    m_ga = core::Global(device, T, N, log2_page_size);
+    m_gb = core::Global(device, T, N, log2_page_size);
+    m_gc = core::Global(device, T, N, log2_page_size);
+    core::Pipe pa(m_program, m_grid, core::PipeKind::INPUT, T, frame_size * 2, frame_size);
+    core::Pipe pb(m_program, m_grid, core::PipeKind::INPUT, T, frame_size * 2, frame_size);
+    core::Pipe pc(m_program, m_grid, core::PipeKind::OUTPUT, T, frame_size * 2, frame_size);
+    std::string base_path = "algo/basic/device/metal";
+    std::map<std::string, std::string> defines = {{"T", "bfloat16"}};
+    core::Kernel reader(
+        m_program,
+        m_grid,
+        core::KernelKind::READER,
+        core::KernelFormat::METAL,
+        base_path + "/eltwise_binary_reader.cpp",
+        {},
+        defines);
+    core::Kernel writer(
+        m_program,
+        m_grid,
+        core::KernelKind::WRITER,
+        core::KernelFormat::METAL,
+        base_path + "/eltwise_binary_writer.cpp",
+        {},
+        defines);
+    core::Kernel math(
+        m_program,
+        m_grid,
+        core::KernelKind::MATH,
+        core::KernelFormat::METAL,
+        base_path + "/eltwise_add_math.cpp",
+        {},
+        defines);
+    reader.set_args(m_grid, {m_ga, m_gb, pa, pb, uint32_t(0), uint32_t(0), num_blocks, frame_size});
+    writer.set_args(m_grid, {m_gc, pc, uint32_t(0), num_blocks, frame_size});
+    math.set_args(m_grid, {pa, pb, pc, num_blocks, frame_size});
+}
+
+bool EltwiseAdd::run(const std::vector<float> &a, const std::vector<float> &b) {
+    std::vector<float> want(m_N);
+    for (uint32_t i = 0; i < m_N; i++) {
+        want[i] = a[i] + b[i];
+    }
+    std::vector<uint16_t> ta = float_to_u16b(a);
+    std::vector<uint16_t> tb = float_to_u16b(b);
+    std::vector<uint16_t> tc(m_N);
+    core::Queue queue(m_device, 0);
+    queue.enqueue_write(m_ga, ta.data(), false);
+    queue.enqueue_write(m_gb, tb.data(), false);
+    queue.enqueue_program(m_program, false);
+    queue.enqueue_read(m_gc, tc.data(), true);
+    // small integer operands: sums are exact in bfloat16
+    return (tc == float_to_u16b(want));
+}
+
+} // namespace
+
+void main_local_arena() {
+    core::Platform platform = core::Platform::get_default();
+    core::Device device(platform, 0);
+    uint32_t N = 256 * TILE_SIZE;
+    std::vector<float> a(N);
+    std::vector<float> b(N);
+    for (uint32_t i = 0; i < N; i++) {
+        a[i] = float(i % 64);
+        b[i] = float((i / 64) % 64);
+    }
+    // program holding 640K bytes of program scope locals on core (0, 0)
+    EltwiseAdd local_heavy(device, 0, 0, N, 1);
+    std::vector<core::Local> locals;
+    for (int i = 0; i < 10; i++) {
+        locals.emplace_back(local_heavy.program(), local_heavy.grid(), T, 32 * TILE_SIZE);
+    }
+    // program with 768K bytes of pipes on core (1, 0):
+    //     fits only if arena does not span all worker cores
+    EltwiseAdd pipe_heavy(device, 1, 0, N, 64);
+    report("Locals", local_heavy.run(a, b));
+    report("Arena on local core", (device.local_arena_bytes(0, 0) == 10 * 32 * TILE_SIZE * 2));
+    report("No arena on pipe core", (device.local_arena_bytes(1, 0) == 0));
+    report("Pipes after locals", pipe_heavy.run(a, b));
+    report("Locals after pipes", local_heavy.run(a, b));
+    // locals allocated per launch: no L1 reserved between launches
+    device.set_local_arena(false);
+    report("Locals without arena", local_heavy.run(a, b));
+    report("Arena released", (device.local_arena_bytes(0, 0) == 0));
+    report("Pipes without arena", pipe_heavy.run(a, b));
+    device.set_local_arena(true);
+    report("Locals with arena restored", local_heavy.run(a, b));
+    device.close();
+}
+
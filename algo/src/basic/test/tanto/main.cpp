@@ -21,7 +21,13 @@ std::unordered_map<std::string, Algo> str_algo_map = {
     {"reduce", Algo::REDUCE},
     {"transpose_wh", Algo::TRANSPOSE_WH},
     {"unpack_tilize", Algo::UNPACK_TILIZE},
-    {"unpack_untilize", Algo::UNPACK_UNTILIZE}
+    {"unpack_untilize", Algo::UNPACK_UNTILIZE},
+    {"global_range", Algo::GLOBAL_RANGE},
+    {"pipe_resize", Algo::PIPE_RESIZE},
+    {"local_arena", Algo::LOCAL_ARENA},
+    {"trace_replay", Algo::TRACE_REPLAY},
+    {"global_block", Algo::GLOBAL_BLOCK},
+    {"graph_chain", Algo::GRAPH_CHAIN}
 };
 
 void usage() {
@@ -37,6 +43,12 @@ void usage() {
     fprintf(stderr, "    transpose_wh\n");
     fprintf(stderr, "    unpack_tilize\n");
     fprintf(stderr, "    unpack_untilize\n");
+    fprintf(stderr, "    global_range\n");
+    fprintf(stderr, "    pipe_resize\n");
+    fprintf(stderr, "    local_arena\n");
+    fprintf(stderr, "    trace_replay\n");
+    fprintf(stderr, "    global_block\n");
+    fprintf(stderr, "    graph_chain\n");
     fprintf(stderr, "\n");
 }
 
@@ -89,6 +101,24 @@ int main(int argc, char **argv) {
         case Algo::UNPACK_UNTILIZE:
             main_unpack_untilize();
             break;
+        case Algo::GLOBAL_RANGE:
+            main_global_range();
+            break;
+        case Algo::PIPE_RESIZE:
+            main_pipe_resize();
+            break;
+        case Algo::LOCAL_ARENA:
+            main_local_arena();
+            break;
+        case Algo::TRACE_REPLAY:
+            main_trace_replay();
+            break;
+        case Algo::GLOBAL_BLOCK:
+            main_global_block();
+            break;
+        case Algo::GRAPH_CHAIN:
+            main_graph_chain();
+            break;
         default:
             assert(false);
             break;
@@ -0,0 +1,131 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdio>
+#include <cstdint>
+#include <string>
+#include <map>
+
+#include "host/core/api.hpp"
+
+#include "test/tanto/common.hpp"
+
+namespace core = ronin::tanto::host;
+
+namespace {
+
+constexpr core::DataFormat T = core::DataFormat::BFLOAT16;
+
+bool resize_throws(const core::Pipe &pipe, uint32_t size) {
+    try {
+        pipe.resize(size);
+    } catch (core::Error &e) {
+        return true;
+    }
+    return false;
+}
+
+// pipe reports as produced by frontend for reader (pushes to 'pa')
+// and math (pops from 'pa') kernels of elementwise binary operation;
+// loop trip counts are bound to 'num_blocks' kernel parameters
+
+const char *reader_report =
+    "pipe 2 pa 4\n"
+    "loop 1 $6\n"
+    "op 2 push 1 1\n";
+
+const char *reader_cond_report =
+    "pipe 2 pa 4\n"
+    "loop 1 $6\n"
+    "op 2 push 1 1\n"
+    "op 2 push 3 1 cond\n";
+
+const char *math_report =
+    "pipe 0 pa 4\n"
+    "loop 1 $3\n"
+    "op 0 pop 1 1\n";
+
+void write_text(const std::string &path, const char *text) {
+    FILE *fp = fopen(path.c_str(), "w");
+    if (fp == nullptr) {
+        throw core::Error("Cannot create pipe report file");
+    }
+    fputs(text, fp);
+    fclose(fp);
+}
+
+// returns size of 'pa' after resizing from initial size 'size'
+uint32_t run_resize(
+        const core::Device &device, 
+        const char *reader_text, 
+        uint32_t size, 
+        uint32_t num_blocks) {
+    uint32_t frame_size = 4;
+    uint32_t N = 16 * 1024;
+    uint32_t log2_page_size = 10; // 2 ^ 10 = 1024
+    core::Program program(device);
+    core::Grid grid(program, 0, 0);
+    core::Global ga(device, T, N, log2_page_size);
+    core::Global gb(device, T, N, log2_page_size);
+    core::Pipe pa(program, grid, core::PipeKind::INPUT, T, size, frame_size);
+    core::Pipe pb(program, grid, core::PipeKind::INPUT, T, frame_size * 2, frame_size);
+    core::Pipe pc(program, grid, core::PipeKind::OUTPUT, T, frame_size * 2, frame_size);
+    std::string base_path = "algo/basic/device/metal";
+    std::map<std::string, std::string> defines = {{"T", "bfloat16"}};
+    core::Kernel reader(
+        program,
+        grid,
+        core::KernelKind::READER,
+        core::KernelFormat::TANTO,
+        base_path + "/eltwise_binary_reader.cpp",
+        {},
+        defines);
+    core::Kernel math(
+        program,
+        grid,
+        core::KernelKind::MATH,
+        core::KernelFormat::TANTO,
+        base_path + "/eltwise_add_math.cpp",
+        {},
+        defines);
+    std::string reader_path = "pipe_resize_reader.txt";
+    std::string math_path = "pipe_resize_math.txt";
+    write_text(reader_path, reader_text);
+    write_text(math_path, math_report);
+    reader.set_pipe_report(reader_path);
+    math.set_pipe_report(math_path);
+    remove(reader_path.c_str());
+    remove(math_path.c_str());
+    reader.set_args(grid, {ga, gb, pa, pb, uint32_t(0), uint32_t(0), num_blocks, frame_size});
+    math.set_args(grid, {pa, pb, pc, num_blocks, frame_size});
+    program.resize_pipes();
+    return pa.size();
+}
+
+} // namespace
+
+void main_pipe_resize() {
+    core::Platform platform = core::Platform::get_default();
+    core::Device device(platform, 0);
+    core::Program program(device);
+    core::Grid grid(program, 0, 0, 1, 1);
+    uint32_t frame_size = 2;
+    core::Pipe pipe(program, grid, core::PipeKind::INPUT, T, frame_size * 2, frame_size);
+    pipe.resize(frame_size * 4);
+    report("Resize", (pipe.size() == frame_size * 4));
+    report("Same size", !resize_throws(pipe, frame_size * 4));
+    report("Non-multiple of frame size", resize_throws(pipe, frame_size * 4 + 1));
+    report("Zero size", resize_throws(pipe, 0));
+    report("Size unchanged", (pipe.size() == frame_size * 4));
+    core::Local local(program, grid, T, frame_size * 2 * 1024);
+    core::Pipe bound(program, grid, core::PipeKind::INTERMED, T, frame_size * 2, frame_size);
+    bound.set_local(local);
+    report("Bound to local", resize_throws(bound, frame_size * 4));
+    // total frame count overflowing 32 bits must not shrink hand-set depth
+    report("Large trip count", (run_resize(device, reader_report, 16, 0x40000001) == 16));
+    // conditional pushes do not raise minimum depth of 2 frames (8 tiles)
+    report("Conditional push", (run_resize(device, reader_cond_report, 4, 8) == 8));
+    device.close();
+}
+
@@ -0,0 +1,125 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdio>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <map>
+
+#include "host/core/api.hpp"
+
+#include "test/util/gen.hpp"
+
+#include "test/tanto/common.hpp"
+
+using namespace ronin::algo::basic::test;
+
+namespace core = ronin::tanto::host;
+
+namespace {
+
+constexpr core::DataFormat T = core::DataFormat::BFLOAT16;
+constexpr uint32_t TILE_SIZE = 1024;
+
+// c = a <op> b on core (0, 0), one tile per block
+core::Program make_program(
+        const core::Device &device,
+        const std::string &math_name,
+        const core::Global &ga,
+        const core::Global &gb,
+        const core::Global &gc,
+        uint32_t N) {
+    uint32_t num_blocks = N / TILE_SIZE;
+    uint32_t block_tiles = 1;
+    core::Program program(device);
+    core::Grid grid(program, 0, 0);
+    core::Pipe pa(program, grid, core::PipeKind::INPUT, T, 2, 1);
+    core::Pipe pb(program, grid, core::PipeKind::INPUT, T, 2, 1);
+    core::Pipe pc(program, grid, core::PipeKind::OUTPUT, T, 2, 1);
+    std::string base_path = "algo/basic/device/metal";
+    std::map<std::string, std::string> defines = {{"T", "bfloat16"}};
+    core::Kernel reader(
+        program,
+        grid,
+        core::KernelKind::READER,
+        core::KernelFormat::METAL,
+        base_path + "/eltwise_binary_reader.cpp",
+        {},
+        defines);
+    core::Kernel writer(
+        program,
+        grid,
+        core::KernelKind::WRITER,
+        core::KernelFormat::METAL,
+        base_path + "/eltwise_binary_writer.cpp",
+        {},
+        defines);
+    core::Kernel math(
+        program,
+        grid,
+        core::KernelKind::MATH,
+        core::KernelFormat::METAL,
+        base_path + "/" + math_name + ".cpp",
+        {},
+        defines);
+    reader.set_args(grid, {ga, gb, pa, pb, uint32_t(0), uint32_t(0), num_blocks, block_tiles});
+    writer.set_args(grid, {gc, pc, uint32_t(0), num_blocks, block_tiles});
+    math.set_args(grid, {pa, pb, pc, num_blocks, block_tiles});
+    return program;
+}
+
+} // namespace
+
+void main_trace_replay() {
+    core::Platform platform = core::Platform::get_default();
+    uint32_t trace_region_size = 4 * 1024 * 1024;
+    core::Device device(platform, 0, trace_region_size);
+    core::Queue queue(device, 0);
+    uint32_t N = 64 * TILE_SIZE;
+    uint32_t log2_page_size = 10; // 2 ^ 10 = 1024 (one tile)
+    core::Global ga(device, T, N, log2_page_size);
+    core::Global gb(device, T, N, log2_page_size);
+    core::Global gc(device, T, N, log2_page_size);
+    core::Global gd(device, T, N, log2_page_size);
+    // d = (a + b) * b
+    core::Program add = make_program(device, "eltwise_add_math", ga, gb, gc, N);
+    core::Program mul = make_program(device, "eltwise_mul_math", gc, gb, gd, N);
+    util::manual_seed(1234);
+    std::vector<uint16_t> a0 = float_to_u16b(util::normal(0.0f, 0.1f, N));
+    std::vector<uint16_t> a1 = float_to_u16b(util::normal(0.0f, 0.1f, N));
+    std::vector<uint16_t> b = float_to_u16b(util::normal(0.0f, 0.1f, N));
+    queue.enqueue_write(gb, b.data(), false);
+    // untraced runs also bind programs before capture
+    std::vector<std::vector<uint16_t>> want(2, std::vector<uint16_t>(N));
+    const std::vector<uint16_t> *inputs[2] = {&a0, &a1};
+    for (int i = 0; i < 2; i++) {
+        queue.enqueue_write(ga, inputs[i]->data(), false);
+        queue.enqueue_program(add, false);
+        queue.enqueue_program(mul, false);
+        queue.enqueue_read(gd, want[i].data(), true);
+    }
+    uint32_t trace_id = queue.begin_trace();
+    queue.enqueue_program(add, false);
+    queue.enqueue_program(mul, false);
+    queue.end_trace();
+    // replay twice per input: trace is reusable
+    bool ok = true;
+    for (int k = 0; k < 4; k++) {
+        int i = k % 2;
+        std::vector<uint16_t> got(N);
+        queue.enqueue_write(ga, inputs[i]->data(), false);
+        queue.replay_trace(trace_id, true);
+        queue.enqueue_read(gd, got.data(), true);
+        if (got != want[i]) {
+            printf("Mismatch at replay %d\n", k);
+            ok = false;
+        }
+    }
+    report("Replay matches untraced run", ok);
+    queue.release_trace(trace_id);
+    queue.finish();
+    device.close();
+}
+
@@ -46,6 +46,7 @@ typedef uint32_t uint32;
 struct Global {
     uint32 addr;
     uint32 log2_page_size;
+    uint32 bank_pages;
 };
 
 struct Local {
@@ -90,6 +91,7 @@ API void tanto_add_bcast_scalar_init();
 API void tanto_sub_bcast_scalar_init();
 API void tanto_mul_bcast_scalar_init();
 API void tanto_matmul_init(bool transpose);
+API void tanto_matmul_block_init(bool transpose, uint32 ct_dim);
 API void tanto_reduce_max_rows_init();
 API void tanto_reduce_max_cols_init();
 API void tanto_reduce_max_scalar_init();
@@ -162,6 +164,7 @@ API void tanto_unpack_bcast_rows_init(uint32 icb0, uint32 icb1);
 API void tanto_unpack_bcast_cols_init(uint32 icb0, uint32 icb1);
 API void tanto_unpack_bcast_scalar_init(uint32 icb0, uint32 icb1);
 API void tanto_unpack_matmul_init(uint32 icb0, uint32 icb1, bool transpose);
+API void tanto_unpack_matmul_block_init(uint32 icb0, uint32 icb1, bool transpose, uint32 ct_dim);
 API void tanto_unpack_unary_init(uint32 icb);
 API void tanto_unpack_reduce_rows_init(uint32 icb, uint32 icb_scaler);
 API void tanto_unpack_reduce_cols_init(uint32 icb, uint32 icb_scaler);
@@ -13,6 +13,7 @@ typedef uint32_t uint32;
 struct Global {
     uint32 addr;
     uint32 log2_page_size;
+    uint32 bank_pages;
 };
 
 struct Local {
@@ -68,6 +69,7 @@ API void noc_async_read_block_dram(
     uint32 dst_addr,
     uint32 src_addr,
     uint32 src_page_size,
+    uint32 src_bank_pages,
     uint32 src_page_id,
     uint32 src_offset,
     uint32 len_bytes);
@@ -89,6 +91,7 @@ API void noc_async_write_block_dram(
     uint32 src_addr,
     uint32 dst_addr,
     uint32 dst_page_size,
+    uint32 dst_bank_pages,
     uint32 dst_page_id,
     uint32 dst_offset,
     uint32 len_bytes);
@@ -100,3 +103,18 @@ API void noc_async_write_cyclic_dram(
     uint32 dst_offset,
     uint32 len_bytes);
 
+API void noc_async_read_2d(
+    uint64_t src_noc_addr,
+    uint32 dst_addr,
+    uint32 rows,
+    uint32 len_bytes,
+    uint32 src_stride,
+    uint32 dst_stride);
+API void noc_async_write_2d(
+    uint32 src_addr,
+    uint64_t dst_noc_addr,
+    uint32 rows,
+    uint32 len_bytes,
+    uint32 src_stride,
+    uint32 dst_stride);
+
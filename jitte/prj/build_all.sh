@@ -19,6 +19,11 @@ cd ./whisper
 ./build_all.sh
 cd ..
 
+echo "Build device test"
+cd ./device
+./build_test.sh
+cd ..
+
 echo "Build examples"
 cd ./examples
 ./build_all.sh
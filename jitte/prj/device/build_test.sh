@@ -0,0 +1,29 @@
+#!/bin/bash
+
+# SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+#
+# SPDX-License-Identifier: Apache-2.0
+
+CXX=/usr/lib/llvm-17/bin/clang++
+
+SRC=../../src
+LIB=../../lib
+BIN=../../bin
+
+mkdir -p $BIN/device
+
+$CXX -o $BIN/device/test_device -std=c++20 -stdlib=libstdc++ -O3 \
+    -I $SRC \
+    -I $SRC/device \
+    $SRC/device/test/*.cpp \
+    $LIB/device/api.a \
+    $LIB/device/dispatch.a \
+    $LIB/device/ref.a \
+    $LIB/device/riscv.a \
+    $LIB/device/core.a \
+    $LIB/device/arch.a \
+    $LIB/device/schedule.a \
+    $LIB/whisper/riscv.a \
+    $LIB/whisper/linker.a \
+    $LIB/whisper/interp.a
+
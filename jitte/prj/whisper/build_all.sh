@@ -7,5 +7,6 @@
 ./build_interp.sh
 ./build_linker.sh
 ./build_riscv.sh
+./build_bench.sh
 
 
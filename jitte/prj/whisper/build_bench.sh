@@ -0,0 +1,20 @@
+#!/bin/bash
+
+# SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+#
+# SPDX-License-Identifier: Apache-2.0
+
+CXX=/usr/lib/llvm-17/bin/clang++
+
+SRC=../../src
+LIB=../../lib
+BIN=../../bin
+
+mkdir -p $BIN/whisper
+
+$CXX -o $BIN/whisper/bench_riscv -std=c++20 -stdlib=libstdc++ -O3 \
+    -I $SRC/whisper \
+    $SRC/whisper/bench/*.cpp \
+    $LIB/whisper/riscv.a \
+    $LIB/whisper/interp.a
+
@@ -10,6 +10,8 @@ namespace tt {
 namespace metal {
 namespace device {
 
+struct CodeStats;
+
 class Device {
 public:
     Device() { }
@@ -55,6 +57,8 @@ public:
         uint32_t num_pages_read) = 0;
     virtual void run_commands(const uint8_t *cmd_reg, uint32_t cmd_seq_size) = 0;
     virtual void launch_kernels() = 0;
+    // kernel binary residency counters (see 'core/machine.hpp')
+    virtual void get_code_stats(CodeStats &stats) = 0;
 };
 
 } // namespace device
@@ -56,7 +56,7 @@ DeviceImpl::DeviceImpl(Arch arch):
     }
     m_machine.reset(machine_builder->create_machine(soc_arch, noc_arch, mem_map));
     m_soc = m_machine->soc();
-    m_dispatch.reset(new dispatch::Dispatch(m_soc, noc_arch)),
+    m_dispatch.reset(new dispatch::Dispatch(m_machine.get(), noc_arch)),
     m_prefetch.reset(new dispatch::Prefetch(m_soc, noc_arch, m_dispatch.get()));
 }
 
@@ -172,6 +172,10 @@ void DeviceImpl::launch_kernels() {
     m_machine->launch_kernels();
 }
 
+void DeviceImpl::get_code_stats(CodeStats &stats) {
+    m_machine->get_code_stats(stats);
+}
+
 void DeviceImpl::write_dram(
         const void *data,
         uint32_t size,
@@ -200,7 +204,12 @@ void DeviceImpl::write_worker(
     uint32_t addr32 = uint32_t(addr);
     assert(uint64_t(addr32) == addr);
     uint8_t *ptr = m_soc->map_l1_addr(x, y, addr32);
-    memcpy(ptr, data, size);
+    if (m_machine->is_code_range(addr32, size)) {
+        const uint8_t *src = static_cast<const uint8_t *>(data);
+        m_machine->write_code(int(x), int(y), addr32, src, size, code_hash(src, size));
+    } else {
+        memcpy(ptr, data, size);
+    }
     WorkerCoreType worker_core_type = m_soc->worker_core_type(x, y);
 #if 0 // TODO: Implement new dispatch
     // special support for dispatch cores
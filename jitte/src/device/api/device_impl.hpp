@@ -59,6 +59,7 @@ public:
         uint32_t num_pages_read) override;
     void run_commands(const uint8_t *cmd_reg, uint32_t cmd_seq_size) override;
     void launch_kernels() override;
+    void get_code_stats(CodeStats &stats) override;
 private:
     void write_dram(
         const void *data,
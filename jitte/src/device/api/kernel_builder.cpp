@@ -114,6 +114,8 @@ void KernelLinker::add_builtins() {
         uint32_t id = uint32_t(entry.first);
         m_linker->add_builtin(name, BUILTIN_MASK | id);
     }
+    // direct builtin calls are bound at decode time, see Riscv32Core
+    m_linker->set_builtin_id_mask(BUILTIN_MASK - 1);
 }
 
 //
@@ -50,6 +50,10 @@ public:
     void set_worker_core_type(WorkerCoreType worker_core_type, int x, int y0, int y1); 
     void set_dram_preferred_worker_endpoint(int dram_channel, int x, int y);
     void finalize();
+    // smaller simulated DRAM banks, e.g. for tests on hosts with little memory
+    void set_dram_bank_size(uint32_t dram_bank_size) {
+        m_dram_bank_size = dram_bank_size;
+    }
 public:
     int x_size() const {
         return m_x_size;
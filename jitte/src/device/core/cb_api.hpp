@@ -45,6 +45,9 @@ public:
     virtual DataFormat get_pack_src_format(uint32_t cb) = 0;
     virtual DataFormat get_pack_dst_format(uint32_t cb) = 0;
     virtual uint32_t get_tile_size(uint32_t cb) = 0;
+    // changes whenever pages visible at read side may change
+    //     (setup, pop, explicit pointer update)
+    virtual uint32_t get_read_version(uint32_t cb) = 0;
 public:
     static constexpr uint32_t NUM_CIRCULAR_BUFFERS = 32;
 };
@@ -66,6 +66,7 @@ void CBImpl::setup_read_write_interfaces(
     m_cb_interface[cb_id].tiles_acked = 0;
     m_cb_interface[cb_id].tiles_received = 0;
     m_cb_interface[cb_id].fifo_wr_tile_ptr = 0;
+    m_read_version[cb_id]++;
 }
 
 void CBImpl::setup_data_formats(
@@ -80,6 +81,7 @@ void CBImpl::setup_data_formats(
     m_pack_dst_format[cb_id] = pack_dst_format;
     // use unpack_src_format, but because unpack_src_format == pack_dst_format, we can use either
     m_tile_size[cb_id] = get_l1_tile_size(unpack_src_format);
+    m_read_version[cb_id]++;
 }
 
 void CBImpl::cb_push_back(uint32_t cb_id, uint32_t num_pages) {
@@ -107,6 +109,7 @@ void CBImpl::cb_pop_front(uint32_t cb_id, uint32_t num_pages) {
 
     uint32_t *tiles_acked_ptr = get_cb_tiles_acked_ptr(cb_id);
     tiles_acked_ptr[0] += num_pages;
+    m_read_version[cb_id]++;
 
     uint32_t num_words = num_pages * cb.fifo_page_size;
 
@@ -134,11 +137,14 @@ uint32_t CBImpl::get_read_ptr(uint32_t cb_id) {
 void CBImpl::set_write_ptr(uint32_t cb_id, uint32_t ptr) {
     // convert byte address (fifo_wr_ptr is 16B address)
     m_cb_interface[cb_id].fifo_wr_ptr = ptr >> 4;
+    // may be used to write into pages at read side
+    m_read_version[cb_id]++;
 }
 
 void CBImpl::set_read_ptr(uint32_t cb_id, uint32_t ptr) {
     // convert byte address (fifo_rd_ptr is 16B address)
     m_cb_interface[cb_id].fifo_rd_ptr = ptr >> 4;
+    m_read_version[cb_id]++;
 }
 
 void CBImpl::cb_reserve_back(uint32_t cb_id, uint32_t num_pages) {
@@ -207,6 +213,10 @@ uint32_t CBImpl::get_tile_size(uint32_t cb) {
     return num_words << 4;
 }
 
+uint32_t CBImpl::get_read_version(uint32_t cb) {
+    return m_read_version[cb];
+}
+
 void CBImpl::reset_read_write_interfaces() {
     for (uint32_t cb_id = 0; cb_id < NUM_CIRCULAR_BUFFERS; cb_id++) {
         m_cb_interface[cb_id].fifo_size = 0;
@@ -218,6 +228,7 @@ void CBImpl::reset_read_write_interfaces() {
         m_cb_interface[cb_id].tiles_acked = 0;
         m_cb_interface[cb_id].tiles_received = 0;
         m_cb_interface[cb_id].fifo_wr_tile_ptr = 0;
+        m_read_version[cb_id] = 0;
     }
 }
 
@@ -59,6 +59,7 @@ public:
     DataFormat get_pack_src_format(uint32_t cb) override;
     DataFormat get_pack_dst_format(uint32_t cb) override;
     uint32_t get_tile_size(uint32_t cb) override;
+    uint32_t get_read_version(uint32_t cb) override;
 private:
     void reset_read_write_interfaces();
     void reset_data_formats();
@@ -76,6 +77,7 @@ private:
     DataFormat m_pack_src_format[NUM_CIRCULAR_BUFFERS];
     DataFormat m_pack_dst_format[NUM_CIRCULAR_BUFFERS];
     uint32_t m_tile_size[NUM_CIRCULAR_BUFFERS];
+    uint32_t m_read_version[NUM_CIRCULAR_BUFFERS];
 };
 
 } // namespace device
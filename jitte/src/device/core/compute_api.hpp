@@ -457,6 +457,7 @@ public:
     virtual void tanto_sub_bcast_scalar_init() = 0;
     virtual void tanto_mul_bcast_scalar_init() = 0;
     virtual void tanto_matmul_init(bool transpose) = 0;
+    virtual void tanto_matmul_block_init(bool transpose, uint32_t ct_dim) = 0;
     virtual void tanto_reduce_max_rows_init() = 0;
     virtual void tanto_reduce_max_cols_init() = 0;
     virtual void tanto_reduce_max_scalar_init() = 0;
@@ -529,6 +530,11 @@ public:
     virtual void tanto_unpack_bcast_cols_init(uint32_t icb0, uint32_t icb1) = 0;
     virtual void tanto_unpack_bcast_scalar_init(uint32_t icb0, uint32_t icb1) = 0;
     virtual void tanto_unpack_matmul_init(uint32_t icb0, uint32_t icb1, bool transpose) = 0;
+    virtual void tanto_unpack_matmul_block_init(
+        uint32_t icb0, 
+        uint32_t icb1, 
+        bool transpose, 
+        uint32_t ct_dim) = 0;
     virtual void tanto_unpack_unary_init(uint32_t icb) = 0;
     virtual void tanto_unpack_reduce_rows_init(uint32_t icb0, uint32_t icb1) = 0;
     virtual void tanto_unpack_reduce_cols_init(uint32_t icb0, uint32_t icb1) = 0;
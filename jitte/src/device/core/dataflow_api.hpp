@@ -218,6 +218,50 @@ public:
         uint32_t dst_log2_page_size,
         uint32_t dst_offset,
         uint32_t len_bytes) = 0;
+    virtual void noc_async_read_block_dram(
+        uint32_t dst_addr,
+        uint32_t src_addr,
+        uint32_t src_page_size,
+        uint32_t src_bank_pages,
+        uint32_t src_page_id,
+        uint32_t src_offset,
+        uint32_t len_bytes) = 0;
+    virtual void noc_async_write_block_dram(
+        uint32_t src_addr,
+        uint32_t dst_addr,
+        uint32_t dst_page_size,
+        uint32_t dst_bank_pages,
+        uint32_t dst_page_id,
+        uint32_t dst_offset,
+        uint32_t len_bytes) = 0;
+    virtual void noc_async_read_cyclic_dram(
+        uint32_t dst_addr,
+        uint32_t src_addr,
+        uint32_t src_page_size,
+        uint32_t src_page_id,
+        uint32_t src_offset,
+        uint32_t len_bytes) = 0;
+    virtual void noc_async_write_cyclic_dram(
+        uint32_t src_addr,
+        uint32_t dst_addr,
+        uint32_t dst_page_size,
+        uint32_t dst_page_id,
+        uint32_t dst_offset,
+        uint32_t len_bytes) = 0;
+    virtual void noc_async_read_2d(
+        uint64_t src_noc_addr,
+        uint32_t dst_addr,
+        uint32_t rows,
+        uint32_t len_bytes,
+        uint32_t src_stride,
+        uint32_t dst_stride) = 0;
+    virtual void noc_async_write_2d(
+        uint32_t src_addr,
+        uint64_t dst_noc_addr,
+        uint32_t rows,
+        uint32_t len_bytes,
+        uint32_t src_stride,
+        uint32_t dst_stride) = 0;
 };
 
 } // namespace device
@@ -891,6 +891,109 @@ void DataflowImpl::noc_async_write_global_l1(
     }
 }
 
+void DataflowImpl::noc_async_read_block_dram(
+        uint32_t dst_addr,
+        uint32_t src_addr,
+        uint32_t src_page_size,
+        uint32_t src_bank_pages,
+        uint32_t src_page_id,
+        uint32_t src_offset,
+        uint32_t len_bytes) {
+    uint64_t src_noc_addr =
+        get_noc_addr_block_dram(
+            src_addr,
+            src_page_id,
+            src_page_size,
+            src_bank_pages,
+            src_offset);
+    noc_fast_read_global(dst_addr, src_noc_addr, len_bytes);
+}
+
+void DataflowImpl::noc_async_write_block_dram(
+        uint32_t src_addr,
+        uint32_t dst_addr,
+        uint32_t dst_page_size,
+        uint32_t dst_bank_pages,
+        uint32_t dst_page_id,
+        uint32_t dst_offset,
+        uint32_t len_bytes) {
+    uint64_t dst_noc_addr =
+        get_noc_addr_block_dram(
+            dst_addr,
+            dst_page_id,
+            dst_page_size,
+            dst_bank_pages,
+            dst_offset);
+    noc_fast_write_global(src_addr, dst_noc_addr, len_bytes);
+}
+
+void DataflowImpl::noc_async_read_cyclic_dram(
+        uint32_t dst_addr,
+        uint32_t src_addr,
+        uint32_t src_page_size,
+        uint32_t src_page_id,
+        uint32_t src_offset,
+        uint32_t len_bytes) {
+    uint64_t src_noc_addr =
+        get_noc_addr_cyclic_dram(src_addr, src_page_id, src_page_size, src_offset);
+    noc_fast_read_global(dst_addr, src_noc_addr, len_bytes);
+}
+
+void DataflowImpl::noc_async_write_cyclic_dram(
+        uint32_t src_addr,
+        uint32_t dst_addr,
+        uint32_t dst_page_size,
+        uint32_t dst_page_id,
+        uint32_t dst_offset,
+        uint32_t len_bytes) {
+    uint64_t dst_noc_addr =
+        get_noc_addr_cyclic_dram(dst_addr, dst_page_id, dst_page_size, dst_offset);
+    noc_fast_write_global(src_addr, dst_noc_addr, len_bytes);
+}
+
+void DataflowImpl::noc_async_read_2d(
+        uint64_t src_noc_addr,
+        uint32_t dst_addr,
+        uint32_t rows,
+        uint32_t len_bytes,
+        uint32_t src_stride,
+        uint32_t dst_stride) {
+    // equivalent of one set_state followed by "rows" with_state reads
+    // but executed as a single bulk copy
+    m_noc->wait_fast_read_ok(m_noc_index, Noc::RD_CMD_BUF);
+    m_noc->read_2d(
+        m_noc_index, 
+        src_noc_addr, 
+        dst_addr, 
+        rows, 
+        len_bytes, 
+        src_stride, 
+        dst_stride);
+    m_noc->incr_reads_num_issued(m_noc_index, rows);
+}
+
+void DataflowImpl::noc_async_write_2d(
+        uint32_t src_addr,
+        uint64_t dst_noc_addr,
+        uint32_t rows,
+        uint32_t len_bytes,
+        uint32_t src_stride,
+        uint32_t dst_stride) {
+    // equivalent of one set_state followed by "rows" with_state writes
+    // but executed as a single bulk copy
+    m_noc->wait_fast_write_ok(m_noc_index, Noc::WR_REG_CMD_BUF);
+    m_noc->write_2d(
+        m_noc_index, 
+        src_addr, 
+        dst_noc_addr, 
+        rows, 
+        len_bytes, 
+        src_stride, 
+        dst_stride);
+    m_noc->incr_nonposted_writes_num_issued(m_noc_index, rows);
+    m_noc->incr_nonposted_writes_acked(m_noc_index, rows);
+}
+
 uint64_t DataflowImpl::get_noc_addr_global_dram(
         uint32_t base_addr, 
         uint32_t log2_page_size, 
@@ -917,6 +1020,31 @@ uint64_t DataflowImpl::get_noc_addr_global_l1(
     return get_noc_addr_helper(noc_xy, addr);
 }
 
+uint64_t DataflowImpl::get_noc_addr_block_dram(
+        uint32_t base_addr,
+        uint32_t page_id,
+        uint32_t page_size,
+        uint32_t bank_pages,
+        uint32_t offset) {
+    uint32_t bank_id = page_id / bank_pages;
+    uint32_t addr = (page_id % bank_pages) * page_size + base_addr + offset;
+    addr += m_noc_arch->bank_to_dram_offset(bank_id);
+    uint32_t noc_xy = m_noc_arch->dram_bank_to_noc_xy(m_noc_index, bank_id);
+    return get_noc_addr_helper(noc_xy, addr);
+}
+
+uint64_t DataflowImpl::get_noc_addr_cyclic_dram(
+        uint32_t base_addr,
+        uint32_t page_id,
+        uint32_t page_size,
+        uint32_t offset) {
+    uint32_t bank_id = page_id % m_num_dram_banks;
+    uint32_t addr = (page_id / m_num_dram_banks) * page_size + base_addr + offset;
+    addr += m_noc_arch->bank_to_dram_offset(bank_id);
+    uint32_t noc_xy = m_noc_arch->dram_bank_to_noc_xy(m_noc_index, bank_id);
+    return get_noc_addr_helper(noc_xy, addr);
+}
+
 void DataflowImpl::noc_fast_read_global(
         uint32_t dst_addr, 
         uint64_t src_addr, 
@@ -2,6 +2,9 @@
 //
 // SPDX-License-Identifier: Apache-2.0
 
+#include <cstdint>
+#include <cstring>
+
 #include "core/machine.hpp"
 
 namespace tt {
@@ -26,6 +29,22 @@ MachineBuilder *get_machine_builder() {
     return g_machine_builder;
 }
 
+uint64_t code_hash(const uint8_t *data, uint32_t size) {
+    // 64-bit FNV-1a over 8-byte words, tail bytes folded in one by one
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    uint64_t prime = 0x100000001b3ULL;
+    uint32_t pos = 0;
+    for ( ; pos + 8 <= size; pos += 8) {
+        uint64_t word;
+        memcpy(&word, data + pos, 8);
+        hash = (hash ^ word) * prime;
+    }
+    for ( ; pos < size; pos++) {
+        hash = (hash ^ data[pos]) * prime;
+    }
+    return hash;
+}
+
 } // namespace device
 } // namespace metal
 } // namespace tt
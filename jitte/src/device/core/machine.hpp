@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <cstdint>
+
 #include "arch/soc_arch.hpp"
 #include "arch/noc_arch.hpp"
 #include "arch/mem_map.hpp"
@@ -17,6 +19,17 @@ namespace tt {
 namespace metal {
 namespace device {
 
+//
+//    CodeStats
+//
+
+struct CodeStats {
+    uint64_t write_count = 0;   // binary writes that updated code regions
+    uint64_t write_bytes = 0;
+    uint64_t skip_count = 0;    // binary writes skipped as already resident
+    uint64_t skip_bytes = 0;
+};
+
 //
 //    Machine
 //
@@ -32,6 +45,17 @@ public:
     virtual Memory *get_worker_l1() = 0;
     virtual void launch_kernels() = 0;
     virtual void stop() = 0;
+    // kernel binary residency: writes to hart code regions
+    //     with content already resident are skipped
+    virtual bool is_code_range(uint32_t addr, uint32_t size) = 0;
+    virtual void write_code(
+        int x, 
+        int y, 
+        uint32_t addr, 
+        const uint8_t *data, 
+        uint32_t size, 
+        uint64_t hash) = 0;
+    virtual void get_code_stats(CodeStats &stats) = 0;
 };
 
 //
@@ -55,6 +79,7 @@ public:
 
 void set_machine_builder(MachineBuilder *machine_builder);
 MachineBuilder *get_machine_builder();
+uint64_t code_hash(const uint8_t *data, uint32_t size);
 
 } // namespace device
 } // namespace metal
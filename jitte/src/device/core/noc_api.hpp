@@ -101,6 +101,22 @@ public:
         bool src,
         bool non_posted) = 0;
     virtual void write_cmd_ctrl_send_req(uint32_t noc, uint32_t buf) = 0;
+    virtual void read_2d(
+        uint32_t noc,
+        uint64_t src_addr,
+        uint32_t dest_addr,
+        uint32_t rows,
+        uint32_t len_bytes,
+        uint32_t src_stride,
+        uint32_t dest_stride) = 0;
+    virtual void write_2d(
+        uint32_t noc,
+        uint32_t src_addr,
+        uint64_t dest_addr,
+        uint32_t rows,
+        uint32_t len_bytes,
+        uint32_t src_stride,
+        uint32_t dest_stride) = 0;
     virtual void incr_reads_num_issued(uint32_t noc, uint32_t incr) = 0;
     virtual void incr_nonposted_writes_num_issued(uint32_t noc, uint32_t incr) = 0;
     virtual void incr_nonposted_writes_acked(uint32_t noc, uint32_t incr) = 0;
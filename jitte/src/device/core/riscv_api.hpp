@@ -26,6 +26,7 @@ public:
     virtual uint32_t code_base() = 0;
     virtual uint32_t code_size() = 0;
     virtual void write_code(const std::vector<uint8_t> &code) = 0; 
+    virtual void invalidate_code() = 0;
     virtual void run(uint32_t start_pc) = 0;
 };
 
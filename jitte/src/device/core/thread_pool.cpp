@@ -0,0 +1,161 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdint>
+#include <cstdlib>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <vector>
+#include <memory>
+#include <functional>
+#include <exception>
+
+#include "core/thread_pool.hpp"
+
+namespace tt {
+namespace metal {
+namespace device {
+
+namespace {
+
+std::once_flag g_host_thread_pool_flag;
+std::unique_ptr<ThreadPool> g_host_thread_pool;
+
+void init_host_thread_pool() {
+    unsigned hw_count = std::thread::hardware_concurrency();
+    int thread_count = (hw_count > 0) ? int(hw_count) : 1;
+    const char *threads = std::getenv("JITTE_HOST_THREADS");
+    if (threads != nullptr) {
+        int count = atoi(threads);
+        if (count > 0) {
+            thread_count = count;
+        }
+    }
+    g_host_thread_pool.reset(new ThreadPool(thread_count));
+}
+
+} // namespace
+
+//
+//    ThreadPool
+//
+
+ThreadPool::ThreadPool(int thread_count):
+        m_body(nullptr),
+        m_count(0),
+        m_next(0),
+        m_busy(0),
+        m_generation(0),
+        m_stop(false) {
+    for (int i = 1; i < thread_count; i++) {
+        m_threads.emplace_back([this]() {
+            worker_main();
+        });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_start_cv.notify_all();
+    for (std::thread &thread: m_threads) {
+        thread.join();
+    }
+}
+
+void ThreadPool::parallel_for(int count, const std::function<void (int index)> &body) {
+    if (m_threads.empty() || count <= 1) {
+        for (int index = 0; index < count; index++) {
+            body(index);
+        }
+        return;
+    }
+    std::lock_guard<std::mutex> call_lock(m_call_mutex);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_body = &body;
+        m_count = count;
+        m_next = 0;
+        m_busy = int(m_threads.size());
+        m_error = nullptr;
+        m_generation++;
+    }
+    m_start_cv.notify_all();
+    run_tasks();
+    std::exception_ptr error;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_done_cv.wait(lock, [this]() -> bool {
+            return (m_busy == 0);
+        });
+        m_body = nullptr;
+        error = m_error;
+        m_error = nullptr;
+    }
+    if (error != nullptr) {
+        std::rethrow_exception(error);
+    }
+}
+
+void ThreadPool::worker_main() {
+    uint64_t generation = 0;
+    for ( ; ; ) {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_start_cv.wait(lock, [&]() -> bool {
+                return (m_stop || m_generation != generation);
+            });
+            if (m_stop) {
+                break;
+            }
+            generation = m_generation;
+        }
+        run_tasks();
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_busy--;
+            if (m_busy == 0) {
+                m_done_cv.notify_one();
+            }
+        }
+    }
+}
+
+void ThreadPool::run_tasks() {
+    // dynamic scheduling: tasks may vary in cost
+    for ( ; ; ) {
+        int index = m_next.fetch_add(1);
+        if (index >= m_count) {
+            break;
+        }
+        try {
+            (*m_body)(index);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_error == nullptr) {
+                m_error = std::current_exception();
+            }
+            // skip remaining tasks
+            m_next = m_count;
+        }
+    }
+}
+
+//
+//    Global functions
+//
+
+ThreadPool *get_host_thread_pool() {
+    std::call_once(g_host_thread_pool_flag, init_host_thread_pool);
+    return g_host_thread_pool.get();
+}
+
+} // namespace device
+} // namespace metal
+} // namespace tt
+
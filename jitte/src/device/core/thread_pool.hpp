@@ -0,0 +1,65 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <vector>
+#include <functional>
+#include <exception>
+
+namespace tt {
+namespace metal {
+namespace device {
+
+//
+//    ThreadPool
+//
+//    Persistent host worker threads for independent per-core work
+//    (kernel launch setup, dispatch writes). Calling thread takes part
+//    in each job; exception thrown by any task is rethrown to caller.
+//
+
+class ThreadPool {
+public:
+    ThreadPool(int thread_count);
+    ~ThreadPool();
+public:
+    int thread_count() {
+        return int(m_threads.size()) + 1;
+    }
+    void parallel_for(int count, const std::function<void (int index)> &body);
+private:
+    void worker_main();
+    void run_tasks();
+private:
+    std::vector<std::thread> m_threads;
+    std::mutex m_call_mutex;
+    std::mutex m_mutex;
+    std::condition_variable m_start_cv;
+    std::condition_variable m_done_cv;
+    const std::function<void (int index)> *m_body;
+    int m_count;
+    std::atomic<int> m_next;
+    int m_busy;
+    uint64_t m_generation;
+    bool m_stop;
+    std::exception_ptr m_error;
+};
+
+//
+//    Global functions
+//
+
+// thread count: JITTE_HOST_THREADS or hardware concurrency
+ThreadPool *get_host_thread_pool();
+
+} // namespace device
+} // namespace metal
+} // namespace tt
+
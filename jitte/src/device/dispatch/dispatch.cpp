@@ -14,6 +14,8 @@
 #include "arch/noc_arch.hpp"
 
 #include "core/soc.hpp"
+#include "core/machine.hpp"
+#include "core/thread_pool.hpp"
 
 #include "dispatch/noc.hpp"
 #include "dispatch/dispatch.hpp"
@@ -30,6 +32,9 @@ constexpr bool DIAG = false;
 
 constexpr uint32_t L1_ALIGNMENT = 16;
 
+// smaller writes are not worth waking host threads
+constexpr uint64_t PARALLEL_MIN_BYTES = 64 * 1024;
+
 uint32_t round_up_pow2(uint32_t v, uint32_t pow2_size) {
     return (v + (pow2_size - 1)) & ~(pow2_size - 1);
 }
@@ -45,9 +50,9 @@ uint32_t align(uint32_t addr, uint32_t alignment) {
 //    Dispatch
 //
 
-Dispatch::Dispatch(Soc *soc, NocArch *noc_arch):
-        m_soc(soc),
-        m_noc(soc, noc_arch),
+Dispatch::Dispatch(Machine *machine, NocArch *noc_arch):
+        m_soc(machine->soc()),
+        m_noc(m_soc, noc_arch, machine),
         m_max_write_packed_cores(108),
         m_cmd_reg(nullptr),
         m_cmd_reg_end(nullptr),
@@ -228,21 +233,26 @@ void Dispatch::process_write_paged(bool is_dram) {
 
     check_cmd_reg_limit(sizeof(CQDispatchCmd) + write_length);
 
-    while (write_length != 0) {
+    // pages go to distinct bank locations and can be written in any order
+    auto write_page = [&](int index) {
         uint64_t dst = 
             m_noc.get_noc_addr_interleaved(
                 is_dram, 
                 base_addr, 
                 page_size, 
-                page_id, 
+                page_id + uint32_t(index), 
                 0);
-        m_noc.write(data_ptr, dst, page_size);
-        page_id++;
-        write_length -= page_size;
-        data_ptr += page_size;
+        m_noc.write(data_ptr + index * page_size, dst, page_size);
+    };
+    if (pages > 1 && write_length >= PARALLEL_MIN_BYTES) {
+        get_host_thread_pool()->parallel_for(int(pages), write_page);
+    } else {
+        for (uint32_t index = 0; index < pages; index++) {
+            write_page(int(index));
+        }
     }
 
-    m_cmd_ptr = data_ptr;
+    m_cmd_ptr = data_ptr + write_length;
 }
 
 //
@@ -292,33 +302,34 @@ void Dispatch::process_write_packed(bool mcast, uint32_t flags) {
     check_cmd_reg_limit(data_start + stride * (count - 1) + padded_xfer_size);
 
     const uint8_t *sub_cmd_ptr = m_cmd_ptr + sizeof(CQDispatchCmd);
-    while (count != 0) {
-        uint32_t dst_noc = 0;
-        uint32_t num_dests = 0;
-        if (mcast) {
+    if (mcast) {
+        // each multicast fans out in parallel inside Noc
+        for (uint32_t i = 0; i < count; i++) {
             const CQDispatchWritePackedMulticastSubCmd *sub_cmd =
-                reinterpret_cast<const CQDispatchWritePackedMulticastSubCmd *>(sub_cmd_ptr);
-            dst_noc = sub_cmd->noc_xy_addr;
-            num_dests = sub_cmd->num_mcast_dests;
-        } else {
-            const CQDispatchWritePackedUnicastSubCmd *sub_cmd =
-                reinterpret_cast<const CQDispatchWritePackedUnicastSubCmd *>(sub_cmd_ptr);
-            dst_noc = sub_cmd->noc_xy_addr;
-            num_dests = 1;
+                reinterpret_cast<const CQDispatchWritePackedMulticastSubCmd *>(
+                    sub_cmd_ptr + i * sub_cmd_size);
+            uint64_t dst = m_noc.get_noc_addr_helper(sub_cmd->noc_xy_addr, dst_addr);
+            m_noc.write_multicast(data_ptr + i * stride, dst, xfer_size, sub_cmd->num_mcast_dests);
         }
-        sub_cmd_ptr += sub_cmd_size;
-        uint64_t dst = m_noc.get_noc_addr_helper(dst_noc, dst_addr);
-
-        if (mcast) {
-            m_noc.write_multicast(data_ptr, dst, xfer_size, num_dests);
+    } else {
+        // unicast sub-commands address distinct cores
+        auto write_core = [&](int index) {
+            const CQDispatchWritePackedUnicastSubCmd *sub_cmd =
+                reinterpret_cast<const CQDispatchWritePackedUnicastSubCmd *>(
+                    sub_cmd_ptr + index * sub_cmd_size);
+            uint64_t dst = m_noc.get_noc_addr_helper(sub_cmd->noc_xy_addr, dst_addr);
+            m_noc.write(data_ptr + index * stride, dst, xfer_size);
+        };
+        if (count > 1 && uint64_t(count) * xfer_size >= PARALLEL_MIN_BYTES) {
+            get_host_thread_pool()->parallel_for(int(count), write_core);
         } else {
-            m_noc.write(data_ptr, dst, xfer_size);
+            for (uint32_t index = 0; index < count; index++) {
+                write_core(int(index));
+            }
         }
-
-        count--;
-        data_ptr += stride;
     }
 
+    data_ptr += stride * count;
     if (stride == 0) {
         data_ptr += padded_xfer_size;
     }
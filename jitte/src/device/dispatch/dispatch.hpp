@@ -10,6 +10,7 @@
 #include "arch/noc_arch.hpp"
 
 #include "core/soc.hpp"
+#include "core/machine.hpp"
 
 #include "dispatch/noc.hpp"
 
@@ -20,7 +21,7 @@ namespace dispatch {
 
 class Dispatch {
 public:
-    Dispatch(Soc *soc, NocArch *noc_arch);
+    Dispatch(Machine *machine, NocArch *noc_arch);
     ~Dispatch();
 public:
     void configure_read_buffer(
@@ -5,12 +5,16 @@
 #include <cstdint>
 #include <cstring>
 #include <string>
+#include <vector>
+#include <utility>
 #include <cassert>
 #include <stdexcept>
 
 #include "arch/noc_arch.hpp"
 
 #include "core/soc.hpp"
+#include "core/machine.hpp"
+#include "core/thread_pool.hpp"
 
 #include "dispatch/noc.hpp"
 
@@ -21,6 +25,9 @@ namespace dispatch {
 
 namespace {
 
+// smaller multicasts are not worth waking host threads
+constexpr uint64_t PARALLEL_MIN_BYTES = 64 * 1024;
+
 uint32_t align(uint32_t addr, uint32_t alignment) { 
     return ((addr - 1) | (alignment - 1)) + 1; 
 }
@@ -40,9 +47,10 @@ std::string xy_to_string(uint32_t x, uint32_t y) {
 //    Noc
 //
 
-Noc::Noc(Soc *soc, NocArch *noc_arch):
+Noc::Noc(Soc *soc, NocArch *noc_arch, Machine *machine):
         m_soc(soc),
         m_noc_arch(noc_arch),
+        m_machine(machine),
         m_num_dram_banks(m_noc_arch->num_dram_banks()),
         m_num_l1_banks(m_noc_arch->num_l1_banks()) { }
 
@@ -92,7 +100,15 @@ void Noc::write(
         const uint8_t *src, 
         uint64_t dst_noc_addr, 
         uint32_t size) {
-    uint8_t *dst = map_remote_addr(dst_noc_addr, size);
+    uint32_t x = 0;
+    uint32_t y = 0;
+    uint32_t addr = 0;
+    m_noc_arch->parse_noc_addr(dst_noc_addr, x, y, addr);
+    if (is_code_write(x, y, addr, size)) {
+        m_machine->write_code(int(x), int(y), addr, src, size, code_hash(src, size));
+        return;
+    }
+    uint8_t *dst = map_remote_addr(x, y, addr, size);
     data_copy(dst, src, size);
 }
 
@@ -123,15 +139,50 @@ void Noc::write_multicast(
         y_start = y_end;
         y_end = temp;
     }
+    std::vector<std::pair<uint32_t, uint32_t>> dests;
     for (uint32_t x = x_start; x <= x_end; x++) {
         for (uint32_t y = y_start; y <= y_end; y++) {
-            if (m_soc->core_type(int(x), int(y)) != CoreType::WORKER) {
-                continue;
+            if (m_soc->core_type(int(x), int(y)) == CoreType::WORKER) {
+                dests.emplace_back(x, y);
             }
+        }
+    }
+    if (dests.empty()) {
+        return;
+    }
+    // same range at every destination: binary is hashed once for all of them
+    bool code = is_code_write(dests[0].first, dests[0].second, addr, size);
+    uint64_t hash = code ? code_hash(src, size) : 0;
+    // one source fanned out to all destinations
+    auto write_dest = [&](int index) {
+        uint32_t x = dests[index].first;
+        uint32_t y = dests[index].second;
+        if (code) {
+            m_machine->write_code(int(x), int(y), addr, src, size, hash);
+        } else {
             uint8_t *dst = map_remote_addr(x, y, addr, size);
             data_copy(dst, src, size);
         }
+    };
+    int count = int(dests.size());
+    if (uint64_t(count) * size >= PARALLEL_MIN_BYTES) {
+        get_host_thread_pool()->parallel_for(count, write_dest);
+    } else {
+        for (int index = 0; index < count; index++) {
+            write_dest(index);
+        }
+    }
+}
+
+bool Noc::is_code_write(uint32_t x, uint32_t y, uint32_t addr, uint32_t size) {
+    if (m_machine == nullptr) {
+        return false;
+    }
+    if (m_soc->core_type(int(x), int(y)) != CoreType::WORKER) {
+        return false;
     }
+    assert(addr + size <= m_soc->worker_l1_size());
+    return m_machine->is_code_range(addr, size);
 }
 
 uint8_t *Noc::map_remote_addr(uint64_t noc_addr, uint32_t size) {
@@ -9,6 +9,7 @@
 #include "arch/noc_arch.hpp"
 
 #include "core/soc.hpp"
+#include "core/machine.hpp"
 
 namespace tt {
 namespace metal {
@@ -17,7 +18,7 @@ namespace dispatch {
 
 class Noc {
 public:
-    Noc(Soc *soc, NocArch *noc_arch);
+    Noc(Soc *soc, NocArch *noc_arch, Machine *machine);
     ~Noc();
 public:
     uint64_t get_noc_addr_interleaved(
@@ -47,9 +48,11 @@ private:
         uint32_t y, 
         uint32_t addr, 
         uint32_t size);
+    bool is_code_write(uint32_t x, uint32_t y, uint32_t addr, uint32_t size);
 private:
     Soc *m_soc;
     NocArch *m_noc_arch;
+    Machine *m_machine;
     uint32_t m_num_dram_banks;
     uint32_t m_num_l1_banks;
 };
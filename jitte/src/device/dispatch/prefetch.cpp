@@ -43,7 +43,7 @@ Prefetch::Prefetch(
         NocArch *noc_arch, 
         Dispatch *dispatch):
             m_soc(soc),
-            m_noc(soc, noc_arch),
+            m_noc(soc, noc_arch, nullptr),
             m_dispatch(dispatch),
             m_cmd_reg(nullptr),
             m_cmd_reg_end(nullptr),
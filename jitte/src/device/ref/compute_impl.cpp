@@ -372,8 +372,7 @@ void ComputeImpl::matmul_tiles(
         uint32_t itile1, 
         uint32_t idst, 
         uint32_t transpose) {
-    m_llk.unpack_AB_matmul(c_in0, c_in1, itile0, itile1);
-    m_llk.math_matmul(idst, bool(transpose)); 
+    m_llk.matmul_tiles(c_in0, c_in1, itile0, itile1, idst, bool(transpose));
 }
 
 void ComputeImpl::mm_init_short(
@@ -417,8 +416,7 @@ void ComputeImpl::matmul_block(
             uint32_t cm_itile0 = in0_tile_index + rt * kt_dim;
             uint32_t cm_itile1 = in1_tile_index + ct;
             uint32_t cm_idst = idst + rt * ct_dim + ct;
-            m_llk.unpack_AB_matmul(in0_cb_id, in1_cb_id, cm_itile0, cm_itile1);
-            m_llk.math_matmul(cm_idst, transpose); 
+            m_llk.matmul_tiles(in0_cb_id, in1_cb_id, cm_itile0, cm_itile1, cm_idst, bool(transpose));
         }
     }
 }
@@ -1225,6 +1223,10 @@ void ComputeImpl::tanto_matmul_init(bool transpose) {
     // nothing to do
 }
 
+void ComputeImpl::tanto_matmul_block_init(bool transpose, uint32_t ct_dim) {
+    // nothing to do
+}
+
 void ComputeImpl::tanto_reduce_max_rows_init() {
     // nothing to do
 }
@@ -1511,6 +1513,14 @@ void ComputeImpl::tanto_unpack_matmul_init(uint32_t icb0, uint32_t icb1, bool tr
     // nothing to do
 }
 
+void ComputeImpl::tanto_unpack_matmul_block_init(
+        uint32_t icb0, 
+        uint32_t icb1, 
+        bool transpose, 
+        uint32_t ct_dim) {
+    // nothing to do
+}
+
 void ComputeImpl::tanto_unpack_unary_init(uint32_t icb) {
     // nothing to do
 }
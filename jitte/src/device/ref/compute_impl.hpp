@@ -461,6 +461,7 @@ public:
     void tanto_sub_bcast_scalar_init() override;
     void tanto_mul_bcast_scalar_init() override;
     void tanto_matmul_init(bool transpose) override;
+    void tanto_matmul_block_init(bool transpose, uint32_t ct_dim) override;
     void tanto_reduce_max_rows_init() override;
     void tanto_reduce_max_cols_init() override;
     void tanto_reduce_max_scalar_init() override;
@@ -533,6 +534,11 @@ public:
     void tanto_unpack_bcast_cols_init(uint32_t icb0, uint32_t icb1) override;
     void tanto_unpack_bcast_scalar_init(uint32_t icb0, uint32_t icb1) override;
     void tanto_unpack_matmul_init(uint32_t icb0, uint32_t icb1, bool transpose) override;
+    void tanto_unpack_matmul_block_init(
+        uint32_t icb0, 
+        uint32_t icb1, 
+        bool transpose, 
+        uint32_t ct_dim) override;
     void tanto_unpack_unary_init(uint32_t icb) override;
     void tanto_unpack_reduce_rows_init(uint32_t icb0, uint32_t icb1) override;
     void tanto_unpack_reduce_cols_init(uint32_t icb0, uint32_t icb1) override;
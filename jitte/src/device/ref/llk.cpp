@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include <cstdint>
+#include <cstdlib>
 #include <cstring>
 #include <cassert>
 #include <cmath>
@@ -25,6 +26,13 @@ namespace ref {
 
 namespace {
 
+// fast matmul path is default, JITTE_FAST_MATMUL=0 selects
+//     reference unpack/math path for each call
+bool get_fast_matmul() {
+    const char *fast = std::getenv("JITTE_FAST_MATMUL");
+    return (fast == nullptr || atoi(fast) != 0);
+}
+
 inline float sigmoid(float x) {
     return 1.0f / (1.0f + std::exp(-x));
 }
@@ -142,6 +150,9 @@ LLK::LLK(Memory *l1, CB *cb) {
     m_relu_threshold = 0.0f;
     m_dst_valid.resize(DST_COUNT, false);
     m_block.resize(32 * TILE_SIZE);
+    m_matmul_terms.resize(DST_COUNT);
+    m_matmul_pending = false;
+    m_fast_matmul = get_fast_matmul();
 }
 
 LLK::~LLK() { }
@@ -149,9 +160,21 @@ LLK::~LLK() { }
 void LLK::reset() {
     m_relu_mode = ReluType::NO_RELU;
     m_relu_threshold = 0.0f;
+    discard_matmul();
+    m_tile_cache.clear();
+}
+
+void LLK::set_fast_matmul(bool enable) {
+    if (m_matmul_pending) {
+        flush_matmul();
+    }
+    m_tile_cache.clear();
+    m_fast_matmul = enable;
 }
 
 void LLK::acquire_dst() {
+    // DST is cleared anyway
+    discard_matmul();
     memset(m_dst.data(), 0, m_dst.size() * sizeof(float));
     for (int i = 0; i < DST_COUNT; i++) {
         m_dst_valid[i] = false;
@@ -350,6 +373,34 @@ void LLK::unpack_AB_matmul(
     faces_to_tile(tile, src_b);
 }
 
+// unpack + math
+
+void LLK::matmul_tiles(
+        uint32_t operandA, 
+        uint32_t operandB, 
+        uint32_t tile_index_a, 
+        uint32_t tile_index_b,
+        uint32_t dst_index,
+        bool transpose) {
+    if (!m_fast_matmul) {
+        unpack_AB_matmul(operandA, operandB, tile_index_a, tile_index_b);
+        math_matmul(dst_index, transpose);
+        return;
+    }
+    assert(dst_index < DST_COUNT);
+    // make room for both operands so that neither is evicted while in use
+    if (m_tile_cache.size() + 2 > MAX_CACHED_TILES) {
+        flush_matmul();
+        m_tile_cache.clear();
+    }
+    // B is cached pre-transposed if needed: flush_matmul has single loop form
+    const float *a = get_cached_tile(operandA, tile_index_a, false);
+    const float *b = get_cached_tile(operandB, tile_index_b, transpose);
+    m_matmul_terms[dst_index].push_back(MatmulTerm{a, b});
+    m_matmul_pending = true;
+    m_dst_valid[dst_index] = true;
+}
+
 //
 //    Dao of tilize/untilize position calculations (without splitting into faces)
 //
@@ -1062,6 +1113,82 @@ void LLK::math_eltwise_unary_sfpu_typecast(
 
 // implementation
 
+const float *LLK::get_cached_tile(uint32_t operand, uint32_t tile_index, bool transpose) {
+    uint32_t addr = m_cb->get_read_ptr(operand) + get_cb_tile_offset(operand, tile_index);
+    uint32_t version = m_cb->get_read_version(operand);
+    uint64_t key = (uint64_t(addr) << 8) | (uint64_t(operand) << 1) | uint64_t(transpose);
+    auto it = m_tile_cache.find(key);
+    if (it != m_tile_cache.end() && it->second.version == version) {
+        return it->second.data.data();
+    }
+    if (it == m_tile_cache.end()) {
+        it = m_tile_cache.emplace(key, CachedTile{}).first;
+        it->second.data.resize(TILE_SIZE);
+    } else if (m_matmul_pending) {
+        // pending terms may refer to stale copy
+        flush_matmul();
+    }
+    CachedTile &entry = it->second;
+    entry.version = version;
+    float *tile = m_tile.data();
+    unpack_tile(get_cb_data_format(operand), m_l1->map_addr(addr), tile);
+    float *data = entry.data.data();
+    if (!transpose) {
+        faces_to_tile(tile, data);
+    } else {
+        float *temp = m_temp.data();
+        faces_to_tile(tile, temp);
+        for (uint32_t h = 0; h < TILE_DIM; h++) {
+            for (uint32_t w = 0; w < TILE_DIM; w++) {
+                data[h * TILE_DIM + w] = temp[w * TILE_DIM + h];
+            }
+        }
+    }
+    return data;
+}
+
+void LLK::flush_matmul() {
+    // run of terms per DST tile is one (32 x 32K) by (32K x 32) product;
+    //     each term is summed separately and added to DST in call order
+    //     to match 'math_matmul' rounding exactly
+    float acc[TILE_DIM];
+    for (uint32_t i = 0; i < DST_COUNT; i++) {
+        std::vector<MatmulTerm> &terms = m_matmul_terms[i];
+        if (terms.empty()) {
+            continue;
+        }
+        float *dst = m_dst.data() + i * TILE_SIZE;
+        for (uint32_t h = 0; h < TILE_DIM; h++) {
+            float *dst_row = dst + h * TILE_DIM;
+            for (const MatmulTerm &term: terms) {
+                const float *a_row = term.a + h * TILE_DIM;
+                for (uint32_t w = 0; w < TILE_DIM; w++) {
+                    acc[w] = 0.0f;
+                }
+                for (uint32_t d = 0; d < TILE_DIM; d++) {
+                    float a = a_row[d];
+                    const float *b_row = term.b + d * TILE_DIM;
+                    for (uint32_t w = 0; w < TILE_DIM; w++) {
+                        acc[w] += a * b_row[w];
+                    }
+                }
+                for (uint32_t w = 0; w < TILE_DIM; w++) {
+                    dst_row[w] += acc[w];
+                }
+            }
+        }
+        terms.clear();
+    }
+    m_matmul_pending = false;
+}
+
+void LLK::discard_matmul() {
+    for (std::vector<MatmulTerm> &terms: m_matmul_terms) {
+        terms.clear();
+    }
+    m_matmul_pending = false;
+}
+
 void LLK::reserve_block(uint32_t tiles) {
     uint32_t size = tiles * TILE_SIZE;
     if (m_block.size() < size) {
@@ -1089,6 +1216,10 @@ uint8_t *LLK::get_cb_write_ptr(uint32_t operand) {
 
 float *LLK::get_dst_ptr(uint32_t dst_index) {
     assert(dst_index >= 0 && dst_index < DST_COUNT);
+    // every DST access except 'acquire_dst' goes here
+    if (m_matmul_pending) {
+        flush_matmul();
+    }
     return m_dst.data() + dst_index * TILE_SIZE;
 }
 
@@ -6,6 +6,7 @@
 
 #include <cstdint>
 #include <vector>
+#include <unordered_map>
 
 #include "core/llk_defs.hpp"
 #include "core/memory.hpp"
@@ -31,6 +32,9 @@ public:
     ~LLK();
 public:
     void reset();
+    // cache unpacked matmul operands and defer matmul math until DST is accessed;
+    //     results are bit-exact with reference unpack/math path
+    void set_fast_matmul(bool enable);
 public:
     void acquire_dst();
 public:
@@ -62,6 +66,15 @@ public:
         uint32_t tile_index_b);
     void unpack_tilize(uint32_t icb, uint32_t block);
     void unpack_untilize(uint32_t icb, uint32_t block); // DEPRECATED
+public:
+    // unpack + math, fast-forward path
+    void matmul_tiles(
+        uint32_t operandA, 
+        uint32_t operandB, 
+        uint32_t tile_index_a, 
+        uint32_t tile_index_b,
+        uint32_t dst_index,
+        bool transpose);
 public:
     // math
     void math_eltwise_binary(
@@ -138,6 +151,18 @@ public:
         uint32_t out_dtype, 
         uint32_t dst_index);
 private:
+    struct CachedTile {
+        uint32_t version;
+        std::vector<float> data;
+    };
+    struct MatmulTerm {
+        const float *a;
+        const float *b;
+    };
+private:
+    const float *get_cached_tile(uint32_t operand, uint32_t tile_index, bool transpose);
+    void flush_matmul();
+    void discard_matmul();
     void reserve_block(uint32_t tiles);
     DataFormat get_cb_data_format(uint32_t operand);
     uint32_t get_cb_tile_offset(uint32_t operand, uint32_t tile_index);
@@ -153,6 +178,7 @@ private:
     static const uint32_t DST_COUNT = 16;
 #endif
     static const uint32_t DST_COUNT = 8;
+    static const uint32_t MAX_CACHED_TILES = 256;
 private:
     Memory *m_l1;
     CB *m_cb;
@@ -165,6 +191,12 @@ private:
     float m_relu_threshold;
     std::vector<bool> m_dst_valid;
     std::vector<float> m_block; // for unpack_tilize/untilize
+    // unpacked CB tiles keyed by CB, L1 address and transpose flag
+    std::unordered_map<uint64_t, CachedTile> m_tile_cache;
+    // deferred matmul terms per DST tile, accumulated on next DST access
+    std::vector<std::vector<MatmulTerm>> m_matmul_terms;
+    bool m_matmul_pending;
+    bool m_fast_matmul;
 };
 
 } // namespace ref
@@ -4,7 +4,9 @@
 
 #include <cstdint>
 #include <cassert>
+#include <string>
 #include <functional>
+#include <stdexcept>
 
 #include "schedule/schedule.hpp"
 
@@ -18,6 +20,7 @@
 #include "core/compute_api.hpp"
 #include "core/dataflow_api.hpp"
 #include "core/machine.hpp"
+#include "core/thread_pool.hpp"
 
 #include "riscv/riscv_impl.hpp"
 #include "riscv/builtin_handler.hpp"
@@ -126,9 +129,14 @@ MachineImpl::MachineImpl(
             m_worker_l1_size(soc_arch->worker_l1_size()),
             m_size_x(soc_arch->worker_x_size()),
             m_size_y(soc_arch->worker_y_size()),
+            m_code_write_count(0),
+            m_code_write_bytes(0),
+            m_code_skip_count(0),
+            m_code_skip_bytes(0),
             m_curr_tensix(nullptr) {
     m_riscv_cluster.reset(create_riscv_cluster(this));
     m_tensix.resize(m_size_x * m_size_y);
+    m_routing_tensix.resize(soc_arch->x_size() * soc_arch->y_size(), nullptr);
     for (uint32_t x = 0; x < m_size_x; x++) {
         for (uint32_t y = 0; y < m_size_y; y++) {
             uint32_t index = linear_tensix_index(x, y); 
@@ -136,8 +144,15 @@ MachineImpl::MachineImpl(
             m_tensix[index].reset(tensix);
             // deferred L1 setting
             m_soc.set_worker_l1(x, y, tensix->get_l1());
+            int routing_x = soc_arch->worker_logical_to_routing_x(x);
+            int routing_y = soc_arch->worker_logical_to_routing_y(y);
+            m_routing_tensix[routing_x * soc_arch->y_size() + routing_y] = tensix;
         }
     }
+    // same code regions as set up by TensixImpl
+    add_code_range(mem_map->brisc_firmware_base(), mem_map->brisc_firmware_size());
+    add_code_range(mem_map->ncrisc_firmware_base(), mem_map->ncrisc_firmware_size());
+    add_code_range(mem_map->trisc0_base(), mem_map->trisc0_size());
 }
 
 MachineImpl::~MachineImpl() { }
@@ -162,9 +177,11 @@ Memory *MachineImpl::get_worker_l1() {
 }
 
 void MachineImpl::launch_kernels() {
-    for (auto &tensix: m_tensix) {
-        tensix->launch_kernels();
-    }
+    // per-core setup is independent; kernels then run on this thread
+    ThreadPool *thread_pool = get_host_thread_pool();
+    thread_pool->parallel_for(int(m_tensix.size()), [&](int index) {
+        m_tensix[index]->launch_kernels();
+    });
     m_scheduler.run();
     for (auto &tensix: m_tensix) {
         tensix->kernels_done();
@@ -178,6 +195,48 @@ void MachineImpl::stop() {
     m_scheduler.run();
 }
 
+bool MachineImpl::is_code_range(uint32_t addr, uint32_t size) {
+    uint32_t end = addr + size;
+    for (const CodeRange &range: m_code_ranges) {
+        if (addr < range.end && end > range.base) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void MachineImpl::write_code(
+        int x, 
+        int y, 
+        uint32_t addr, 
+        const uint8_t *data, 
+        uint32_t size, 
+        uint64_t hash) {
+    Tensix *tensix = m_routing_tensix[x * m_soc_arch->y_size() + y];
+    if (tensix == nullptr) {
+        throw std::runtime_error(
+            "No worker core at (" + std::to_string(x) + ", " + std::to_string(y) + ")");
+    }
+    if (tensix->write_code(addr, data, size, hash)) {
+        m_code_skip_count++;
+        m_code_skip_bytes += size;
+    } else {
+        m_code_write_count++;
+        m_code_write_bytes += size;
+    }
+}
+
+void MachineImpl::get_code_stats(CodeStats &stats) {
+    stats.write_count = m_code_write_count;
+    stats.write_bytes = m_code_write_bytes;
+    stats.skip_count = m_code_skip_count;
+    stats.skip_bytes = m_code_skip_bytes;
+}
+
+void MachineImpl::add_code_range(uint32_t base, uint32_t size) {
+    m_code_ranges.push_back(CodeRange{base, base + size});
+}
+
 } // namespace ref
 } // namespace device
 } // namespace metal
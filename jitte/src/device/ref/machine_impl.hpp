@@ -5,6 +5,7 @@
 #pragma once
 
 #include <cstdint>
+#include <atomic>
 #include <vector>
 #include <memory>
 #include <functional>
@@ -120,6 +121,12 @@ public:
     virtual void launch_kernels() = 0;
     virtual void kernels_done() = 0;
     virtual void stop() = 0;
+    // returns true if binary was already resident and write was skipped
+    virtual bool write_code(
+        uint32_t addr, 
+        const uint8_t *data, 
+        uint32_t size, 
+        uint64_t hash) = 0;
 };
 
 //
@@ -178,10 +185,25 @@ public:
     Memory *get_worker_l1() override;
     void launch_kernels() override;
     void stop() override;
+    bool is_code_range(uint32_t addr, uint32_t size) override;
+    void write_code(
+        int x, 
+        int y, 
+        uint32_t addr, 
+        const uint8_t *data, 
+        uint32_t size, 
+        uint64_t hash) override;
+    void get_code_stats(CodeStats &stats) override;
 private:
     uint32_t linear_tensix_index(uint32_t x, uint32_t y) {
         return x * m_size_y + y;
     }
+    void add_code_range(uint32_t base, uint32_t size);
+private:
+    struct CodeRange {
+        uint32_t base;
+        uint32_t end;
+    };
 private:
     SocArch *m_soc_arch;
     NocArch *m_noc_arch;
@@ -195,6 +217,13 @@ private:
     uint32_t m_size_x;
     uint32_t m_size_y;
     std::vector<std::unique_ptr<Tensix>> m_tensix;
+    std::vector<Tensix *> m_routing_tensix;
+    std::vector<CodeRange> m_code_ranges;
+    // dispatch may write code to several cores in parallel
+    std::atomic<uint64_t> m_code_write_count;
+    std::atomic<uint64_t> m_code_write_bytes;
+    std::atomic<uint64_t> m_code_skip_count;
+    std::atomic<uint64_t> m_code_skip_bytes;
     Tensix *m_curr_tensix;
 };
 
@@ -198,6 +198,52 @@ void NocImpl::write_cmd_ctrl_send_req(uint32_t noc, uint32_t buf) {
     }
 }
 
+void NocImpl::read_2d(
+        uint32_t noc,
+        uint64_t src_addr,
+        uint32_t dest_addr,
+        uint32_t rows,
+        uint32_t len_bytes,
+        uint32_t src_stride,
+        uint32_t dest_stride) {
+    if (rows == 0 || len_bytes == 0) {
+        return;
+    }
+    // map both regions once and copy all rows in bulk
+    uint32_t src_extent = (rows - 1) * src_stride + len_bytes;
+    uint32_t dest_extent = (rows - 1) * dest_stride + len_bytes;
+    uint8_t *src = map_remote_addr(noc, src_addr, src_extent);
+    uint8_t *dest = map_local_addr(noc, dest_addr, dest_extent);
+    for (uint32_t i = 0; i < rows; i++) {
+        data_copy(dest, src, len_bytes);
+        src += src_stride;
+        dest += dest_stride;
+    }
+}
+
+void NocImpl::write_2d(
+        uint32_t noc,
+        uint32_t src_addr,
+        uint64_t dest_addr,
+        uint32_t rows,
+        uint32_t len_bytes,
+        uint32_t src_stride,
+        uint32_t dest_stride) {
+    if (rows == 0 || len_bytes == 0) {
+        return;
+    }
+    // map both regions once and copy all rows in bulk
+    uint32_t src_extent = (rows - 1) * src_stride + len_bytes;
+    uint32_t dest_extent = (rows - 1) * dest_stride + len_bytes;
+    uint8_t *src = map_local_addr(noc, src_addr, src_extent);
+    uint8_t *dest = map_remote_addr(noc, dest_addr, dest_extent);
+    for (uint32_t i = 0; i < rows; i++) {
+        data_copy(dest, src, len_bytes);
+        src += src_stride;
+        dest += dest_stride;
+    }
+}
+
 void NocImpl::incr_reads_num_issued(uint32_t noc, uint32_t incr) {
     assert(noc < NUM_NOCS);
     m_reads_num_issued[noc] += incr;
@@ -5,7 +5,9 @@
 #include <cstdint>
 #include <cstring>
 #include <cassert>
+#include <map>
 #include <memory>
+#include <iterator>
 
 #include "arch/soc_arch.hpp"
 #include "arch/noc_arch.hpp"
@@ -40,13 +42,15 @@ ThreadRunner::ThreadRunner(
             m_sync(sync),
             m_thread(thread),
             m_riscv_core(riscv_core),
-            m_signal(Signal::NONE) { }
+            m_signal(Signal::NONE),
+            m_armed(false) { }
 
 ThreadRunner::~ThreadRunner() { }
 
-void ThreadRunner::go() {
+void ThreadRunner::go(bool armed) {
     assert(m_signal == Signal::NONE);
     m_signal = Signal::GO;
+    m_armed = armed;
 }
 
 void ThreadRunner::stop() {
@@ -64,7 +68,9 @@ void ThreadRunner::main_loop() {
         }
         assert(m_signal == Signal::GO);
         m_signal = Signal::NONE;
-        uint32_t start_pc = get_start_pc();
+        // code regions are no longer cleared after launch:
+        //     harts that received no code for this launch stay idle
+        uint32_t start_pc = m_armed ? get_start_pc() : 0;
         if (start_pc != 0) {
             m_thread->set_active(true);
             m_riscv_core->run(start_pc);
@@ -93,6 +99,8 @@ TensixImpl::TensixImpl(
             m_my_x(0),     // deferred
             m_my_y(0),     // deferred
             m_l1(nullptr), // deferred
+            m_code_armed{false, false, false},
+            m_code_dirty{false, false, false},
             m_curr_thread(nullptr) {
     Sync *sync = machine->sync();
     m_cb.reset(new CBImpl(sync));
@@ -193,12 +201,18 @@ Dataflow *TensixImpl::get_dataflow_api() {
 void TensixImpl::launch_kernels() {
     setup_cb();
     for (int i = 0; i < 3; i++) {
-        m_thread_runners[i]->go();
+        if (m_code_dirty[i]) {
+            m_riscv_system->core_at(i)->invalidate_code();
+            m_code_dirty[i] = false;
+        }
+        m_thread_runners[i]->go(m_code_armed[i]);
     }
 }
 
 void TensixImpl::kernels_done() {
-    clear_code();
+    for (int i = 0; i < 3; i++) {
+        m_code_armed[i] = false;
+    }
 }
 
 void TensixImpl::stop() {
@@ -233,11 +247,77 @@ void TensixImpl::setup_cb() {
     }
 }
 
-void TensixImpl::clear_code() {
+bool TensixImpl::write_code(
+        uint32_t addr, 
+        const uint8_t *data, 
+        uint32_t size, 
+        uint64_t hash) {
+    uint32_t end = addr + size;
+    bool overlap = false;
+    bool resident = true;
+    for (int i = 0; i < 3; i++) {
+        RiscvCore *core = m_riscv_system->core_at(i);
+        uint32_t code_base = core->code_base();
+        uint32_t code_end = code_base + core->code_size();
+        if (addr >= code_end || end <= code_base) {
+            continue;
+        }
+        overlap = true;
+        m_code_armed[i] = true;
+        if (!is_code_resident(i, addr, size, hash)) {
+            resident = false;
+        }
+    }
+    uint8_t *dst = m_l1->map_addr(addr);
+    if (overlap && resident) {
+        // resident image still differs from L1 contents if kernel stored to its
+        // initialized data (.data, .sdata) during previous launch: restore these
+        // bytes; instructions are never stored to, so decoded code stays valid
+        if (memcmp(dst, data, size) == 0) {
+            return true;
+        }
+        memcpy(dst, data, size);
+        return false;
+    }
+    memcpy(dst, data, size);
     for (int i = 0; i < 3; i++) {
         RiscvCore *core = m_riscv_system->core_at(i);
-        uint8_t *ptr = m_l1->map_addr(core->code_base());
-        memset(ptr, 0, core->code_size());
+        uint32_t code_base = core->code_base();
+        uint32_t code_end = code_base + core->code_size();
+        if (addr >= code_end || end <= code_base) {
+            continue;
+        }
+        update_code_chunks(i, addr, size, hash);
+        m_code_dirty[i] = true;
+    }
+    return false;
+}
+
+bool TensixImpl::is_code_resident(int hart, uint32_t addr, uint32_t size, uint64_t hash) {
+    const std::map<uint32_t, CodeChunk> &chunks = m_code_chunks[hart];
+    auto it = chunks.find(addr);
+    return (it != chunks.end() && it->second.size == size && it->second.hash == hash);
+}
+
+void TensixImpl::update_code_chunks(int hart, uint32_t addr, uint32_t size, uint64_t hash) {
+    // drop all chunks overlapped by new one
+    std::map<uint32_t, CodeChunk> &chunks = m_code_chunks[hart];
+    uint32_t end = addr + size;
+    auto it = chunks.upper_bound(addr);
+    if (it != chunks.begin()) {
+        auto prev = std::prev(it);
+        if (prev->first + prev->second.size > addr) {
+            it = prev;
+        }
+    }
+    while (it != chunks.end() && it->first < end) {
+        it = chunks.erase(it);
+    }
+    // chunks crossing region boundary are not tracked and always rewritten
+    RiscvCore *core = m_riscv_system->core_at(hart);
+    uint32_t code_base = core->code_base();
+    if (addr >= code_base && end <= code_base + core->code_size()) {
+        chunks[addr] = CodeChunk{size, hash};
     }
 }
 
@@ -6,6 +6,7 @@
 
 #include <cstdint>
 #include <array>
+#include <map>
 #include <memory>
 
 #include "core/memory.hpp"
@@ -34,7 +35,7 @@ public:
         RiscvCore *riscv_core);
     ~ThreadRunner();
 public:
-    void go();
+    void go(bool armed);
     void stop();
     void main_loop();
 private:
@@ -50,6 +51,7 @@ private:
     Thread *m_thread;
     RiscvCore *m_riscv_core;
     Signal m_signal;
+    bool m_armed;
 };
 
 //
@@ -77,15 +79,25 @@ public:
     void launch_kernels() override;
     void kernels_done() override;
     void stop() override;
+    bool write_code(
+        uint32_t addr, 
+        const uint8_t *data, 
+        uint32_t size, 
+        uint64_t hash) override;
 private:
     void setup_cb();
-    void clear_code();
+    bool is_code_resident(int hart, uint32_t addr, uint32_t size, uint64_t hash);
+    void update_code_chunks(int hart, uint32_t addr, uint32_t size, uint64_t hash);
 private:
     enum {
         BRISC = 0,
         TRISC = 1,
         NCRISC = 2
     };
+    struct CodeChunk {
+        uint32_t size;
+        uint64_t hash;
+    };
 private:
     MachineImpl *m_machine;
     uint32_t m_my_x; // mainly for diagnostics
@@ -96,6 +108,12 @@ private:
     std::unique_ptr<RiscvSystem> m_riscv_system;
     std::array<std::unique_ptr<Thread>, 3> m_threads;
     std::array<std::unique_ptr<ThreadRunner>, 3> m_thread_runners;
+    // resident binary chunks per hart code region, keyed by address
+    std::array<std::map<uint32_t, CodeChunk>, 3> m_code_chunks;
+    // hart has code for current launch
+    std::array<bool, 3> m_code_armed;
+    // hart code changed since last launch, decoded code is stale
+    std::array<bool, 3> m_code_dirty;
     Thread *m_curr_thread;
 };
 
@@ -28,6 +28,7 @@
     DECL_BUILTIN(tanto_sub_bcast_scalar_init, 0) \
     DECL_BUILTIN(tanto_mul_bcast_scalar_init, 0) \
     DECL_BUILTIN(tanto_matmul_init, 1) \
+    DECL_BUILTIN(tanto_matmul_block_init, 2) \
     DECL_BUILTIN(tanto_reduce_max_rows_init, 0) \
     DECL_BUILTIN(tanto_reduce_max_cols_init, 0) \
     DECL_BUILTIN(tanto_reduce_max_scalar_init, 0) \
@@ -99,6 +100,7 @@
     DECL_BUILTIN(tanto_unpack_bcast_cols_init, 2) \
     DECL_BUILTIN(tanto_unpack_bcast_scalar_init, 2) \
     DECL_BUILTIN(tanto_unpack_matmul_init, 3) \
+    DECL_BUILTIN(tanto_unpack_matmul_block_init, 4) \
     DECL_BUILTIN(tanto_unpack_unary_init, 1) \
     DECL_BUILTIN(tanto_unpack_reduce_rows_init, 2) \
     DECL_BUILTIN(tanto_unpack_reduce_cols_init, 2) \
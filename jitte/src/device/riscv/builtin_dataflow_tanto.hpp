@@ -16,7 +16,13 @@
     DECL_BUILTIN(noc_async_read_global_dram, 5, 0) \
     DECL_BUILTIN(noc_async_read_global_l1, 5, 0) \
     DECL_BUILTIN(noc_async_write_global_dram, 5, 0) \
-    DECL_BUILTIN(noc_async_write_global_l1, 5, 0)
+    DECL_BUILTIN(noc_async_write_global_l1, 5, 0) \
+    DECL_BUILTIN(noc_async_read_block_dram, 7, 0) \
+    DECL_BUILTIN(noc_async_read_cyclic_dram, 6, 0) \
+    DECL_BUILTIN(noc_async_write_block_dram, 7, 0) \
+    DECL_BUILTIN(noc_async_write_cyclic_dram, 6, 0) \
+    DECL_BUILTIN(noc_async_read_2d, 7, 0) \
+    DECL_BUILTIN(noc_async_write_2d, 7, 0)
 
 //
 //    Dataflow builtin enumeration
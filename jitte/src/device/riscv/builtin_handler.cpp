@@ -116,6 +116,30 @@ void BuiltinHandler::call(Riscv32Core *core, int id) {
     exit(1);
 }
 
+Riscv32BuiltinHandler *BuiltinHandler::resolve(int id) {
+    // call reports need dispatch via 'call'
+    if (DIAG_REPORT_CALL_ENABLED) {
+        return this;
+    }
+    if (get_compute_builtin_map().count(ComputeBuiltinId(id)) != 0) {
+        return &m_compute_handler;
+    }
+    if (get_compute_tanto_builtin_map().count(ComputeTantoBuiltinId(id)) != 0) {
+        return &m_compute_tanto_handler;
+    }
+    if (get_dataflow_builtin_map().count(DataflowBuiltinId(id)) != 0) {
+        return &m_dataflow_handler;
+    }
+    if (get_dataflow_tanto_builtin_map().count(DataflowTantoBuiltinId(id)) != 0) {
+        return &m_dataflow_tanto_handler;
+    }
+    if (get_stdlib_builtin_map().count(StdlibBuiltinId(id)) != 0) {
+        return &m_stdlib_handler;
+    }
+    // unsupported ID is reported by 'call'
+    return this;
+}
+
 } // namespace riscv
 } // namespace device
 } // namespace metal
@@ -28,6 +28,7 @@ public:
     ~BuiltinHandler();
 public:
     void call(Riscv32Core *core, int id) override;
+    Riscv32BuiltinHandler *resolve(int id) override;
 private:
     ComputeHandler m_compute_handler;
     ComputeTantoHandler m_compute_tanto_handler;
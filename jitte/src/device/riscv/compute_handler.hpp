@@ -17,14 +17,15 @@ namespace metal {
 namespace device {
 namespace riscv {
 
+using ::riscv::core::Riscv32BuiltinHandler;
 using ::riscv::core::Riscv32Core;
 
-class ComputeHandler {
+class ComputeHandler: public Riscv32BuiltinHandler {
 public:
     ComputeHandler(Machine *machine);
     ~ComputeHandler();
 public:
-    void call(Riscv32Core *core, int id);
+    void call(Riscv32Core *core, int id) override;
 private:
     Machine *m_machine;
 };
@@ -87,6 +87,12 @@ void tanto_matmul_init(Compute *api, Riscv32Core *core) {
     api->tanto_matmul_init(transpose);
 }
 
+void tanto_matmul_block_init(Compute *api, Riscv32Core *core) {
+    bool transpose = bool(core->get_arg(0));
+    uint32_t ct_dim = core->get_arg(1);
+    api->tanto_matmul_block_init(transpose, ct_dim);
+}
+
 void tanto_reduce_max_rows_init(Compute *api, Riscv32Core *core) {
     api->tanto_reduce_max_rows_init();
 }
@@ -384,6 +390,14 @@ void tanto_unpack_matmul_init(Compute *api, Riscv32Core *core) {
     api->tanto_unpack_matmul_init(icb0, icb1, transpose);
 }
 
+void tanto_unpack_matmul_block_init(Compute *api, Riscv32Core *core) {
+    uint32_t icb0 = core->get_arg(0);
+    uint32_t icb1 = core->get_arg(1);
+    bool transpose = bool(core->get_arg(2));
+    uint32_t ct_dim = core->get_arg(3);
+    api->tanto_unpack_matmul_block_init(icb0, icb1, transpose, ct_dim);
+}
+
 void tanto_unpack_unary_init(Compute *api, Riscv32Core *core) {
     uint32_t icb = core->get_arg(0);
     api->tanto_unpack_unary_init(icb);
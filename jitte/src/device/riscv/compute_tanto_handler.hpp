@@ -17,14 +17,15 @@ namespace metal {
 namespace device {
 namespace riscv {
 
+using ::riscv::core::Riscv32BuiltinHandler;
 using ::riscv::core::Riscv32Core;
 
-class ComputeTantoHandler {
+class ComputeTantoHandler: public Riscv32BuiltinHandler {
 public:
     ComputeTantoHandler(Machine *machine);
     ~ComputeTantoHandler();
 public:
-    void call(Riscv32Core *core, int id);
+    void call(Riscv32Core *core, int id) override;
 private:
     Machine *m_machine;
 };
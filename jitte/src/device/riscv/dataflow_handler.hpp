@@ -16,14 +16,15 @@ namespace metal {
 namespace device {
 namespace riscv {
 
+using ::riscv::core::Riscv32BuiltinHandler;
 using ::riscv::core::Riscv32Core;
 
-class DataflowHandler {
+class DataflowHandler: public Riscv32BuiltinHandler {
 public:
     DataflowHandler(Machine *machine);
     ~DataflowHandler();
 public:
-    void call(Riscv32Core *core, int id);
+    void call(Riscv32Core *core, int id) override;
 private:
     Machine *m_machine;
 };
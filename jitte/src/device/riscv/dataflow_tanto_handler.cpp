@@ -23,6 +23,14 @@ namespace {
 
 using ::riscv::core::Riscv32Core;
 
+uint64_t make_u64(uint32_t lo, uint32_t hi) {
+    return (uint64_t(hi) << 32) | uint64_t(lo);
+}
+
+uint64_t get_arg64(Riscv32Core *core, int index) {
+    return make_u64(core->get_arg(index), core->get_arg(index + 1));
+}
+
 // Tanto extensions
 
 void noc_async_read_global_dram(Dataflow *api, Riscv32Core *core) {
@@ -81,6 +89,106 @@ void noc_async_write_global_l1(Dataflow *api, Riscv32Core *core) {
         len_bytes);
 }
 
+void noc_async_read_block_dram(Dataflow *api, Riscv32Core *core) {
+    uint32_t dst_addr = core->get_arg(0);
+    uint32_t src_addr = core->get_arg(1);
+    uint32_t src_page_size = core->get_arg(2);
+    uint32_t src_bank_pages = core->get_arg(3);
+    uint32_t src_page_id = core->get_arg(4);
+    uint32_t src_offset = core->get_arg(5);
+    uint32_t len_bytes = core->get_arg(6);
+    api->noc_async_read_block_dram(
+        dst_addr,
+        src_addr,
+        src_page_size,
+        src_bank_pages,
+        src_page_id,
+        src_offset,
+        len_bytes);
+}
+
+void noc_async_read_cyclic_dram(Dataflow *api, Riscv32Core *core) {
+    uint32_t dst_addr = core->get_arg(0);
+    uint32_t src_addr = core->get_arg(1);
+    uint32_t src_page_size = core->get_arg(2);
+    uint32_t src_page_id = core->get_arg(3);
+    uint32_t src_offset = core->get_arg(4);
+    uint32_t len_bytes = core->get_arg(5);
+    api->noc_async_read_cyclic_dram(
+        dst_addr,
+        src_addr,
+        src_page_size,
+        src_page_id,
+        src_offset,
+        len_bytes);
+}
+
+void noc_async_write_block_dram(Dataflow *api, Riscv32Core *core) {
+    uint32_t src_addr = core->get_arg(0);
+    uint32_t dst_addr = core->get_arg(1);
+    uint32_t dst_page_size = core->get_arg(2);
+    uint32_t dst_bank_pages = core->get_arg(3);
+    uint32_t dst_page_id = core->get_arg(4);
+    uint32_t dst_offset = core->get_arg(5);
+    uint32_t len_bytes = core->get_arg(6);
+    api->noc_async_write_block_dram(
+        src_addr,
+        dst_addr,
+        dst_page_size,
+        dst_bank_pages,
+        dst_page_id,
+        dst_offset,
+        len_bytes);
+}
+
+void noc_async_write_cyclic_dram(Dataflow *api, Riscv32Core *core) {
+    uint32_t src_addr = core->get_arg(0);
+    uint32_t dst_addr = core->get_arg(1);
+    uint32_t dst_page_size = core->get_arg(2);
+    uint32_t dst_page_id = core->get_arg(3);
+    uint32_t dst_offset = core->get_arg(4);
+    uint32_t len_bytes = core->get_arg(5);
+    api->noc_async_write_cyclic_dram(
+        src_addr,
+        dst_addr,
+        dst_page_size,
+        dst_page_id,
+        dst_offset,
+        len_bytes);
+}
+
+void noc_async_read_2d(Dataflow *api, Riscv32Core *core) {
+    uint64_t src_noc_addr = get_arg64(core, 0);
+    uint32_t dst_addr = core->get_arg(2);
+    uint32_t rows = core->get_arg(3);
+    uint32_t len_bytes = core->get_arg(4);
+    uint32_t src_stride = core->get_arg(5);
+    uint32_t dst_stride = core->get_arg(6);
+    api->noc_async_read_2d(
+        src_noc_addr,
+        dst_addr,
+        rows,
+        len_bytes,
+        src_stride,
+        dst_stride);
+}
+
+void noc_async_write_2d(Dataflow *api, Riscv32Core *core) {
+    uint32_t src_addr = core->get_arg(0);
+    uint64_t dst_noc_addr = get_arg64(core, 1);
+    uint32_t rows = core->get_arg(3);
+    uint32_t len_bytes = core->get_arg(4);
+    uint32_t src_stride = core->get_arg(5);
+    uint32_t dst_stride = core->get_arg(6);
+    api->noc_async_write_2d(
+        src_addr,
+        dst_noc_addr,
+        rows,
+        len_bytes,
+        src_stride,
+        dst_stride);
+}
+
 } // namespace
 
 //
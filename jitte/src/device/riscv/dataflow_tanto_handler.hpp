@@ -16,14 +16,15 @@ namespace metal {
 namespace device {
 namespace riscv {
 
+using ::riscv::core::Riscv32BuiltinHandler;
 using ::riscv::core::Riscv32Core;
 
-class DataflowTantoHandler {
+class DataflowTantoHandler: public Riscv32BuiltinHandler {
 public:
     DataflowTantoHandler(Machine *machine);
     ~DataflowTantoHandler();
 public:
-    void call(Riscv32Core *core, int id);
+    void call(Riscv32Core *core, int id) override;
 private:
     Machine *m_machine;
 };
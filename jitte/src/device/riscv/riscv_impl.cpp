@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include <cstdint>
+#include <cstdlib>
 #include <cassert>
 #include <vector>
 #include <memory>
@@ -25,6 +26,16 @@ namespace {
 
 namespace rv32 = ::riscv::core;
 
+// lean hart is much faster but does not accumulate FP exception flags and
+//     honors static rounding modes only in conversions: enabled on request
+rv32::Riscv32HartKind get_hart_kind() {
+    const char *lean = std::getenv("JITTE_LEAN_HART");
+    if (lean != nullptr && atoi(lean) != 0) {
+        return rv32::Riscv32HartKind::LEAN;
+    }
+    return rv32::Riscv32HartKind::FULL;
+}
+
 //
 //    MemoryImpl    
 //
@@ -76,6 +87,9 @@ public:
         // TODO: Check whether 'addr' argument of 'Riscv32Core::write_code' is really needed
         m_core->write_code(m_core->code_base(), code);
     }
+    void invalidate_code() override {
+        m_core->invalidate_code();
+    }
     void run(uint32_t start_pc) override {
         m_core->run(start_pc);
     }
@@ -153,7 +167,12 @@ RiscvSystem *RiscvClusterImpl::create_system(int core_count, uint32_t mem_size)
     mem_size = ((mem_size + sec_size - 1) / sec_size) * sec_size;
 #endif
     rv32::Riscv32System *system = 
-        rv32::Riscv32System::create(core_count, mem_size, 4 * 1024, 0);
+        rv32::Riscv32System::create(
+            core_count, 
+            mem_size, 
+            4 * 1024, 
+            0, 
+            get_hart_kind());
     return new RiscvSystemImpl(&m_builtin_handler, system, mem_size);
 }
 
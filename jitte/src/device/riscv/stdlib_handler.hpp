@@ -18,14 +18,15 @@ namespace metal {
 namespace device {
 namespace riscv {
 
+using ::riscv::core::Riscv32BuiltinHandler;
 using ::riscv::core::Riscv32Core;
 
-class StdlibHandler {
+class StdlibHandler: public Riscv32BuiltinHandler {
 public:
     StdlibHandler(Machine *machine);
     ~StdlibHandler();
 public:
-    void call(Riscv32Core *core, int id);
+    void call(Riscv32Core *core, int id) override;
 private:
     Machine *m_machine;
 };
@@ -0,0 +1,371 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <memory>
+#include <exception>
+
+#include "arch/soc_arch.hpp"
+#include "arch/noc_arch.hpp"
+#include "arch/mem_map.hpp"
+
+#include "core/memory.hpp"
+#include "core/sync.hpp"
+#include "core/cb_impl.hpp"
+#include "core/machine.hpp"
+
+#include "ref/machine_builder_impl.hpp"
+#include "ref/llk.hpp"
+
+#include "dispatch/noc.hpp"
+
+#include "api/device_api.hpp"
+
+//
+//    Kernel binary residency
+//
+//    Binaries are written to hart code regions of worker cores the same
+//    way dispatch does on each launch, by host writes and by NOC unicast
+//    and multicast writes: writing the same binary again (repeated launch)
+//    must be counted as skip, a changed binary must be copied.
+//
+//    Small hand-assembled kernels are launched to check that a changed
+//    binary is decoded again and that initialized data stored to by
+//    a kernel is restored before the next launch.
+//
+//    The simulated DRAM is reduced so that the test runs on hosts
+//    with little memory.
+//
+//    Fast matmul path
+//
+//    Reference LLK matmul with cached operands and deferred math must
+//    produce the same bits as unpack/math per call, including K loops
+//    that pop operands between iterations (CB slots are reused) and
+//    transposed B.
+//
+
+using namespace tt::metal::device;
+
+namespace {
+
+// worker core in NOC coordinates
+constexpr uint32_t WORKER_X = 1;
+constexpr uint32_t WORKER_Y = 1;
+
+constexpr uint32_t DRAM_BANK_SIZE = 16 * 1024 * 1024;
+
+// kernel result in worker L1 (outside of code and local regions)
+constexpr uint32_t RESULT_ADDR = 0x100000;
+
+//
+//    TestMachineBuilder
+//
+
+class TestMachineBuilder: public MachineBuilder {
+public:
+    TestMachineBuilder();
+    ~TestMachineBuilder();
+public:
+    Machine *create_machine(
+        SocArch *soc_arch,
+        NocArch *noc_arch,
+        MemMap *mem_map) override;
+    Machine *machine() {
+        return m_machine;
+    }
+private:
+    ref::MachineBuilderImpl m_ref_builder;
+    SocArch m_soc_arch;
+    Machine *m_machine;
+};
+
+TestMachineBuilder::TestMachineBuilder():
+        m_machine(nullptr) { }
+
+TestMachineBuilder::~TestMachineBuilder() { }
+
+Machine *TestMachineBuilder::create_machine(
+        SocArch *soc_arch,
+        NocArch *noc_arch,
+        MemMap *mem_map) {
+    m_soc_arch = *soc_arch;
+    m_soc_arch.set_dram_bank_size(DRAM_BANK_SIZE);
+    m_machine = m_ref_builder.create_machine(&m_soc_arch, noc_arch, mem_map);
+    return m_machine;
+}
+
+//
+//    Test kernels
+//
+
+uint32_t enc_i(uint32_t opcode, uint32_t funct3, uint32_t rd, uint32_t rs1, int32_t imm) {
+    return (uint32_t(imm) << 20) | (rs1 << 15) | (funct3 << 12) | (rd << 7) | opcode;
+}
+
+uint32_t enc_s(uint32_t funct3, uint32_t rs1, uint32_t rs2, int32_t imm) {
+    uint32_t uimm = uint32_t(imm);
+    return
+        ((uimm >> 5) << 25) | (rs2 << 20) | (rs1 << 15) |
+            (funct3 << 12) | ((uimm & 0x1f) << 7) | 0x23;
+}
+
+uint32_t enc_u(uint32_t opcode, uint32_t rd, uint32_t imm) {
+    return (imm & 0xfffff000) | (rd << 7) | opcode;
+}
+
+// image: start PC, initialized counter (.data), code
+//     counter += step; *RESULT_ADDR = counter
+std::vector<uint8_t> make_kernel(uint32_t code_base, uint32_t counter, int32_t step) {
+    static constexpr uint32_t RA = 1;
+    static constexpr uint32_t T0 = 5;
+    static constexpr uint32_t T1 = 6;
+    static constexpr uint32_t T2 = 7;
+    std::vector<uint32_t> words{
+        code_base + 8,
+        counter,
+        enc_u(0x17, T0, 0),                 // auipc t0, 0
+        enc_i(0x03, 2, T1, T0, -4),         // lw t1, -4(t0)
+        enc_i(0x13, 0, T1, T1, step),       // addi t1, t1, step
+        enc_s(2, T0, T1, -4),               // sw t1, -4(t0)
+        enc_u(0x37, T2, RESULT_ADDR),       // lui t2, %hi(RESULT_ADDR)
+        enc_s(2, T2, T1, 0),                // sw t1, 0(t2)
+        enc_i(0x67, 0, 0, RA, 0)            // ret
+    };
+    std::vector<uint8_t> code(words.size() * 4);
+    for (size_t i = 0; i < words.size(); i++) {
+        for (int k = 0; k < 4; k++) {
+            code[i * 4 + k] = uint8_t(words[i] >> (k * 8));
+        }
+    }
+    return code;
+}
+
+//
+//    Checks
+//
+
+std::vector<uint8_t> make_code(uint32_t size, uint32_t seed) {
+    std::vector<uint8_t> code(size);
+    for (uint32_t i = 0; i < size; i++) {
+        code[i] = uint8_t(i * 13 + seed);
+    }
+    return code;
+}
+
+bool report(const char *check, bool ok) {
+    printf("%s = %s\n", check, ok ? "OK" : "FAIL");
+    return ok;
+}
+
+bool check_stats(Device *device, uint64_t write_count, uint64_t skip_count) {
+    CodeStats stats;
+    device->get_code_stats(stats);
+    return (stats.write_count == write_count && stats.skip_count == skip_count);
+}
+
+bool check_code(
+        Device *device,
+        uint32_t x,
+        uint32_t y,
+        uint32_t addr,
+        const std::vector<uint8_t> &want) {
+    std::vector<uint8_t> got(want.size());
+    device->read(got.data(), uint32_t(got.size()), x, y, addr);
+    return (got == want);
+}
+
+bool check_result(Device *device, uint32_t want) {
+    uint32_t got = 0;
+    device->read(&got, uint32_t(sizeof(got)), WORKER_X, WORKER_Y, RESULT_ADDR);
+    return (got == want);
+}
+
+bool run_host_write() {
+    std::unique_ptr<Device> device(Device::create(Device::Arch::WORMHOLE_B0));
+    uint32_t addr = get_mem_map_wormhole_b0()->trisc0_base();
+    std::vector<uint8_t> code1 = make_code(1024, 1);
+    std::vector<uint8_t> code2 = make_code(1024, 2);
+    uint32_t size = uint32_t(code1.size());
+    bool ok = true;
+    device->write(code1.data(), size, WORKER_X, WORKER_Y, addr);
+    ok &= report("First launch writes", check_stats(device.get(), 1, 0));
+    device->write(code1.data(), size, WORKER_X, WORKER_Y, addr);
+    device->write(code1.data(), size, WORKER_X, WORKER_Y, addr);
+    ok &= report("Repeated launches skip", check_stats(device.get(), 1, 2));
+    ok &= report("Resident code", check_code(device.get(), WORKER_X, WORKER_Y, addr, code1));
+    device->write(code2.data(), size, WORKER_X, WORKER_Y, addr);
+    ok &= report("Changed binary writes", check_stats(device.get(), 2, 2));
+    ok &= report("Changed code", check_code(device.get(), WORKER_X, WORKER_Y, addr, code2));
+    device->write(code1.data(), size, WORKER_X, WORKER_Y, addr);
+    ok &= report("Previous binary writes", check_stats(device.get(), 3, 2));
+    ok &= report("Previous code", check_code(device.get(), WORKER_X, WORKER_Y, addr, code1));
+    device->stop();
+    return ok;
+}
+
+bool run_dispatch_write(TestMachineBuilder *builder) {
+    std::unique_ptr<Device> device(Device::create(Device::Arch::WORMHOLE_B0));
+    Machine *machine = builder->machine();
+    SocArch *soc_arch = get_soc_arch_wormhole_b0();
+    NocArch *noc_arch = get_noc_arch_wormhole_b0();
+    dispatch::Noc noc(machine->soc(), noc_arch, machine);
+    uint32_t addr = get_mem_map_wormhole_b0()->ncrisc_firmware_base();
+    std::vector<uint8_t> code1 = make_code(2048, 3);
+    std::vector<uint8_t> code2 = make_code(2048, 4);
+    uint32_t size = uint32_t(code1.size());
+    uint32_t x_end = uint32_t(soc_arch->x_size() - 1);
+    uint32_t y_end = uint32_t(soc_arch->y_size() - 1);
+    uint32_t num_dests = 0;
+    for (int x = 0; x < soc_arch->x_size(); x++) {
+        for (int y = 0; y < soc_arch->y_size(); y++) {
+            if (soc_arch->core_type(x, y) == CoreType::WORKER) {
+                num_dests++;
+            }
+        }
+    }
+    uint64_t mcast_addr = noc_arch->noc_multicast_addr(0, 0, x_end, y_end, addr);
+    uint64_t unicast_addr = noc_arch->noc_xy_addr(WORKER_X, WORKER_Y, addr);
+    bool ok = true;
+    noc.write_multicast(code1.data(), mcast_addr, size, num_dests);
+    ok &= report("Multicast writes", check_stats(device.get(), num_dests, 0));
+    noc.write_multicast(code1.data(), mcast_addr, size, num_dests);
+    ok &= report("Repeated multicast skips", check_stats(device.get(), num_dests, num_dests));
+    noc.write(code2.data(), unicast_addr, size);
+    ok &= report("Changed unicast writes", check_stats(device.get(), num_dests + 1, num_dests));
+    ok &= report("Unicast code", check_code(device.get(), WORKER_X, WORKER_Y, addr, code2));
+    noc.write_multicast(code1.data(), mcast_addr, size, num_dests);
+    ok &=
+        report(
+            "Multicast rewrites changed core",
+            check_stats(device.get(), num_dests + 2, 2 * num_dests - 1));
+    ok &= report("Multicast code", check_code(device.get(), WORKER_X, WORKER_Y, addr, code1));
+    device->stop();
+    return ok;
+}
+
+bool run_kernel_launch(TestMachineBuilder *builder) {
+    std::unique_ptr<Device> device(Device::create(Device::Arch::WORMHOLE_B0));
+    Machine *machine = builder->machine();
+    NocArch *noc_arch = get_noc_arch_wormhole_b0();
+    dispatch::Noc noc(machine->soc(), noc_arch, machine);
+    uint32_t addr = get_mem_map_wormhole_b0()->trisc0_base();
+    uint64_t noc_addr = noc_arch->noc_xy_addr(WORKER_X, WORKER_Y, addr);
+    std::vector<uint8_t> kernel1 = make_kernel(addr, 100, 1);
+    std::vector<uint8_t> kernel2 = make_kernel(addr, 100, 2);
+    bool ok = true;
+    noc.write(kernel1.data(), noc_addr, uint32_t(kernel1.size()));
+    device->launch_kernels();
+    ok &= report("First kernel run", check_result(device.get(), 101));
+    // kernel stored to its counter: resident image is restored
+    noc.write(kernel1.data(), noc_addr, uint32_t(kernel1.size()));
+    device->launch_kernels();
+    ok &= report("Initialized data restored", check_result(device.get(), 101));
+    // changed instruction must not run from stale decoded code
+    noc.write(kernel2.data(), noc_addr, uint32_t(kernel2.size()));
+    device->launch_kernels();
+    ok &= report("Changed kernel decoded", check_result(device.get(), 102));
+    // hart without code for this launch stays idle
+    device->write(&addr, uint32_t(sizeof(addr)), WORKER_X, WORKER_Y, RESULT_ADDR);
+    device->launch_kernels();
+    ok &= report("Idle without code", check_result(device.get(), addr));
+    device->stop();
+    return ok;
+}
+
+//
+//    Fast matmul path
+//
+
+constexpr uint32_t CB_A = 0;
+constexpr uint32_t CB_B = 1;
+constexpr uint32_t CB_OUT = 16;
+
+constexpr uint32_t MATMUL_K = 5;
+constexpr uint32_t MATMUL_DST = 2;
+
+// 16B words
+constexpr uint32_t BF16_TILE_WORDS = 2048 >> 4;
+constexpr uint32_t FP32_TILE_WORDS = 4096 >> 4;
+
+void setup_cb(
+        CBImpl &cb,
+        uint32_t cb_id,
+        uint32_t addr,
+        uint32_t num_pages,
+        uint32_t page_words,
+        DataFormat format) {
+    cb.setup_read_write_interfaces(cb_id, addr >> 4, num_pages * page_words, num_pages, page_words);
+    cb.setup_data_formats(cb_id, format, format, format, format);
+}
+
+// bfloat16 tiles with values in [-1, 1)
+void push_tiles(Memory &l1, CBImpl &cb, uint32_t cb_id, uint32_t count, uint32_t &seed) {
+    uint8_t *dst = l1.map_addr(cb.get_write_ptr(cb_id));
+    for (uint32_t i = 0; i < count * 1024; i++) {
+        seed = seed * 1664525 + 1013904223;
+        float value = float(int32_t(seed >> 8) - (1 << 23)) / float(1 << 23);
+        uint32_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        uint16_t bf16 = uint16_t(bits >> 16);
+        memcpy(dst + i * 2, &bf16, sizeof(bf16));
+    }
+    cb.cb_push_back(cb_id, count);
+}
+
+// DST tiles packed as float32 after K loop
+std::vector<uint8_t> run_matmul(bool fast, bool transpose) {
+    L1Bank l1;
+    l1.init(1024 * 1024);
+    Sync sync(nullptr);
+    CBImpl cb(&sync);
+    // two K iterations per FIFO: slots are reused with new data
+    setup_cb(cb, CB_A, 0x10000, 2 * MATMUL_DST, BF16_TILE_WORDS, DataFormat::Float16_b);
+    setup_cb(cb, CB_B, 0x20000, 2, BF16_TILE_WORDS, DataFormat::Float16_b);
+    setup_cb(cb, CB_OUT, 0x30000, MATMUL_DST, FP32_TILE_WORDS, DataFormat::Float32);
+    ref::LLK llk(&l1, &cb);
+    llk.set_fast_matmul(fast);
+    llk.acquire_dst();
+    uint32_t seed = 1;
+    for (uint32_t k = 0; k < MATMUL_K; k++) {
+        push_tiles(l1, cb, CB_A, MATMUL_DST, seed);
+        push_tiles(l1, cb, CB_B, 1, seed);
+        for (uint32_t i = 0; i < MATMUL_DST; i++) {
+            llk.matmul_tiles(CB_A, CB_B, i, 0, i, transpose);
+        }
+        cb.cb_pop_front(CB_A, MATMUL_DST);
+        cb.cb_pop_front(CB_B, 1);
+    }
+    uint8_t *out = l1.map_addr(cb.get_write_ptr(CB_OUT));
+    llk.matmul_pack(0, CB_OUT, MATMUL_DST);
+    return std::vector<uint8_t>(out, out + MATMUL_DST * 4096);
+}
+
+bool run_fast_matmul() {
+    bool ok = true;
+    ok &= report("Fast matmul", (run_matmul(true, false) == run_matmul(false, false)));
+    ok &= report("Fast matmul transposed", (run_matmul(true, true) == run_matmul(false, true)));
+    return ok;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    TestMachineBuilder builder;
+    set_machine_builder(&builder);
+    bool ok = true;
+    try {
+        ok &= run_host_write();
+        ok &= run_dispatch_write(&builder);
+        ok &= run_kernel_launch(&builder);
+        ok &= run_fast_matmul();
+    } catch (std::exception &e) {
+        fprintf(stderr, "Error: %s\n", e.what());
+        ok = false;
+    }
+    set_machine_builder(nullptr);
+    return ok ? 0 : 1;
+}
@@ -468,6 +468,46 @@ void EnqueueWriteBuffer(
     HostDataType src,
     bool blocking);
 
+/**
+ * Reads a region of a buffer from the device
+ *
+ * Return value: void
+ *
+ * | Argument     | Description                                                            | Type                                | Valid Range                        | Required |
+ * |--------------|------------------------------------------------------------------------|-------------------------------------|------------------------------------|----------|
+ * | cq           | The command queue object which dispatches the command to the hardware  | CommandQueue &                      |                                    | Yes      |
+ * | buffer       | The device buffer we are reading from                                  | Buffer & or std::shared_ptr<Buffer> | Interleaved buffers only           | Yes      |
+ * | dst          | The memory where the region data will be stored                        | void*                               |                                    | Yes      |
+ * | region       | Byte offset and size of the region                                     | const BufferRegion &                | Multiples of buffer page size      | Yes      |
+ * | blocking     | Whether or not this is a blocking operation                            | bool                                |                                    | Yes      |
+ */
+void EnqueueReadSubBuffer(
+    CommandQueue &cq,
+    std::variant<std::reference_wrapper<Buffer>, std::shared_ptr<Buffer>> buffer,
+    void *dst,
+    const BufferRegion &region,
+    bool blocking);
+
+/**
+ * Writes a region of a buffer to the device
+ *
+ * Return value: void
+ *
+ * | Argument     | Description                                                            | Type                                | Valid Range                        | Required |
+ * |--------------|------------------------------------------------------------------------|-------------------------------------|------------------------------------|----------|
+ * | cq           | The command queue object which dispatches the command to the hardware  | CommandQueue &                      |                                    | Yes      |
+ * | buffer       | The device buffer we are writing to                                    | Buffer & or std::shared_ptr<Buffer> | Interleaved buffers only           | Yes      |
+ * | src          | The memory holding the region data                                     | HostDataType                        |                                    | Yes      |
+ * | region       | Byte offset and size of the region                                     | const BufferRegion &                | Multiples of buffer page size      | Yes      |
+ * | blocking     | Whether or not this is a blocking operation                            | bool                                |                                    | Yes      |
+ */
+void EnqueueWriteSubBuffer(
+    CommandQueue &cq,
+    std::variant<std::reference_wrapper<Buffer>, std::shared_ptr<Buffer>> buffer,
+    HostDataType src,
+    const BufferRegion &region,
+    bool blocking);
+
 /**
  * Writes a program to the device and launches it
  *
@@ -481,6 +521,24 @@ void EnqueueWriteBuffer(
  */
 void EnqueueProgram(CommandQueue& cq, Program& program, bool blocking);
 
+/**
+ * Writes a sequence of programs to the device and launches them back to back (Jitte extension)
+ *
+ * Programs between barriers are launched together; a barrier is also inserted
+ * before any program that shares cores with a program launched after the previous barrier.
+ *
+ * Return value: void
+ *
+ * | Argument     | Description                                                            | Type                               | Valid Range                        | Required |
+ * |--------------|------------------------------------------------------------------------|------------------------------------|------------------------------------|----------|
+ * | cq           | The command queue object which dispatches the command to the hardware  | CommandQueue &                     |                                    | Yes      |
+ * | programs     | The programs that will be executed in the given order                  | const std::vector<Program *> &     |                                    | Yes      |
+ * | barriers     | Whether program must wait for completion of all preceding programs     | const std::vector<bool> &          | Same size as programs              | Yes      |
+ * | blocking     | Whether or not this is a blocking operation                            | bool                               |                                    | Yes      |
+ */
+void EnqueueProgramChain(
+    CommandQueue& cq, const std::vector<Program*>& programs, const std::vector<bool>& barriers, bool blocking);
+
 /**
  * Blocks until all previously dispatched commands on the device have completed
  *
@@ -118,6 +118,15 @@ struct BufferConfig {
 
 typedef BufferConfig InterleavedBufferConfig;
 
+// Byte range of buffer used by sub-buffer reads and writes
+struct BufferRegion {
+    DeviceAddr offset = 0;
+    DeviceAddr size = 0;
+
+    BufferRegion() = delete;
+    BufferRegion(const DeviceAddr offset, const DeviceAddr size) : offset(offset), size(size) {}
+};
+
 // copied from above instead of using inheritance such that we can use
 // designator constructor
 struct ShardedBufferConfig {
@@ -966,6 +966,8 @@ void Device::end_trace(const uint8_t cq_id, const uint32_t tid) {
     for (int i = 0; i < command_sequence.size_bytes() / sizeof(uint32_t); i++) {
         trace_data.push_back(((uint32_t*)command_sequence.data())[i]);
     }
+    // Trace buffer is committed to trace region as on device;
+    //     emulator replays host copy of recorded data up to terminating command
     Trace::initialize_buffer(this->command_queue(cq_id), this->trace_buffer_pool_[tid]);
     this->DisableAllocs();
 }
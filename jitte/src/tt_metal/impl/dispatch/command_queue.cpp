@@ -9,6 +9,7 @@
 #include <algorithm>  // for copy() and assign()
 #include <iterator>   // for back_inserter
 #include <memory>
+#include <set>
 #include <string>
 #include <utility>
 #include <variant>
@@ -147,8 +148,21 @@ void EnqueueReadBufferCommand::process() {
 
 void EnqueueReadInterleavedBufferCommand::add_prefetch_relay(HugepageDeviceCommand& command) {
     uint32_t padded_page_size = this->buffer.aligned_page_size();
+    // Start page in CQ_PREFETCH_CMD_RELAY_PAGED is 4 bits wide (CQ_PREFETCH_RELAY_PAGED_START_PAGE_MASK)
+    // To handle larger page indices move bank base address up by whole bank rounds (as for kernel binaries);
+    // callers must split off leading pages in banks above the mask (see sub-buffer read)
+    uint32_t base_address = this->buffer.address();
+    uint32_t start_page = this->src_page_index;
+    if (start_page > CQ_PREFETCH_RELAY_PAGED_START_PAGE_MASK) {
+        uint32_t num_banks = this->device->num_banks(this->buffer.buffer_type());
+        base_address += (start_page / num_banks) * padded_page_size;
+        start_page %= num_banks;
+    }
+    TT_FATAL(
+        start_page <= CQ_PREFETCH_RELAY_PAGED_START_PAGE_MASK,
+        "Relay start page {} exceeds command field width", start_page);
     command.add_prefetch_relay_paged(
-        this->buffer.is_dram(), this->src_page_index, this->buffer.address(), padded_page_size, this->pages_to_read);
+        this->buffer.is_dram(), start_page, base_address, padded_page_size, this->pages_to_read);
 }
 
 //
@@ -181,7 +195,8 @@ EnqueueWriteBufferCommand::EnqueueWriteBufferCommand(
     uint32_t bank_base_address,
     uint32_t padded_page_size,
     uint32_t dst_page_index,
-    std::optional<uint32_t> pages_to_write) :
+    std::optional<uint32_t> pages_to_write,
+    uint32_t src_page_index) :
     command_queue_id(command_queue_id),
     noc_index(noc_index),
     cq_manager(cq_manager),
@@ -192,7 +207,8 @@ EnqueueWriteBufferCommand::EnqueueWriteBufferCommand(
     bank_base_address(bank_base_address),
     padded_page_size(padded_page_size),
     dst_page_index(dst_page_index),
-    pages_to_write(pages_to_write.has_value() ? pages_to_write.value() : buffer.num_pages()) {
+    pages_to_write(pages_to_write.has_value() ? pages_to_write.value() : buffer.num_pages()),
+    src_page_index(src_page_index) {
     TT_ASSERT(buffer.is_dram() or buffer.is_l1(), "Trying to write to an invalid buffer");
     this->device = device;
     this->dispatch_core_type = dispatch_core_manager::instance().get_dispatch_core_type(device->id());
@@ -270,7 +286,8 @@ void EnqueueWriteInterleavedBufferCommand::add_buffer_data(HugepageDeviceCommand
         }
     } else {
         uint32_t unpadded_src_offset =
-            (((buffer_addr_offset / this->padded_page_size) * num_banks) + this->dst_page_index) *
+            (((buffer_addr_offset / this->padded_page_size) * num_banks) + this->dst_page_index -
+                this->src_page_index) *
             this->buffer.page_size();
         if (this->buffer.page_size() % this->buffer.alignment() != 0 and
             this->buffer.page_size() != this->buffer.size()) {
@@ -1858,6 +1875,149 @@ void HWCommandQueue::enqueue_write_buffer(Buffer& buffer, const void* src, bool
     }
 }
 
+// Sub-buffer transfers support interleaved buffers and whole pages only
+void HWCommandQueue::enqueue_read_buffer(Buffer& buffer, void* dst, const BufferRegion& region, bool blocking) {
+    ZoneScopedN("HWCommandQueue_read_sub_buffer");
+    TT_FATAL(!this->cq_manager->get_bypass_mode(), "Enqueue Read Buffer cannot be used with tracing");
+    TT_FATAL(!is_sharded(buffer.buffer_layout()), "Sub-buffer reads are not supported for sharded buffers");
+    uint32_t page_size = buffer.page_size();
+    TT_FATAL(
+        region.offset % page_size == 0 and region.size % page_size == 0,
+        "Sub-buffer region must be aligned to buffer page size {}", page_size);
+    TT_FATAL(region.offset + region.size <= buffer.size(), "Sub-buffer region exceeds buffer size");
+    uint32_t pages_to_read = region.size / page_size;
+    if (pages_to_read == 0) {
+        return;
+    }
+    uint32_t src_page_index = region.offset / page_size;
+    uint32_t padded_page_size = buffer.aligned_page_size();
+    uint32_t unpadded_dst_offset = 0;
+
+    // Relay start page can be rebased by whole bank rounds only: with more banks than
+    // CQ_PREFETCH_RELAY_PAGED_START_PAGE_MASK + 1 (L1), leading pages that fall into
+    // banks above the mask are relayed one by one directly from their bank
+    const uint32_t num_banks = this->device->num_banks(buffer.buffer_type());
+    while (pages_to_read > 0 and src_page_index % num_banks > CQ_PREFETCH_RELAY_PAGED_START_PAGE_MASK) {
+        TT_ASSERT(buffer.is_l1(), "Unexpected bank count {} for DRAM buffer", num_banks);
+        uint32_t bank_id = src_page_index % num_banks;
+        uint32_t bank_base_address =
+            buffer.address() + buffer.device()->bank_offset(BufferType::L1, bank_id) +
+            (src_page_index / num_banks) * padded_page_size;
+
+        auto command = EnqueueReadShardedBufferCommand(
+            this->id,
+            this->device,
+            this->noc_index,
+            buffer,
+            dst,
+            this->cq_manager,
+            this->expected_num_workers_completed,
+            buffer.device()->logical_core_from_bank_id(bank_id),
+            bank_base_address,
+            src_page_index,
+            1);
+
+        this->cq_manager->config_read_buffer(
+            padded_page_size,
+            dst,
+            unpadded_dst_offset,
+            1);
+        this->enqueue_command(command, false);
+
+        src_page_index++;
+        pages_to_read--;
+        unpadded_dst_offset += page_size;
+    }
+
+    if (pages_to_read > 0) {
+        auto command = EnqueueReadInterleavedBufferCommand(
+            this->id,
+            this->device,
+            this->noc_index,
+            buffer,
+            dst,
+            this->cq_manager,
+            this->expected_num_workers_completed,
+            src_page_index,
+            pages_to_read);
+
+        this->cq_manager->config_read_buffer(
+            padded_page_size,
+            dst,
+            unpadded_dst_offset,
+            pages_to_read);
+        this->enqueue_command(command, false);
+    }
+
+    if (blocking) {
+        this->finish();
+    }
+}
+
+void HWCommandQueue::enqueue_write_buffer(Buffer& buffer, const void* src, const BufferRegion& region, bool blocking) {
+    ZoneScopedN("HWCommandQueue_write_sub_buffer");
+    TT_FATAL(!this->cq_manager->get_bypass_mode(), "Enqueue Write Buffer cannot be used with tracing");
+    TT_FATAL(!is_sharded(buffer.buffer_layout()), "Sub-buffer writes are not supported for sharded buffers");
+    uint32_t page_size = buffer.page_size();
+    TT_FATAL(
+        region.offset % page_size == 0 and region.size % page_size == 0,
+        "Sub-buffer region must be aligned to buffer page size {}", page_size);
+    TT_FATAL(region.offset + region.size <= buffer.size(), "Sub-buffer region exceeds buffer size");
+
+    uint32_t padded_page_size = buffer.aligned_page_size();
+    CoreType dispatch_core_type = dispatch_core_manager::instance().get_dispatch_core_type(this->device->id());
+    const uint32_t max_prefetch_command_size = dispatch_constants::get(dispatch_core_type).max_prefetch_command_size();
+    uint32_t max_data_sizeB =
+        max_prefetch_command_size - (CQ_PREFETCH_CMD_BARE_MIN_SIZE * 2);  // * 2 to account for issue
+    TT_FATAL(padded_page_size <= max_data_sizeB, "Sub-buffer writes of pages > {} are not supported", max_data_sizeB);
+
+    uint32_t src_page_index = region.offset / page_size;
+    uint32_t total_pages_to_write = region.size / page_size;
+    uint32_t dst_page_index = src_page_index;
+    uint32_t bank_base_address = buffer.address();
+    const uint32_t num_banks = this->device->num_banks(buffer.buffer_type());
+    bool issue_wait = true;  // only stall for the first write of the region
+    while (total_pages_to_write > 0) {
+        uint32_t data_offsetB = CQ_PREFETCH_CMD_BARE_MIN_SIZE;
+        if (issue_wait) {
+            data_offsetB *= 2;
+        }
+        int32_t num_pages_available =
+            (int32_t(max_prefetch_command_size) - int32_t(data_offsetB)) / int32_t(padded_page_size);
+        uint32_t num_pages_to_write = std::min((uint32_t)num_pages_available, total_pages_to_write);
+
+        // Page offset in CQ_DISPATCH_CMD_WRITE_PAGED is uint16_t
+        if (dst_page_index > 0xFFFF) {
+            bank_base_address += (dst_page_index / num_banks) * padded_page_size;
+            dst_page_index %= num_banks;
+        }
+
+        auto command = EnqueueWriteInterleavedBufferCommand(
+            this->id,
+            this->device,
+            this->noc_index,
+            buffer,
+            src,
+            this->cq_manager,
+            issue_wait,
+            this->expected_num_workers_completed,
+            bank_base_address,
+            padded_page_size,
+            dst_page_index,
+            num_pages_to_write,
+            src_page_index);
+        this->enqueue_command(command, false);
+
+        issue_wait = false;
+        total_pages_to_write -= num_pages_to_write;
+        dst_page_index += num_pages_to_write;
+    }
+
+    if (blocking) {
+        this->finish();
+    }
+}
+
 void HWCommandQueue::enqueue_program(Program& program, bool blocking) {
     ZoneScopedN("HWCommandQueue_enqueue_program");
     if (not program.is_finalized()) {
@@ -1923,6 +2083,43 @@ void HWCommandQueue::enqueue_program(Program& program, bool blocking) {
         expected_workers_completed);
 }
 
+// Programs between barriers are loaded into worker L1 together and launched once.
+// Programs sharing a core always need a barrier: they share code, config and CB regions.
+void HWCommandQueue::enqueue_program_chain(
+    const std::vector<Program*>& programs, const std::vector<bool>& barriers, bool blocking) {
+    ZoneScopedN("HWCommandQueue_enqueue_program_chain");
+    TT_FATAL(programs.size() == barriers.size(), "Program chain requires one barrier flag per program");
+    std::set<std::pair<uint32_t, CoreCoord>> pending_cores;
+    this->cq_manager->set_launch_deferred(true);
+    for (size_t i = 0; i < programs.size(); i++) {
+        Program& program = *programs[i];
+        std::vector<std::vector<CoreCoord>> logical_cores = program.logical_cores();
+        bool barrier = barriers[i];
+        for (uint32_t index = 0; index < logical_cores.size() && !barrier; index++) {
+            for (const CoreCoord& core : logical_cores[index]) {
+                if (pending_cores.count({index, core}) != 0) {
+                    barrier = true;
+                    break;
+                }
+            }
+        }
+        if (barrier) {
+            this->cq_manager->flush_launch();
+            pending_cores.clear();
+        }
+        for (uint32_t index = 0; index < logical_cores.size(); index++) {
+            for (const CoreCoord& core : logical_cores[index]) {
+                pending_cores.insert({index, core});
+            }
+        }
+        this->enqueue_program(program, false);
+    }
+    this->cq_manager->set_launch_deferred(false);
+    if (blocking) {
+        this->finish();
+    }
+}
+
 void HWCommandQueue::enqueue_record_event(const std::shared_ptr<Event>& event, bool clear_count) {
     ZoneScopedN("HWCommandQueue_enqueue_record_event");
 
@@ -1946,6 +2143,10 @@ void HWCommandQueue::enqueue_record_event(const std::shared_ptr<Event>& event, b
 void HWCommandQueue::enqueue_wait_for_event(const std::shared_ptr<Event>& sync_event, bool clear_count) {
     ZoneScopedN("HWCommandQueue_enqueue_wait_for_event");
 
+    // Commands of all queues run to completion on submission, so an event
+    // recorded on any queue is already completed here and cross-queue
+    // ordering holds without a wait command.
+
     // Don't enqueue any commands
 
     if (clear_count) {
@@ -1957,14 +2158,10 @@ void HWCommandQueue::enqueue_trace(const uint32_t trace_id, bool blocking) {
     ZoneScopedN("HWCommandQueue_enqueue_trace");
 
     auto trace_inst = this->device->get_trace(trace_id);
-    auto command = EnqueueTraceCommand(
-        this->id, 
-        this->device, 
-        this->cq_manager, 
-        *trace_inst->buffer, 
-        this->expected_num_workers_completed);
-
-    this->enqueue_command(command, false);
+    // replay recorded command sequences without regenerating them
+    this->cq_manager->replay(trace_inst->desc->data);
+    // worker counter is cleared as by original trace command
+    this->expected_num_workers_completed = 0;
 
     // Increment the exepected worker cores counter due to trace programs completions
     this->expected_num_workers_completed += trace_inst->desc->num_completion_worker_cores;
@@ -2216,6 +2413,70 @@ void EnqueueWriteBufferImpl(
     cq.hw_command_queue().enqueue_write_buffer(buffer, src, blocking);
 }
 
+void EnqueueReadSubBuffer(
+    CommandQueue& cq,
+    std::variant<std::reference_wrapper<Buffer>, std::shared_ptr<Buffer>> buffer,
+    void* dst,
+    const BufferRegion& region,
+    bool blocking) {
+    detail::DispatchStateCheck(true);
+    cq.run_command(CommandInterface{
+        .type = EnqueueCommandType::ENQUEUE_READ_BUFFER,
+        .blocking = blocking,
+        .buffer = buffer,
+        .dst = dst,
+        .region = region});
+}
+
+void EnqueueReadSubBufferImpl(
+    CommandQueue& cq,
+    std::variant<std::reference_wrapper<Buffer>, std::shared_ptr<Buffer>> buffer,
+    void* dst,
+    const BufferRegion& region,
+    bool blocking) {
+    Buffer& b = std::holds_alternative<std::shared_ptr<Buffer>>(buffer)
+                    ? *(std::get<std::shared_ptr<Buffer>>(buffer))
+                    : std::get<std::reference_wrapper<Buffer>>(buffer).get();
+    cq.hw_command_queue().enqueue_read_buffer(b, dst, region, blocking);
+}
+
+void EnqueueWriteSubBuffer(
+    CommandQueue& cq,
+    std::variant<std::reference_wrapper<Buffer>, std::shared_ptr<Buffer>> buffer,
+    HostDataType src,
+    const BufferRegion& region,
+    bool blocking) {
+    detail::DispatchStateCheck(true);
+    cq.run_command(CommandInterface{
+        .type = EnqueueCommandType::ENQUEUE_WRITE_BUFFER,
+        .blocking = blocking,
+        .buffer = buffer,
+        .src = src,
+        .region = region});
+}
+
+void EnqueueWriteSubBufferImpl(
+    CommandQueue& cq,
+    std::variant<std::reference_wrapper<Buffer>, std::shared_ptr<Buffer>> buffer,
+    HostDataType src,
+    const BufferRegion& region,
+    bool blocking) {
+    Buffer& b = std::holds_alternative<std::shared_ptr<Buffer>>(buffer)
+                    ? *(std::get<std::shared_ptr<Buffer>>(buffer))
+                    : std::get<std::reference_wrapper<Buffer>>(buffer).get();
+    const void* data = std::visit(
+        [](auto&& d) -> const void* {
+            using T = std::decay_t<decltype(d)>;
+            if constexpr (std::is_same_v<T, const void*>) {
+                return d;
+            } else {
+                return d->data();
+            }
+        },
+        src);
+    cq.hw_command_queue().enqueue_write_buffer(b, data, region, blocking);
+}
+
 void EnqueueProgram(
     CommandQueue& cq, Program& program, bool blocking) {
     detail::DispatchStateCheck(true);
@@ -2238,6 +2499,32 @@ void EnqueueProgramImpl(
 
 }
 
+void EnqueueProgramChain(
+    CommandQueue& cq, const std::vector<Program*>& programs, const std::vector<bool>& barriers, bool blocking) {
+    detail::DispatchStateCheck(true);
+    cq.run_command(CommandInterface{
+        .type = EnqueueCommandType::ENQUEUE_PROGRAM_CHAIN,
+        .blocking = blocking,
+        .programs = programs,
+        .barriers = barriers});
+}
+
+void EnqueueProgramChainImpl(
+    CommandQueue& cq, const std::vector<Program*>& programs, const std::vector<bool>& barriers, bool blocking) {
+    ZoneScoped;
+
+    Device* device = cq.device();
+    for (Program* program : programs) {
+        detail::CompileProgram(device, *program);
+        program->allocate_circular_buffers();
+        detail::ValidateCircularBufferRegion(*program, device);
+    }
+    cq.hw_command_queue().enqueue_program_chain(programs, barriers, blocking);
+    for (Program* program : programs) {
+        program->release_buffers();
+    }
+}
+
 // NOTE: Simplified event handling (all events are completed immediately)
 
 void EnqueueRecordEvent(CommandQueue& cq, const std::shared_ptr<Event>& event) {
@@ -2350,13 +2637,23 @@ void CommandQueue::run_command_impl(const CommandInterface& command) {
             TT_ASSERT(command.dst.has_value(), "Must provide a dst!");
             TT_ASSERT(command.buffer.has_value(), "Must provide a buffer!");
             TT_ASSERT(command.blocking.has_value(), "Must specify blocking value!");
-            EnqueueReadBufferImpl(*this, command.buffer.value(), command.dst.value(), command.blocking.value());
+            if (command.region.has_value()) {
+                EnqueueReadSubBufferImpl(
+                    *this, command.buffer.value(), command.dst.value(), command.region.value(), command.blocking.value());
+            } else {
+                EnqueueReadBufferImpl(*this, command.buffer.value(), command.dst.value(), command.blocking.value());
+            }
             break;
         case EnqueueCommandType::ENQUEUE_WRITE_BUFFER:
             TT_ASSERT(command.src.has_value(), "Must provide a src!");
             TT_ASSERT(command.buffer.has_value(), "Must provide a buffer!");
             TT_ASSERT(command.blocking.has_value(), "Must specify blocking value!");
-            EnqueueWriteBufferImpl(*this, command.buffer.value(), command.src.value(), command.blocking.value());
+            if (command.region.has_value()) {
+                EnqueueWriteSubBufferImpl(
+                    *this, command.buffer.value(), command.src.value(), command.region.value(), command.blocking.value());
+            } else {
+                EnqueueWriteBufferImpl(*this, command.buffer.value(), command.src.value(), command.blocking.value());
+            }
             break;
         case EnqueueCommandType::ALLOCATE_BUFFER:
             TT_ASSERT(command.alloc_md.has_value(), "Must provide buffer allocation metdata!");
@@ -2385,6 +2682,13 @@ void CommandQueue::run_command_impl(const CommandInterface& command) {
             TT_ASSERT(command.blocking.has_value(), "Must specify blocking value!");
             EnqueueProgramImpl(*this, *command.program, command.blocking.value());
             break;
+        case EnqueueCommandType::ENQUEUE_PROGRAM_CHAIN:
+            TT_ASSERT(command.programs.has_value(), "Must provide programs!");
+            TT_ASSERT(command.barriers.has_value(), "Must provide barriers!");
+            TT_ASSERT(command.blocking.has_value(), "Must specify blocking value!");
+            EnqueueProgramChainImpl(
+                *this, command.programs.value(), command.barriers.value(), command.blocking.value());
+            break;
         case EnqueueCommandType::ENQUEUE_TRACE:
             EnqueueTraceImpl(*this, command.trace_id.value(), command.blocking.value());
             break;
@@ -2412,6 +2716,7 @@ std::ostream& operator<<(std::ostream& os, EnqueueCommandType const& type) {
         case EnqueueCommandType::ENQUEUE_READ_BUFFER: os << "ENQUEUE_READ_BUFFER"; break;
         case EnqueueCommandType::ENQUEUE_WRITE_BUFFER: os << "ENQUEUE_WRITE_BUFFER"; break;
         case EnqueueCommandType::ENQUEUE_PROGRAM: os << "ENQUEUE_PROGRAM"; break;
+        case EnqueueCommandType::ENQUEUE_PROGRAM_CHAIN: os << "ENQUEUE_PROGRAM_CHAIN"; break;
         case EnqueueCommandType::ENQUEUE_TRACE: os << "ENQUEUE_TRACE"; break;
         case EnqueueCommandType::ENQUEUE_RECORD_EVENT: os << "ENQUEUE_RECORD_EVENT"; break;
         case EnqueueCommandType::ENQUEUE_WAIT_FOR_EVENT: os << "ENQUEUE_WAIT_FOR_EVENT"; break;
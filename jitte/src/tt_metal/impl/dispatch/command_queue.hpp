@@ -34,6 +34,7 @@ enum class EnqueueCommandType {
     ADD_BUFFER_TO_PROGRAM,
     SET_RUNTIME_ARGS,
     ENQUEUE_PROGRAM,
+    ENQUEUE_PROGRAM_CHAIN,
     ENQUEUE_TRACE,
     ENQUEUE_RECORD_EVENT,
     ENQUEUE_WAIT_FOR_EVENT,
@@ -171,6 +172,8 @@ protected:
     uint32_t padded_page_size;
     uint32_t dst_page_index;
     uint32_t pages_to_write;
+    // buffer page corresponding to start of source data
+    uint32_t src_page_index;
     bool issue_wait;
 
 public:
@@ -186,7 +189,8 @@ public:
         uint32_t bank_base_address,
         uint32_t padded_page_size,
         uint32_t dst_page_index = 0,
-        std::optional<uint32_t> pages_to_write = std::nullopt);
+        std::optional<uint32_t> pages_to_write = std::nullopt,
+        uint32_t src_page_index = 0);
 
     void process();
 
@@ -213,7 +217,8 @@ public:
         uint32_t bank_base_address,
         uint32_t padded_page_size,
         uint32_t dst_page_index = 0,
-        std::optional<uint32_t> pages_to_write = std::nullopt) :
+        std::optional<uint32_t> pages_to_write = std::nullopt,
+        uint32_t src_page_index = 0) :
         EnqueueWriteBufferCommand(
             command_queue_id,
             device,
@@ -226,7 +231,8 @@ public:
             bank_base_address,
             padded_page_size,
             dst_page_index,
-            pages_to_write) {
+            pages_to_write,
+            src_page_index) {
         ;
     }
 };
@@ -460,10 +466,14 @@ private:
 
     void enqueue_read_buffer(std::shared_ptr<Buffer>& buffer, void* dst, bool blocking);
     void enqueue_read_buffer(Buffer& buffer, void* dst, bool blocking);
+    void enqueue_read_buffer(Buffer& buffer, void* dst, const BufferRegion& region, bool blocking);
     void enqueue_write_buffer(
         std::variant<std::reference_wrapper<Buffer>, std::shared_ptr<Buffer>> buffer, HostDataType src, bool blocking);
     void enqueue_write_buffer(Buffer& buffer, const void* src, bool blocking);
+    void enqueue_write_buffer(Buffer& buffer, const void* src, const BufferRegion& region, bool blocking);
     void enqueue_program(Program& program, bool blocking);
+    void enqueue_program_chain(
+        const std::vector<Program*>& programs, const std::vector<bool>& barriers, bool blocking);
     void enqueue_record_event(const std::shared_ptr<Event>& event, bool clear_count = false);
     void enqueue_wait_for_event(const std::shared_ptr<Event>& sync_event, bool clear_count = false);
     void enqueue_trace(const uint32_t trace_id, bool blocking);
@@ -471,6 +481,8 @@ private:
     void terminate();
 
     friend void EnqueueTraceImpl(CommandQueue& cq, uint32_t trace_id, bool blocking);
+    friend void EnqueueProgramChainImpl(
+        CommandQueue& cq, const std::vector<Program*>& programs, const std::vector<bool>& barriers, bool blocking);
     friend void EnqueueProgramImpl(
         CommandQueue& cq,
         Program& program,
@@ -485,6 +497,18 @@ private:
         std::variant<std::reference_wrapper<Buffer>, std::shared_ptr<Buffer>> buffer,
         HostDataType src,
         bool blocking);
+    friend void EnqueueReadSubBufferImpl(
+        CommandQueue& cq,
+        std::variant<std::reference_wrapper<Buffer>, std::shared_ptr<Buffer>> buffer,
+        void* dst,
+        const BufferRegion& region,
+        bool blocking);
+    friend void EnqueueWriteSubBufferImpl(
+        CommandQueue& cq,
+        std::variant<std::reference_wrapper<Buffer>, std::shared_ptr<Buffer>> buffer,
+        HostDataType src,
+        const BufferRegion& region,
+        bool blocking);
     friend void EnqueueAllocateBufferImpl(AllocBufferMetadata alloc_md);
     friend void EnqueueDeallocateBufferImpl(AllocBufferMetadata alloc_md);
     friend void EnqueueGetBufferAddrImpl(void* dst_buf_addr, const Buffer* buffer);
@@ -502,11 +526,14 @@ struct CommandInterface {
     std::optional<bool> blocking;
     std::optional<std::variant<std::reference_wrapper<Buffer>, std::shared_ptr<Buffer>>> buffer;
     Program* program;
+    std::optional<std::vector<Program*>> programs;
+    std::optional<std::vector<bool>> barriers;
     std::optional<AllocBufferMetadata> alloc_md;
     std::optional<RuntimeArgsMetadata> runtime_args_md;
     std::optional<const Buffer*> shadow_buffer;
     std::optional<HostDataType> src;
     std::optional<void*> dst;
+    std::optional<BufferRegion> region;
     std::optional<std::shared_ptr<Event>> event;
     std::optional<uint32_t> trace_id;
 };
@@ -7,6 +7,7 @@
 
 #include "tt_metal/third_party/umd/device/command_processor.h"
 #include "tt_metal/llrt/hal.hpp"
+#include "tt_metal/impl/dispatch/cq_commands.hpp"
 #include "tt_metal/impl/dispatch/command_queue_manager.hpp"
 
 namespace tt {
@@ -14,6 +15,19 @@ namespace tt_metal {
 
 // Replaces original "command_queue_interface" mechanics
 
+namespace {
+
+// In bypass (trace capture) mode, command sequences and kernel launches
+// are recorded as tagged entries instead of being run:
+//     TRACE_RUN_COMMANDS, <size in bytes>, <command words>
+//     TRACE_LAUNCH_KERNELS
+// Trace buffer ends with prefetch "exec_buf_end" command followed by padding;
+// tag values differ from its command ID held in low byte of first word.
+constexpr uint32_t TRACE_RUN_COMMANDS = 1;
+constexpr uint32_t TRACE_LAUNCH_KERNELS = 2;
+
+} // namespace
+
 //
 //    CQManager
 //
@@ -21,6 +35,8 @@ namespace tt_metal {
 CQManager::CQManager(CommandProcessor *command_processor, uint32_t num_hw_cqs):
         m_command_processor(command_processor),
         m_bypass_enable(false),
+        m_launch_deferred(false),
+        m_launch_pending(false),
         m_next_event_id(num_hw_cqs, 0) { 
     m_data.reserve(128 * 1024);        
     init_config_buffer_mgr();
@@ -40,6 +56,17 @@ void CQManager::write(const void *data, uint32_t size, uint32_t write_ptr) {
 
 void CQManager::push(uint32_t size) {
     assert(size <= m_data.size());
+    if (m_bypass_enable) {
+        assert(size % sizeof(uint32_t) == 0);
+        uint32_t count = size / sizeof(uint32_t);
+        size_t pos = m_bypass_buffer.size();
+        m_bypass_buffer.resize(pos + 2 + count);
+        m_bypass_buffer[pos] = TRACE_RUN_COMMANDS;
+        m_bypass_buffer[pos + 1] = size;
+        memcpy(m_bypass_buffer.data() + pos + 2, m_data.data(), size);
+        m_data.clear();
+        return;
+    }
     uint8_t *data = reinterpret_cast<uint8_t *>(m_data.data());
     m_command_processor->run_commands(data, size);
     m_data.clear();
@@ -58,13 +85,66 @@ void CQManager::config_read_buffer(
 }
 
 void CQManager::launch_kernels() {
+    if (m_launch_deferred) {
+        m_launch_pending = true;
+        return;
+    }
+    if (m_bypass_enable) {
+        m_bypass_buffer.push_back(TRACE_LAUNCH_KERNELS);
+        return;
+    }
     m_command_processor->launch_kernels();
 }
 
+void CQManager::set_launch_deferred(bool enable) {
+    if (!enable) {
+        flush_launch();
+    }
+    m_launch_deferred = enable;
+}
+
+void CQManager::flush_launch() {
+    if (!m_launch_pending) {
+        return;
+    }
+    m_launch_pending = false;
+    bool deferred = m_launch_deferred;
+    m_launch_deferred = false;
+    launch_kernels();
+    m_launch_deferred = deferred;
+}
+
 std::vector<uint32_t> CQManager::get_bypass_data() { 
     return std::move(m_bypass_buffer); 
 }
 
+void CQManager::replay(const std::vector<uint32_t> &data) {
+    assert(!m_bypass_enable);
+    size_t pos = 0;
+    size_t end = data.size();
+    while (pos < end) {
+        uint32_t tag = data[pos];
+        if ((tag & 0xff) == CQ_PREFETCH_CMD_EXEC_BUF_END) {
+            break;
+        }
+        if (tag == TRACE_RUN_COMMANDS) {
+            assert(pos + 2 <= end);
+            uint32_t size = data[pos + 1];
+            uint32_t count = size / sizeof(uint32_t);
+            assert(pos + 2 + count <= end);
+            const uint8_t *cmds = reinterpret_cast<const uint8_t *>(data.data() + pos + 2);
+            m_command_processor->run_commands(cmds, size);
+            pos += 2 + count;
+        } else if (tag == TRACE_LAUNCH_KERNELS) {
+            m_command_processor->launch_kernels();
+            pos++;
+        } else {
+            assert(false);
+            break;
+        }
+    }
+}
+
 void CQManager::reset_event_id(uint32_t cq_id) {
     m_next_event_id[cq_id] = 0;
 }
@@ -23,6 +23,9 @@ public:
         uint32_t dst_offset,
         uint32_t num_pages_read);
     void launch_kernels();
+    // while deferred, kernel launches are merged until 'flush_launch'
+    void set_launch_deferred(bool enable);
+    void flush_launch();
     void set_bypass_mode(bool enable) {
         m_bypass_enable = enable;
     }
@@ -30,6 +33,8 @@ public:
         return m_bypass_enable;
     }
     std::vector<uint32_t> get_bypass_data();
+    // runs commands and kernel launches recorded in bypass mode
+    void replay(const std::vector<uint32_t> &data);
     void reset_event_id(uint32_t cq_id);
     uint32_t get_next_event(uint32_t cq_id);
     WorkerConfigBufferMgr &get_config_buffer_mgr() { 
@@ -41,6 +46,8 @@ private:
     CommandProcessor *m_command_processor;
     std::vector<char> m_data;
     bool m_bypass_enable;
+    bool m_launch_deferred;
+    bool m_launch_pending;
     std::vector<uint32_t> m_bypass_buffer;
     std::vector<uint32_t> m_next_event_id;
     WorkerConfigBufferMgr m_config_buffer_mgr;
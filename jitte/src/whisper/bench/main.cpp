@@ -0,0 +1,702 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <string>
+#include <vector>
+#include <memory>
+#include <chrono>
+#include <exception>
+
+#include "riscv/riscv32.hpp"
+
+//
+//    Instruction throughput of FULL and LEAN RV32 harts
+//
+//    Each kernel is a hand-encoded loop ending with 'ret'; both harts
+//    run the same code on the same initial memory and must produce
+//    identical results. Kernels are limited to RV32IMC as this is
+//    the ISA configured for the full hart (MISA reset value).
+//
+//    The FP kernel runs on the lean hart only; its results are
+//    checked against the same operations evaluated on the host.
+//
+
+using namespace riscv::core;
+
+namespace {
+
+constexpr uint32_t MEM_SIZE = 1024 * 1024;
+constexpr uint32_t CODE_BASE = 0;
+constexpr uint32_t CODE_SIZE = 64 * 1024;
+constexpr uint32_t LOCAL_BASE = 64 * 1024;
+constexpr uint32_t LOCAL_SIZE = 64 * 1024;
+constexpr uint32_t DATA_BASE = 128 * 1024;
+constexpr uint32_t DATA_SIZE = 64 * 1024;
+
+// register numbers
+enum {
+    ZERO = 0,
+    RA = 1,
+    SP = 2,
+    T0 = 5,
+    T1 = 6,
+    T2 = 7,
+    S0 = 8,
+    S1 = 9,
+    A0 = 10,
+    A1 = 11,
+    A2 = 12,
+    A3 = 13,
+    A4 = 14,
+    A5 = 15
+};
+
+// FP register numbers
+enum {
+    F0 = 0,
+    F1 = 1,
+    F2 = 2,
+    F3 = 3
+};
+
+// FP rounding modes
+enum {
+    RNE = 0,
+    RTZ = 1
+};
+
+class Asm {
+public:
+    Asm() { }
+public:
+    uint32_t pc() {
+        return uint32_t(m_code.size());
+    }
+    const std::vector<uint8_t> &code() {
+        return m_code;
+    }
+    void r_type(uint32_t f7, int rs2, int rs1, uint32_t f3, int rd, uint32_t op) {
+        emit32((f7 << 25) | (rs2 << 20) | (rs1 << 15) | (f3 << 12) | (rd << 7) | op);
+    }
+    void i_type(int32_t imm, int rs1, uint32_t f3, int rd, uint32_t op) {
+        emit32((uint32_t(imm & 0xfff) << 20) | (rs1 << 15) | (f3 << 12) | (rd << 7) | op);
+    }
+    void s_type(int32_t imm, int rs2, int rs1, uint32_t f3, uint32_t op) {
+        uint32_t u = uint32_t(imm);
+        emit32(
+            (((u >> 5) & 0x7f) << 25) | (rs2 << 20) | (rs1 << 15) |
+            (f3 << 12) | ((u & 0x1f) << 7) | op);
+    }
+    void add(int rd, int rs1, int rs2) {
+        r_type(0x00, rs2, rs1, 0, rd, 0x33);
+    }
+    void sub(int rd, int rs1, int rs2) {
+        r_type(0x20, rs2, rs1, 0, rd, 0x33);
+    }
+    void xor_(int rd, int rs1, int rs2) {
+        r_type(0x00, rs2, rs1, 4, rd, 0x33);
+    }
+    void or_(int rd, int rs1, int rs2) {
+        r_type(0x00, rs2, rs1, 6, rd, 0x33);
+    }
+    void mul(int rd, int rs1, int rs2) {
+        r_type(0x01, rs2, rs1, 0, rd, 0x33);
+    }
+    void mulhu(int rd, int rs1, int rs2) {
+        r_type(0x01, rs2, rs1, 3, rd, 0x33);
+    }
+    void divu(int rd, int rs1, int rs2) {
+        r_type(0x01, rs2, rs1, 5, rd, 0x33);
+    }
+    void rem(int rd, int rs1, int rs2) {
+        r_type(0x01, rs2, rs1, 6, rd, 0x33);
+    }
+    void addi(int rd, int rs1, int32_t imm) {
+        i_type(imm, rs1, 0, rd, 0x13);
+    }
+    void slli(int rd, int rs1, int shamt) {
+        i_type(shamt, rs1, 1, rd, 0x13);
+    }
+    void srli(int rd, int rs1, int shamt) {
+        i_type(shamt, rs1, 5, rd, 0x13);
+    }
+    void lui(int rd, uint32_t imm20) {
+        emit32((imm20 << 12) | (rd << 7) | 0x37);
+    }
+    void li(int rd, uint32_t value) {
+        uint32_t lo = value & 0xfff;
+        uint32_t hi = (value >> 12) + ((lo & 0x800) != 0 ? 1 : 0);
+        lui(rd, hi & 0xfffff);
+        addi(rd, rd, int32_t(lo << 20) >> 20);
+    }
+    void lw(int rd, int rs1, int32_t imm) {
+        i_type(imm, rs1, 2, rd, 0x03);
+    }
+    void lbu(int rd, int rs1, int32_t imm) {
+        i_type(imm, rs1, 4, rd, 0x03);
+    }
+    void sw(int rs2, int rs1, int32_t imm) {
+        s_type(imm, rs2, rs1, 2, 0x23);
+    }
+    void sb(int rs2, int rs1, int32_t imm) {
+        s_type(imm, rs2, rs1, 0, 0x23);
+    }
+    void bne(int rs1, int rs2, uint32_t target) {
+        uint32_t u = target - pc();
+        emit32(
+            (((u >> 12) & 0x1) << 31) | (((u >> 5) & 0x3f) << 25) |
+            (rs2 << 20) | (rs1 << 15) | (1 << 12) |
+            (((u >> 1) & 0xf) << 8) | (((u >> 11) & 0x1) << 7) | 0x63);
+    }
+    void blt(int rs1, int rs2, uint32_t target) {
+        uint32_t u = target - pc();
+        emit32(
+            (((u >> 12) & 0x1) << 31) | (((u >> 5) & 0x3f) << 25) |
+            (rs2 << 20) | (rs1 << 15) | (4 << 12) |
+            (((u >> 1) & 0xf) << 8) | (((u >> 11) & 0x1) << 7) | 0x63);
+    }
+    void jal(int rd, uint32_t target) {
+        uint32_t u = target - pc();
+        emit32(
+            (((u >> 20) & 0x1) << 31) | (((u >> 1) & 0x3ff) << 21) |
+            (((u >> 11) & 0x1) << 20) | (((u >> 12) & 0xff) << 12) |
+            (rd << 7) | 0x6f);
+    }
+    void ret() {
+        i_type(0, RA, 0, ZERO, 0x67);
+    }
+    // single precision FP
+    void flw(int rd, int rs1, int32_t imm) {
+        i_type(imm, rs1, 2, rd, 0x07);
+    }
+    void fsw(int rs2, int rs1, int32_t imm) {
+        s_type(imm, rs2, rs1, 2, 0x27);
+    }
+    void fadd_s(int rd, int rs1, int rs2) {
+        r_type(0x00, rs2, rs1, RNE, rd, 0x53);
+    }
+    void fsub_s(int rd, int rs1, int rs2) {
+        r_type(0x04, rs2, rs1, RNE, rd, 0x53);
+    }
+    void fmul_s(int rd, int rs1, int rs2) {
+        r_type(0x08, rs2, rs1, RNE, rd, 0x53);
+    }
+    void fdiv_s(int rd, int rs1, int rs2) {
+        r_type(0x0c, rs2, rs1, RNE, rd, 0x53);
+    }
+    void fsqrt_s(int rd, int rs1) {
+        r_type(0x2c, 0, rs1, RNE, rd, 0x53);
+    }
+    void fsgnjn_s(int rd, int rs1, int rs2) {
+        r_type(0x10, rs2, rs1, 1, rd, 0x53);
+    }
+    void fmin_s(int rd, int rs1, int rs2) {
+        r_type(0x14, rs2, rs1, 0, rd, 0x53);
+    }
+    void fmax_s(int rd, int rs1, int rs2) {
+        r_type(0x14, rs2, rs1, 1, rd, 0x53);
+    }
+    void fcvt_w_s(int rd, int rs1, uint32_t rm) {
+        r_type(0x60, 0, rs1, rm, rd, 0x53);
+    }
+    void fcvt_wu_s(int rd, int rs1, uint32_t rm) {
+        r_type(0x60, 1, rs1, rm, rd, 0x53);
+    }
+    void fcvt_s_w(int rd, int rs1) {
+        r_type(0x68, 0, rs1, RNE, rd, 0x53);
+    }
+    void fclass_s(int rd, int rs1) {
+        r_type(0x70, 0, rs1, 1, rd, 0x53);
+    }
+    void feq_s(int rd, int rs1, int rs2) {
+        r_type(0x50, rs2, rs1, 2, rd, 0x53);
+    }
+    void flt_s(int rd, int rs1, int rs2) {
+        r_type(0x50, rs2, rs1, 1, rd, 0x53);
+    }
+    void fle_s(int rd, int rs1, int rs2) {
+        r_type(0x50, rs2, rs1, 0, rd, 0x53);
+    }
+    // rd = rs1 * rs2 + rs3
+    void fmadd_s(int rd, int rs1, int rs2, int rs3) {
+        emit32((rs3 << 27) | (rs2 << 20) | (rs1 << 15) | (RNE << 12) | (rd << 7) | 0x43);
+    }
+    // rd = -(rs1 * rs2) + rs3
+    void fnmsub_s(int rd, int rs1, int rs2, int rs3) {
+        emit32((rs3 << 27) | (rs2 << 20) | (rs1 << 15) | (RNE << 12) | (rd << 7) | 0x4b);
+    }
+    // compressed
+    void c_addi(int rd, int32_t imm) {
+        uint32_t u = uint32_t(imm);
+        emit16((0 << 13) | (((u >> 5) & 1) << 12) | (rd << 7) | ((u & 0x1f) << 2) | 0x1);
+    }
+    void c_add(int rd, int rs2) {
+        emit16((4 << 13) | (1 << 12) | (rd << 7) | (rs2 << 2) | 0x2);
+    }
+    void c_mv(int rd, int rs2) {
+        emit16((4 << 13) | (0 << 12) | (rd << 7) | (rs2 << 2) | 0x2);
+    }
+    void c_slli(int rd, int shamt) {
+        emit16((0 << 13) | (rd << 7) | (shamt << 2) | 0x2);
+    }
+    // rd, rs2 in x8..x15
+    void c_xor(int rd, int rs2) {
+        emit16((4 << 13) | (3 << 10) | ((rd - 8) << 7) | (1 << 5) | ((rs2 - 8) << 2) | 0x1);
+    }
+    void c_srli(int rd, int shamt) {
+        emit16((4 << 13) | (0 << 10) | ((rd - 8) << 7) | (shamt << 2) | 0x1);
+    }
+    void c_lw(int rd, int rs1, uint32_t off) {
+        emit16(
+            (2 << 13) | (((off >> 3) & 0x7) << 10) | ((rs1 - 8) << 7) |
+            (((off >> 2) & 1) << 6) | (((off >> 6) & 1) << 5) | ((rd - 8) << 2) | 0x0);
+    }
+    void c_sw(int rs2, int rs1, uint32_t off) {
+        emit16(
+            (6 << 13) | (((off >> 3) & 0x7) << 10) | ((rs1 - 8) << 7) |
+            (((off >> 2) & 1) << 6) | (((off >> 6) & 1) << 5) | ((rs2 - 8) << 2) | 0x0);
+    }
+    void c_bnez(int rs1, uint32_t target) {
+        uint32_t u = target - pc();
+        emit16(
+            (7 << 13) | (((u >> 8) & 1) << 12) | (((u >> 3) & 0x3) << 10) |
+            ((rs1 - 8) << 7) | (((u >> 6) & 0x3) << 5) | (((u >> 1) & 0x3) << 3) |
+            (((u >> 5) & 1) << 2) | 0x1);
+    }
+private:
+    void emit16(uint32_t v) {
+        m_code.push_back(uint8_t(v));
+        m_code.push_back(uint8_t(v >> 8));
+    }
+    void emit32(uint32_t v) {
+        emit16(v & 0xffff);
+        emit16(v >> 16);
+    }
+private:
+    std::vector<uint8_t> m_code;
+};
+
+struct Kernel {
+    std::string name;
+    std::vector<uint8_t> code;
+};
+
+// integer ALU: 8 instructions per iteration
+Kernel make_alu(int iters) {
+    Asm a;
+    a.li(T0, uint32_t(iters));
+    a.li(A0, 0x12345678);
+    a.li(A1, 0x9abcdef0);
+    uint32_t loop = a.pc();
+    a.add(A2, A0, A1);
+    a.xor_(A3, A2, A0);
+    a.slli(A4, A3, 3);
+    a.srli(A5, A3, 7);
+    a.or_(A0, A4, A5);
+    a.sub(A1, A1, A2);
+    a.addi(T0, T0, -1);
+    a.bne(T0, ZERO, loop);
+    a.ret();
+    return {"alu", a.code()};
+}
+
+// compressed ALU: same work as 'alu' in 16-bit encodings
+Kernel make_rvc(int iters) {
+    Asm a;
+    a.li(S0, uint32_t(iters));
+    a.li(A0, 0x12345678);
+    a.li(A1, 0x9abcdef0);
+    uint32_t loop = a.pc();
+    a.c_mv(A2, A0);
+    a.c_add(A2, A1);
+    a.c_mv(A3, A2);
+    a.c_xor(A3, A0);
+    a.c_mv(A4, A3);
+    a.c_slli(A4, 3);
+    a.c_srli(A3, 7);
+    a.c_mv(A0, A4);
+    a.c_add(A0, A3);
+    a.c_add(A1, A2);
+    a.c_addi(S0, -1);
+    a.c_bnez(S0, loop);
+    a.ret();
+    return {"rvc", a.code()};
+}
+
+// load / store: streaming read-modify-write over data buffer
+Kernel make_mem(int iters) {
+    Asm a;
+    constexpr int N = 1024;
+    a.li(T0, uint32_t(iters / N));
+    uint32_t outer = a.pc();
+    a.li(S0, DATA_BASE);
+    a.li(T1, uint32_t(N));
+    uint32_t inner = a.pc();
+    a.lw(A0, S0, 0);
+    a.lbu(A1, S0, 4);
+    a.add(A0, A0, A1);
+    a.sw(A0, S0, 0);
+    a.sb(A0, S0, 5);
+    a.c_lw(A2, S0, 8);
+    a.c_addi(A2, 1);
+    a.c_sw(A2, S0, 8);
+    a.addi(S0, S0, 4);
+    a.addi(T1, T1, -1);
+    a.bne(T1, ZERO, inner);
+    a.addi(T0, T0, -1);
+    a.bne(T0, ZERO, outer);
+    a.ret();
+    return {"mem", a.code()};
+}
+
+// multiply / divide
+Kernel make_muldiv(int iters) {
+    Asm a;
+    a.li(T0, uint32_t(iters));
+    a.li(A0, 0x12345);
+    a.li(A1, 0x6789);
+    a.li(T2, 0x7fff);
+    uint32_t loop = a.pc();
+    a.mul(A2, A0, A1);
+    a.mulhu(A3, A2, A0);
+    a.divu(A4, A2, T2);
+    a.rem(A5, A2, T0);
+    a.add(A0, A4, A3);
+    a.addi(A1, A5, 17);
+    a.addi(T0, T0, -1);
+    a.bne(T0, ZERO, loop);
+    a.ret();
+    return {"muldiv", a.code()};
+}
+
+// branches and calls
+Kernel make_branch(int iters) {
+    Asm a;
+    a.li(T0, uint32_t(iters));
+    a.li(T1, uint32_t(iters / 2));
+    a.li(A0, 0);
+    a.li(A1, 0);
+    // skip leaf function (2 instructions)
+    a.jal(ZERO, a.pc() + 12);
+    // leaf function: a1 += a0, return via t2
+    uint32_t func = a.pc();
+    a.add(A1, A1, A0);
+    a.i_type(0, T2, 0, ZERO, 0x67);
+    uint32_t loop = a.pc();
+    a.addi(A0, A0, 1);
+    // taken in first half of iterations: skip next instruction
+    a.blt(A0, T1, loop + 12);
+    a.addi(A1, A1, 3);
+    a.jal(T2, func);
+    a.addi(T0, T0, -1);
+    a.bne(T0, ZERO, loop);
+    a.ret();
+    return {"branch", a.code()};
+}
+
+// single precision FP: FP_COUNT input triples (x, y, z) at DATA_BASE,
+// FP_OUT_WORDS results per triple at FP_OUT_BASE; initial data words
+// reinterpreted as floats cover NaN, infinity and subnormal operands
+constexpr uint32_t FP_COUNT = 512;
+constexpr uint32_t FP_OUT_BASE = DATA_BASE + 8 * 1024;
+constexpr uint32_t FP_OUT_WORDS = 16;
+
+Kernel make_fp(int iters) {
+    Asm a;
+    int outer_iters = iters / int(FP_COUNT);
+    a.li(T0, uint32_t(outer_iters > 0 ? outer_iters : 1));
+    uint32_t outer = a.pc();
+    a.li(S0, DATA_BASE);
+    a.li(S1, FP_OUT_BASE);
+    a.li(T1, FP_COUNT);
+    uint32_t inner = a.pc();
+    a.flw(F0, S0, 0);
+    a.flw(F1, S0, 4);
+    a.flw(F2, S0, 8);
+    a.fadd_s(F3, F0, F1);
+    a.fsw(F3, S1, 0);
+    a.fsub_s(F3, F0, F1);
+    a.fsw(F3, S1, 4);
+    a.fmul_s(F3, F0, F1);
+    a.fsw(F3, S1, 8);
+    a.fdiv_s(F3, F0, F1);
+    a.fsw(F3, S1, 12);
+    a.fsqrt_s(F3, F0);
+    a.fsw(F3, S1, 16);
+    a.fmadd_s(F3, F0, F1, F2);
+    a.fsw(F3, S1, 20);
+    a.fmin_s(F3, F0, F1);
+    a.fsw(F3, S1, 24);
+    a.fmax_s(F3, F0, F1);
+    a.fsw(F3, S1, 28);
+    a.fcvt_w_s(A0, F0, RTZ);
+    a.sw(A0, S1, 32);
+    a.fcvt_w_s(A0, F0, RNE);
+    a.sw(A0, S1, 36);
+    a.lw(A0, S0, 0);
+    a.fcvt_s_w(F3, A0);
+    a.fsw(F3, S1, 40);
+    a.feq_s(A0, F0, F1);
+    a.flt_s(A1, F0, F1);
+    a.slli(A1, A1, 1);
+    a.or_(A0, A0, A1);
+    a.fle_s(A1, F0, F1);
+    a.slli(A1, A1, 2);
+    a.or_(A0, A0, A1);
+    a.sw(A0, S1, 44);
+    a.fclass_s(A0, F0);
+    a.sw(A0, S1, 48);
+    a.fsgnjn_s(F3, F0, F1);
+    a.fsw(F3, S1, 52);
+    a.fcvt_wu_s(A0, F0, RTZ);
+    a.sw(A0, S1, 56);
+    a.fnmsub_s(F3, F0, F1, F2);
+    a.fsw(F3, S1, 60);
+    a.addi(S0, S0, 12);
+    a.addi(S1, S1, int32_t(FP_OUT_WORDS * 4));
+    a.addi(T1, T1, -1);
+    a.bne(T1, ZERO, inner);
+    a.addi(T0, T0, -1);
+    a.bne(T0, ZERO, outer);
+    a.ret();
+    return {"fp", a.code()};
+}
+
+float to_float(uint32_t v) {
+    float f;
+    memcpy(&f, &v, sizeof(f));
+    return f;
+}
+
+uint32_t to_bits(float f) {
+    uint32_t v;
+    memcpy(&v, &f, sizeof(v));
+    return v;
+}
+
+// arithmetic results: any NaN becomes canonical NaN
+uint32_t ref_canon(float f) {
+    return std::isnan(f) ? 0x7fc00000 : to_bits(f);
+}
+
+uint32_t ref_min_max(float x, float y, bool is_max) {
+    if (std::isnan(x) && std::isnan(y)) {
+        return 0x7fc00000;
+    }
+    // single NaN operand (also signaling NaN, which host 'fmin' may quiet
+    // and return): result is the other operand
+    if (std::isnan(x)) {
+        return to_bits(y);
+    }
+    if (std::isnan(y)) {
+        return to_bits(x);
+    }
+    if (x == 0.0f && y == 0.0f) {
+        // -0.0 is less than +0.0
+        return to_bits((std::signbit(x) != is_max) ? x : y);
+    }
+    return to_bits(is_max ? std::fmax(x, y) : std::fmin(x, y));
+}
+
+uint32_t ref_cvt_w(float f, bool rtz) {
+    if (std::isnan(f)) {
+        return 0x7fffffff;
+    }
+    double r = rtz ? std::trunc(double(f)) : std::nearbyint(double(f));
+    if (r > 2147483647.0) {
+        return 0x7fffffff;
+    }
+    if (r < -2147483648.0) {
+        return 0x80000000;
+    }
+    return uint32_t(int32_t(r));
+}
+
+uint32_t ref_cvt_wu(float f) {
+    if (std::isnan(f)) {
+        return 0xffffffff;
+    }
+    double r = std::trunc(double(f));
+    if (r > 4294967295.0) {
+        return 0xffffffff;
+    }
+    if (r < 0.0) {
+        return 0;
+    }
+    return uint32_t(r);
+}
+
+uint32_t ref_class(float f) {
+    bool neg = std::signbit(f);
+    switch (std::fpclassify(f)) {
+    case FP_INFINITE:
+        return neg ? (1 << 0) : (1 << 7);
+    case FP_NORMAL:
+        return neg ? (1 << 1) : (1 << 6);
+    case FP_SUBNORMAL:
+        return neg ? (1 << 2) : (1 << 5);
+    case FP_ZERO:
+        return neg ? (1 << 3) : (1 << 4);
+    default:
+        // quiet NaN has most significant mantissa bit set
+        return ((to_bits(f) & 0x400000) != 0) ? (1 << 9) : (1 << 8);
+    }
+}
+
+// expected FP kernel results computed with host arithmetic
+std::vector<uint8_t> make_fp_ref(const std::vector<uint8_t> &init) {
+    std::vector<uint8_t> data(init);
+    const uint32_t *in = reinterpret_cast<const uint32_t *>(init.data());
+    uint32_t *out = reinterpret_cast<uint32_t *>(data.data() + (FP_OUT_BASE - DATA_BASE));
+    for (uint32_t i = 0; i < FP_COUNT; i++) {
+        uint32_t bx = in[3 * i];
+        uint32_t by = in[3 * i + 1];
+        float x = to_float(bx);
+        float y = to_float(by);
+        float z = to_float(in[3 * i + 2]);
+        uint32_t *r = out + i * FP_OUT_WORDS;
+        r[0] = ref_canon(x + y);
+        r[1] = ref_canon(x - y);
+        r[2] = ref_canon(x * y);
+        r[3] = ref_canon(x / y);
+        r[4] = ref_canon(std::sqrt(x));
+        r[5] = ref_canon(std::fma(x, y, z));
+        r[6] = ref_min_max(x, y, false);
+        r[7] = ref_min_max(x, y, true);
+        r[8] = ref_cvt_w(x, true);
+        r[9] = ref_cvt_w(x, false);
+        r[10] = to_bits(float(int32_t(bx)));
+        r[11] = (x == y ? 1 : 0) | (x < y ? 2 : 0) | (x <= y ? 4 : 0);
+        r[12] = ref_class(x);
+        r[13] = (bx & 0x7fffffff) | (~by & 0x80000000);
+        r[14] = ref_cvt_wu(x);
+        r[15] = ref_canon(std::fma(-x, y, z));
+    }
+    return data;
+}
+
+class NullBuiltinHandler: public Riscv32BuiltinHandler {
+public:
+    NullBuiltinHandler() { }
+    ~NullBuiltinHandler() { }
+public:
+    void call([[maybe_unused]] Riscv32Core *core, int id) override {
+        throw std::runtime_error("Unexpected builtin call: " + std::to_string(id));
+    }
+};
+
+struct Result {
+    double seconds;
+    uint32_t a0;
+    uint32_t a1;
+    std::vector<uint8_t> data;
+};
+
+void init_data(uint8_t *data) {
+    uint32_t *p = reinterpret_cast<uint32_t *>(data);
+    int count = int(DATA_SIZE / sizeof(uint32_t));
+    for (int i = 0; i < count; i++) {
+        p[i] = uint32_t(i) * 2654435761u;
+    }
+}
+
+Result run_kernel(Riscv32HartKind hart_kind, const Kernel &kernel) {
+    NullBuiltinHandler builtin_handler;
+    std::unique_ptr<Riscv32System> system(
+        Riscv32System::create(1, MEM_SIZE, 4 * 1024, 0, hart_kind));
+    Riscv32Core *core = system->core_at(0);
+    core->set_builtin_handler(&builtin_handler);
+    core->set_memory_layout(CODE_BASE, CODE_SIZE, LOCAL_BASE, LOCAL_SIZE);
+    core->write_code(CODE_BASE, kernel.code);
+    init_data(system->map_addr(DATA_BASE));
+    auto start = std::chrono::steady_clock::now();
+    core->run(CODE_BASE);
+    auto end = std::chrono::steady_clock::now();
+    Result result;
+    result.seconds = std::chrono::duration<double>(end - start).count();
+    result.a0 = core->get_arg(0);
+    result.a1 = core->get_arg(1);
+    uint8_t *data = system->map_addr(DATA_BASE);
+    result.data.assign(data, data + DATA_SIZE);
+    return result;
+}
+
+bool str_to_int(const char *s, int &v) {
+    char *p;
+    long t = strtol(s, &p, 10);
+    if (*p != '\0') {
+        return false;
+    }
+    int r = int(t);
+    if (long(r) != t || r <= 0) {
+        return false;
+    }
+    v = r;
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    // approximate number of loop iterations per kernel
+    int iters = 2 * 1024 * 1024;
+    if (argc > 2 || (argc == 2 && !str_to_int(argv[1], iters))) {
+        fprintf(stderr, "Usage: bench_riscv [<iterations>]\n");
+        return 1;
+    }
+    std::vector<Kernel> kernels = {
+        make_alu(iters),
+        make_rvc(iters),
+        make_mem(iters),
+        make_muldiv(iters),
+        make_branch(iters)
+    };
+    Kernel fp_kernel = make_fp(iters);
+    bool ok = true;
+    try {
+        printf("%-8s %12s %12s %10s %8s\n", "kernel", "full [s]", "lean [s]", "speedup", "match");
+        for (Kernel &kernel: kernels) {
+            Result full = run_kernel(Riscv32HartKind::FULL, kernel);
+            Result lean = run_kernel(Riscv32HartKind::LEAN, kernel);
+            bool match =
+                (full.a0 == lean.a0 &&
+                    full.a1 == lean.a1 &&
+                    full.data == lean.data);
+            if (!match) {
+                ok = false;
+            }
+            printf(
+                "%-8s %12.4f %12.4f %9.2fx %8s\n",
+                    kernel.name.c_str(),
+                    full.seconds,
+                    lean.seconds,
+                    full.seconds / lean.seconds,
+                    match ? "OK" : "FAIL");
+        }
+        Result lean = run_kernel(Riscv32HartKind::LEAN, fp_kernel);
+        std::vector<uint8_t> init(DATA_SIZE);
+        init_data(init.data());
+        bool match = (lean.data == make_fp_ref(init));
+        if (!match) {
+            ok = false;
+        }
+        printf(
+            "%-8s %12s %12.4f %10s %8s\n",
+                fp_kernel.name.c_str(),
+                "-",
+                lean.seconds,
+                "-",
+                match ? "OK" : "FAIL");
+    } catch (std::exception &e) {
+        fprintf(stderr, "Error: %s\n", e.what());
+        return 1;
+    }
+    return ok ? 0 : 1;
+}
+
@@ -44,7 +44,8 @@ namespace WdRiscv
     /// Default contructor: Define an invalid object.
     DecodedInst()
       : addr_(0), physAddr_(0), inst_(0), size_(0), entry_(nullptr), op0_(0),
-	op1_(0), op2_(0), op3_(0), valid_(false), masked_(false), vecFields_(0)
+	op1_(0), op2_(0), op3_(0), builtinHandler_(nullptr), valid_(false),
+	masked_(false), vecFields_(0)
     { values_[0] = values_[1] = values_[2] = values_[3] = 0; }
 
     /// Constructor.
@@ -52,7 +53,8 @@ namespace WdRiscv
 		uint32_t op0, uint32_t op1, uint32_t op2, uint32_t op3)
       : addr_(addr), physAddr_(0), inst_(inst), size_(instructionSize(inst)),
 	entry_(entry), op0_(op0), op1_(op1), op2_(op2), op3_(op3),
-	valid_(entry != nullptr), masked_(false), vecFields_(0)
+	builtinHandler_(nullptr), valid_(entry != nullptr), masked_(false),
+	vecFields_(0)
     { values_[0] = values_[1] = values_[2] = values_[3] = 0; }
 
     /// Return instruction size in bytes.
@@ -215,6 +217,15 @@ namespace WdRiscv
     void setVecFieldCount(uint32_t count)
     { vecFields_ = count; }
 
+    /// [RONIN] Return handler bound to builtin call instruction at
+    /// decode time (null if none).
+    void* builtinHandler() const
+    { return builtinHandler_; }
+
+    /// [RONIN] Bind handler to builtin call instruction.
+    void setBuiltinHandler(void* handler)
+    { builtinHandler_ = handler; }
+
     void reset(uint64_t addr, uint64_t physAddr, uint32_t inst,
 	       const InstEntry* entry,
 	       uint32_t op0, uint32_t op1, uint32_t op2, uint32_t op3)
@@ -225,6 +236,7 @@ namespace WdRiscv
       entry_ = entry;
       op0_ = op0; op1_ = op1; op2_ = op2; op3_ = op3;
       size_ = instructionSize(inst);
+      builtinHandler_ = nullptr;
       valid_ = entry != nullptr;
     }
 
@@ -241,6 +253,7 @@ namespace WdRiscv
     uint32_t op3_;    // 4th operand (typically a register number)
 
     uint64_t values_[4];  // Values of operands.
+    void* builtinHandler_;  // [RONIN] For builtin call instructions.
     bool valid_;
     bool masked_;     // For vector instructions.
     uint8_t vecFields_;   // For vector ld/st instructions.
@@ -5912,6 +5912,10 @@ Hart<URV>::execute(const DecodedInst* di)
       execBbarrier(di);
       return;
 
+    case InstId::builtin:
+      execBuiltin(di);
+      return;
+
     case InstId::vsetvli:
       execVsetvli(di);
       return;
@@ -7804,21 +7808,25 @@ Hart<URV>::execJalr(const DecodedInst* di)
 //printf("@@@ ---- execJalr newPc %x oldPc %x (op0 %x op1 %x op2 %x (%x))\n", 
 //int(new_pc), int(pc_), int(di->op0()), unsigned(intRegs_.read(di->op1())), 
 //unsigned(di->op2As<SRV>()), unsigned(di->op2())); 
-  int ret_hook = execJalrHook(new_pc);
-  // [RONIN]
-  if (ret_hook > 0)
-    {
-      // builtin call
-      URV temp = pc_;  // pc has the address of the instruction after jalr
-      intRegs_.write(di->op0(), temp);
-      setPc(intRegs_.read(1));  // ra has the return address
-      return;
-    }
-  if (ret_hook < 0) 
+  // [RONIN] Hook is only needed for special targets (program exit,
+  // builtins called indirectly); direct builtin calls are bound at decode.
+  if ((new_pc & jalrHookMask_) != 0)
     {
+      int ret_hook = execJalrHook(new_pc);
+      if (ret_hook > 0)
+        {
+          // builtin call
+          URV temp = pc_;  // pc has the address of the instruction after jalr
+          intRegs_.write(di->op0(), temp);
+          setPc(intRegs_.read(1));  // ra has the return address
+          return;
+        }
+      if (ret_hook < 0) 
+        {
 //printf("@@@   PROGRAM RUN COMPLETED: HART %d\n", hartIx_);
-      forceUserStop(1);
-      return;
+          forceUserStop(1);
+          return;
+        }
     }
 
   URV temp = pc_;  // pc has the address of the instruction after jalr
@@ -9509,6 +9517,43 @@ Hart<URV>::execJalrHook(URV pc)
 }
 
 
+// [RONIN]
+template <typename URV>
+void*
+Hart<URV>::bindBuiltin(unsigned)
+{
+  return nullptr;
+}
+
+
+// [RONIN]
+template <typename URV>
+void
+Hart<URV>::execBuiltinHook(void*, unsigned)
+{
+}
+
+
+// [RONIN] Builtin call replacing "jalr rd, offset(rs1)" at linked call
+// site: same register effects as the jalr-based builtin call path.
+template <typename URV>
+void
+Hart<URV>::execBuiltin(const DecodedInst* di)
+{
+  void* handler = di->builtinHandler();
+  if (handler == nullptr)
+    {
+      illegalInst(di);
+      return;
+    }
+
+  execBuiltinHook(handler, di->op1());
+  URV temp = pc_;  // pc has the address of the instruction after call
+  intRegs_.write(di->op0(), temp);
+  setPc(intRegs_.read(1));  // ra has the return address
+}
+
+
 template
 bool
 WdRiscv::Hart<uint32_t>::store<uint16_t>(uint32_t, uint32_t, uint32_t, uint16_t);
@@ -1272,6 +1272,12 @@ namespace WdRiscv
     void enableBusBarrier(bool flag)
     { enableBbarrier_ = flag; }
 
+    /// [RONIN] Set mask of jalr target address bits that require
+    /// execJalrHook. Targets with none of these bits set are plain
+    /// jumps and do not invoke the hook.
+    void setJalrHookMask(URV mask)
+    { jalrHookMask_ = mask; }
+
     /// Unpack the memory protection information defined by the given
     /// physical memory protection entry (entry 0 corresponds to
     /// PMPADDR0, ... 15 o PMPADDR15). Return true on success setting
@@ -2208,6 +2214,7 @@ namespace WdRiscv
     void execLoad64(const DecodedInst*);
     void execStore64(const DecodedInst*);
     void execBbarrier(const DecodedInst*);
+    void execBuiltin(const DecodedInst*);
 
     void vsetvl(unsigned rd, unsigned rs1, URV vtypeVal);
     void execVsetvli(const DecodedInst*);
@@ -3625,6 +3632,13 @@ namespace WdRiscv
     // [RONIN]
     virtual int execJalrHook(URV pc);
 
+    // [RONIN] Return handler for given builtin ID; called once when
+    // builtin call instruction is decoded (null if not supported).
+    virtual void* bindBuiltin(unsigned id);
+
+    // [RONIN] Invoke builtin using handler bound at decode time.
+    virtual void execBuiltinHook(void* handler, unsigned id);
+
   private:
 
     // We model non-blocking load buffer in order to undo load
@@ -3851,6 +3865,7 @@ namespace WdRiscv
     bool enableWideLdSt_ = false;   // True if wide (64-bit) ld/st enabled.
     bool wideLdSt_ = false;         // True if executing wide ld/st instrution.
     bool enableBbarrier_ = false;
+    URV jalrHookMask_ = URV(1) << ((sizeof(URV) << 3) - 1);  // [RONIN]
 
     int gdbInputFd_ = -1;  // Input file descriptor when running in gdb mode.
 
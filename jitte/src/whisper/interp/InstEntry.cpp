@@ -2225,6 +2225,13 @@ InstTable::setupInstVec()
         InstType::Int
       },
 
+      // [RONIN] Custom instruction: call of host builtin (custom-2 opcode).
+      // Emitted by linker in place of jalr of builtin call site.
+      { "builtin", InstId::builtin, 0x5b, low7Mask,
+        InstType::Int,
+        OperandType::IntReg, OperandMode::Write, rdMask,
+        OperandType::Imm, OperandMode::None, immTop20 },
+
       { "vsetvli", InstId::vsetvli,
         0b000000'0'00000'00000'111'00000'1010111, // Opcode
         0b100000'0'00000'00000'111'00000'1111111, // Mask of opcode bits
@@ -409,6 +409,7 @@ namespace WdRiscv
      load64,
      store64,
      bbarrier,
+     builtin,   // [RONIN] host builtin call bound at decode time
 
      // vector
      vsetvli,
@@ -45,6 +45,10 @@ Hart<URV>::decode(URV addr, uint64_t physAddr, uint32_t inst, DecodedInst& di)
       di.setMasked(masked);
       di.setVecFieldCount(op3);
     }
+
+  // [RONIN] Resolve builtin handler once per decoded call site.
+  if (di.instEntry() and di.instEntry()->instId() == InstId::builtin)
+    di.setBuiltinHandler(bindBuiltin(op1));
 }
 
 
@@ -2087,7 +2091,15 @@ Hart<URV>::decode(uint32_t inst, uint32_t& op0, uint32_t& op1, uint32_t& op2,
       case 21: // 10101
         return decodeVec(inst, op0, op1, op2, op3);
 
-      case 22:
+      case 22:  // 10110  U-form (custom-2)
+      {
+        // [RONIN] builtin call: op1 is builtin ID
+        UFormInst uform(inst);
+        op0 = uform.bits.rd;
+        op1 = uform.bits.imm;
+        return instTable_.getEntry(InstId::builtin);
+      }
+
       case 23:
       case 26:
       case 29:
@@ -151,6 +151,7 @@ Linker *Linker::create() {
 //
 
 LinkerImpl::LinkerImpl():
+        m_builtin_id_mask(0),
         m_code_base(0),
         m_code_end(0) { }
 
@@ -160,6 +161,10 @@ void LinkerImpl::add_builtin(const std::string &name, uint64_t value) {
     m_builtin_map.emplace(name, value);
 }
 
+void LinkerImpl::set_builtin_id_mask(uint64_t mask) {
+    m_builtin_id_mask = mask;
+}
+
 void LinkerImpl::link(
         const std::string &fname, 
         uint64_t code_base,
@@ -201,6 +206,9 @@ void LinkerImpl::collect_sections() {
 }
 
 void LinkerImpl::collect_code_sections() {
+    // Initialized writable data (.data, .sdata) is part of linked image:
+    // the device keeps kernel binaries resident across launches and restores
+    // bytes that previous launch stored to (see 'TensixImpl::write_code')
     Sections &sections = m_elfio.sections; 
     int sections_size = int(sections.size());
     for (int i = 0; i < sections_size; i++) {
@@ -434,7 +442,9 @@ uint64_t LinkerImpl::relocate_entry(
         // S + A - P: U+I-Type
         {
             calc_value = var_s + var_a - var_p;
-            reloc_ui_type(var_p, calc_value);
+            if (var_a != 0 || !reloc_builtin_call(var_p, symbol_name)) {
+                reloc_ui_type(var_p, calc_value);
+            }
         }
         break;
     case RelocType::PCREL_HI20:
@@ -637,6 +647,44 @@ void LinkerImpl::reloc_ui_type(uint64_t offset, uint64_t value) {
     diag_reloc_code("U+I-Type after", offset + 4);
 }
 
+bool LinkerImpl::reloc_builtin_call(uint64_t offset, const std::string &symbol_name) {
+    // Call of builtin: "auipc rd1, hi" + "jalr rd, lo(rd1)" pair
+    // jalr is replaced with custom-2 U-Type "builtin rd, id" instruction
+    // that is bound to builtin handler at decode time
+    static constexpr uint32_t BUILTIN_OPCODE = 0x5b;
+    if (m_builtin_id_mask == 0) {
+        return false;
+    }
+    int local_index;
+    int entry_index;
+    if (!map_symbol(symbol_name, local_index, entry_index)) {
+        return false;
+    }
+    SymbolEntry &entry = m_symbol_sections[local_index].entries[entry_index];
+    if (!entry.is_builtin) {
+        return false;
+    }
+    uint64_t id = entry.value & m_builtin_id_mask;
+    if (id == 0 || id >= (uint64_t(1) << 20)) {
+        return false;
+    }
+    check_code_offset(offset, 8);
+    offset -= m_code_base;
+    uint32_t inst = 0;
+    memcpy(&inst, m_code.data() + offset + 4, 4);
+    if ((inst & 0x707f) != 0x67) {
+        // not a jalr (opcode 1100111, funct3 000)
+        return false;
+    }
+    diag_reloc_entry(offset, id);
+    diag_reloc_code("Builtin before", offset + 4);
+    uint32_t rd = (inst >> 7) & 0x1f;
+    inst = (uint32_t(id) << 12) | (rd << 7) | BUILTIN_OPCODE;
+    memcpy(m_code.data() + offset + 4, &inst, 4);
+    diag_reloc_code("Builtin after", offset + 4);
+    return true;
+}
+
 void LinkerImpl::move_code(std::vector<uint8_t> &result) {
     result.clear();
     result.swap(m_code);
@@ -18,6 +18,10 @@ public:
 public:
     static Linker *create();
     virtual void add_builtin(const std::string &name, uint64_t value) = 0;
+    // if mask is not zero, direct calls of builtins are emitted as custom
+    // 'builtin' instructions carrying ID (value & mask) that must fit into
+    // 20 bits; other references to builtins still use value as address
+    virtual void set_builtin_id_mask(uint64_t mask) = 0;
     virtual void link(
         const std::string &fname, 
         uint64_t code_base,
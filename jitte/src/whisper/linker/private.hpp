@@ -28,6 +28,7 @@ public:
     ~LinkerImpl();
 public:
     void add_builtin(const std::string &name, uint64_t value) override;
+    void set_builtin_id_mask(uint64_t mask) override;
     void link(
         const std::string &fname, 
         uint64_t code_base,
@@ -61,6 +62,7 @@ private:
     void reloc_i_type(uint64_t offset, uint64_t value);
     void reloc_u_type(uint64_t offset, uint64_t value);
     void reloc_ui_type(uint64_t offset, uint64_t value);
+    bool reloc_builtin_call(uint64_t offset, const std::string &symbol_name);
     void move_code(std::vector<uint8_t> &result);
     uint64_t get_start_pc();
     bool map_builtin(const std::string &name, uint64_t &offset);
@@ -115,6 +117,7 @@ private:
     };
 private:
     std::unordered_map<std::string, uint64_t> m_builtin_map;
+    uint64_t m_builtin_id_mask;
     uint64_t m_code_base;
     Elfio m_elfio;
     std::vector<SymbolSection> m_symbol_sections;
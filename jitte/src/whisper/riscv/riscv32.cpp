@@ -12,6 +12,7 @@
 
 #include "riscv/riscv32.hpp"
 #include "riscv/riscv32impl.hpp"
+#include "riscv/riscv32lean.hpp"
 
 namespace riscv {
 namespace core {
@@ -30,7 +31,10 @@ Riscv32CoreImpl::Riscv32CoreImpl(int id, Memory *memory):
         m_code_base(0), 
         m_code_size(0), 
         m_local_base(0), 
-        m_local_size(0) { }
+        m_local_size(0) {
+    // cannot use shift by 31 because of linker requirements
+    Hart32::setJalrHookMask(uint32_t(1) << 30);
+}
 
 Riscv32CoreImpl::~Riscv32CoreImpl() { }
 
@@ -66,6 +70,10 @@ void Riscv32CoreImpl::write_code(uint32_t addr, const std::vector<uint8_t> &code
     memcpy(dst, src, size);
 }
 
+void Riscv32CoreImpl::invalidate_code() {
+    Hart32::invalidateDecodeCache();
+}
+
 void Riscv32CoreImpl::run(uint32_t start_pc) {
     if (m_code_size == 0 || m_local_size == 0) {
         throw std::runtime_error("Memory layout is not set");
@@ -139,6 +147,17 @@ int Riscv32CoreImpl::execJalrHook(uint32_t pc) {
     return 1;
 }
 
+void *Riscv32CoreImpl::bindBuiltin(unsigned id) {
+    if (m_builtin_handler == nullptr) {
+        throw std::runtime_error("Missing builtin handler");
+    }
+    return m_builtin_handler->resolve(int(id));
+}
+
+void Riscv32CoreImpl::execBuiltinHook(void *handler, unsigned id) {
+    static_cast<Riscv32BuiltinHandler *>(handler)->call(this, int(id));
+}
+
 void Riscv32CoreImpl::set_int_reg(const std::string &reg_name, uint32_t val) {
     bool ok = true;
     unsigned reg = 0;
@@ -156,8 +175,9 @@ Riscv32System *Riscv32System::create(
         int core_count,
         uint32_t mem_size, 
         uint32_t page_size, 
-        uint32_t region_size) {
-    return new Riscv32SystemImpl(core_count, mem_size, page_size, region_size);
+        uint32_t region_size,
+        Riscv32HartKind hart_kind) {
+    return new Riscv32SystemImpl(core_count, mem_size, page_size, region_size, hart_kind);
 }
 
 //
@@ -168,7 +188,8 @@ Riscv32SystemImpl::Riscv32SystemImpl(
         int core_count,
         uint32_t mem_size, 
         uint32_t page_size, 
-        uint32_t region_size) {
+        uint32_t region_size,
+        Riscv32HartKind hart_kind) {
     m_memory.reset(
         new Memory(
             size_t(mem_size), 
@@ -176,7 +197,11 @@ Riscv32SystemImpl::Riscv32SystemImpl(
             size_t(region_size)));
     m_memory->setHartCount(core_count);
     for (int i = 0; i < core_count; i++) {
-        m_cores.emplace_back(new Riscv32CoreImpl(i, m_memory.get()));
+        if (hart_kind == Riscv32HartKind::LEAN) {
+            m_cores.emplace_back(new Riscv32LeanCoreImpl(i, m_memory->data(), mem_size));
+        } else {
+            m_cores.emplace_back(new Riscv32CoreImpl(i, m_memory.get()));
+        }
     }
 }
 
@@ -18,6 +18,11 @@ public:
     virtual ~Riscv32BuiltinHandler() { }
 public:
     virtual void call(Riscv32Core *core, int id) = 0;
+    // returns handler implementing builtin with given ID; called once per
+    // decoded call site, result is used for all subsequent calls
+    virtual Riscv32BuiltinHandler *resolve([[maybe_unused]] int id) {
+        return this;
+    }
 };
 
 class Riscv32Core {
@@ -36,12 +41,23 @@ public:
     virtual uint32_t local_base() = 0;
     virtual uint32_t local_size() = 0;
     virtual void write_code(uint32_t addr, const std::vector<uint8_t> &code) = 0; 
+    // call after code region is modified other than via 'write_code'
+    virtual void invalidate_code() = 0;
     virtual void run(uint32_t start_pc) = 0;
     virtual uint32_t get_arg(int index) = 0;
     virtual void set_ret(int index, uint32_t value) = 0;
     virtual uint8_t *map_addr(uint32_t addr) = 0;
 };
 
+// FULL: complete Whisper hart (all extensions, MMU, PMP, triggers, ...)
+// LEAN: bare RV32IMFC hart with flat memory, for kernels built by linker;
+//     FP exception flags are not accumulated and static rounding modes
+//     are honored only by conversions (arithmetic uses host rounding)
+enum class Riscv32HartKind {
+    FULL,
+    LEAN
+};
+
 class Riscv32System {
 public:
     Riscv32System() { }
@@ -51,7 +67,8 @@ public:
         int core_count,
         uint32_t mem_size, 
         uint32_t page_size, 
-        uint32_t region_size);
+        uint32_t region_size,
+        Riscv32HartKind hart_kind = Riscv32HartKind::FULL);
     virtual int core_count() = 0;
     virtual Riscv32Core *core_at(int index) = 0;
     virtual uint8_t *map_addr(uint32_t addr) = 0;
@@ -45,12 +45,15 @@ public:
         return m_local_size;
     }
     void write_code(uint32_t addr, const std::vector<uint8_t> &code) override; 
+    void invalidate_code() override;
     void run(uint32_t start_pc) override;
     uint32_t get_arg(int index) override;
     void set_ret(int index, uint32_t value) override;
     uint8_t *map_addr(uint32_t addr) override;
 protected:
     int execJalrHook(uint32_t pc) override;
+    void *bindBuiltin(unsigned id) override;
+    void execBuiltinHook(void *handler, unsigned id) override;
 private:
     void set_int_reg(const std::string &reg_name, uint32_t val);
 private:
@@ -68,7 +71,8 @@ public:
         int core_count,
         uint32_t mem_size, 
         uint32_t page_size, 
-        uint32_t region_size);
+        uint32_t region_size,
+        Riscv32HartKind hart_kind);
     ~Riscv32SystemImpl();
 public:
     int core_count() override;
@@ -76,7 +80,7 @@ public:
     uint8_t *map_addr(uint32_t addr) override;
 private:
     std::unique_ptr<Memory> m_memory;
-    std::vector<std::unique_ptr<Riscv32CoreImpl>> m_cores;
+    std::vector<std::unique_ptr<Riscv32Core>> m_cores;
 };
 
 } // namespace core
@@ -0,0 +1,1476 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdint>
+#include <cstring>
+#include <cstdio>
+#include <cmath>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+
+#include "riscv/riscv32.hpp"
+#include "riscv/riscv32lean.hpp"
+
+namespace riscv {
+namespace core {
+
+namespace {
+
+enum Op: uint8_t {
+    OP_ILLEGAL,
+    // RV32I
+    OP_LUI,
+    OP_AUIPC,
+    OP_JAL,
+    OP_JALR,
+    OP_BEQ,
+    OP_BNE,
+    OP_BLT,
+    OP_BGE,
+    OP_BLTU,
+    OP_BGEU,
+    OP_LB,
+    OP_LH,
+    OP_LW,
+    OP_LBU,
+    OP_LHU,
+    OP_SB,
+    OP_SH,
+    OP_SW,
+    OP_ADDI,
+    OP_SLTI,
+    OP_SLTIU,
+    OP_XORI,
+    OP_ORI,
+    OP_ANDI,
+    OP_SLLI,
+    OP_SRLI,
+    OP_SRAI,
+    OP_ADD,
+    OP_SUB,
+    OP_SLL,
+    OP_SLT,
+    OP_SLTU,
+    OP_XOR,
+    OP_SRL,
+    OP_SRA,
+    OP_OR,
+    OP_AND,
+    OP_FENCE,
+    OP_ECALL,
+    OP_EBREAK,
+    // Zicsr
+    OP_CSRRW,
+    OP_CSRRS,
+    OP_CSRRC,
+    OP_CSRRWI,
+    OP_CSRRSI,
+    OP_CSRRCI,
+    // RV32M
+    OP_MUL,
+    OP_MULH,
+    OP_MULHSU,
+    OP_MULHU,
+    OP_DIV,
+    OP_DIVU,
+    OP_REM,
+    OP_REMU,
+    // RV32A (harts run one at a time: trivially atomic)
+    OP_LR_W,
+    OP_SC_W,
+    OP_AMOSWAP_W,
+    OP_AMOADD_W,
+    OP_AMOXOR_W,
+    OP_AMOAND_W,
+    OP_AMOOR_W,
+    OP_AMOMIN_W,
+    OP_AMOMAX_W,
+    OP_AMOMINU_W,
+    OP_AMOMAXU_W,
+    // RV32F
+    OP_FLW,
+    OP_FSW,
+    OP_FMADD_S,
+    OP_FMSUB_S,
+    OP_FNMSUB_S,
+    OP_FNMADD_S,
+    OP_FADD_S,
+    OP_FSUB_S,
+    OP_FMUL_S,
+    OP_FDIV_S,
+    OP_FSQRT_S,
+    OP_FSGNJ_S,
+    OP_FSGNJN_S,
+    OP_FSGNJX_S,
+    OP_FMIN_S,
+    OP_FMAX_S,
+    OP_FCVT_W_S,
+    OP_FCVT_WU_S,
+    OP_FMV_X_W,
+    OP_FEQ_S,
+    OP_FLT_S,
+    OP_FLE_S,
+    OP_FCLASS_S,
+    OP_FCVT_S_W,
+    OP_FCVT_S_WU,
+    OP_FMV_W_X,
+    // custom: builtin call emitted by linker
+    OP_BUILTIN
+};
+
+// cannot use shift by 31 because of linker requirements
+constexpr uint32_t BUILTIN_MASK = uint32_t(1) << 30;
+
+constexpr uint32_t SIGN_MASK = 0x80000000;
+constexpr uint32_t CANONICAL_NAN = 0x7fc00000;
+
+constexpr uint32_t CSR_FFLAGS = 0x001;
+constexpr uint32_t CSR_FRM = 0x002;
+constexpr uint32_t CSR_FCSR = 0x003;
+constexpr uint32_t CSR_MCYCLE = 0xb00;
+constexpr uint32_t CSR_MINSTRET = 0xb02;
+constexpr uint32_t CSR_MCYCLEH = 0xb80;
+constexpr uint32_t CSR_MINSTRETH = 0xb82;
+constexpr uint32_t CSR_CYCLE = 0xc00;
+constexpr uint32_t CSR_TIME = 0xc01;
+constexpr uint32_t CSR_INSTRET = 0xc02;
+constexpr uint32_t CSR_CYCLEH = 0xc80;
+constexpr uint32_t CSR_TIMEH = 0xc81;
+constexpr uint32_t CSR_INSTRETH = 0xc82;
+constexpr uint32_t CSR_MHARTID = 0xf14;
+
+inline float as_float(uint32_t v) {
+    float f;
+    memcpy(&f, &v, sizeof(f));
+    return f;
+}
+
+inline uint32_t as_u32(float f) {
+    uint32_t v;
+    memcpy(&v, &f, sizeof(v));
+    return v;
+}
+
+inline uint32_t canon(float f) {
+    return std::isnan(f) ? CANONICAL_NAN : as_u32(f);
+}
+
+inline uint32_t fmin_s(uint32_t a, uint32_t b) {
+    float fa = as_float(a);
+    float fb = as_float(b);
+    bool na = std::isnan(fa);
+    bool nb = std::isnan(fb);
+    if (na && nb) {
+        return CANONICAL_NAN;
+    }
+    if (na) {
+        return b;
+    }
+    if (nb) {
+        return a;
+    }
+    if (fa == fb) {
+        // -0.0 is less than +0.0
+        return ((a & SIGN_MASK) != 0) ? a : b;
+    }
+    return (fa < fb) ? a : b;
+}
+
+inline uint32_t fmax_s(uint32_t a, uint32_t b) {
+    float fa = as_float(a);
+    float fb = as_float(b);
+    bool na = std::isnan(fa);
+    bool nb = std::isnan(fb);
+    if (na && nb) {
+        return CANONICAL_NAN;
+    }
+    if (na) {
+        return b;
+    }
+    if (nb) {
+        return a;
+    }
+    if (fa == fb) {
+        return ((a & SIGN_MASK) != 0) ? b : a;
+    }
+    return (fa > fb) ? a : b;
+}
+
+inline uint32_t fclass_s(uint32_t v) {
+    bool sign = ((v & SIGN_MASK) != 0);
+    uint32_t exp = (v >> 23) & 0xff;
+    uint32_t man = v & 0x7fffff;
+    if (exp == 0xff) {
+        if (man == 0) {
+            return sign ? (1 << 0) : (1 << 7);
+        }
+        return ((man & 0x400000) != 0) ? (1 << 9) : (1 << 8);
+    }
+    if (exp == 0) {
+        if (man == 0) {
+            return sign ? (1 << 3) : (1 << 4);
+        }
+        return sign ? (1 << 2) : (1 << 5);
+    }
+    return sign ? (1 << 1) : (1 << 6);
+}
+
+inline float round_rm(float f, uint32_t rm) {
+    switch (rm) {
+    case 1:
+        return std::trunc(f);
+    case 2:
+        return std::floor(f);
+    case 3:
+        return std::ceil(f);
+    case 4:
+        return std::round(f);
+    default:
+        // host is assumed to use round-to-nearest-even
+        return std::nearbyint(f);
+    }
+}
+
+inline uint32_t fcvt_w_s(float f, uint32_t rm) {
+    if (std::isnan(f)) {
+        return 0x7fffffff;
+    }
+    float r = round_rm(f, rm);
+    if (r >= 2147483648.0f) {
+        return 0x7fffffff;
+    }
+    if (r < -2147483648.0f) {
+        return 0x80000000;
+    }
+    return uint32_t(int32_t(r));
+}
+
+inline uint32_t fcvt_wu_s(float f, uint32_t rm) {
+    if (std::isnan(f)) {
+        return 0xffffffff;
+    }
+    float r = round_rm(f, rm);
+    if (r >= 4294967296.0f) {
+        return 0xffffffff;
+    }
+    if (r <= 0.0f) {
+        return 0;
+    }
+    return uint32_t(r);
+}
+
+inline uint32_t bits(uint32_t v, int hi, int lo) {
+    return (v >> lo) & ((uint32_t(1) << (hi - lo + 1)) - 1);
+}
+
+inline int32_t sext(uint32_t v, int width) {
+    int shift = 32 - width;
+    return int32_t(v << shift) >> shift;
+}
+
+std::string to_hex(uint32_t v) {
+    char buf[16];
+    snprintf(buf, sizeof(buf), "0x%08x", v);
+    return std::string(buf);
+}
+
+} // namespace
+
+//
+//    Riscv32LeanCoreImpl
+//
+
+Riscv32LeanCoreImpl::Riscv32LeanCoreImpl(int id, uint8_t *mem, uint32_t mem_size):
+        m_id(id),
+        m_mem(mem),
+        m_mem_size(mem_size),
+        m_builtin_handler(nullptr),
+        m_code_base(0),
+        m_code_size(0),
+        m_local_base(0),
+        m_local_size(0),
+        m_frm(0),
+        m_fflags(0),
+        m_inst_count(0),
+        m_reserve_addr(0),
+        m_reserve_valid(false) {
+    memset(m_x, 0, sizeof(m_x));
+    memset(m_f, 0, sizeof(m_f));
+}
+
+Riscv32LeanCoreImpl::~Riscv32LeanCoreImpl() { }
+
+void Riscv32LeanCoreImpl::set_builtin_handler(Riscv32BuiltinHandler *builtin_handler) {
+    m_builtin_handler = builtin_handler;
+    // bound handlers are stale
+    invalidate_code();
+}
+
+void Riscv32LeanCoreImpl::set_memory_layout(
+        uint32_t code_base,
+        uint32_t code_size,
+        uint32_t local_base,
+        uint32_t local_size) {
+    if (!(code_size > 0 && code_base + code_size <= m_mem_size)) {
+        throw std::runtime_error("Invalid code memory layout");
+    }
+    if (!(local_size > 0 && local_base + local_size <= m_mem_size)) {
+        throw std::runtime_error("Invalid local memory layout");
+    }
+    m_code_base = code_base;
+    m_code_size = code_size;
+    m_local_base = local_base;
+    m_local_size = local_size;
+    // one slot per 16-bit parcel
+    m_code.resize(code_size / 2 + 1);
+    invalidate_code();
+}
+
+void Riscv32LeanCoreImpl::write_code(uint32_t addr, const std::vector<uint8_t> &code) {
+    uint32_t size = uint32_t(code.size());
+    if (!(addr >= m_code_base && addr + size <= m_code_base + m_code_size)) {
+        throw std::runtime_error("Code does not fit into code region");
+    }
+    memcpy(m_mem + addr, code.data(), size);
+    invalidate_code();
+}
+
+void Riscv32LeanCoreImpl::run(uint32_t start_pc) {
+    if (m_code_size == 0 || m_local_size == 0) {
+        throw std::runtime_error("Memory layout is not set");
+    }
+    if (!(start_pc >= m_code_base && start_pc < m_code_base + m_code_size)) {
+        throw std::runtime_error("Start PC is out of code region");
+    }
+    uint32_t *x = m_x;
+    uint32_t *f = m_f;
+    x[2] = m_local_base + m_local_size - 4;
+    x[1] = BUILTIN_MASK;
+    m_reserve_valid = false;
+    uint32_t pc = start_pc;
+    for ( ; ; ) {
+        uint32_t offset = pc - m_code_base;
+        if (offset >= m_code_size) {
+            bad_pc(pc);
+        }
+        Inst &inst = m_code[offset >> 1];
+        if (inst.size == 0) {
+            decode(pc, inst);
+        }
+        m_inst_count++;
+        uint32_t next_pc = pc + inst.size;
+        uint32_t rs1 = x[inst.rs1];
+        uint32_t rs2 = x[inst.rs2];
+        int32_t imm = inst.imm;
+        switch (inst.op) {
+        case OP_LUI:
+            x[inst.rd] = uint32_t(imm);
+            break;
+        case OP_AUIPC:
+            x[inst.rd] = pc + uint32_t(imm);
+            break;
+        case OP_JAL:
+            x[inst.rd] = next_pc;
+            next_pc = pc + uint32_t(imm);
+            break;
+        case OP_JALR:
+            {
+                uint32_t target = rs1 + uint32_t(imm);
+                if ((target & BUILTIN_MASK) != 0) {
+                    uint32_t id = target & ~BUILTIN_MASK;
+                    if (id == 0) {
+                        // program run completed
+                        return;
+                    }
+                    // builtin called via function pointer
+                    call_builtin(m_builtin_handler, id);
+                    x[inst.rd] = next_pc;
+                    x[0] = 0;
+                    next_pc = x[1];
+                    break;
+                }
+                x[inst.rd] = next_pc;
+                next_pc = target & ~uint32_t(1);
+            }
+            break;
+        case OP_BEQ:
+            if (rs1 == rs2) {
+                next_pc = pc + uint32_t(imm);
+            }
+            break;
+        case OP_BNE:
+            if (rs1 != rs2) {
+                next_pc = pc + uint32_t(imm);
+            }
+            break;
+        case OP_BLT:
+            if (int32_t(rs1) < int32_t(rs2)) {
+                next_pc = pc + uint32_t(imm);
+            }
+            break;
+        case OP_BGE:
+            if (int32_t(rs1) >= int32_t(rs2)) {
+                next_pc = pc + uint32_t(imm);
+            }
+            break;
+        case OP_BLTU:
+            if (rs1 < rs2) {
+                next_pc = pc + uint32_t(imm);
+            }
+            break;
+        case OP_BGEU:
+            if (rs1 >= rs2) {
+                next_pc = pc + uint32_t(imm);
+            }
+            break;
+        case OP_LB:
+            x[inst.rd] = uint32_t(int32_t(load<int8_t>(rs1 + uint32_t(imm))));
+            break;
+        case OP_LH:
+            x[inst.rd] = uint32_t(int32_t(load<int16_t>(rs1 + uint32_t(imm))));
+            break;
+        case OP_LW:
+            x[inst.rd] = load<uint32_t>(rs1 + uint32_t(imm));
+            break;
+        case OP_LBU:
+            x[inst.rd] = load<uint8_t>(rs1 + uint32_t(imm));
+            break;
+        case OP_LHU:
+            x[inst.rd] = load<uint16_t>(rs1 + uint32_t(imm));
+            break;
+        case OP_SB:
+            store<uint8_t>(rs1 + uint32_t(imm), uint8_t(rs2));
+            break;
+        case OP_SH:
+            store<uint16_t>(rs1 + uint32_t(imm), uint16_t(rs2));
+            break;
+        case OP_SW:
+            store<uint32_t>(rs1 + uint32_t(imm), rs2);
+            break;
+        case OP_ADDI:
+            x[inst.rd] = rs1 + uint32_t(imm);
+            break;
+        case OP_SLTI:
+            x[inst.rd] = (int32_t(rs1) < imm) ? 1 : 0;
+            break;
+        case OP_SLTIU:
+            x[inst.rd] = (rs1 < uint32_t(imm)) ? 1 : 0;
+            break;
+        case OP_XORI:
+            x[inst.rd] = rs1 ^ uint32_t(imm);
+            break;
+        case OP_ORI:
+            x[inst.rd] = rs1 | uint32_t(imm);
+            break;
+        case OP_ANDI:
+            x[inst.rd] = rs1 & uint32_t(imm);
+            break;
+        case OP_SLLI:
+            x[inst.rd] = rs1 << imm;
+            break;
+        case OP_SRLI:
+            x[inst.rd] = rs1 >> imm;
+            break;
+        case OP_SRAI:
+            x[inst.rd] = uint32_t(int32_t(rs1) >> imm);
+            break;
+        case OP_ADD:
+            x[inst.rd] = rs1 + rs2;
+            break;
+        case OP_SUB:
+            x[inst.rd] = rs1 - rs2;
+            break;
+        case OP_SLL:
+            x[inst.rd] = rs1 << (rs2 & 0x1f);
+            break;
+        case OP_SLT:
+            x[inst.rd] = (int32_t(rs1) < int32_t(rs2)) ? 1 : 0;
+            break;
+        case OP_SLTU:
+            x[inst.rd] = (rs1 < rs2) ? 1 : 0;
+            break;
+        case OP_XOR:
+            x[inst.rd] = rs1 ^ rs2;
+            break;
+        case OP_SRL:
+            x[inst.rd] = rs1 >> (rs2 & 0x1f);
+            break;
+        case OP_SRA:
+            x[inst.rd] = uint32_t(int32_t(rs1) >> (rs2 & 0x1f));
+            break;
+        case OP_OR:
+            x[inst.rd] = rs1 | rs2;
+            break;
+        case OP_AND:
+            x[inst.rd] = rs1 & rs2;
+            break;
+        case OP_FENCE:
+            break;
+        case OP_ECALL:
+        case OP_EBREAK:
+        case OP_ILLEGAL:
+            illegal_inst(pc);
+            break;
+        case OP_CSRRW:
+        case OP_CSRRWI:
+            {
+                uint32_t value = (inst.op == OP_CSRRW) ? rs1 : inst.rs1;
+                uint32_t old = read_csr(uint32_t(imm));
+                write_csr(uint32_t(imm), value);
+                x[inst.rd] = old;
+            }
+            break;
+        case OP_CSRRS:
+        case OP_CSRRSI:
+            {
+                uint32_t value = (inst.op == OP_CSRRS) ? rs1 : inst.rs1;
+                uint32_t old = read_csr(uint32_t(imm));
+                if (inst.rs1 != 0) {
+                    write_csr(uint32_t(imm), old | value);
+                }
+                x[inst.rd] = old;
+            }
+            break;
+        case OP_CSRRC:
+        case OP_CSRRCI:
+            {
+                uint32_t value = (inst.op == OP_CSRRC) ? rs1 : inst.rs1;
+                uint32_t old = read_csr(uint32_t(imm));
+                if (inst.rs1 != 0) {
+                    write_csr(uint32_t(imm), old & ~value);
+                }
+                x[inst.rd] = old;
+            }
+            break;
+        case OP_MUL:
+            x[inst.rd] = rs1 * rs2;
+            break;
+        case OP_MULH:
+            x[inst.rd] = uint32_t((int64_t(int32_t(rs1)) * int64_t(int32_t(rs2))) >> 32);
+            break;
+        case OP_MULHSU:
+            x[inst.rd] = uint32_t((int64_t(int32_t(rs1)) * int64_t(uint64_t(rs2))) >> 32);
+            break;
+        case OP_MULHU:
+            x[inst.rd] = uint32_t((uint64_t(rs1) * uint64_t(rs2)) >> 32);
+            break;
+        case OP_DIV:
+            if (rs2 == 0) {
+                x[inst.rd] = 0xffffffff;
+            } else if (rs1 == 0x80000000 && rs2 == 0xffffffff) {
+                x[inst.rd] = rs1;
+            } else {
+                x[inst.rd] = uint32_t(int32_t(rs1) / int32_t(rs2));
+            }
+            break;
+        case OP_DIVU:
+            x[inst.rd] = (rs2 == 0) ? 0xffffffff : rs1 / rs2;
+            break;
+        case OP_REM:
+            if (rs2 == 0) {
+                x[inst.rd] = rs1;
+            } else if (rs1 == 0x80000000 && rs2 == 0xffffffff) {
+                x[inst.rd] = 0;
+            } else {
+                x[inst.rd] = uint32_t(int32_t(rs1) % int32_t(rs2));
+            }
+            break;
+        case OP_REMU:
+            x[inst.rd] = (rs2 == 0) ? rs1 : rs1 % rs2;
+            break;
+        case OP_LR_W:
+            x[inst.rd] = load<uint32_t>(rs1);
+            m_reserve_addr = rs1;
+            m_reserve_valid = true;
+            break;
+        case OP_SC_W:
+            if (m_reserve_valid && m_reserve_addr == rs1) {
+                store<uint32_t>(rs1, rs2);
+                x[inst.rd] = 0;
+            } else {
+                x[inst.rd] = 1;
+            }
+            m_reserve_valid = false;
+            break;
+        case OP_AMOSWAP_W:
+        case OP_AMOADD_W:
+        case OP_AMOXOR_W:
+        case OP_AMOAND_W:
+        case OP_AMOOR_W:
+        case OP_AMOMIN_W:
+        case OP_AMOMAX_W:
+        case OP_AMOMINU_W:
+        case OP_AMOMAXU_W:
+            {
+                uint32_t old = load<uint32_t>(rs1);
+                uint32_t value = rs2;
+                switch (inst.op) {
+                case OP_AMOADD_W:
+                    value = old + rs2;
+                    break;
+                case OP_AMOXOR_W:
+                    value = old ^ rs2;
+                    break;
+                case OP_AMOAND_W:
+                    value = old & rs2;
+                    break;
+                case OP_AMOOR_W:
+                    value = old | rs2;
+                    break;
+                case OP_AMOMIN_W:
+                    value = uint32_t(std::min(int32_t(old), int32_t(rs2)));
+                    break;
+                case OP_AMOMAX_W:
+                    value = uint32_t(std::max(int32_t(old), int32_t(rs2)));
+                    break;
+                case OP_AMOMINU_W:
+                    value = std::min(old, rs2);
+                    break;
+                case OP_AMOMAXU_W:
+                    value = std::max(old, rs2);
+                    break;
+                default:
+                    break;
+                }
+                store<uint32_t>(rs1, value);
+                x[inst.rd] = old;
+            }
+            break;
+        case OP_FLW:
+            f[inst.rd] = load<uint32_t>(rs1 + uint32_t(imm));
+            break;
+        case OP_FSW:
+            store<uint32_t>(rs1 + uint32_t(imm), f[inst.rs2]);
+            break;
+        case OP_FMADD_S:
+            f[inst.rd] =
+                canon(
+                    std::fma(
+                        as_float(f[inst.rs1]),
+                        as_float(f[inst.rs2]),
+                        as_float(f[inst.rs3])));
+            break;
+        case OP_FMSUB_S:
+            f[inst.rd] =
+                canon(
+                    std::fma(
+                        as_float(f[inst.rs1]),
+                        as_float(f[inst.rs2]),
+                        -as_float(f[inst.rs3])));
+            break;
+        case OP_FNMSUB_S:
+            f[inst.rd] =
+                canon(
+                    std::fma(
+                        -as_float(f[inst.rs1]),
+                        as_float(f[inst.rs2]),
+                        as_float(f[inst.rs3])));
+            break;
+        case OP_FNMADD_S:
+            f[inst.rd] =
+                canon(
+                    std::fma(
+                        -as_float(f[inst.rs1]),
+                        as_float(f[inst.rs2]),
+                        -as_float(f[inst.rs3])));
+            break;
+        case OP_FADD_S:
+            f[inst.rd] = canon(as_float(f[inst.rs1]) + as_float(f[inst.rs2]));
+            break;
+        case OP_FSUB_S:
+            f[inst.rd] = canon(as_float(f[inst.rs1]) - as_float(f[inst.rs2]));
+            break;
+        case OP_FMUL_S:
+            f[inst.rd] = canon(as_float(f[inst.rs1]) * as_float(f[inst.rs2]));
+            break;
+        case OP_FDIV_S:
+            f[inst.rd] = canon(as_float(f[inst.rs1]) / as_float(f[inst.rs2]));
+            break;
+        case OP_FSQRT_S:
+            f[inst.rd] = canon(std::sqrt(as_float(f[inst.rs1])));
+            break;
+        case OP_FSGNJ_S:
+            f[inst.rd] = (f[inst.rs1] & ~SIGN_MASK) | (f[inst.rs2] & SIGN_MASK);
+            break;
+        case OP_FSGNJN_S:
+            f[inst.rd] = (f[inst.rs1] & ~SIGN_MASK) | (~f[inst.rs2] & SIGN_MASK);
+            break;
+        case OP_FSGNJX_S:
+            f[inst.rd] = f[inst.rs1] ^ (f[inst.rs2] & SIGN_MASK);
+            break;
+        case OP_FMIN_S:
+            f[inst.rd] = fmin_s(f[inst.rs1], f[inst.rs2]);
+            break;
+        case OP_FMAX_S:
+            f[inst.rd] = fmax_s(f[inst.rs1], f[inst.rs2]);
+            break;
+        case OP_FCVT_W_S:
+            x[inst.rd] = fcvt_w_s(as_float(f[inst.rs1]), (inst.rm == 7) ? m_frm : inst.rm);
+            break;
+        case OP_FCVT_WU_S:
+            x[inst.rd] = fcvt_wu_s(as_float(f[inst.rs1]), (inst.rm == 7) ? m_frm : inst.rm);
+            break;
+        case OP_FMV_X_W:
+            x[inst.rd] = f[inst.rs1];
+            break;
+        case OP_FEQ_S:
+            x[inst.rd] = (as_float(f[inst.rs1]) == as_float(f[inst.rs2])) ? 1 : 0;
+            break;
+        case OP_FLT_S:
+            x[inst.rd] = (as_float(f[inst.rs1]) < as_float(f[inst.rs2])) ? 1 : 0;
+            break;
+        case OP_FLE_S:
+            x[inst.rd] = (as_float(f[inst.rs1]) <= as_float(f[inst.rs2])) ? 1 : 0;
+            break;
+        case OP_FCLASS_S:
+            x[inst.rd] = fclass_s(f[inst.rs1]);
+            break;
+        case OP_FCVT_S_W:
+            f[inst.rd] = as_u32(float(int32_t(rs1)));
+            break;
+        case OP_FCVT_S_WU:
+            f[inst.rd] = as_u32(float(rs1));
+            break;
+        case OP_FMV_W_X:
+            f[inst.rd] = rs1;
+            break;
+        case OP_BUILTIN:
+            call_builtin(inst.handler, uint32_t(imm));
+            x[inst.rd] = next_pc;
+            x[0] = 0;
+            next_pc = x[1];
+            break;
+        default:
+            illegal_inst(pc);
+            break;
+        }
+        x[0] = 0;
+        pc = next_pc;
+    }
+}
+
+uint32_t Riscv32LeanCoreImpl::get_arg(int index) {
+    static constexpr int reg_a0 = 10;
+    static constexpr int reg_sp = 2;
+    if (index < 0) {
+        throw std::runtime_error("Argument index is out of range");
+    }
+    if (index < 8) {
+        return m_x[reg_a0 + index];
+    } else {
+        // same convention as full hart
+        uint32_t addr = m_x[reg_sp] - uint32_t(index - 8);
+        return load<uint32_t>(addr);
+    }
+}
+
+void Riscv32LeanCoreImpl::set_ret(int index, uint32_t value) {
+    static constexpr int reg_a0 = 10;
+    if (!(index >= 0 && index < 2)) {
+        throw std::runtime_error("Argument index is out of range");
+    }
+    m_x[reg_a0 + index] = value;
+}
+
+uint8_t *Riscv32LeanCoreImpl::map_addr(uint32_t addr) {
+    return m_mem + addr;
+}
+
+void Riscv32LeanCoreImpl::decode(uint32_t pc, Inst &inst) {
+    uint32_t code = load<uint16_t>(pc);
+    inst.op = OP_ILLEGAL;
+    inst.rd = 0;
+    inst.rs1 = 0;
+    inst.rs2 = 0;
+    inst.rs3 = 0;
+    inst.rm = 0;
+    inst.imm = 0;
+    inst.handler = nullptr;
+    if ((code & 0x3) == 0x3) {
+        code |= uint32_t(load<uint16_t>(pc + 2)) << 16;
+        inst.size = 4;
+        decode32(code, inst);
+    } else {
+        inst.size = 2;
+        decode16(code, inst);
+    }
+    if (inst.op == OP_BUILTIN) {
+        bind_builtin(inst);
+    }
+}
+
+void Riscv32LeanCoreImpl::decode32(uint32_t code, Inst &inst) {
+    uint32_t opcode = bits(code, 6, 0);
+    uint32_t rd = bits(code, 11, 7);
+    uint32_t funct3 = bits(code, 14, 12);
+    uint32_t rs1 = bits(code, 19, 15);
+    uint32_t rs2 = bits(code, 24, 20);
+    uint32_t funct7 = bits(code, 31, 25);
+    int32_t imm_i = int32_t(code) >> 20;
+    int32_t imm_s = ((int32_t(code) >> 25) << 5) | int32_t(bits(code, 11, 7));
+    int32_t imm_b =
+        ((int32_t(code) >> 31) << 12) |
+        int32_t(bits(code, 7, 7) << 11) |
+        int32_t(bits(code, 30, 25) << 5) |
+        int32_t(bits(code, 11, 8) << 1);
+    int32_t imm_u = int32_t(code & 0xfffff000);
+    int32_t imm_j =
+        ((int32_t(code) >> 31) << 20) |
+        int32_t(code & 0xff000) |
+        int32_t(bits(code, 20, 20) << 11) |
+        int32_t(bits(code, 30, 21) << 1);
+    inst.rd = uint8_t(rd);
+    inst.rs1 = uint8_t(rs1);
+    inst.rs2 = uint8_t(rs2);
+    inst.rs3 = uint8_t(bits(code, 31, 27));
+    inst.rm = uint8_t(funct3);
+    switch (opcode) {
+    case 0x37:
+        inst.op = OP_LUI;
+        inst.imm = imm_u;
+        break;
+    case 0x17:
+        inst.op = OP_AUIPC;
+        inst.imm = imm_u;
+        break;
+    case 0x6f:
+        inst.op = OP_JAL;
+        inst.imm = imm_j;
+        break;
+    case 0x67:
+        if (funct3 == 0) {
+            inst.op = OP_JALR;
+            inst.imm = imm_i;
+        }
+        break;
+    case 0x63:
+        {
+            static const uint8_t ops[8] = {
+                OP_BEQ, OP_BNE, OP_ILLEGAL, OP_ILLEGAL,
+                OP_BLT, OP_BGE, OP_BLTU, OP_BGEU
+            };
+            inst.op = ops[funct3];
+            inst.imm = imm_b;
+        }
+        break;
+    case 0x03:
+        {
+            static const uint8_t ops[8] = {
+                OP_LB, OP_LH, OP_LW, OP_ILLEGAL,
+                OP_LBU, OP_LHU, OP_ILLEGAL, OP_ILLEGAL
+            };
+            inst.op = ops[funct3];
+            inst.imm = imm_i;
+        }
+        break;
+    case 0x23:
+        {
+            static const uint8_t ops[8] = {
+                OP_SB, OP_SH, OP_SW, OP_ILLEGAL,
+                OP_ILLEGAL, OP_ILLEGAL, OP_ILLEGAL, OP_ILLEGAL
+            };
+            inst.op = ops[funct3];
+            inst.imm = imm_s;
+        }
+        break;
+    case 0x13:
+        inst.imm = imm_i;
+        switch (funct3) {
+        case 0:
+            inst.op = OP_ADDI;
+            break;
+        case 1:
+            if (funct7 == 0x00) {
+                inst.op = OP_SLLI;
+                inst.imm = int32_t(rs2);
+            }
+            break;
+        case 2:
+            inst.op = OP_SLTI;
+            break;
+        case 3:
+            inst.op = OP_SLTIU;
+            break;
+        case 4:
+            inst.op = OP_XORI;
+            break;
+        case 5:
+            if (funct7 == 0x00) {
+                inst.op = OP_SRLI;
+                inst.imm = int32_t(rs2);
+            } else if (funct7 == 0x20) {
+                inst.op = OP_SRAI;
+                inst.imm = int32_t(rs2);
+            }
+            break;
+        case 6:
+            inst.op = OP_ORI;
+            break;
+        case 7:
+            inst.op = OP_ANDI;
+            break;
+        }
+        break;
+    case 0x33:
+        if (funct7 == 0x00) {
+            static const uint8_t ops[8] = {
+                OP_ADD, OP_SLL, OP_SLT, OP_SLTU,
+                OP_XOR, OP_SRL, OP_OR, OP_AND
+            };
+            inst.op = ops[funct3];
+        } else if (funct7 == 0x20) {
+            if (funct3 == 0) {
+                inst.op = OP_SUB;
+            } else if (funct3 == 5) {
+                inst.op = OP_SRA;
+            }
+        } else if (funct7 == 0x01) {
+            static const uint8_t ops[8] = {
+                OP_MUL, OP_MULH, OP_MULHSU, OP_MULHU,
+                OP_DIV, OP_DIVU, OP_REM, OP_REMU
+            };
+            inst.op = ops[funct3];
+        }
+        break;
+    case 0x0f:
+        // fence, fence.i
+        inst.op = OP_FENCE;
+        break;
+    case 0x73:
+        inst.imm = int32_t(bits(code, 31, 20));
+        switch (funct3) {
+        case 0:
+            if (code == 0x00000073) {
+                inst.op = OP_ECALL;
+            } else if (code == 0x00100073) {
+                inst.op = OP_EBREAK;
+            } else if (code == 0x10500073) {
+                // wfi: no interrupts, treat as no-op
+                inst.op = OP_FENCE;
+            }
+            break;
+        case 1:
+            inst.op = OP_CSRRW;
+            break;
+        case 2:
+            inst.op = OP_CSRRS;
+            break;
+        case 3:
+            inst.op = OP_CSRRC;
+            break;
+        case 5:
+            inst.op = OP_CSRRWI;
+            break;
+        case 6:
+            inst.op = OP_CSRRSI;
+            break;
+        case 7:
+            inst.op = OP_CSRRCI;
+            break;
+        }
+        break;
+    case 0x2f:
+        if (funct3 == 2) {
+            switch (funct7 >> 2) {
+            case 0x02:
+                if (rs2 == 0) {
+                    inst.op = OP_LR_W;
+                }
+                break;
+            case 0x03:
+                inst.op = OP_SC_W;
+                break;
+            case 0x01:
+                inst.op = OP_AMOSWAP_W;
+                break;
+            case 0x00:
+                inst.op = OP_AMOADD_W;
+                break;
+            case 0x04:
+                inst.op = OP_AMOXOR_W;
+                break;
+            case 0x0c:
+                inst.op = OP_AMOAND_W;
+                break;
+            case 0x08:
+                inst.op = OP_AMOOR_W;
+                break;
+            case 0x10:
+                inst.op = OP_AMOMIN_W;
+                break;
+            case 0x14:
+                inst.op = OP_AMOMAX_W;
+                break;
+            case 0x18:
+                inst.op = OP_AMOMINU_W;
+                break;
+            case 0x1c:
+                inst.op = OP_AMOMAXU_W;
+                break;
+            }
+        }
+        break;
+    case 0x07:
+        if (funct3 == 2) {
+            inst.op = OP_FLW;
+            inst.imm = imm_i;
+        }
+        break;
+    case 0x27:
+        if (funct3 == 2) {
+            inst.op = OP_FSW;
+            inst.imm = imm_s;
+        }
+        break;
+    case 0x43:
+    case 0x47:
+    case 0x4b:
+    case 0x4f:
+        // single precision format only
+        if (bits(code, 26, 25) == 0) {
+            static const uint8_t ops[4] = {
+                OP_FMADD_S, OP_FMSUB_S, OP_FNMSUB_S, OP_FNMADD_S
+            };
+            inst.op = ops[(opcode >> 2) & 0x3];
+        }
+        break;
+    case 0x53:
+        switch (funct7) {
+        case 0x00:
+            inst.op = OP_FADD_S;
+            break;
+        case 0x04:
+            inst.op = OP_FSUB_S;
+            break;
+        case 0x08:
+            inst.op = OP_FMUL_S;
+            break;
+        case 0x0c:
+            inst.op = OP_FDIV_S;
+            break;
+        case 0x2c:
+            if (rs2 == 0) {
+                inst.op = OP_FSQRT_S;
+            }
+            break;
+        case 0x10:
+            if (funct3 == 0) {
+                inst.op = OP_FSGNJ_S;
+            } else if (funct3 == 1) {
+                inst.op = OP_FSGNJN_S;
+            } else if (funct3 == 2) {
+                inst.op = OP_FSGNJX_S;
+            }
+            break;
+        case 0x14:
+            if (funct3 == 0) {
+                inst.op = OP_FMIN_S;
+            } else if (funct3 == 1) {
+                inst.op = OP_FMAX_S;
+            }
+            break;
+        case 0x60:
+            if (rs2 == 0) {
+                inst.op = OP_FCVT_W_S;
+            } else if (rs2 == 1) {
+                inst.op = OP_FCVT_WU_S;
+            }
+            break;
+        case 0x70:
+            if (rs2 == 0 && funct3 == 0) {
+                inst.op = OP_FMV_X_W;
+            } else if (rs2 == 0 && funct3 == 1) {
+                inst.op = OP_FCLASS_S;
+            }
+            break;
+        case 0x50:
+            if (funct3 == 2) {
+                inst.op = OP_FEQ_S;
+            } else if (funct3 == 1) {
+                inst.op = OP_FLT_S;
+            } else if (funct3 == 0) {
+                inst.op = OP_FLE_S;
+            }
+            break;
+        case 0x68:
+            if (rs2 == 0) {
+                inst.op = OP_FCVT_S_W;
+            } else if (rs2 == 1) {
+                inst.op = OP_FCVT_S_WU;
+            }
+            break;
+        case 0x78:
+            if (rs2 == 0 && funct3 == 0) {
+                inst.op = OP_FMV_W_X;
+            }
+            break;
+        }
+        break;
+    case 0x5b:
+        // custom-2 U-Type: builtin rd, id
+        inst.op = OP_BUILTIN;
+        inst.imm = int32_t(bits(code, 31, 12));
+        break;
+    }
+}
+
+void Riscv32LeanCoreImpl::decode16(uint32_t code, Inst &inst) {
+    uint32_t quadrant = bits(code, 1, 0);
+    uint32_t funct3 = bits(code, 15, 13);
+    // full and compressed ("prime") register fields
+    uint32_t r_11_7 = bits(code, 11, 7);
+    uint32_t r_6_2 = bits(code, 6, 2);
+    uint32_t rp_9_7 = bits(code, 9, 7) + 8;
+    uint32_t rp_4_2 = bits(code, 4, 2) + 8;
+    // c.lw, c.sw, c.flw, c.fsw offset
+    int32_t imm_lw =
+        int32_t(
+            (bits(code, 12, 10) << 3) |
+            (bits(code, 6, 6) << 2) |
+            (bits(code, 5, 5) << 6));
+    // c.addi, c.li, c.andi immediate
+    int32_t imm_ci = sext((bits(code, 12, 12) << 5) | bits(code, 6, 2), 6);
+    // c.j, c.jal offset
+    int32_t imm_cj =
+        sext(
+            (bits(code, 12, 12) << 11) |
+            (bits(code, 11, 11) << 4) |
+            (bits(code, 10, 9) << 8) |
+            (bits(code, 8, 8) << 10) |
+            (bits(code, 7, 7) << 6) |
+            (bits(code, 6, 6) << 7) |
+            (bits(code, 5, 3) << 1) |
+            (bits(code, 2, 2) << 5),
+            12);
+    // c.beqz, c.bnez offset
+    int32_t imm_cb =
+        sext(
+            (bits(code, 12, 12) << 8) |
+            (bits(code, 11, 10) << 3) |
+            (bits(code, 6, 5) << 6) |
+            (bits(code, 4, 3) << 1) |
+            (bits(code, 2, 2) << 5),
+            9);
+    // c.lwsp, c.flwsp offset
+    int32_t imm_lwsp =
+        int32_t(
+            (bits(code, 12, 12) << 5) |
+            (bits(code, 6, 4) << 2) |
+            (bits(code, 3, 2) << 6));
+    // c.swsp, c.fswsp offset
+    int32_t imm_swsp = int32_t((bits(code, 12, 9) << 2) | (bits(code, 8, 7) << 6));
+    if (quadrant == 0) {
+        switch (funct3) {
+        case 0:
+            {
+                // c.addi4spn
+                uint32_t imm =
+                    (bits(code, 12, 11) << 4) |
+                    (bits(code, 10, 7) << 6) |
+                    (bits(code, 6, 6) << 2) |
+                    (bits(code, 5, 5) << 3);
+                if (imm != 0) {
+                    inst.op = OP_ADDI;
+                    inst.rd = uint8_t(rp_4_2);
+                    inst.rs1 = 2;
+                    inst.imm = int32_t(imm);
+                }
+            }
+            break;
+        case 2:
+            inst.op = OP_LW;
+            inst.rd = uint8_t(rp_4_2);
+            inst.rs1 = uint8_t(rp_9_7);
+            inst.imm = imm_lw;
+            break;
+        case 3:
+            inst.op = OP_FLW;
+            inst.rd = uint8_t(rp_4_2);
+            inst.rs1 = uint8_t(rp_9_7);
+            inst.imm = imm_lw;
+            break;
+        case 6:
+            inst.op = OP_SW;
+            inst.rs1 = uint8_t(rp_9_7);
+            inst.rs2 = uint8_t(rp_4_2);
+            inst.imm = imm_lw;
+            break;
+        case 7:
+            inst.op = OP_FSW;
+            inst.rs1 = uint8_t(rp_9_7);
+            inst.rs2 = uint8_t(rp_4_2);
+            inst.imm = imm_lw;
+            break;
+        }
+    } else if (quadrant == 1) {
+        switch (funct3) {
+        case 0:
+            // c.addi, c.nop
+            inst.op = OP_ADDI;
+            inst.rd = uint8_t(r_11_7);
+            inst.rs1 = uint8_t(r_11_7);
+            inst.imm = imm_ci;
+            break;
+        case 1:
+            // c.jal
+            inst.op = OP_JAL;
+            inst.rd = 1;
+            inst.imm = imm_cj;
+            break;
+        case 2:
+            // c.li
+            inst.op = OP_ADDI;
+            inst.rd = uint8_t(r_11_7);
+            inst.rs1 = 0;
+            inst.imm = imm_ci;
+            break;
+        case 3:
+            if (r_11_7 == 2) {
+                // c.addi16sp
+                int32_t imm =
+                    sext(
+                        (bits(code, 12, 12) << 9) |
+                        (bits(code, 6, 6) << 4) |
+                        (bits(code, 5, 5) << 6) |
+                        (bits(code, 4, 3) << 7) |
+                        (bits(code, 2, 2) << 5),
+                        10);
+                if (imm != 0) {
+                    inst.op = OP_ADDI;
+                    inst.rd = 2;
+                    inst.rs1 = 2;
+                    inst.imm = imm;
+                }
+            } else {
+                // c.lui
+                if (imm_ci != 0) {
+                    inst.op = OP_LUI;
+                    inst.rd = uint8_t(r_11_7);
+                    inst.imm = imm_ci << 12;
+                }
+            }
+            break;
+        case 4:
+            {
+                uint32_t funct2 = bits(code, 11, 10);
+                inst.rd = uint8_t(rp_9_7);
+                inst.rs1 = uint8_t(rp_9_7);
+                if (funct2 == 0 || funct2 == 1) {
+                    // c.srli, c.srai (shamt[5] must be zero on RV32)
+                    if (bits(code, 12, 12) == 0) {
+                        inst.op = (funct2 == 0) ? OP_SRLI : OP_SRAI;
+                        inst.imm = int32_t(r_6_2);
+                    }
+                } else if (funct2 == 2) {
+                    inst.op = OP_ANDI;
+                    inst.imm = imm_ci;
+                } else if (bits(code, 12, 12) == 0) {
+                    static const uint8_t ops[4] = {OP_SUB, OP_XOR, OP_OR, OP_AND};
+                    inst.op = ops[bits(code, 6, 5)];
+                    inst.rs2 = uint8_t(rp_4_2);
+                }
+            }
+            break;
+        case 5:
+            // c.j
+            inst.op = OP_JAL;
+            inst.rd = 0;
+            inst.imm = imm_cj;
+            break;
+        case 6:
+        case 7:
+            // c.beqz, c.bnez
+            inst.op = (funct3 == 6) ? OP_BEQ : OP_BNE;
+            inst.rs1 = uint8_t(rp_9_7);
+            inst.rs2 = 0;
+            inst.imm = imm_cb;
+            break;
+        }
+    } else if (quadrant == 2) {
+        switch (funct3) {
+        case 0:
+            // c.slli
+            if (bits(code, 12, 12) == 0) {
+                inst.op = OP_SLLI;
+                inst.rd = uint8_t(r_11_7);
+                inst.rs1 = uint8_t(r_11_7);
+                inst.imm = int32_t(r_6_2);
+            }
+            break;
+        case 2:
+            // c.lwsp
+            if (r_11_7 != 0) {
+                inst.op = OP_LW;
+                inst.rd = uint8_t(r_11_7);
+                inst.rs1 = 2;
+                inst.imm = imm_lwsp;
+            }
+            break;
+        case 3:
+            // c.flwsp
+            inst.op = OP_FLW;
+            inst.rd = uint8_t(r_11_7);
+            inst.rs1 = 2;
+            inst.imm = imm_lwsp;
+            break;
+        case 4:
+            if (bits(code, 12, 12) == 0) {
+                if (r_6_2 == 0) {
+                    // c.jr
+                    if (r_11_7 != 0) {
+                        inst.op = OP_JALR;
+                        inst.rd = 0;
+                        inst.rs1 = uint8_t(r_11_7);
+                    }
+                } else {
+                    // c.mv
+                    inst.op = OP_ADD;
+                    inst.rd = uint8_t(r_11_7);
+                    inst.rs1 = 0;
+                    inst.rs2 = uint8_t(r_6_2);
+                }
+            } else {
+                if (r_6_2 == 0) {
+                    if (r_11_7 == 0) {
+                        inst.op = OP_EBREAK;
+                    } else {
+                        // c.jalr
+                        inst.op = OP_JALR;
+                        inst.rd = 1;
+                        inst.rs1 = uint8_t(r_11_7);
+                    }
+                } else {
+                    // c.add
+                    inst.op = OP_ADD;
+                    inst.rd = uint8_t(r_11_7);
+                    inst.rs1 = uint8_t(r_11_7);
+                    inst.rs2 = uint8_t(r_6_2);
+                }
+            }
+            break;
+        case 6:
+            // c.swsp
+            inst.op = OP_SW;
+            inst.rs1 = 2;
+            inst.rs2 = uint8_t(r_6_2);
+            inst.imm = imm_swsp;
+            break;
+        case 7:
+            // c.fswsp
+            inst.op = OP_FSW;
+            inst.rs1 = 2;
+            inst.rs2 = uint8_t(r_6_2);
+            inst.imm = imm_swsp;
+            break;
+        }
+    }
+}
+
+void Riscv32LeanCoreImpl::bind_builtin(Inst &inst) {
+    if (m_builtin_handler == nullptr) {
+        throw std::runtime_error("Missing builtin handler");
+    }
+    inst.handler = m_builtin_handler->resolve(inst.imm);
+}
+
+void Riscv32LeanCoreImpl::call_builtin(Riscv32BuiltinHandler *handler, uint32_t id) {
+    if (handler == nullptr) {
+        throw std::runtime_error("Missing builtin handler");
+    }
+    handler->call(this, int(id));
+}
+
+uint32_t Riscv32LeanCoreImpl::read_csr(uint32_t csr) {
+    switch (csr) {
+    case CSR_FFLAGS:
+        return m_fflags;
+    case CSR_FRM:
+        return m_frm;
+    case CSR_FCSR:
+        return (m_frm << 5) | m_fflags;
+    case CSR_CYCLE:
+    case CSR_TIME:
+    case CSR_INSTRET:
+    case CSR_MCYCLE:
+    case CSR_MINSTRET:
+        return uint32_t(m_inst_count);
+    case CSR_CYCLEH:
+    case CSR_TIMEH:
+    case CSR_INSTRETH:
+    case CSR_MCYCLEH:
+    case CSR_MINSTRETH:
+        return uint32_t(m_inst_count >> 32);
+    case CSR_MHARTID:
+        return uint32_t(m_id);
+    default:
+        return 0;
+    }
+}
+
+void Riscv32LeanCoreImpl::write_csr(uint32_t csr, uint32_t value) {
+    switch (csr) {
+    case CSR_FFLAGS:
+        m_fflags = value & 0x1f;
+        break;
+    case CSR_FRM:
+        m_frm = value & 0x7;
+        break;
+    case CSR_FCSR:
+        m_fflags = value & 0x1f;
+        m_frm = (value >> 5) & 0x7;
+        break;
+    default:
+        // other CSRs are not modeled
+        break;
+    }
+}
+
+void Riscv32LeanCoreImpl::invalidate_code() {
+    for (Inst &inst: m_code) {
+        inst.size = 0;
+    }
+}
+
+void Riscv32LeanCoreImpl::bad_access(uint32_t addr, uint32_t size) {
+    throw std::runtime_error(
+        "Memory access out of range: address " + to_hex(addr) +
+            " size " + std::to_string(size));
+}
+
+void Riscv32LeanCoreImpl::bad_pc(uint32_t pc) {
+    throw std::runtime_error("PC is out of code region: " + to_hex(pc));
+}
+
+void Riscv32LeanCoreImpl::illegal_inst(uint32_t pc) {
+    uint32_t code = load<uint16_t>(pc);
+    if ((code & 0x3) == 0x3) {
+        code |= uint32_t(load<uint16_t>(pc + 2)) << 16;
+    }
+    throw std::runtime_error(
+        "Illegal or unsupported instruction " + to_hex(code) + " at " + to_hex(pc));
+}
+
+template<typename T>
+T Riscv32LeanCoreImpl::load(uint32_t addr) {
+    if (addr > m_mem_size - sizeof(T)) {
+        bad_access(addr, sizeof(T));
+    }
+    T value;
+    memcpy(&value, m_mem + addr, sizeof(T));
+    return value;
+}
+
+template<typename T>
+void Riscv32LeanCoreImpl::store(uint32_t addr, T value) {
+    if (addr > m_mem_size - sizeof(T)) {
+        bad_access(addr, sizeof(T));
+    }
+    memcpy(m_mem + addr, &value, sizeof(T));
+}
+
+} // namespace core
+} // namespace riscv
+
@@ -0,0 +1,106 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "riscv/riscv32.hpp"
+
+namespace riscv {
+namespace core {
+
+//
+//    Lean RV32IMFC hart for bare-metal kernels
+//
+//    Flat bounds-checked memory access, no MMU, PMA/PMP, interrupts,
+//    triggers or vectors. Instructions are pre-decoded per code region.
+//    Floating point uses host arithmetic with round-to-nearest-even
+//    (static rounding modes are honored only by float to integer
+//    conversions); accrued exception flags are not tracked.
+//
+//    Code must be written via 'write_code' (direct writes to code
+//    region are not seen by decoded instruction cache unless followed
+//    by 'invalidate_code').
+//
+
+class Riscv32LeanCoreImpl: public Riscv32Core {
+public:
+    Riscv32LeanCoreImpl(int id, uint8_t *mem, uint32_t mem_size);
+    ~Riscv32LeanCoreImpl();
+public:
+    void set_builtin_handler(Riscv32BuiltinHandler *builtin_handler) override;
+    void set_memory_layout(
+        uint32_t code_base,
+        uint32_t code_size,
+        uint32_t local_base,
+        uint32_t local_size) override;
+    uint32_t code_base() override {
+        return m_code_base;
+    }
+    uint32_t code_size() override {
+        return m_code_size;
+    }
+    uint32_t local_base() override {
+        return m_local_base;
+    }
+    uint32_t local_size() override {
+        return m_local_size;
+    }
+    void write_code(uint32_t addr, const std::vector<uint8_t> &code) override;
+    void invalidate_code() override;
+    void run(uint32_t start_pc) override;
+    uint32_t get_arg(int index) override;
+    void set_ret(int index, uint32_t value) override;
+    uint8_t *map_addr(uint32_t addr) override;
+private:
+    struct Inst {
+        uint8_t op;
+        uint8_t size;   // 0 if not decoded yet
+        uint8_t rd;
+        uint8_t rs1;
+        uint8_t rs2;
+        uint8_t rs3;
+        uint8_t rm;
+        int32_t imm;
+        Riscv32BuiltinHandler *handler;
+    };
+private:
+    void decode(uint32_t pc, Inst &inst);
+    void decode32(uint32_t code, Inst &inst);
+    void decode16(uint32_t code, Inst &inst);
+    void bind_builtin(Inst &inst);
+    void call_builtin(Riscv32BuiltinHandler *handler, uint32_t id);
+    uint32_t read_csr(uint32_t csr);
+    void write_csr(uint32_t csr, uint32_t value);
+    [[noreturn]] void bad_access(uint32_t addr, uint32_t size);
+    [[noreturn]] void bad_pc(uint32_t pc);
+    [[noreturn]] void illegal_inst(uint32_t pc);
+    template<typename T>
+    T load(uint32_t addr);
+    template<typename T>
+    void store(uint32_t addr, T value);
+private:
+    int m_id;
+    uint8_t *m_mem;
+    uint32_t m_mem_size;
+    Riscv32BuiltinHandler *m_builtin_handler;
+    uint32_t m_code_base;
+    uint32_t m_code_size;
+    uint32_t m_local_base;
+    uint32_t m_local_size;
+    uint32_t m_x[32];
+    uint32_t m_f[32];
+    uint32_t m_frm;
+    uint32_t m_fflags;
+    uint64_t m_inst_count;
+    uint32_t m_reserve_addr;
+    bool m_reserve_valid;
+    std::vector<Inst> m_code;
+};
+
+} // namespace core
+} // namespace riscv
+
@@ -61,6 +61,7 @@ typedef uint32_t uint32;
 struct Global {
     uint32 addr;
     uint32 log2_page_size;
+    uint32 bank_pages;
 };
 
 struct Local {
@@ -181,6 +182,10 @@ ALWI void tanto_matmul_init(bool transpose, uint32 ct_dim, uint32 rt_dim, uint32
     MATH(( llk_math_matmul_init<MATH_FIDELITY>(0, 1, transpose, ct_dim, rt_dim, kt_dim) ));
 }
 
+ALWI void tanto_matmul_block_init(bool transpose, uint32 ct_dim) { 
+    MATH(( llk_math_matmul_init<MATH_FIDELITY>(0, 1, transpose, ct_dim, 1, 1) ));
+}
+
 ALWI void tanto_reduce_max_rows_init() { 
     MATH(( llk_math_reduce_init<PoolType::MAX, ReduceDim::REDUCE_ROW, MATH_FIDELITY>() ));
 }
@@ -488,6 +493,11 @@ ALWI void tanto_unpack_matmul_init(uint32 icb0, uint32 icb1, bool transpose, uin
     UNPACK(( llk_unpack_AB_matmul_init(icb0, icb1, transpose, ct_dim, rt_dim, kt_dim) ));
 }
 
+ALWI void tanto_unpack_matmul_block_init(uint32 icb0, uint32 icb1, bool transpose, uint32 ct_dim) { 
+    UNPACK(( llk_unpack_AB_matmul_hw_configure_disaggregated<DST_ACCUM_MODE>(icb0, icb1) ));
+    UNPACK(( llk_unpack_AB_matmul_init(icb0, icb1, transpose, ct_dim, 1, 1) ));
+}
+
 ALWI void tanto_unpack_unary_init(uint32 icb) {
     UNPACK(( llk_unpack_A_hw_configure_disaggregated<DST_ACCUM_MODE>(icb) ));
     // transpose_of_faces = 0, within_face_16x16_transpose = 0
@@ -13,6 +13,7 @@ typedef uint32_t uint32;
 struct Global {
     uint32 addr;
     uint32 log2_page_size;
+    uint32 bank_pages;
 };
 
 struct Local {
@@ -30,6 +31,16 @@ struct Semaphore {
 
 #define tanto_get_semaphore(x) get_semaphore(x)
 
+// byte size of block float data; valid for tile aligned item counts only
+
+FORCE_INLINE uint32 tanto_bfp8_bytes(uint32 items) {
+    return items + (items >> 4);
+}
+
+FORCE_INLINE uint32 tanto_bfp4_bytes(uint32 items) {
+    return (items >> 1) + (items >> 4);
+}
+
 FORCE_INLINE uint64_t __get_noc_addr_global_dram(
         uint32_t base_addr, 
         uint32_t log2_page_size, 
@@ -241,4 +252,87 @@ FORCE_INLINE void noc_async_write_cyclic_dram(
     __noc_fast_write_global(src_addr, dst_noc_addr, len_bytes);
 }
 
+FORCE_INLINE uint64_t __get_noc_addr_block_dram(
+        uint32_t base_addr,
+        uint32_t page_id,
+        uint32_t page_size,
+        uint32_t bank_pages,
+        uint32_t offset) {
+    uint32_t bank_id = page_id / bank_pages;
+    uint32_t addr = (page_id - bank_id * bank_pages) * page_size;
+    addr += base_addr + offset;
+    addr += bank_to_dram_offset[bank_id];
+    uint32_t noc_xy = dram_bank_to_noc_xy[noc_index][bank_id];
+    return get_noc_addr_helper(noc_xy, addr);
+}
+
+FORCE_INLINE void noc_async_read_block_dram(
+        uint32_t dst_addr,
+        uint32_t src_addr,
+        uint32_t src_page_size,
+        uint32_t src_bank_pages,
+        uint32_t src_page_id,
+        uint32_t src_offset,
+        uint32_t len_bytes) {
+    uint64_t src_noc_addr =
+        __get_noc_addr_block_dram(
+            src_addr,
+            src_page_id,
+            src_page_size,
+            src_bank_pages,
+            src_offset);
+    __noc_fast_read_global(dst_addr, src_noc_addr, len_bytes);
+}
+
+FORCE_INLINE void noc_async_write_block_dram(
+        uint32_t src_addr,
+        uint32_t dst_addr,
+        uint32_t dst_page_size,
+        uint32_t dst_bank_pages,
+        uint32_t dst_page_id,
+        uint32_t dst_offset,
+        uint32_t len_bytes) {
+    uint64_t dst_noc_addr =
+        __get_noc_addr_block_dram(
+            dst_addr,
+            dst_page_id,
+            dst_page_size,
+            dst_bank_pages,
+            dst_offset);
+    __noc_fast_write_global(src_addr, dst_noc_addr, len_bytes);
+}
+
+FORCE_INLINE void noc_async_read_2d(
+        uint64_t src_noc_addr,
+        uint32_t dst_addr,
+        uint32_t rows,
+        uint32_t len_bytes,
+        uint32_t src_stride,
+        uint32_t dst_stride) {
+    // each row must fit in one NoC packet (NOC_MAX_BURST_SIZE)
+    uint32_t src_addr = uint32_t(src_noc_addr);
+    noc_async_read_one_packet_set_state(src_noc_addr, len_bytes);
+    for (uint32_t i = 0; i < rows; i++) {
+        noc_async_read_one_packet_with_state(src_addr, dst_addr);
+        src_addr += src_stride;
+        dst_addr += dst_stride;
+    }
+}
+
+FORCE_INLINE void noc_async_write_2d(
+        uint32_t src_addr,
+        uint64_t dst_noc_addr,
+        uint32_t rows,
+        uint32_t len_bytes,
+        uint32_t src_stride,
+        uint32_t dst_stride) {
+    // each row must fit in one NoC packet (NOC_MAX_BURST_SIZE)
+    uint32_t dst_addr = uint32_t(dst_noc_addr);
+    noc_async_write_one_packet_set_state(dst_noc_addr, len_bytes);
+    for (uint32_t i = 0; i < rows; i++) {
+        noc_async_write_one_packet_with_state(src_addr, dst_addr);
+        src_addr += src_stride;
+        dst_addr += dst_stride;
+    }
+}
 
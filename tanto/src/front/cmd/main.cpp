@@ -108,8 +108,10 @@ bool parse_args(
         int argc,
         char **argv,
         FrontendArgs &args,
-        std::string &input_path) {
+        std::string &input_path,
+        std::string &pipe_report_path) {
     args.mode = FrontendMode::UNDEF;
+    args.pipe_report = false;
     int iarg = 1;
     for ( ; iarg < argc; iarg++) {
         char *argp = argv[iarg];
@@ -139,6 +141,13 @@ bool parse_args(
                 return false;
             }
             args.params.emplace_back(index, value);
+        } else if (has_prefix(argp, "--pipe-report=")) {
+            pipe_report_path = argp + 14;
+            if (pipe_report_path.empty()) {
+                printf("Missing pipe report path\n");
+                return false;
+            }
+            args.pipe_report = true;
         }
     }
     if (!validate_args(args)) {
@@ -157,7 +166,8 @@ bool parse_args(
 int main(int argc, char **argv) {
     FrontendArgs args;
     std::string input_path;
-    if (!parse_args(argc, argv, args, input_path)) {
+    std::string pipe_report_path;
+    if (!parse_args(argc, argv, args, input_path, pipe_report_path)) {
         printf("Invalid command line arguments\n");
         return 1;
     }
@@ -167,8 +177,9 @@ int main(int argc, char **argv) {
         return 1;
     }
     std::string output_code;
+    std::string pipe_report;
     std::vector<std::string> errors;
-    bool ok = run_frontend(args, input_code, output_code, errors);
+    bool ok = run_frontend(args, input_code, output_code, pipe_report, errors);
     if (!ok) {
         for (std::string text: errors) {
             printf("%s\n", text.c_str());
@@ -176,6 +187,10 @@ int main(int argc, char **argv) {
         printf("Compilation failed\n");
         return 1;
     }
+    if (args.pipe_report && !write_file(pipe_report_path, pipe_report)) {
+        printf("Cannot write pipe report file [%s]\n", pipe_report_path.c_str());
+        return 1;
+    }
     printf("%s\n", output_code.c_str());
     return 0;
 }
@@ -20,7 +20,18 @@ bool run_frontend(
         const std::string &input_code,
         std::string &output_code,
         std::vector<std::string> &errors) {
+    std::string pipe_report;
+    return run_frontend(args, input_code, output_code, pipe_report, errors);
+}
+
+bool run_frontend(
+        const FrontendArgs &args, 
+        const std::string &input_code,
+        std::string &output_code,
+        std::string &pipe_report,
+        std::vector<std::string> &errors) {
     output_code.clear();
+    pipe_report.clear();
     errors.clear();
     Frontend frontend;
     for (std::pair<std::string, std::string> define: args.defines) {
@@ -30,6 +41,9 @@ bool run_frontend(
         frontend.add_param(param.first, param.second);
     }
     bool ok = frontend.compile(args.mode, input_code, output_code);
+    if (ok && args.pipe_report) {
+        ok = frontend.analyze_pipes(args.mode, input_code, pipe_report);
+    }
     if (!ok) {
         errors = frontend.get_errors();
         return false;
@@ -19,6 +19,7 @@ struct FrontendArgs {
     FrontendMode mode;
     std::vector<std::pair<std::string, std::string>> defines;
     std::vector<std::pair<uint32_t, uint32_t>> params;
+    bool pipe_report;
 };
 
 bool run_frontend(
@@ -27,6 +28,13 @@ bool run_frontend(
     std::string &output_code,
     std::vector<std::string> &errors);
 
+bool run_frontend(
+    const FrontendArgs &args, 
+    const std::string &input_code,
+    std::string &output_code,
+    std::string &pipe_report,
+    std::vector<std::string> &errors);
+
 } // namespace front
 } // namespace tanto
 } // namespace ronin
@@ -30,6 +30,17 @@ struct bfloat16 {
     uint32 value;
 };
 
+// block-float formats: tiles of 1024 items, 16 items share exponent;
+// global, local, and pipe offsets and counts must be multiples of 1024
+
+struct bfp8_b {
+    uint32 value;
+};
+
+struct bfp4_b {
+    uint32 value;
+};
+
 //
 //    Parameters
 //
@@ -200,6 +211,78 @@ public:
         uint32 dst_offset, 
         pipe<T> src, 
         uint32 src_offset);
+    void read_2d(
+        uint32 dst_offset, 
+        local<T> src, 
+        uint32 src_offset, 
+        uint32 rows, 
+        uint32 count, 
+        uint32 dst_stride, 
+        uint32 src_stride);
+    void read_2d(
+        uint32 dst_offset, 
+        local<T> src, 
+        uint32 src_offset, 
+        uint32 rows, 
+        uint32 count, 
+        uint32 dst_stride, 
+        uint32 src_stride, 
+        uint32 x, 
+        uint32 y);
+    void read_2d(
+        uint32 dst_offset, 
+        pipe<T> src, 
+        uint32 src_offset, 
+        uint32 rows, 
+        uint32 count, 
+        uint32 dst_stride, 
+        uint32 src_stride);
+    void read_2d(
+        uint32 dst_offset, 
+        pipe<T> src, 
+        uint32 src_offset, 
+        uint32 rows, 
+        uint32 count, 
+        uint32 dst_stride, 
+        uint32 src_stride, 
+        uint32 x, 
+        uint32 y);
+    void write_2d(
+        uint32 src_offset, 
+        local<T> dst, 
+        uint32 dst_offset, 
+        uint32 rows, 
+        uint32 count, 
+        uint32 src_stride, 
+        uint32 dst_stride);
+    void write_2d(
+        uint32 src_offset, 
+        local<T> dst, 
+        uint32 dst_offset, 
+        uint32 rows, 
+        uint32 count, 
+        uint32 src_stride, 
+        uint32 dst_stride, 
+        uint32 x, 
+        uint32 y);
+    void write_2d(
+        uint32 src_offset, 
+        pipe<T> dst, 
+        uint32 dst_offset, 
+        uint32 rows, 
+        uint32 count, 
+        uint32 src_stride, 
+        uint32 dst_stride);
+    void write_2d(
+        uint32 src_offset, 
+        pipe<T> dst, 
+        uint32 dst_offset, 
+        uint32 rows, 
+        uint32 count, 
+        uint32 src_stride, 
+        uint32 dst_stride, 
+        uint32 x, 
+        uint32 y);
 };
 
 //
@@ -339,6 +422,78 @@ public:
         uint32 dst_offset, 
         pipe<T> src, 
         uint32 src_offset);
+    void read_2d(
+        uint32 dst_offset, 
+        local<T> src, 
+        uint32 src_offset, 
+        uint32 rows, 
+        uint32 count, 
+        uint32 dst_stride, 
+        uint32 src_stride);
+    void read_2d(
+        uint32 dst_offset, 
+        local<T> src, 
+        uint32 src_offset, 
+        uint32 rows, 
+        uint32 count, 
+        uint32 dst_stride, 
+        uint32 src_stride, 
+        uint32 x, 
+        uint32 y);
+    void read_2d(
+        uint32 dst_offset, 
+        pipe<T> src, 
+        uint32 src_offset, 
+        uint32 rows, 
+        uint32 count, 
+        uint32 dst_stride, 
+        uint32 src_stride);
+    void read_2d(
+        uint32 dst_offset, 
+        pipe<T> src, 
+        uint32 src_offset, 
+        uint32 rows, 
+        uint32 count, 
+        uint32 dst_stride, 
+        uint32 src_stride, 
+        uint32 x, 
+        uint32 y);
+    void write_2d(
+        uint32 src_offset, 
+        local<T> dst, 
+        uint32 dst_offset, 
+        uint32 rows, 
+        uint32 count, 
+        uint32 src_stride, 
+        uint32 dst_stride);
+    void write_2d(
+        uint32 src_offset, 
+        local<T> dst, 
+        uint32 dst_offset, 
+        uint32 rows, 
+        uint32 count, 
+        uint32 src_stride, 
+        uint32 dst_stride, 
+        uint32 x, 
+        uint32 y);
+    void write_2d(
+        uint32 src_offset, 
+        pipe<T> dst, 
+        uint32 dst_offset, 
+        uint32 rows, 
+        uint32 count, 
+        uint32 src_stride, 
+        uint32 dst_stride);
+    void write_2d(
+        uint32 src_offset, 
+        pipe<T> dst, 
+        uint32 dst_offset, 
+        uint32 rows, 
+        uint32 count, 
+        uint32 src_stride, 
+        uint32 dst_stride, 
+        uint32 x, 
+        uint32 y);
 };
 
 //
@@ -478,6 +633,15 @@ public:
         uint32 isrc1, 
         uint32 idst,
         bool transpose);
+    template<typename U, typename V>
+    void matmul_block(
+        pipe<U> src0, 
+        pipe<V> src1, 
+        uint32 isrc0, 
+        uint32 isrc1, 
+        uint32 idst,
+        bool transpose,
+        uint32 ct_dim);
     // reduce
     template<typename U, typename V>
     void reduce_max_rows(
@@ -28,6 +28,7 @@ void __add_bcast_scalar_init();
 void __sub_bcast_scalar_init();
 void __mul_bcast_scalar_init();
 void __matmul_init(bool transpose);
+void __matmul_block_init(bool transpose, uint32 ct_dim);
 void __reduce_max_rows_init();
 void __reduce_max_cols_init();
 void __reduce_max_scalar_init();
@@ -109,6 +110,8 @@ template<typename U, typename V>
     void __unpack_bcast_scalar_init(pipe<U> icb0, pipe<V> icb1);
 template<typename U, typename V>
     void __unpack_matmul_init(pipe<U> icb0, pipe<V> icb1, bool transpose);
+template<typename U, typename V>
+    void __unpack_matmul_block_init(pipe<U> icb0, pipe<V> icb1, bool transpose, uint32 ct_dim);
 template<typename U>
     void __unpack_unary_init(pipe<U> icb);
 template<typename U, typename V>
@@ -135,6 +138,11 @@ template<typename U>
 template<typename U>
     void __pack_scalar_init(pipe<U> ocb);
 
+// destination accumulation mode: defined by device compiler,
+// placeholder value is never used in generated code
+
+constexpr bool DST_ACCUM_MODE = false;
+
 )cpp";
 
 } // namespace
@@ -21,6 +21,7 @@ enum class DataType {
     FLOAT,
     BFLOAT16,
     GLOBAL,
+    GLOBAL_BLOCK,
     LOCAL,
     SEMAPHORE,
     PIPE
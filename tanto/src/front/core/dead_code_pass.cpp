@@ -19,32 +19,13 @@ using namespace clang;
 
 namespace {
 
-// ACHTUNG: Unify with "graph_builder.cpp"?
-bool get_int_const_expr_value(const Expr *expr, ASTContext *context, int &value) {
-    value = 0;
-    std::optional<llvm::APSInt> aps_int = expr->getIntegerConstantExpr(*context);
-    if (!aps_int) {
-        return false;
-    }
-    std::optional<int64_t> sext_value = (*aps_int).trySExtValue();
-    if (!sext_value) {
-        return false;
-    }
-    int64_t value64 = *sext_value;
-    value = int(value64);
-    if (int64_t(value) != value64) {
-        return false;
-    }
-    return true;
-}
-
 bool match_const_expr_if(const IfStmt &stmt, ASTContext &context, bool value) {
     const Expr *cond = stmt.getCond();
     if (cond == nullptr) {
         return false;
     }
     int int_value = 0;
-    if (!get_int_const_expr_value(cond, &context, int_value)) {
+    if (!get_int_const_expr_value(cond, context, int_value)) {
         return false;
     }
     bool bool_value = (int_value != 0);
@@ -0,0 +1,515 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdlib>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <sstream>
+
+#include "clang/AST/Decl.h"
+#include "clang/AST/DeclCXX.h"
+#include "clang/AST/DeclTemplate.h"
+#include "clang/AST/Expr.h"
+#include "clang/AST/ExprCXX.h"
+#include "clang/AST/Stmt.h"
+#include "clang/Tooling/Transformer/SourceCode.h"
+
+#include "core/error.hpp"
+#include "core/tooling.hpp"
+#include "core/math_init_builtin.hpp"
+#include "core/dst_block_pass.hpp"
+
+namespace ronin {
+namespace tanto {
+namespace front {
+
+using namespace clang;
+
+namespace {
+
+bool is_math_var(const VarDecl *var) {
+    const CXXRecordDecl *decl = var->getType()->getAsCXXRecordDecl();
+    return (decl != nullptr && decl->getName() == "math");
+}
+
+bool is_var_ref(const Expr *expr, const VarDecl *var) {
+    const DeclRefExpr *ref = dyn_cast<DeclRefExpr>(expr->IgnoreParenImpCasts());
+    return (ref != nullptr && ref->getDecl() == var);
+}
+
+std::string trim(const std::string &str) {
+    size_t start = str.find_first_not_of(" \t");
+    if (start == std::string::npos) {
+        return std::string();
+    }
+    size_t end = str.find_last_not_of(" \t");
+    return str.substr(start, end - start + 1);
+}
+
+} // namespace
+
+//
+//    DstBlockPass
+//
+
+DstBlockPass::DstBlockPass():
+        m_error_handler(nullptr),
+        m_rewrite_ok(false) { }
+
+DstBlockPass::~DstBlockPass() { }
+
+void DstBlockPass::set_error_handler(ErrorHandler *error_handler) {
+    m_error_handler = error_handler;
+}
+
+bool DstBlockPass::run(const std::string &input_code, std::string &output_code) {
+    reset();
+    std::string scan_code;
+    if (!scan_pragmas(input_code, scan_code)) {
+        return false;
+    }
+    if (m_block_map.empty()) {
+        output_code = scan_code;
+        return true;
+    }
+    if (!transform(scan_code, output_code)) {
+        return false;
+    }
+    for (auto &entry: m_block_map) {
+        if (m_done_lines.find(entry.first) == m_done_lines.end()) {
+            error(
+                "Statement at line " + std::to_string(entry.first) +
+                    " following pragma dst_block is not a for statement");
+            return false;
+        }
+    }
+    return true;
+}
+
+bool DstBlockPass::strip_pragmas(const std::string &input_code, std::string &output_code) {
+    // pragmas have no effect on dataflow kernels
+    reset();
+    return scan_pragmas(input_code, output_code);
+}
+
+void DstBlockPass::reset() {
+    m_block_map.clear();
+    m_done_lines.clear();
+}
+
+bool DstBlockPass::scan_pragmas(const std::string &input_code, std::string &output_code) {
+    // Tanto pragma lines are blanked out to preserve line numbering
+    // and to keep them away from the Clang pragma handlers
+    std::istringstream is(input_code);
+    std::string result;
+    std::string line;
+    int line_num = 0;
+    int pending_block_size = -1;
+    int pending_line_num = 0;
+    while (std::getline(is, line)) {
+        line_num++;
+        bool is_tanto = false;
+        int block_size = 0;
+        if (!parse_pragma(line, is_tanto, block_size)) {
+            return false;
+        }
+        if (is_tanto) {
+            if (pending_block_size >= 0) {
+                error("Pragma dst_block at line " + std::to_string(pending_line_num) +
+                    " is not followed by a for statement");
+                return false;
+            }
+            pending_block_size = block_size;
+            pending_line_num = line_num;
+            result += "\n";
+            continue;
+        }
+        if (pending_block_size >= 0 && !trim(line).empty()) {
+            m_block_map.emplace(line_num, pending_block_size);
+            pending_block_size = -1;
+        }
+        result += line;
+        result += "\n";
+    }
+    if (pending_block_size >= 0) {
+        error("Pragma dst_block at line " + std::to_string(pending_line_num) +
+            " is not followed by a for statement");
+        return false;
+    }
+    output_code = result;
+    return true;
+}
+
+bool DstBlockPass::parse_pragma(const std::string &line, bool &is_tanto, int &block_size) {
+    // #pragma tanto dst_block
+    // #pragma tanto dst_block(<size>)
+    is_tanto = false;
+    block_size = 0;
+    std::string text = trim(line);
+    if (text.compare(0, 7, "#pragma") != 0) {
+        return true;
+    }
+    std::istringstream is(text.substr(7));
+    std::string ns;
+    is >> ns;
+    if (ns != "tanto") {
+        return true;
+    }
+    is_tanto = true;
+    std::string rest;
+    std::getline(is, rest);
+    rest = trim(rest);
+    std::string name = rest.substr(0, rest.find('('));
+    if (trim(name) != "dst_block") {
+        error("Unknown pragma: " + text);
+        return false;
+    }
+    size_t lpar = rest.find('(');
+    if (lpar == std::string::npos) {
+        return true;
+    }
+    size_t rpar = rest.find(')', lpar);
+    if (rpar == std::string::npos || !trim(rest.substr(rpar + 1)).empty()) {
+        error("Invalid pragma syntax: " + text);
+        return false;
+    }
+    std::string arg = trim(rest.substr(lpar + 1, rpar - lpar - 1));
+    char *end = nullptr;
+    long value = strtol(arg.c_str(), &end, 0);
+    if (arg.empty() || *end != '\0' || value <= 0 || value > DST_SLOT_COUNT) {
+        error("Invalid dst_block size: " + text);
+        return false;
+    }
+    block_size = int(value);
+    return true;
+}
+
+bool DstBlockPass::transform(const std::string &input_code, std::string &output_code) {
+    auto match_loop = [this](const ForStmt &stmt, ASTContext &context) -> bool {
+        return match_pragma_loop(stmt, context);
+    };
+    auto make_loop = [this](const MatchResult &result) -> std::string {
+        return make_blocked_loop(result);
+    };
+    m_rewrite_ok = true;
+    TransformerTool transformer_tool;
+    transformer_tool.set_error_handler(m_error_handler);
+    RewriteRule rule =
+        makeRule(
+            forStmt(customMatch<ForStmt>(match_loop)).bind("stmt"),
+            changeTo(statement("stmt"), cat(transformer::run(make_loop))));
+    if (!transformer_tool.run(rule, input_code, output_code)) {
+        return false;
+    }
+    return m_rewrite_ok;
+}
+
+bool DstBlockPass::match_pragma_loop(const ForStmt &stmt, ASTContext &context) {
+    int line = get_loc_line(context, stmt.getBeginLoc());
+    return (m_block_map.find(line) != m_block_map.end());
+}
+
+std::string DstBlockPass::make_blocked_loop(const MatchResult &result) {
+    const ForStmt *stmt = result.Nodes.getNodeAs<ForStmt>("stmt");
+    ASTContext &context = *result.Context;
+    std::string orig_code = tooling::getText(*stmt, context).str();
+    int line = get_loc_line(context, stmt->getBeginLoc());
+    m_done_lines.insert(line);
+    LoopInfo info;
+    if (!analyze_loop(stmt, context, info)) {
+        error("Loop at line " + std::to_string(line) + " cannot be blocked by dst_block pragma");
+        m_rewrite_ok = false;
+        return orig_code;
+    }
+    int slot_count = get_dst_slot_count(info.math_var, context);
+    int block_size = m_block_map[line];
+    bool is_default = (block_size == 0);
+    if (is_default) {
+        block_size = slot_count / info.slot_count;
+    }
+    if (block_size == 0 || block_size * info.slot_count > slot_count) {
+        error(
+            "Loop at line " + std::to_string(line) + " uses " +
+                std::to_string(info.slot_count) + " destination slots per iteration: " +
+                "block size " + std::to_string(block_size) + " is too large");
+        m_rewrite_ok = false;
+        return orig_code;
+    }
+    // body code following the math declaration, with edits applied
+    const CompoundStmt *body = cast<CompoundStmt>(stmt->getBody());
+    unsigned start =
+        get_loc_offset(context, info.math_decl->getBeginLoc()) +
+            unsigned(tooling::getText(*info.math_decl, context).size());
+    unsigned end = get_loc_offset(context, body->getRBracLoc());
+    StringRef buffer = context.getSourceManager().getBufferData(
+        context.getSourceManager().getMainFileID());
+    std::sort(
+        info.edits.begin(),
+        info.edits.end(),
+        [](const Edit &a, const Edit &b) -> bool {
+            return (a.offset < b.offset);
+        });
+    std::string type = info.var->getType().getAsString();
+    std::string var = info.var->getNameAsString();
+    std::string blk = var + "_blk";
+    // slot index => (<var> - <var>_blk) * <slot_count> + <slot index>
+    std::string slot_base = "(" + var + " - " + blk + ")";
+    if (info.slot_count > 1) {
+        slot_base += " * " + std::to_string(info.slot_count);
+    }
+    std::string rest;
+    unsigned pos = start;
+    for (const Edit &edit: info.edits) {
+        rest += buffer.substr(pos, edit.offset - pos).str();
+        rest += slot_base;
+        if (edit.slot != 0) {
+            rest += " + " + std::to_string(edit.slot);
+        }
+        pos = edit.offset + edit.length;
+    }
+    rest += buffer.substr(pos, end - pos).str();
+    std::string init = tooling::getText(*info.init, context).str();
+    std::string cond_end = tooling::getText(*info.end, context).str();
+    std::string size = std::to_string(block_size);
+    std::string guard;
+    if (block_size * info.slot_count > DST_SLOT_COUNT_32) {
+        // block does not fit in fp32 accumulation mode
+        int acc_block_size = DST_SLOT_COUNT_32 / info.slot_count;
+        if (is_default && acc_block_size > 0) {
+            size = 
+                "(DST_ACCUM_MODE ? " + std::to_string(acc_block_size) + 
+                    " : " + size + ")";
+        } else {
+            guard = "static_assert(!DST_ACCUM_MODE, \"dst_block exceeds fp32 destination\");\n";
+        }
+    }
+    std::string code;
+    code += "for (" + type + " " + blk + " = " + init + "; " +
+        blk + " < " + cond_end + "; " + blk + " += " + size + ") {\n";
+    code += guard;
+    code += tooling::getText(*info.math_decl, context).str() + "\n";
+    code += "for (" + type + " " + var + " = " + blk + "; " +
+        var + " < " + cond_end + " && " + var + " < " + blk + " + " + size + "; " +
+        var + "++) {";
+    code += rest;
+    code += "}\n";
+    code += "}";
+    return code;
+}
+
+bool DstBlockPass::analyze_loop(const ForStmt *stmt, ASTContext &context, LoopInfo &info) {
+    // init: <type> <var> = <init>
+    const DeclStmt *init = dyn_cast_or_null<DeclStmt>(stmt->getInit());
+    if (init == nullptr || !init->isSingleDecl()) {
+        return false;
+    }
+    const VarDecl *var = dyn_cast<VarDecl>(init->getSingleDecl());
+    if (var == nullptr || var->getInit() == nullptr) {
+        return false;
+    }
+    info.var = var;
+    info.init = var->getInit();
+    // cond: <var> < <end>
+    if (stmt->getCond() == nullptr) {
+        return false;
+    }
+    const BinaryOperator *cond =
+        dyn_cast<BinaryOperator>(stmt->getCond()->IgnoreParenImpCasts());
+    if (cond == nullptr || cond->getOpcode() != BO_LT || !is_var_ref(cond->getLHS(), var)) {
+        return false;
+    }
+    info.end = cond->getRHS();
+    // inc: <var>++ or ++<var>
+    if (stmt->getInc() == nullptr) {
+        return false;
+    }
+    const UnaryOperator *inc =
+        dyn_cast<UnaryOperator>(stmt->getInc()->IgnoreParenImpCasts());
+    if (inc == nullptr || !inc->isIncrementOp() || !is_var_ref(inc->getSubExpr(), var)) {
+        return false;
+    }
+    // body: { math<T> <name>; ... }
+    const CompoundStmt *body = dyn_cast<CompoundStmt>(stmt->getBody());
+    if (body == nullptr || body->body_empty()) {
+        return false;
+    }
+    const DeclStmt *math_decl = dyn_cast<DeclStmt>(body->body_front());
+    if (math_decl == nullptr || !math_decl->isSingleDecl()) {
+        return false;
+    }
+    const VarDecl *math_var = dyn_cast<VarDecl>(math_decl->getSingleDecl());
+    if (math_var == nullptr || !is_math_var(math_var)) {
+        return false;
+    }
+    info.math_decl = math_decl;
+    info.math_var = math_var;
+    info.slot_count = 0;
+    info.edits.clear();
+    // math object must be referenced only as object of method calls
+    int math_ref_count = 0;
+    int math_call_count = 0;
+    bool first = true;
+    for (const Stmt *child: body->body()) {
+        if (first) {
+            first = false;
+            continue;
+        }
+        if (!scan_body_stmt(child, context, 0, info, math_ref_count, math_call_count)) {
+            return false;
+        }
+    }
+    if (math_ref_count != math_call_count) {
+        return false;
+    }
+    if (info.slot_count == 0) {
+        info.slot_count = 1;
+    }
+    return true;
+}
+
+bool DstBlockPass::scan_body_stmt(
+        const Stmt *stmt,
+        ASTContext &context,
+        int loop_depth,
+        LoopInfo &info,
+        int &math_ref_count,
+        int &math_call_count) {
+    if (isa<ReturnStmt>(stmt) || isa<GotoStmt>(stmt)) {
+        return false;
+    }
+    if (isa<BreakStmt>(stmt) && loop_depth == 0) {
+        return false;
+    }
+    if (const DeclStmt *decl_stmt = dyn_cast<DeclStmt>(stmt)) {
+        for (const Decl *decl: decl_stmt->decls()) {
+            const VarDecl *var = dyn_cast<VarDecl>(decl);
+            if (var != nullptr && is_math_var(var)) {
+                return false;
+            }
+        }
+    }
+    if (const DeclRefExpr *ref = dyn_cast<DeclRefExpr>(stmt)) {
+        if (ref->getDecl() == info.math_var) {
+            math_ref_count++;
+        }
+    }
+    if (const CXXMemberCallExpr *call = dyn_cast<CXXMemberCallExpr>(stmt)) {
+        const Expr *self = call->getImplicitObjectArgument();
+        if (self != nullptr && is_var_ref(self, info.math_var)) {
+            math_call_count++;
+            if (!scan_math_call(call, context, info)) {
+                return false;
+            }
+        }
+    }
+    int child_depth = loop_depth;
+    if (isa<ForStmt>(stmt) ||
+            isa<WhileStmt>(stmt) ||
+            isa<DoStmt>(stmt) ||
+            isa<SwitchStmt>(stmt)) {
+        child_depth++;
+    }
+    for (const Stmt *child: stmt->children()) {
+        if (child == nullptr) {
+            continue;
+        }
+        if (!scan_body_stmt(
+                child,
+                context,
+                child_depth,
+                info,
+                math_ref_count,
+                math_call_count)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool DstBlockPass::scan_math_call(
+        const CXXMemberCallExpr *call,
+        ASTContext &context,
+        LoopInfo &info) {
+    std::string method = call->getMethodDecl()->getNameAsString();
+    MathBuiltinId id = m_builtin_handler.map("math", method);
+    if (id == MathBuiltinId::NONE) {
+        // method not using destination slots
+        return true;
+    }
+    const MathDstArgDesc &desc = m_dst_arg_handler.map(id);
+    int arg_count = int(call->getNumArgs());
+    int span = 1;
+    if (desc.span >= 0) {
+        if (desc.span >= arg_count ||
+                !get_int_const_expr_value(call->getArg(desc.span), context, span) ||
+                span <= 0) {
+            // number of slots must be known at compile time
+            return false;
+        }
+    }
+    for (int i = 0; i < MathDstArgDesc::MAX_ARGS; i++) {
+        int index = desc.args[i];
+        if (index < 0) {
+            break;
+        }
+        if (index >= arg_count) {
+            return false;
+        }
+        const Expr *arg = call->getArg(index);
+        int value = 0;
+        if (!get_int_const_expr_value(arg, context, value) || value < 0) {
+            // slot index must be known at compile time
+            return false;
+        }
+        info.slot_count = std::max(info.slot_count, value + span);
+        Edit edit;
+        edit.offset = get_loc_offset(context, arg->getBeginLoc());
+        edit.length = unsigned(tooling::getText(*arg, context).size());
+        edit.slot = value;
+        info.edits.push_back(edit);
+    }
+    return true;
+}
+
+int DstBlockPass::get_dst_slot_count(const VarDecl *math_var, ASTContext &context) {
+    // math<T>: 32-bit arithmetic compute types halve destination array
+    const ClassTemplateSpecializationDecl *decl =
+        dyn_cast_or_null<ClassTemplateSpecializationDecl>(
+            math_var->getType()->getAsCXXRecordDecl());
+    if (decl == nullptr || decl->getTemplateArgs().size() == 0) {
+        return DST_SLOT_COUNT;
+    }
+    const TemplateArgument &arg = decl->getTemplateArgs()[0];
+    if (arg.getKind() != TemplateArgument::Type) {
+        return DST_SLOT_COUNT;
+    }
+    QualType type = arg.getAsType();
+    if (type->isArithmeticType() && context.getTypeSize(type) == 32) {
+        return DST_SLOT_COUNT_32;
+    }
+    return DST_SLOT_COUNT;
+}
+
+int DstBlockPass::get_loc_line(ASTContext &context, SourceLocation loc) {
+    const SourceManager &source_manager = context.getSourceManager();
+    return int(source_manager.getExpansionLineNumber(loc));
+}
+
+unsigned DstBlockPass::get_loc_offset(ASTContext &context, SourceLocation loc) {
+    const SourceManager &source_manager = context.getSourceManager();
+    return source_manager.getFileOffset(source_manager.getExpansionLoc(loc));
+}
+
+void DstBlockPass::error(const std::string &text) {
+    if (m_error_handler != nullptr) {
+        m_error_handler->error(text);
+    }
+}
+
+} // namespace front
+} // namespace tanto
+} // namespace ronin
+
@@ -0,0 +1,128 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+
+#include "clang/AST/Decl.h"
+#include "clang/AST/Stmt.h"
+#include "clang/Tooling/Transformer/RewriteRule.h"
+
+#include "core/error.hpp"
+#include "core/tooling.hpp"
+#include "core/math_init_builtin.hpp"
+
+namespace ronin {
+namespace tanto {
+namespace front {
+
+using namespace clang;
+using namespace transformer;
+
+//
+//    Destination register blocking
+//
+//    Loops marked with "#pragma tanto dst_block(N)" and having a math object
+//    declared as the first statement of their body are rewritten so that
+//    N consecutive iterations share one math object, each iteration using
+//    its own group of destination slots:
+//
+//    #pragma tanto dst_block(N)
+//    for (uint32 i = <init>; i < <end>; i++) {
+//        math<T> acc;
+//        <body>
+//    }
+//        =>
+//    for (uint32 i_blk = <init>; i_blk < <end>; i_blk += N) {
+//        math<T> acc;
+//        for (uint32 i = i_blk; i < <end> && i < i_blk + N; i++) {
+//            <body with destination slot indices shifted by (i - i_blk) * S>
+//        }
+//    }
+//
+//    where S is the number of destination slots used by a single iteration.
+//    Destination slot arguments of math methods are specified by MathDstArgHandler.
+//    Order of all pipe operations is preserved. The pass runs before math
+//    initialization inference so that init calls are derived from the blocked code.
+//
+//    The pass is pragma driven only: loops with independent accumulators
+//    are not detected and blocked automatically.
+//
+//    Destination array holds 8 slots for 16-bit compute types and 4 slots
+//    for 32-bit compute types. Accumulation mode (DST_ACCUM_MODE) is chosen
+//    by the host when the kernel is built and also limits the array to 4 slots:
+//    default block size is then selected in generated code, and larger explicit
+//    block sizes are rejected with static assertion.
+//
+
+class DstBlockPass {
+public:
+    DstBlockPass();
+    ~DstBlockPass();
+public:
+    void set_error_handler(ErrorHandler *error_handler);
+    bool run(const std::string &input_code, std::string &output_code);
+    bool strip_pragmas(const std::string &input_code, std::string &output_code);
+private:
+    struct Edit {
+        unsigned offset;
+        unsigned length;
+        int slot;
+    };
+    struct LoopInfo {
+        const VarDecl *var;
+        const Expr *init;
+        const Expr *end;
+        const DeclStmt *math_decl;
+        const VarDecl *math_var;
+        int slot_count;
+        std::vector<Edit> edits;
+    };
+private:
+    void reset();
+    bool scan_pragmas(const std::string &input_code, std::string &output_code);
+    bool parse_pragma(const std::string &line, bool &is_tanto, int &block_size);
+    bool transform(const std::string &input_code, std::string &output_code);
+    bool match_pragma_loop(const ForStmt &stmt, ASTContext &context);
+    std::string make_blocked_loop(const MatchResult &result);
+    bool analyze_loop(const ForStmt *stmt, ASTContext &context, LoopInfo &info);
+    bool scan_body_stmt(
+        const Stmt *stmt,
+        ASTContext &context,
+        int loop_depth,
+        LoopInfo &info,
+        int &math_ref_count,
+        int &math_call_count);
+    bool scan_math_call(
+        const CXXMemberCallExpr *call,
+        ASTContext &context,
+        LoopInfo &info);
+    static int get_dst_slot_count(const VarDecl *math_var, ASTContext &context);
+    static int get_loc_line(ASTContext &context, SourceLocation loc);
+    static unsigned get_loc_offset(ASTContext &context, SourceLocation loc);
+    void error(const std::string &text);
+private:
+    // number of destination slots available for 16-bit compute types
+    static constexpr int DST_SLOT_COUNT = 8;
+    // number of destination slots available for 32-bit compute types
+    // or in fp32 accumulation mode
+    static constexpr int DST_SLOT_COUNT_32 = 4;
+private:
+    ErrorHandler *m_error_handler;
+    MathInitBuiltinHandler m_builtin_handler;
+    MathDstArgHandler m_dst_arg_handler;
+    // begin line of target loop => block size (0 for default)
+    std::map<int, int> m_block_map;
+    std::set<int> m_done_lines;
+    bool m_rewrite_ok;
+};
+
+} // namespace front
+} // namespace tanto
+} // namespace ronin
+
@@ -20,6 +20,7 @@ Mapping of standard objects
 struct Global {
     uint32_t addr;
     uint32_t log2_page_size;
+    uint32_t bank_pages; // block distribution only
 };
 struct Local {
     uint32_t addr;
@@ -72,7 +73,9 @@ Frontend::Frontend() {
     m_query.set_error_handler(&m_error_handler);
     m_transform.set_error_handler(&m_error_handler);
     m_dead_code_pass.set_error_handler(&m_error_handler);
+    m_dst_block_pass.set_error_handler(&m_error_handler);
     m_math_init_pass.set_error_handler(&m_error_handler);
+    m_pipe_analysis.set_error_handler(&m_error_handler);
 }
 
 Frontend::~Frontend() { }
@@ -103,6 +106,25 @@ bool Frontend::compile(
     return false;
 }
 
+bool Frontend::analyze_pipes(
+        FrontendMode mode,
+        const std::string &input_code,
+        std::string &report) {
+    report.clear();
+    bool with_init = (mode == FrontendMode::COMPUTE);
+    std::string full_input;
+    bool ok = m_dst_block_pass.strip_pragmas(make_full_input(input_code, with_init), full_input);
+    if (!ok) {
+        return false;
+    }
+    ok = m_pipe_analysis.run(full_input);
+    if (!ok) {
+        return false;
+    }
+    report = m_pipe_analysis.report();
+    return true;
+}
+
 bool Frontend::setup_transform() {
     m_transform.reset();
     for (std::pair<uint32_t, uint32_t> entry: m_params) {
@@ -115,7 +137,11 @@ bool Frontend::setup_transform() {
 
 bool Frontend::compile_compute(const std::string &input_code, std::string &output_code) {
     bool ok = true;
-    std::string full_input = make_full_input(input_code, true);
+    std::string full_input;
+    ok = m_dst_block_pass.run(make_full_input(input_code, true), full_input);
+    if (!ok) {
+        return false;
+    }
     ok = m_query.run(full_input);
     if (!ok) {
         return false;
@@ -159,7 +185,11 @@ bool Frontend::compile_dataflow(
         std::string &output_code,
         bool write_mode) {
     bool ok = true;
-    std::string full_input = make_full_input(input_code, false);
+    std::string full_input;
+    ok = m_dst_block_pass.strip_pragmas(make_full_input(input_code, false), full_input);
+    if (!ok) {
+        return false;
+    }
     ok = m_query.run(full_input);
     if (!ok) {
         return false;
@@ -302,6 +332,13 @@ std::string Frontend::build_kernel_main_body(bool compute) {
             result << name << ".log2_page_size = get_arg_val<uint32>(" << (k + 1) << ");\n";
             k += 2;
             break;
+        case DataType::GLOBAL_BLOCK:
+            result << "Global " << name << ";\n";
+            result << name << ".addr = get_arg_val<uint32>(" << k << ");\n";
+            result << name << ".log2_page_size = get_arg_val<uint32>(" << (k + 1) << ");\n";
+            result << name << ".bank_pages = get_arg_val<uint32>(" << (k + 2) << ");\n";
+            k += 3;
+            break;
         case DataType::LOCAL:
             result << "Local " << name << ";\n";
             result << name << ".addr = get_arg_val<uint32>(" << k << ");\n";
@@ -14,7 +14,9 @@
 #include "core/query.hpp"
 #include "core/transform.hpp"
 #include "core/dead_code_pass.hpp"
+#include "core/dst_block_pass.hpp"
 #include "core/math_init_pass.hpp"
+#include "core/pipe_analysis.hpp"
 
 namespace ronin {
 namespace tanto {
@@ -31,6 +33,10 @@ public:
         FrontendMode mode,
         const std::string &input_code, 
         std::string &output_code);
+    bool analyze_pipes(
+        FrontendMode mode,
+        const std::string &input_code,
+        std::string &report);
     const std::vector<std::string> get_errors() {
         return m_error_handler.get_errors();
     }
@@ -60,7 +66,9 @@ private:
     Query m_query;
     Transform m_transform;
     DeadCodePass m_dead_code_pass;
+    DstBlockPass m_dst_block_pass;
     MathInitPass m_math_init_pass;
+    PipeAnalysis m_pipe_analysis;
 };
 
 } // namespace front
@@ -66,24 +66,6 @@ bool get_int_literal_value(const IntegerLiteral *int_literal, int &value) {
     return true;
 }
 
-bool get_int_const_expr_value(const Expr *expr, ASTContext *context, int &value) {
-    value = 0;
-    std::optional<llvm::APSInt> aps_int = expr->getIntegerConstantExpr(*context);
-    if (!aps_int) {
-        return false;
-    }
-    std::optional<int64_t> sext_value = (*aps_int).trySExtValue();
-    if (!sext_value) {
-        return false;
-    }
-    int64_t value64 = *sext_value;
-    value = int(value64);
-    if (int64_t(value) != value64) {
-        return false;
-    }
-    return true;
-}
-
 } // namespace
 
 //
@@ -242,7 +224,7 @@ void StmtGraphBuilder::parse_stmt_attrs(
     const Expr *expr = result.Nodes.getNodeAs<Expr>("expr");
     if (expr != nullptr) {
         int value = 0;
-        if (get_int_const_expr_value(expr, result.Context, value)) {
+        if (get_int_const_expr_value(expr, *result.Context, value)) {
             stmt->set_int_const_expr(value);
         }
     }
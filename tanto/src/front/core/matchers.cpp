@@ -22,7 +22,9 @@ auto make_data_type_matcher() {
         qualType(asString("unsigned short")).bind("T_uint16"),
         qualType(asString("unsigned int")).bind("T_uint32"),
         qualType(asString("float")).bind("T_float"),
-        recordType(hasDeclaration(cxxRecordDecl(hasName("bfloat16")))).bind("T_bfloat16")
+        recordType(hasDeclaration(cxxRecordDecl(hasName("bfloat16")))).bind("T_bfloat16"),
+        recordType(hasDeclaration(cxxRecordDecl(hasName("bfp8_b")))).bind("T_bfp8_b"),
+        recordType(hasDeclaration(cxxRecordDecl(hasName("bfp4_b")))).bind("T_bfp4_b")
     );
 } 
 
@@ -87,6 +89,18 @@ StatementMatcher make_func_call_3_matcher(const std::string &func_name) {
     ).bind("stmt");
 }
 
+StatementMatcher make_func_call_4_matcher(const std::string &func_name) {
+    // <stmt> ::= func(<arg0>, <arg1>, <arg2>, <arg3>);
+    return callExpr(
+        callee(functionDecl(hasName(func_name))),
+        argumentCountIs(4),
+        hasArgument(0, expr().bind("arg0")),
+        hasArgument(1, expr().bind("arg1")),
+        hasArgument(2, expr().bind("arg2")),
+        hasArgument(3, expr().bind("arg3"))
+    ).bind("stmt");
+}
+
 // member calls
 
 StatementMatcher make_member_call_0_matcher(
@@ -371,6 +385,31 @@ StatementMatcher make_member_call_6_with_t_arg1_matcher(
     ).bind("stmt");
 }
 
+StatementMatcher make_member_call_7_with_t_arg1_matcher(
+        const std::string &self_type,
+        const std::string &method_name,
+        const std::string &arg1_type) {
+    // <stmt> ::= <self>.method(<arg0>, <arg1>, <arg2>, <arg3>, <arg4>, <arg5>, <arg6>);
+    auto t = make_data_type_matcher();
+    return cxxMemberCallExpr(
+        on(expr(hasType(classTemplateSpecializationDecl(
+            hasName(self_type),
+            hasTemplateArgument(0, templateArgument(refersToType(t)))
+        ))).bind("self")),
+        callee(cxxMethodDecl(hasName(method_name))),
+        argumentCountIs(7),
+        hasArgument(0, expr().bind("arg0")),
+        hasArgument(1, expr(
+            hasType(cxxRecordDecl(hasName(arg1_type)))
+        ).bind("arg1")),
+        hasArgument(2, expr().bind("arg2")),
+        hasArgument(3, expr().bind("arg3")),
+        hasArgument(4, expr().bind("arg4")),
+        hasArgument(5, expr().bind("arg5")),
+        hasArgument(6, expr().bind("arg6"))
+    ).bind("stmt");
+}
+
 StatementMatcher make_member_call_9_with_t_arg1_matcher(
         const std::string &self_type,
         const std::string &method_name,
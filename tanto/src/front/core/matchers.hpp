@@ -23,6 +23,7 @@ StatementMatcher make_func_call_0_matcher(const std::string &func_name);
 StatementMatcher make_func_call_1_matcher(const std::string &func_name);
 StatementMatcher make_func_call_2_matcher(const std::string &func_name);
 StatementMatcher make_func_call_3_matcher(const std::string &func_name);
+StatementMatcher make_func_call_4_matcher(const std::string &func_name);
 
 StatementMatcher make_member_call_0_matcher(
     const std::string &self_type,
@@ -77,6 +78,10 @@ StatementMatcher make_member_call_6_with_t_arg1_matcher(
         const std::string &self_type,
         const std::string &method_name,
         const std::string &arg1_type);
+StatementMatcher make_member_call_7_with_t_arg1_matcher(
+        const std::string &self_type,
+        const std::string &method_name,
+        const std::string &arg1_type);
 StatementMatcher make_member_call_9_with_t_arg1_matcher(
         const std::string &self_type,
         const std::string &method_name,
@@ -97,6 +97,7 @@ void MathInitArgsBuilder::init() {
     set_arg_desc_unpack(MathBuiltinId::SUB_BCAST_SCALAR, 0, 1);
     set_arg_desc_unpack(MathBuiltinId::MUL_BCAST_SCALAR, 0, 1);
     set_arg_desc_unpack(MathBuiltinId::MATMUL, 0, 1, 5);
+    set_arg_desc_unpack(MathBuiltinId::MATMUL_BLOCK, 0, 1, 5, 6);
     set_arg_desc_unpack(MathBuiltinId::REDUCE_MAX_ROWS, 0, 1);
     set_arg_desc_unpack(MathBuiltinId::REDUCE_MAX_COLS, 0, 1);
     set_arg_desc_unpack(MathBuiltinId::REDUCE_MAX_SCALAR, 0, 1);
@@ -108,6 +109,7 @@ void MathInitArgsBuilder::init() {
     set_arg_desc_unpack(MathBuiltinId::UNTILIZE_BLOCK, 0);
     // math
     set_arg_desc_math(MathBuiltinId::MATMUL, 5);
+    set_arg_desc_math(MathBuiltinId::MATMUL_BLOCK, 5, 6);
     // pack
     set_arg_desc_pack(MathBuiltinId::PACK, 1);
     set_arg_desc_pack(MathBuiltinId::PACK_ROW, 1);
@@ -122,13 +124,15 @@ void MathInitArgsBuilder::set_arg_desc(
         int group,
         int p0,
         int p1,
-        int p2) {
+        int p2,
+        int p3) {
     int index = int(id);
     assert(index >= 0 && index < MathInitFuncCount);
     assert(group >= 0 && group < MathInitFuncGroup::COUNT);
     m_arg_desc[index][group][0] = p0;
     m_arg_desc[index][group][1] = p1;
     m_arg_desc[index][group][2] = p2;
+    m_arg_desc[index][group][3] = p3;
 }
 
 void MathInitArgsBuilder::reset() {
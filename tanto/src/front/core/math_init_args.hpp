@@ -15,7 +15,7 @@ namespace tanto {
 namespace front {
 
 struct MathInitArgConst {
-    static constexpr int MAX_ARGS = 3;
+    static constexpr int MAX_ARGS = 4;
     static constexpr int ARG_UNDEF = -1;
 };
 
@@ -47,29 +47,33 @@ private:
             MathBuiltinId id, 
             int p0,
             int p1 = -1,
-            int p2 = -1) {
-        set_arg_desc(id, MathInitFuncGroup::PACK, p0, p1, p2);
+            int p2 = -1,
+            int p3 = -1) {
+        set_arg_desc(id, MathInitFuncGroup::PACK, p0, p1, p2, p3);
     }
     void set_arg_desc_math(
             MathBuiltinId id, 
             int p0,
             int p1 = -1,
-            int p2 = -1) {
-        set_arg_desc(id, MathInitFuncGroup::MATH, p0, p1, p2);
+            int p2 = -1,
+            int p3 = -1) {
+        set_arg_desc(id, MathInitFuncGroup::MATH, p0, p1, p2, p3);
     }
     void set_arg_desc_unpack(
             MathBuiltinId id, 
             int p0,
             int p1 = -1,
-            int p2 = -1) {
-        set_arg_desc(id, MathInitFuncGroup::UNPACK, p0, p1, p2);
+            int p2 = -1,
+            int p3 = -1) {
+        set_arg_desc(id, MathInitFuncGroup::UNPACK, p0, p1, p2, p3);
     }
     void set_arg_desc(
         MathBuiltinId id, 
         int group,
         int p0,
         int p1,
-        int p2);
+        int p2,
+        int p3);
     void reset();
     int get_arg_param(StmtNode *stmt);
     int get_arg_value(StmtNode *stmt);
@@ -33,6 +33,7 @@ std::unordered_map<std::string, MathBuiltinId> g_math_builtin_id_map = {
     {"sub_bcast_scalar", MathBuiltinId::SUB_BCAST_SCALAR},
     {"mul_bcast_scalar", MathBuiltinId::MUL_BCAST_SCALAR},
     {"matmul", MathBuiltinId::MATMUL},
+    {"matmul_block", MathBuiltinId::MATMUL_BLOCK},
     {"reduce_max_rows", MathBuiltinId::REDUCE_MAX_ROWS},
     {"reduce_max_cols", MathBuiltinId::REDUCE_MAX_COLS},
     {"reduce_max_scalar", MathBuiltinId::REDUCE_MAX_SCALAR},
@@ -175,6 +176,7 @@ void MathInitFuncHandler::init() {
     enter_unpack(MathBuiltinId::SUB_BCAST_SCALAR, MathInitFunc::UNPACK_BCAST_SCALAR);
     enter_unpack(MathBuiltinId::MUL_BCAST_SCALAR, MathInitFunc::UNPACK_BCAST_SCALAR);
     enter_unpack(MathBuiltinId::MATMUL, MathInitFunc::UNPACK_MATMUL);
+    enter_unpack(MathBuiltinId::MATMUL_BLOCK, MathInitFunc::UNPACK_MATMUL_BLOCK);
     enter_unpack(MathBuiltinId::REDUCE_MAX_ROWS, MathInitFunc::UNPACK_REDUCE_ROWS);
     enter_unpack(MathBuiltinId::REDUCE_MAX_COLS, MathInitFunc::UNPACK_REDUCE_COLS);
     enter_unpack(MathBuiltinId::REDUCE_MAX_SCALAR, MathInitFunc::UNPACK_REDUCE_SCALAR);
@@ -199,6 +201,7 @@ void MathInitFuncHandler::init() {
     enter_math(MathBuiltinId::SUB_BCAST_SCALAR, MathInitFunc::SUB_BCAST_SCALAR);
     enter_math(MathBuiltinId::MUL_BCAST_SCALAR, MathInitFunc::MUL_BCAST_SCALAR);
     enter_math(MathBuiltinId::MATMUL, MathInitFunc::MATMUL);
+    enter_math(MathBuiltinId::MATMUL_BLOCK, MathInitFunc::MATMUL_BLOCK);
     enter_math(MathBuiltinId::REDUCE_MAX_ROWS, MathInitFunc::REDUCE_MAX_ROWS);
     enter_math(MathBuiltinId::REDUCE_MAX_COLS, MathInitFunc::REDUCE_MAX_COLS);
     enter_math(MathBuiltinId::REDUCE_MAX_SCALAR, MathInitFunc::REDUCE_MAX_SCALAR);
@@ -287,6 +290,142 @@ void MathInitFuncHandler::enter(MathBuiltinId id, int group, MathInitFunc func)
     m_map[index][group] = func;
 }
 
+//
+//    MathDstArgHandler
+//
+
+MathDstArgHandler::MathDstArgHandler() {
+    init();
+}
+
+MathDstArgHandler::~MathDstArgHandler() { }
+
+const MathDstArgDesc &MathDstArgHandler::map(MathBuiltinId id) {
+    int index = int(id);
+    assert(index >= 0 && index < MathBuiltinIdCount);
+    return m_map[index];
+}
+
+void MathDstArgHandler::init() {
+    for (int i = 0; i < MathBuiltinIdCount; i++) {
+        for (int k = 0; k < MathDstArgDesc::MAX_ARGS; k++) {
+            m_map[i].args[k] = -1;
+        }
+        m_map[i].span = -1;
+    }
+    // pack
+    enter(MathBuiltinId::PACK, 0);
+    enter(MathBuiltinId::PACK_ROW, 0);
+    enter(MathBuiltinId::PACK_COL, 0);
+    enter(MathBuiltinId::PACK_SCALAR, 0);
+    // copy
+    enter(MathBuiltinId::COPY, 2);
+    // eltwise binary, bcast, matmul
+    enter(MathBuiltinId::ADD, 4);
+    enter(MathBuiltinId::SUB, 4);
+    enter(MathBuiltinId::MUL, 4);
+    enter(MathBuiltinId::ADD_BCAST_ROWS, 4);
+    enter(MathBuiltinId::SUB_BCAST_ROWS, 4);
+    enter(MathBuiltinId::MUL_BCAST_ROWS, 4);
+    enter(MathBuiltinId::ADD_BCAST_COLS, 4);
+    enter(MathBuiltinId::SUB_BCAST_COLS, 4);
+    enter(MathBuiltinId::MUL_BCAST_COLS, 4);
+    enter(MathBuiltinId::ADD_BCAST_SCALAR, 4);
+    enter(MathBuiltinId::SUB_BCAST_SCALAR, 4);
+    enter(MathBuiltinId::MUL_BCAST_SCALAR, 4);
+    enter(MathBuiltinId::MATMUL, 4);
+    enter_span(MathBuiltinId::MATMUL_BLOCK, 4, 6);
+    // reduce
+    enter(MathBuiltinId::REDUCE_MAX_ROWS, 4);
+    enter(MathBuiltinId::REDUCE_MAX_COLS, 4);
+    enter(MathBuiltinId::REDUCE_MAX_SCALAR, 4);
+    enter(MathBuiltinId::REDUCE_SUM_ROWS, 4);
+    enter(MathBuiltinId::REDUCE_SUM_COLS, 4);
+    enter(MathBuiltinId::REDUCE_SUM_SCALAR, 4);
+    // transpose
+    enter(MathBuiltinId::TRANSPOSE, 2);
+    // copy / eltwise binary dst
+    enter(MathBuiltinId::COPY_DST, 0, 1);
+    enter(MathBuiltinId::ADD_DST, 0, 1);
+    enter(MathBuiltinId::SUB_DST, 0, 1);
+    enter(MathBuiltinId::RSUB_DST, 0, 1);
+    enter(MathBuiltinId::MUL_DST, 0, 1);
+    enter(MathBuiltinId::DIV_DST, 0, 1);
+    enter(MathBuiltinId::POWER_DST, 0, 1);
+    // eltwise unary
+    enter(MathBuiltinId::ABS, 0);
+    enter(MathBuiltinId::ACOS, 0);
+    enter(MathBuiltinId::ADD_SCALAR, 0);
+    enter(MathBuiltinId::ASIN, 0);
+    enter(MathBuiltinId::ATAN, 0);
+    enter(MathBuiltinId::CAST_BF16_U16, 0);
+    enter(MathBuiltinId::CAST_U16_BF16, 0);
+    enter(MathBuiltinId::CEIL, 0);
+    enter(MathBuiltinId::COS, 0);
+    enter(MathBuiltinId::DIV_SCALAR, 0);
+    enter(MathBuiltinId::ELU, 0);
+    enter(MathBuiltinId::EQZ, 0);
+    enter(MathBuiltinId::ERF, 0);
+    enter(MathBuiltinId::ERFC, 0);
+    enter(MathBuiltinId::ERFINV, 0);
+    enter(MathBuiltinId::EXP, 0);
+    enter(MathBuiltinId::EXP2, 0);
+    enter(MathBuiltinId::EXPM1, 0);
+    enter(MathBuiltinId::FILL, 0);
+    enter(MathBuiltinId::FLOOR, 0);
+    enter(MathBuiltinId::GELU, 0);
+    enter(MathBuiltinId::GEZ, 0);
+    enter(MathBuiltinId::GTZ, 0);
+    enter(MathBuiltinId::HEAVISIDE, 0);
+    enter(MathBuiltinId::I0, 0);
+    enter(MathBuiltinId::ISFINITE, 0);
+    enter(MathBuiltinId::ISINF, 0);
+    enter(MathBuiltinId::ISNAN, 0);
+    enter(MathBuiltinId::ISNEGINF, 0);
+    enter(MathBuiltinId::ISPOSINF, 0);
+    enter(MathBuiltinId::LEAKY_RELU, 0);
+    enter(MathBuiltinId::LEZ, 0);
+    enter(MathBuiltinId::LOG, 0);
+    enter(MathBuiltinId::LOG_WITH_BASE, 0);
+    enter(MathBuiltinId::LOGICAL_NOT, 0);
+    enter(MathBuiltinId::LTZ, 0);
+    enter(MathBuiltinId::MAX, 0);
+    enter(MathBuiltinId::MUL_SCALAR, 0);
+    enter(MathBuiltinId::NEZ, 0);
+    enter(MathBuiltinId::POWER, 0);
+    enter(MathBuiltinId::RECIP, 0);
+    enter(MathBuiltinId::RELU, 0);
+    enter(MathBuiltinId::RELU_MAX, 0);
+    enter(MathBuiltinId::RELU_MIN, 0);
+    enter(MathBuiltinId::RSQRT, 0);
+    enter(MathBuiltinId::RSUB_SCALAR, 0);
+    enter(MathBuiltinId::SIGMOID, 0);
+    enter(MathBuiltinId::SIGN, 0);
+    enter(MathBuiltinId::SIGNBIT, 0);
+    enter(MathBuiltinId::SIN, 0);
+    enter(MathBuiltinId::SQRT, 0);
+    enter(MathBuiltinId::SQUARE, 0);
+    enter(MathBuiltinId::SUB_SCALAR, 0);
+    enter(MathBuiltinId::TAN, 0);
+    enter(MathBuiltinId::TANH, 0);
+}
+
+void MathDstArgHandler::enter(MathBuiltinId id, int arg0, int arg1) {
+    int index = int(id);
+    assert(index >= 0 && index < MathBuiltinIdCount);
+    m_map[index].args[0] = arg0;
+    m_map[index].args[1] = arg1;
+    m_map[index].span = -1;
+}
+
+void MathDstArgHandler::enter_span(MathBuiltinId id, int arg, int span) {
+    int index = int(id);
+    assert(index >= 0 && index < MathBuiltinIdCount);
+    m_map[index].args[0] = arg;
+    m_map[index].args[1] = -1;
+    m_map[index].span = span;
+}
+
 //
 //    Public functions
 //
@@ -303,6 +442,7 @@ std::unordered_map<MathInitFunc, std::string> g_math_init_func_name_map = {
     {MathInitFunc::UNPACK_BCAST_COLS, "unpack_bcast_cols"},
     {MathInitFunc::UNPACK_BCAST_SCALAR, "unpack_bcast_scalar"},
     {MathInitFunc::UNPACK_MATMUL, "unpack_matmul"},
+    {MathInitFunc::UNPACK_MATMUL_BLOCK, "unpack_matmul_block"},
     {MathInitFunc::UNPACK_UNARY, "unpack_unary"},
     {MathInitFunc::UNPACK_REDUCE_ROWS, "unpack_reduce_rows"},
     {MathInitFunc::UNPACK_REDUCE_COLS, "unpack_reduce_cols"},
@@ -330,6 +470,7 @@ std::unordered_map<MathInitFunc, std::string> g_math_init_func_name_map = {
     {MathInitFunc::SUB_BCAST_SCALAR, "sub_bcast_scalar"},
     {MathInitFunc::MUL_BCAST_SCALAR, "mul_bcast_scalar"},
     {MathInitFunc::MATMUL, "matmul"},
+    {MathInitFunc::MATMUL_BLOCK, "matmul_block"},
     {MathInitFunc::REDUCE_MAX_ROWS, "reduce_max_rows"},
     {MathInitFunc::REDUCE_MAX_COLS, "reduce_max_cols"},
     {MathInitFunc::REDUCE_MAX_SCALAR, "reduce_max_scalar"},
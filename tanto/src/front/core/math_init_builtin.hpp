@@ -32,6 +32,7 @@ enum class MathBuiltinId {
     SUB_BCAST_SCALAR,
     MUL_BCAST_SCALAR,
     MATMUL,
+    MATMUL_BLOCK,
     REDUCE_MAX_ROWS,
     REDUCE_MAX_COLS,
     REDUCE_MAX_SCALAR,
@@ -127,6 +128,7 @@ enum class MathInitFunc {
     UNPACK_BCAST_COLS,
     UNPACK_BCAST_SCALAR,
     UNPACK_MATMUL,
+    UNPACK_MATMUL_BLOCK,
     UNPACK_UNARY,
     UNPACK_REDUCE_ROWS,
     UNPACK_REDUCE_COLS,
@@ -154,6 +156,7 @@ enum class MathInitFunc {
     SUB_BCAST_SCALAR,
     MUL_BCAST_SCALAR,
     MATMUL,
+    MATMUL_BLOCK,
     REDUCE_MAX_ROWS,
     REDUCE_MAX_COLS,
     REDUCE_MAX_SCALAR,
@@ -258,6 +261,33 @@ private:
     MathInitFunc m_map[MathBuiltinIdCount][MathInitFuncGroup::COUNT];
 };
 
+//
+//    Destination slot arguments of math builtins
+//
+
+struct MathDstArgDesc {
+    static constexpr int MAX_ARGS = 2;
+    // positions of destination slot arguments, -1 if not used
+    int args[MAX_ARGS];
+    // position of argument specifying number of consecutive slots
+    // starting at each destination slot, -1 if one slot is used
+    int span;
+};
+
+class MathDstArgHandler {
+public:
+    MathDstArgHandler();
+    ~MathDstArgHandler();
+public:
+    const MathDstArgDesc &map(MathBuiltinId id);
+private:
+    void init();
+    void enter(MathBuiltinId id, int arg0, int arg1 = -1);
+    void enter_span(MathBuiltinId id, int arg, int span);
+private:
+    MathDstArgDesc m_map[MathBuiltinIdCount];
+};
+
 // public functions
 
 std::string get_math_init_func_name(MathInitFunc func);
@@ -0,0 +1,398 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <map>
+#include <sstream>
+
+#include "clang/AST/Decl.h"
+#include "clang/AST/DeclCXX.h"
+#include "clang/AST/Expr.h"
+#include "clang/AST/ExprCXX.h"
+#include "clang/AST/Stmt.h"
+
+#include "core/error.hpp"
+#include "core/tooling.hpp"
+#include "core/pipe_analysis.hpp"
+
+namespace ronin {
+namespace tanto {
+namespace front {
+
+using namespace clang;
+
+namespace {
+
+bool is_var_ref(const Expr *expr, const VarDecl *var) {
+    const DeclRefExpr *ref = dyn_cast<DeclRefExpr>(expr->IgnoreParenImpCasts());
+    return (ref != nullptr && ref->getDecl() == var);
+}
+
+} // namespace
+
+//
+//    PipeAnalysis
+//
+
+PipeAnalysis::PipeAnalysis():
+        m_error_handler(nullptr),
+        m_kernel_func(nullptr),
+        m_cond_depth(0),
+        m_branch_start(false) { }
+
+PipeAnalysis::~PipeAnalysis() { }
+
+void PipeAnalysis::set_error_handler(ErrorHandler *error_handler) {
+    m_error_handler = error_handler;
+    m_matcher_tool.set_error_handler(error_handler);
+}
+
+bool PipeAnalysis::run(const std::string &input_code) {
+    reset();
+    if (!m_matcher_tool.reset_code(input_code)) {
+        return false;
+    }
+    auto matcher = functionDecl(hasName("kernel"), isDefinition()).bind("func");
+    auto results = m_matcher_tool.match(matcher);
+    if (results.size() != 1) {
+        error("Pipe analysis: cannot find kernel function");
+        return false;
+    }
+    const MatchResult &result = results[0];
+    const FunctionDecl *func = result.Nodes.getNodeAs<FunctionDecl>("func");
+    return scan_kernel(func, *result.Context);
+}
+
+std::string PipeAnalysis::report() {
+    std::stringstream ss;
+    for (PipeInfo &pipe: m_pipes) {
+        ss << "pipe " << pipe.index << " " << pipe.name << " ";
+        if (pipe.frame > 0) {
+            ss << pipe.frame;
+        } else if (pipe.frame == 0) {
+            ss << "-";
+        } else {
+            ss << "?";
+        }
+        ss << "\n";
+    }
+    for (LoopInfo &loop: m_loops) {
+        ss << "loop " << loop.id << " " << loop.trip << "\n";
+    }
+    for (OpInfo &op: m_ops) {
+        ss << "op " << op.index << " " << (op.push ? "push" : "pop") << " " << op.count << " ";
+        if (op.loops.empty()) {
+            ss << "-";
+        } else {
+            bool first = true;
+            for (int id: op.loops) {
+                if (!first) {
+                    ss << ",";
+                }
+                ss << id;
+                first = false;
+            }
+        }
+        if (op.cond) {
+            ss << " cond";
+        }
+        ss << "\n";
+    }
+    return ss.str();
+}
+
+void PipeAnalysis::reset() {
+    m_kernel_func = nullptr;
+    m_pipes.clear();
+    m_loops.clear();
+    m_ops.clear();
+    m_loop_stack.clear();
+    m_cond_depth = 0;
+    m_branch_start = false;
+}
+
+bool PipeAnalysis::scan_kernel(const FunctionDecl *func, ASTContext &context) {
+    m_kernel_func = func;
+    Binding binding;
+    int index = 0;
+    for (const ParmVarDecl *param: func->parameters()) {
+        if (is_pipe_type(param->getType())) {
+            binding.emplace(param, index);
+            m_pipes.push_back(PipeInfo{index, param->getNameAsString(), 0});
+        }
+        index++;
+    }
+    return scan_stmt(func->getBody(), context, binding, 0);
+}
+
+bool PipeAnalysis::scan_stmt(
+        const Stmt *stmt, 
+        ASTContext &context, 
+        const Binding &binding,
+        int depth) {
+    if (stmt == nullptr) {
+        return true;
+    }
+    if (const ForStmt *for_stmt = dyn_cast<ForStmt>(stmt)) {
+        if (!scan_stmt(for_stmt->getInit(), context, binding, depth)) {
+            return false;
+        }
+        std::string trip = get_loop_trip(for_stmt, context);
+        return scan_loop(for_stmt->getBody(), trip, context, binding, depth);
+    }
+    if (const WhileStmt *while_stmt = dyn_cast<WhileStmt>(stmt)) {
+        return scan_loop(while_stmt->getBody(), "?", context, binding, depth);
+    }
+    if (const DoStmt *do_stmt = dyn_cast<DoStmt>(stmt)) {
+        return scan_loop(do_stmt->getBody(), "?", context, binding, depth);
+    }
+    if (const IfStmt *if_stmt = dyn_cast<IfStmt>(stmt)) {
+        return 
+            scan_stmt(if_stmt->getInit(), context, binding, depth) &&
+            scan_stmt(if_stmt->getCond(), context, binding, depth) &&
+            scan_branch(if_stmt->getThen(), context, binding, depth) &&
+            scan_branch(if_stmt->getElse(), context, binding, depth);
+    }
+    if (const SwitchStmt *switch_stmt = dyn_cast<SwitchStmt>(stmt)) {
+        return 
+            scan_stmt(switch_stmt->getInit(), context, binding, depth) &&
+            scan_stmt(switch_stmt->getCond(), context, binding, depth) &&
+            scan_branch(switch_stmt->getBody(), context, binding, depth);
+    }
+    if (const ConditionalOperator *cond_op = dyn_cast<ConditionalOperator>(stmt)) {
+        return 
+            scan_stmt(cond_op->getCond(), context, binding, depth) &&
+            scan_branch(cond_op->getTrueExpr(), context, binding, depth) &&
+            scan_branch(cond_op->getFalseExpr(), context, binding, depth);
+    }
+    if (const CXXMemberCallExpr *call = dyn_cast<CXXMemberCallExpr>(stmt)) {
+        if (!scan_pipe_call(call, context, binding)) {
+            return false;
+        }
+    } else if (const CallExpr *call = dyn_cast<CallExpr>(stmt)) {
+        if (!scan_func_call(call, context, binding, depth)) {
+            return false;
+        }
+    }
+    for (const Stmt *child: stmt->children()) {
+        if (!scan_stmt(child, context, binding, depth)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool PipeAnalysis::scan_loop(
+        const Stmt *body,
+        const std::string &trip,
+        ASTContext &context,
+        const Binding &binding,
+        int depth) {
+    int id = int(m_loops.size()) + 1;
+    m_loops.push_back(LoopInfo{id, trip});
+    m_loop_stack.push_back(id);
+    bool ok = scan_stmt(body, context, binding, depth);
+    m_loop_stack.pop_back();
+    return ok;
+}
+
+bool PipeAnalysis::scan_branch(
+        const Stmt *stmt,
+        ASTContext &context,
+        const Binding &binding,
+        int depth) {
+    m_cond_depth++;
+    m_branch_start = true;
+    bool ok = scan_stmt(stmt, context, binding, depth);
+    m_cond_depth--;
+    m_branch_start = true;
+    return ok;
+}
+
+bool PipeAnalysis::scan_pipe_call(
+        const CXXMemberCallExpr *call,
+        ASTContext &context,
+        const Binding &binding) {
+    const Expr *object = call->getImplicitObjectArgument();
+    if (object == nullptr || !is_pipe_type(object->getType())) {
+        return true;
+    }
+    const CXXMethodDecl *method = call->getMethodDecl();
+    if (method == nullptr) {
+        return true;
+    }
+    int index = get_binding(object, binding);
+    if (index < 0) {
+        // pipe not traceable to kernel parameter
+        return true;
+    }
+    std::string name = method->getNameAsString();
+    if (name == "push_back") {
+        add_op(index, true);
+    } else if (name == "pop_front") {
+        add_op(index, false);
+    } else if (name == "set_frame") {
+        for (PipeInfo &pipe: m_pipes) {
+            if (pipe.index != index) {
+                continue;
+            }
+            int frame = 0;
+            if (call->getNumArgs() != 1 || 
+                    !get_int_const_expr_value(call->getArg(0), context, frame) ||
+                    frame <= 0) {
+                pipe.frame = -1;
+            } else if (pipe.frame == 0) {
+                pipe.frame = frame;
+            } else if (pipe.frame != frame) {
+                pipe.frame = -1;
+            }
+        }
+    }
+    return true;
+}
+
+bool PipeAnalysis::scan_func_call(
+        const CallExpr *call,
+        ASTContext &context,
+        const Binding &binding,
+        int depth) {
+    const FunctionDecl *callee = call->getDirectCallee();
+    if (callee == nullptr) {
+        return true;
+    }
+    const FunctionDecl *def = nullptr;
+    if (!callee->hasBody(def) || def == nullptr) {
+        // builtin function
+        return true;
+    }
+    if (depth >= MAX_CALL_DEPTH) {
+        error("Pipe analysis: function calls nested too deeply in " + def->getNameAsString());
+        return false;
+    }
+    Binding callee_binding;
+    unsigned count = call->getNumArgs();
+    if (count > def->getNumParams()) {
+        count = def->getNumParams();
+    }
+    for (unsigned i = 0; i < count; i++) {
+        const ParmVarDecl *param = def->getParamDecl(i);
+        if (!is_pipe_type(param->getType())) {
+            continue;
+        }
+        int index = get_binding(call->getArg(i), binding);
+        if (index >= 0) {
+            callee_binding.emplace(param, index);
+        }
+    }
+    return scan_stmt(def->getBody(), context, callee_binding, depth + 1);
+}
+
+std::string PipeAnalysis::get_loop_trip(const ForStmt *stmt, ASTContext &context) {
+    // init: <type> <var> = <const>
+    const DeclStmt *init = dyn_cast_or_null<DeclStmt>(stmt->getInit());
+    if (init == nullptr || !init->isSingleDecl()) {
+        return "?";
+    }
+    const VarDecl *var = dyn_cast<VarDecl>(init->getSingleDecl());
+    if (var == nullptr || var->getInit() == nullptr) {
+        return "?";
+    }
+    int start = 0;
+    if (!get_int_const_expr_value(var->getInit(), context, start)) {
+        return "?";
+    }
+    // cond: <var> < <end> or <var> != <end>
+    if (stmt->getCond() == nullptr) {
+        return "?";
+    }
+    const BinaryOperator *cond = 
+        dyn_cast<BinaryOperator>(stmt->getCond()->IgnoreParenImpCasts());
+    if (cond == nullptr || 
+            (cond->getOpcode() != BO_LT && cond->getOpcode() != BO_NE) ||
+            !is_var_ref(cond->getLHS(), var)) {
+        return "?";
+    }
+    // inc: <var>++ or ++<var>
+    if (stmt->getInc() == nullptr) {
+        return "?";
+    }
+    const UnaryOperator *inc = 
+        dyn_cast<UnaryOperator>(stmt->getInc()->IgnoreParenImpCasts());
+    if (inc == nullptr || !inc->isIncrementOp() || !is_var_ref(inc->getSubExpr(), var)) {
+        return "?";
+    }
+    const Expr *end = cond->getRHS();
+    int end_value = 0;
+    if (get_int_const_expr_value(end, context, end_value)) {
+        return (end_value > start) ? std::to_string(end_value - start) : "0";
+    }
+    if (start != 0) {
+        return "?";
+    }
+    // end is kernel parameter that is not modified in the kernel body
+    // ACHTUNG: Modification of parameters is not checked (rare in practice)
+    const DeclRefExpr *ref = dyn_cast<DeclRefExpr>(end->IgnoreParenImpCasts());
+    if (ref == nullptr) {
+        return "?";
+    }
+    const ParmVarDecl *param = dyn_cast<ParmVarDecl>(ref->getDecl());
+    if (param == nullptr || param->getDeclContext() != m_kernel_func) {
+        return "?";
+    }
+    return "$" + std::to_string(param->getFunctionScopeIndex());
+}
+
+void PipeAnalysis::add_op(int index, bool push) {
+    bool cond = (m_cond_depth > 0);
+    bool branch_start = m_branch_start;
+    m_branch_start = false;
+    if (!m_ops.empty() && !branch_start) {
+        OpInfo &last = m_ops.back();
+        if (last.index == index && 
+                last.push == push && 
+                last.loops == m_loop_stack && 
+                last.cond == cond) {
+            last.count++;
+            return;
+        }
+    }
+    m_ops.push_back(OpInfo{index, push, 1, m_loop_stack, cond});
+}
+
+bool PipeAnalysis::is_pipe_type(QualType type) {
+    const CXXRecordDecl *decl = type.getNonReferenceType()->getAsCXXRecordDecl();
+    return (decl != nullptr && decl->getName() == "pipe");
+}
+
+int PipeAnalysis::get_binding(const Expr *expr, const Binding &binding) {
+    expr = expr->IgnoreParenImpCasts();
+    // pipes passed by value are copy constructed
+    const CXXConstructExpr *ctor = dyn_cast<CXXConstructExpr>(expr);
+    if (ctor != nullptr && ctor->getNumArgs() == 1) {
+        expr = ctor->getArg(0)->IgnoreParenImpCasts();
+    }
+    const DeclRefExpr *ref = dyn_cast<DeclRefExpr>(expr);
+    if (ref == nullptr) {
+        return -1;
+    }
+    const ParmVarDecl *param = dyn_cast<ParmVarDecl>(ref->getDecl());
+    if (param == nullptr) {
+        return -1;
+    }
+    auto it = binding.find(param);
+    return (it != binding.end()) ? it->second : -1;
+}
+
+void PipeAnalysis::error(const std::string &text) {
+    if (m_error_handler != nullptr) {
+        m_error_handler->error(text);
+    }
+}
+
+} // namespace front
+} // namespace tanto
+} // namespace ronin
+
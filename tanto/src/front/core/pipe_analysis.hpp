@@ -0,0 +1,126 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <map>
+
+#include "clang/AST/Decl.h"
+#include "clang/AST/Stmt.h"
+
+#include "core/error.hpp"
+#include "core/tooling.hpp"
+
+namespace ronin {
+namespace tanto {
+namespace front {
+
+using namespace clang;
+
+//
+//    Pipe analysis
+//
+//    Extracts the sequence of frame operations that a kernel performs
+//    on its pipe parameters and emits it as a line-oriented text report
+//    that the host uses to size circular buffers and to detect potential
+//    deadlocks before launch:
+//
+//    pipe <index> <name> <frame>
+//    loop <id> <trip>
+//    op <index> push|pop <count> <loops> [cond]
+//
+//    <index> is the kernel parameter index of the pipe and <frame> is
+//    the argument of "set_frame" or "?" if unknown or not constant.
+//    Each "op" line describes <count> consecutive "push_back" (producer) or
+//    "pop_front" (consumer) calls performed in one iteration of the innermost
+//    enclosing loop; "op" lines are listed in program order. <loops> is
+//    a comma separated list of enclosing loop ids, outermost first, or "-".
+//    Loop <trip> is either a decimal number, "$<index>" for loops running
+//    from a constant to the value of the kernel parameter <index>, or "?".
+//
+//    Optional "cond" marks operations in branches of "if" and "switch"
+//    statements and of conditional operators, which may be skipped.
+//
+//    Calls to user functions are inlined into the sequence with pipe
+//    parameters bound to the corresponding kernel parameters.
+//
+
+class PipeAnalysis {
+public:
+    PipeAnalysis();
+    ~PipeAnalysis();
+public:
+    void set_error_handler(ErrorHandler *error_handler);
+    bool run(const std::string &input_code);
+    std::string report();
+private:
+    struct PipeInfo {
+        int index;
+        std::string name;
+        int frame;
+    };
+    struct LoopInfo {
+        int id;
+        std::string trip;
+    };
+    struct OpInfo {
+        int index;
+        bool push;
+        int count;
+        std::vector<int> loops;
+        bool cond;
+    };
+    // pipe parameter in current scope => kernel parameter index
+    using Binding = std::map<const ParmVarDecl *, int>;
+private:
+    void reset();
+    bool scan_kernel(const FunctionDecl *func, ASTContext &context);
+    bool scan_stmt(const Stmt *stmt, ASTContext &context, const Binding &binding, int depth);
+    bool scan_loop(
+        const Stmt *body,
+        const std::string &trip,
+        ASTContext &context,
+        const Binding &binding,
+        int depth);
+    bool scan_branch(
+        const Stmt *stmt,
+        ASTContext &context,
+        const Binding &binding,
+        int depth);
+    bool scan_pipe_call(
+        const CXXMemberCallExpr *call,
+        ASTContext &context,
+        const Binding &binding);
+    bool scan_func_call(
+        const CallExpr *call,
+        ASTContext &context,
+        const Binding &binding,
+        int depth);
+    std::string get_loop_trip(const ForStmt *stmt, ASTContext &context);
+    void add_op(int index, bool push);
+    static bool is_pipe_type(QualType type);
+    static int get_binding(const Expr *expr, const Binding &binding);
+    void error(const std::string &text);
+private:
+    // maximum depth of nested user function calls
+    static constexpr int MAX_CALL_DEPTH = 16;
+private:
+    ErrorHandler *m_error_handler;
+    MatcherTool m_matcher_tool;
+    const FunctionDecl *m_kernel_func;
+    std::vector<PipeInfo> m_pipes;
+    std::vector<LoopInfo> m_loops;
+    std::vector<OpInfo> m_ops;
+    std::vector<int> m_loop_stack;
+    int m_cond_depth;
+    // ops in different branches are never merged
+    bool m_branch_start;
+};
+
+} // namespace front
+} // namespace tanto
+} // namespace ronin
+
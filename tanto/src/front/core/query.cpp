@@ -2,11 +2,15 @@
 //
 // SPDX-License-Identifier: Apache-2.0
 
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <unordered_map>
 #include <utility>
 
+#include "clang/AST/Decl.h"
+#include "clang/AST/DeclTemplate.h"
+
 #include "core/error.hpp"
 #include "core/tooling.hpp"
 #include "core/query.hpp"
@@ -17,7 +21,25 @@ namespace front {
 
 namespace {
 
-bool parse_kernel_param_type(const std::string &source, DataType &type) {
+// global buffer distribution 'block' (see 'builtin.cpp')
+constexpr uint64_t GLOBAL_DIST_BLOCK = 1;
+
+bool is_block_dist(QualType type) {
+    // global<T, DIST, DRAM>: DIST is taken from template arguments
+    //     of the specialization, default arguments included
+    const ClassTemplateSpecializationDecl *decl =
+        dyn_cast_or_null<ClassTemplateSpecializationDecl>(type->getAsCXXRecordDecl());
+    if (decl == nullptr || decl->getTemplateArgs().size() < 2) {
+        return false;
+    }
+    const TemplateArgument &arg = decl->getTemplateArgs()[1];
+    if (arg.getKind() != TemplateArgument::Integral) {
+        return false;
+    }
+    return (arg.getAsIntegral().getZExtValue() == GLOBAL_DIST_BLOCK);
+}
+
+bool parse_kernel_param_type(const std::string &source, bool block_dist, DataType &type) {
     size_t pos = source.find("<");
     if (pos == std::string::npos) {
         if (source == "int32") {
@@ -34,7 +56,7 @@ bool parse_kernel_param_type(const std::string &source, DataType &type) {
     } else {
         std::string base = source.substr(0, pos);
         if (base == "global") {
-            type = DataType::GLOBAL;
+            type = block_dist ? DataType::GLOBAL_BLOCK : DataType::GLOBAL;
         } else if (base == "local") {
             type = DataType::LOCAL;
         } else if (base == "pipe") {
@@ -106,8 +128,10 @@ bool Query::query_kernel_params() {
         if (!m_matcher_tool.eval_stencil(select_type, result, type)) {
             return false;
         }
+        const ParmVarDecl *param = result.Nodes.getNodeAs<ParmVarDecl>("param");
+        bool block_dist = is_block_dist(param->getType());
         DataType data_type;
-        if (!parse_kernel_param_type(type, data_type)) {
+        if (!parse_kernel_param_type(type, block_dist, data_type)) {
             error("Invalid kernel parameter type: " + type);
             return false;
         }
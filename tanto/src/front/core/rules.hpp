@@ -63,6 +63,7 @@ public:
     RewriteRule make_math_sub_bcast_scalar_rule();
     RewriteRule make_math_mul_bcast_scalar_rule();
     RewriteRule make_math_matmul_rule();
+    RewriteRule make_math_matmul_block_rule();
     RewriteRule make_math_reduce_max_rows_rule();
     RewriteRule make_math_reduce_max_cols_rule();
     RewriteRule make_math_reduce_max_scalar_rule();
@@ -151,6 +152,7 @@ public:
     RewriteRule make_sub_bcast_scalar_init_rule();
     RewriteRule make_mul_bcast_scalar_init_rule();
     RewriteRule make_matmul_init_rule();
+    RewriteRule make_matmul_block_init_rule();
     RewriteRule make_reduce_max_rows_init_rule();
     RewriteRule make_reduce_max_cols_init_rule();
     RewriteRule make_reduce_max_scalar_init_rule();
@@ -222,6 +224,7 @@ public:
     RewriteRule make_unpack_bcast_cols_init_rule();
     RewriteRule make_unpack_bcast_scalar_init_rule();
     RewriteRule make_unpack_matmul_init_rule();
+    RewriteRule make_unpack_matmul_block_init_rule();
     RewriteRule make_unpack_unary_init_rule();
     RewriteRule make_unpack_reduce_rows_init_rule();
     RewriteRule make_unpack_reduce_cols_init_rule();
@@ -255,6 +258,14 @@ public:
     RewriteRule make_local_move_init_rule();
     RewriteRule make_local_move_local_rule();
     RewriteRule make_local_move_pipe_rule();
+    RewriteRule make_local_read_2d_local_rule();
+    RewriteRule make_local_read_2d_local_xy_rule();
+    RewriteRule make_local_read_2d_pipe_rule();
+    RewriteRule make_local_read_2d_pipe_xy_rule();
+    RewriteRule make_local_write_2d_local_rule();
+    RewriteRule make_local_write_2d_local_xy_rule();
+    RewriteRule make_local_write_2d_pipe_rule();
+    RewriteRule make_local_write_2d_pipe_xy_rule();
     // dataflow: pipe
     RewriteRule make_pipe_get_rule();
     RewriteRule make_pipe_set_rule();
@@ -277,6 +288,14 @@ public:
     RewriteRule make_pipe_move_init_rule();
     RewriteRule make_pipe_move_local_rule();
     RewriteRule make_pipe_move_pipe_rule();
+    RewriteRule make_pipe_read_2d_local_rule();
+    RewriteRule make_pipe_read_2d_local_xy_rule();
+    RewriteRule make_pipe_read_2d_pipe_rule();
+    RewriteRule make_pipe_read_2d_pipe_xy_rule();
+    RewriteRule make_pipe_write_2d_local_rule();
+    RewriteRule make_pipe_write_2d_local_xy_rule();
+    RewriteRule make_pipe_write_2d_pipe_rule();
+    RewriteRule make_pipe_write_2d_pipe_xy_rule();
     // dataflow: semaphore
     RewriteRule make_semaphore_set_rule();
     RewriteRule make_semaphore_set_remote_rule();
@@ -384,6 +384,25 @@ RewriteRule RuleFactory::make_math_matmul_rule() {
                     node("arg5"), ");")));
 }
 
+RewriteRule RuleFactory::make_math_matmul_block_rule() {
+    // self.matmul_block(src0, src1, isrc0, isrc1, idst, transpose, ct_dim);
+    //     =>
+    // matmul_block(src0.cb_id, src1.cb_id, isrc0, isrc1, idst, transpose, ct_dim, 1, 1);
+    return makeRule(
+        make_member_call_7_matcher("math", "matmul_block"),
+        changeTo(
+            statement("stmt"), 
+            cat(
+                "matmul_block(", 
+                    access("arg0", "cb_id"), ", ", 
+                    access("arg1", "cb_id"), ", ",
+                    node("arg2"), ", ", 
+                    node("arg3"), ", ", 
+                    node("arg4"), ", ", 
+                    node("arg5"), ", ", 
+                    node("arg6"), ", 1, 1);")));
+}
+
 RewriteRule RuleFactory::make_math_reduce_max_rows_rule() {
     // self.reduce_max_rows(src0, src1, isrc0, isrc1, idst);
     //    =>
@@ -205,6 +205,17 @@ RewriteRule RuleFactory::make_matmul_init_rule() {
     return _make_math_init_param_rule("__matmul_init", "tanto_matmul_init");
 }
 
+RewriteRule RuleFactory::make_matmul_block_init_rule() {
+    // __matmul_block_init(transpose, ct_dim);
+    //     =>
+    // tanto_matmul_block_init(transpose, ct_dim);
+    return makeRule(
+        make_func_call_2_matcher("__matmul_block_init"),
+        changeTo(
+            statement("stmt"),
+            cat("tanto_matmul_block_init(", node("arg0"), ", ", node("arg1"), ");")));
+}
+
 RewriteRule RuleFactory::make_reduce_max_rows_init_rule() {
     // __reduce_max_rows_init();
     //     =>
@@ -706,6 +717,22 @@ RewriteRule RuleFactory::make_unpack_matmul_init_rule() {
         "__unpack_matmul_init", "tanto_unpack_matmul_init");
 }
 
+RewriteRule RuleFactory::make_unpack_matmul_block_init_rule() {
+    // __unpack_matmul_block_init(icb0, icb1, transpose, ct_dim);
+    //     =>
+    // tanto_unpack_matmul_block_init(icb0.cb_id, icb1.cb_id, transpose, ct_dim);
+    return makeRule(
+        make_func_call_4_matcher("__unpack_matmul_block_init"),
+        changeTo(
+            statement("stmt"),
+            cat(
+                "tanto_unpack_matmul_block_init(", 
+                    access("arg0", "cb_id"), ", ", 
+                    access("arg1", "cb_id"), ", ",
+                    node("arg2"), ", ",
+                    node("arg3"), ");")));
+}
+
 RewriteRule RuleFactory::make_unpack_unary_init_rule() {
     // __unpack_unary_init(icb);
     //     =>
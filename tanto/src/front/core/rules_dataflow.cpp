@@ -14,6 +14,11 @@
 /*
 Global buffers require these extensions to dataflow API
 
+For distributed (block and cyclic) global buffers, field "log2_page_size"
+of the global buffer object holds page size in bytes rather than its log2
+(see GlobalImpl::page_arg in host API); field "bank_pages" holds number
+of pages per DRAM bank and is set for block distribution only
+
 void noc_async_read_global_dram(
     uint32_t dst_addr,
     uint32_t src_addr,
@@ -43,6 +48,7 @@ void noc_async_read_block_dram(
     uint32_t dst_addr,
     uint32_t src_addr,
     uint32_t src_page_size,
+    uint32_t src_bank_pages,
     uint32_t src_page_id,
     uint32_t src_offset,
     uint32_t len_bytes);
@@ -57,6 +63,7 @@ void noc_async_write_block_dram(
     uint32_t src_addr,
     uint32_t dst_addr,
     uint32_t dst_page_size,
+    uint32_t dst_bank_pages,
     uint32_t dst_page_id,
     uint32_t dst_offset,
     uint32_t len_bytes);
@@ -67,6 +74,21 @@ void noc_async_write_cyclic_dram(
     uint32_t dst_page_id,
     uint32_t dst_offset,
     uint32_t len_bytes);
+
+void noc_async_read_2d(
+    uint64_t src_noc_addr,
+    uint32_t dst_addr,
+    uint32_t rows,
+    uint32_t len_bytes,
+    uint32_t src_stride,
+    uint32_t dst_stride);
+void noc_async_write_2d(
+    uint32_t src_addr,
+    uint64_t dst_noc_addr,
+    uint32_t rows,
+    uint32_t len_bytes,
+    uint32_t src_stride,
+    uint32_t dst_stride);
 */
 
 namespace ronin {
@@ -84,21 +106,28 @@ Stencil make_t_stencil() {
             {"T_uint16", cat("uint16_t")},
             {"T_uint32", cat("uint32_t")},
             {"T_float", cat("float")},
-            {"T_bfloat16", cat("bfloat16_t")}
+            {"T_bfloat16", cat("bfloat16_t")},
+            {"T_bfp8_b", cat("uint8_t")},
+            {"T_bfp4_b", cat("uint8_t")}
         },
         cat("float") // cannot happen
     );
 }
 
-Stencil make_t_shift_stencil() {
+Stencil make_t_bytes_stencil(const std::string &id) {
+    // converts offset or count in items to bytes; block-float
+    // offsets and counts must be multiples of tile size (1024 items);
+    // rule comments below denote the conversion as BYTES(x)
     return selectBound(
         {
-            {"T_uint16", cat("1")},
-            {"T_uint32", cat("2")},
-            {"T_float", cat("2")},
-            {"T_bfloat16", cat("1")}
+            {"T_uint16", cat(expression(id), " << 1")},
+            {"T_uint32", cat(expression(id), " << 2")},
+            {"T_float", cat(expression(id), " << 2")},
+            {"T_bfloat16", cat(expression(id), " << 1")},
+            {"T_bfp8_b", cat("tanto_bfp8_bytes(", expression(id), ")")},
+            {"T_bfp4_b", cat("tanto_bfp4_bytes(", expression(id), ")")}
         },
-        cat("0") // cannot happen
+        cat(expression(id)) // cannot happen
     );
 }
 
@@ -113,6 +142,16 @@ Stencil make_dist_suffix_stencil() {
     );
 }
 
+Stencil make_dist_bank_pages_stencil(const std::string &id) {
+    // bank pages are passed for block distribution only
+    return selectBound(
+        {
+            {"DIST_block", cat(access(id, "bank_pages"), ", ")}
+        },
+        cat("")
+    );
+}
+
 Stencil make_dram_suffix_stencil() {
     return selectBound(
         {
@@ -171,12 +210,11 @@ RewriteRule RuleFactory::make_local_read_global_rule() {
     // self.read(dst_offset, src, src_offset, count);
     //     =>
     // noc_async_read_global_[dram|l1](
-    //     self.addr + (dst_offset << T_SHIFT),
+    //     self.addr + (BYTES(dst_offset)),
     //     src.addr,
     //     src.log2_page_size,
-    //     src_offset << T_SHIFT,
-    //     count << T_SHIFT);
-    auto t_shift = make_t_shift_stencil();
+    //     BYTES(src_offset),
+    //     BYTES(count));
     auto dram = make_dram_suffix_stencil();
     return makeRule(
         make_member_call_4_with_t_dist_dram_matcher("local", "read"),
@@ -185,24 +223,24 @@ RewriteRule RuleFactory::make_local_read_global_rule() {
             cat(
                 "noc_async_read_global_", dram, "(",
                     access("self", "addr"), 
-                        " + (", expression("arg0"), " << ", t_shift, "), ",
+                        " + (", make_t_bytes_stencil("arg0"), "), ",
                     access("arg1", "addr"), ", ",
                     access("arg1", "log2_page_size"), ", ",
-                    expression("arg2"), " << ", t_shift, ", ",
-                    expression("arg3"), " << ", t_shift, ");")));
+                    make_t_bytes_stencil("arg2"), ", ",
+                    make_t_bytes_stencil("arg3"), ");")));
 }
 
 RewriteRule RuleFactory::make_local_read_global_dist_rule() {
     // self.read(dst_offset, src, src_page, src_offset, count);
     //     =>
     // noc_async_read_[linear|block|cyclic]_dram(
-    //     self.addr + (dst_offset << T_SHIFT),
+    //     self.addr + (BYTES(dst_offset)),
     //     src.addr,
     //     src.log2_page_size,
+    //     [src.bank_pages,]
     //     src_page,
-    //     src_offset << T_SHIFT,
-    //     count << T_SHIFT);
-    auto t_shift = make_t_shift_stencil();
+    //     BYTES(src_offset),
+    //     BYTES(count));
     auto dist = make_dist_suffix_stencil();
     return makeRule(
         make_member_call_5_with_t_dist_dram_matcher("local", "read"),
@@ -211,22 +249,22 @@ RewriteRule RuleFactory::make_local_read_global_dist_rule() {
             cat(
                 "noc_async_read_", dist, "_dram(",
                     access("self", "addr"), 
-                        " + (", expression("arg0"), " << ", t_shift, "), ",
+                        " + (", make_t_bytes_stencil("arg0"), "), ",
                     access("arg1", "addr"), ", ",
                     access("arg1", "log2_page_size"), ", ",
+                    make_dist_bank_pages_stencil("arg1"),
                     expression("arg2"), ", ",
-                    expression("arg3"), " << ", t_shift, ", ",
-                    expression("arg4"), " << ", t_shift, ");")));
+                    make_t_bytes_stencil("arg3"), ", ",
+                    make_t_bytes_stencil("arg4"), ");")));
 }
 
 RewriteRule RuleFactory::make_local_read_local_rule() {
     // self.read(dst_offset, src, src_offset, count);
     //     =>
     // noc_async_read(
-    //     get_noc_addr(src.addr + (src_offset << T_SHIFT)), 
-    //     self.addr + (dst_offset << T_SHIFT),
-    //     count << T_SHIFT);
-    auto t_shift = make_t_shift_stencil();
+    //     get_noc_addr(src.addr + (BYTES(src_offset))), 
+    //     self.addr + (BYTES(dst_offset)),
+    //     BYTES(count));
     return makeRule(
         make_member_call_4_with_t_arg1_matcher("local", "read", "local"),
         changeTo(
@@ -234,20 +272,19 @@ RewriteRule RuleFactory::make_local_read_local_rule() {
             cat(
                 "noc_async_read(",
                     "get_noc_addr(", access("arg1", "addr"), 
-                        " + (", expression("arg2"), " << ", t_shift, ")), ",
+                        " + (", make_t_bytes_stencil("arg2"), ")), ",
                     access("self", "addr"),
-                        " + (", expression("arg0"), " << ", t_shift, "), ",
-                    expression("arg3"), " << ", t_shift, ");")));
+                        " + (", make_t_bytes_stencil("arg0"), "), ",
+                    make_t_bytes_stencil("arg3"), ");")));
 }
 
 RewriteRule RuleFactory::make_local_read_local_xy_rule() {
     // self.read(dst_offset, src, src_offset, count, x, y);
     //     =>
     // noc_async_read(
-    //     get_noc_addr(x, y, src.addr + (src_offset << T_SHIFT)), 
-    //     self.addr + (dst_offset << T_SHIFT),
-    //     count << T_SHIFT);
-    auto t_shift = make_t_shift_stencil();
+    //     get_noc_addr(x, y, src.addr + (BYTES(src_offset))), 
+    //     self.addr + (BYTES(dst_offset)),
+    //     BYTES(count));
     return makeRule(
         make_member_call_6_with_t_arg1_matcher("local", "read", "local"),
         changeTo(
@@ -258,20 +295,19 @@ RewriteRule RuleFactory::make_local_read_local_xy_rule() {
                         node("arg4"), ", ", 
                         node("arg5"), ", ", 
                         access("arg1", "addr"), 
-                            " + (", expression("arg2"), " << ", t_shift, ")), ",
+                            " + (", make_t_bytes_stencil("arg2"), ")), ",
                     access("self", "addr"),
-                        " + (", expression("arg0"), " << ", t_shift, "), ",
-                    expression("arg3"), " << ", t_shift, ");")));
+                        " + (", make_t_bytes_stencil("arg0"), "), ",
+                    make_t_bytes_stencil("arg3"), ");")));
 }
 
 RewriteRule RuleFactory::make_local_read_pipe_rule() {
     // self.read(dst_offset, src, src_offset, count);
     //     =>
     // noc_async_read(
-    //     get_noc_addr(get_read_ptr(src.cb_id) + (src_offset << T_SHIFT)), 
-    //     self.addr + (dst_offset << T_SHIFT),
-    //     count << T_SHIFT);
-    auto t_shift = make_t_shift_stencil();
+    //     get_noc_addr(get_read_ptr(src.cb_id) + (BYTES(src_offset))), 
+    //     self.addr + (BYTES(dst_offset)),
+    //     BYTES(count));
     return makeRule(
         make_member_call_4_with_t_arg1_matcher("local", "read", "pipe"),
         changeTo(
@@ -279,20 +315,19 @@ RewriteRule RuleFactory::make_local_read_pipe_rule() {
             cat(
                 "noc_async_read(",
                     "get_noc_addr(get_read_ptr(", access("arg1", "cb_id"), 
-                        ") + (", expression("arg2"), " << ", t_shift, ")), ",
+                        ") + (", make_t_bytes_stencil("arg2"), ")), ",
                     access("self", "addr"),
-                        " + (", expression("arg0"), " << ", t_shift, "), ",
-                    expression("arg3"), " << ", t_shift, ");")));
+                        " + (", make_t_bytes_stencil("arg0"), "), ",
+                    make_t_bytes_stencil("arg3"), ");")));
 }
 
 RewriteRule RuleFactory::make_local_read_pipe_xy_rule() {
     // self.read(dst_offset, src, src_offset, count, x, y);
     //     =>
     // noc_async_read(
-    //     get_noc_addr(x, y, get_read_ptr(src.cb_id) + (src_offset << T_SHIFT)), 
-    //     self.addr + (dst_offset << T_SHIFT),
-    //     count << T_SHIFT);
-    auto t_shift = make_t_shift_stencil();
+    //     get_noc_addr(x, y, get_read_ptr(src.cb_id) + (BYTES(src_offset))), 
+    //     self.addr + (BYTES(dst_offset)),
+    //     BYTES(count));
     return makeRule(
         make_member_call_6_with_t_arg1_matcher("local", "read", "pipe"),
         changeTo(
@@ -303,22 +338,21 @@ RewriteRule RuleFactory::make_local_read_pipe_xy_rule() {
                         node("arg4"), ", ", 
                         node("arg5"), ", ", 
                         "get_read_ptr(", access("arg1", "cb_id"), 
-                            ") + (", expression("arg2"), " << ", t_shift, ")), ",
+                            ") + (", make_t_bytes_stencil("arg2"), ")), ",
                     access("self", "addr"),
-                        " + (", expression("arg0"), " << ", t_shift, "), ",
-                    expression("arg3"), " << ", t_shift, ");")));
+                        " + (", make_t_bytes_stencil("arg0"), "), ",
+                    make_t_bytes_stencil("arg3"), ");")));
 }
 
 RewriteRule RuleFactory::make_local_write_global_rule() {
     // self.write(src_offset, dst, dst_offset, count);
     //     =>
     // noc_async_write_global_[dram|l1](
-    //     self.addr + (src_offset << T_SHIFT),
+    //     self.addr + (BYTES(src_offset)),
     //     dst.addr,
     //     dst.log2_page_size,
-    //     dst_offset << T_SHIFT,
-    //     count << T_SHIFT);
-    auto t_shift = make_t_shift_stencil();
+    //     BYTES(dst_offset),
+    //     BYTES(count));
     auto dram = make_dram_suffix_stencil();
     return makeRule(
         make_member_call_4_with_t_dist_dram_matcher("local", "write"),
@@ -327,24 +361,24 @@ RewriteRule RuleFactory::make_local_write_global_rule() {
             cat(
                 "noc_async_write_global_", dram, "(",
                     access("self", "addr"), 
-                        " + (", expression("arg0"), " << ", t_shift, "), ",
+                        " + (", make_t_bytes_stencil("arg0"), "), ",
                     access("arg1", "addr"), ", ",
                     access("arg1", "log2_page_size"), ", ",
-                    expression("arg2"), " << ", t_shift, ", ",
-                    expression("arg3"), " << ", t_shift, ");")));
+                    make_t_bytes_stencil("arg2"), ", ",
+                    make_t_bytes_stencil("arg3"), ");")));
 }
 
 RewriteRule RuleFactory::make_local_write_global_dist_rule() {
     // self.write(src_offset, dst, dst_page, dst_offset, count);
     //     =>
     // noc_async_write_[linear|block|cyclic]_dram(
-    //     self.addr + (src_offset << T_SHIFT),
+    //     self.addr + (BYTES(src_offset)),
     //     dst.addr,
     //     dst.log2_page_size,
+    //     [dst.bank_pages,]
     //     dst_page,
-    //     dst_offset << T_SHIFT,
-    //     count << T_SHIFT);
-    auto t_shift = make_t_shift_stencil();
+    //     BYTES(dst_offset),
+    //     BYTES(count));
     auto dist = make_dist_suffix_stencil();
     return makeRule(
         make_member_call_5_with_t_dist_dram_matcher("local", "write"),
@@ -353,22 +387,22 @@ RewriteRule RuleFactory::make_local_write_global_dist_rule() {
             cat(
                 "noc_async_write_", dist, "_dram(",
                     access("self", "addr"), 
-                        " + (", expression("arg0"), " << ", t_shift, "), ",
+                        " + (", make_t_bytes_stencil("arg0"), "), ",
                     access("arg1", "addr"), ", ",
                     access("arg1", "log2_page_size"), ", ",
+                    make_dist_bank_pages_stencil("arg1"),
                     expression("arg2"), ", ",
-                    expression("arg3"), " << ", t_shift, ", ",
-                    expression("arg4"), " << ", t_shift, ");")));
+                    make_t_bytes_stencil("arg3"), ", ",
+                    make_t_bytes_stencil("arg4"), ");")));
 }
 
 RewriteRule RuleFactory::make_local_write_local_rule() {
     // self.write(src_offset, dst, dst_offset, count);
     //     =>
     // noc_async_write(
-    //     self.addr + (src_offset << T_SHIFT),
-    //     get_noc_addr(dst.addr + (dst_offset << T_SHIFT)),
-    //     count << T_SHIFT);
-    auto t_shift = make_t_shift_stencil();
+    //     self.addr + (BYTES(src_offset)),
+    //     get_noc_addr(dst.addr + (BYTES(dst_offset))),
+    //     BYTES(count));
     return makeRule(
         make_member_call_4_with_t_arg1_matcher("local", "write", "local"),
         changeTo(
@@ -376,20 +410,19 @@ RewriteRule RuleFactory::make_local_write_local_rule() {
             cat(
                 "noc_async_write(",
                     access("self", "addr"),
-                        " + (", expression("arg0"), " << ", t_shift, "), ",
+                        " + (", make_t_bytes_stencil("arg0"), "), ",
                     "get_noc_addr(", access("arg1", "addr"), 
-                        " + (", expression("arg2"), " << ", t_shift, ")), ",
-                    expression("arg3"), " << ", t_shift, ");")));
+                        " + (", make_t_bytes_stencil("arg2"), ")), ",
+                    make_t_bytes_stencil("arg3"), ");")));
 }
 
 RewriteRule RuleFactory::make_local_write_local_xy_rule() {
     // self.write(src_offset, dst, dst_offset, count, x, y);
     //     =>
     // noc_async_write(
-    //     self.addr + (src_offset << T_SHIFT),
-    //     get_noc_addr(x, y, dst.addr + (dst_offset << T_SHIFT)),
-    //     count << T_SHIFT);
-    auto t_shift = make_t_shift_stencil();
+    //     self.addr + (BYTES(src_offset)),
+    //     get_noc_addr(x, y, dst.addr + (BYTES(dst_offset))),
+    //     BYTES(count));
     return makeRule(
         make_member_call_6_with_t_arg1_matcher("local", "write", "local"),
         changeTo(
@@ -397,23 +430,22 @@ RewriteRule RuleFactory::make_local_write_local_xy_rule() {
             cat(
                 "noc_async_write(",
                     access("self", "addr"),
-                        " + (", expression("arg0"), " << ", t_shift, "), ",
+                        " + (", make_t_bytes_stencil("arg0"), "), ",
                     "get_noc_addr(", 
                         node("arg4"), ", ", 
                         node("arg5"), ", ", 
                         access("arg1", "addr"), 
-                            " + (", expression("arg2"), " << ", t_shift, ")), ",
-                    expression("arg3"), " << ", t_shift, ");")));
+                            " + (", make_t_bytes_stencil("arg2"), ")), ",
+                    make_t_bytes_stencil("arg3"), ");")));
 }
 
 RewriteRule RuleFactory::make_local_write_pipe_rule() {
     // self.write(src_offset, dst, dst_offset, count);
     //     =>
     // noc_async_write(
-    //     self.addr + (src_offset << T_SHIFT),
-    //     get_noc_addr(get_write_ptr(dst.cb_id) + (dst_offset << T_SHIFT)),
-    //     count << T_SHIFT);
-    auto t_shift = make_t_shift_stencil();
+    //     self.addr + (BYTES(src_offset)),
+    //     get_noc_addr(get_write_ptr(dst.cb_id) + (BYTES(dst_offset))),
+    //     BYTES(count));
     return makeRule(
         make_member_call_4_with_t_arg1_matcher("local", "write", "pipe"),
         changeTo(
@@ -421,19 +453,18 @@ RewriteRule RuleFactory::make_local_write_pipe_rule() {
             cat(
                 "noc_async_write(",
                     access("self", "addr"),
-                        " + (", expression("arg0"), " << ", t_shift, "), ",
+                        " + (", make_t_bytes_stencil("arg0"), "), ",
                     "get_noc_addr(get_write_ptr(", access("arg1", "cb_id"), 
-                        ") + (", expression("arg2"), " << ", t_shift, ")), ",
-                    expression("arg3"), " << ", t_shift, ");")));
+                        ") + (", make_t_bytes_stencil("arg2"), ")), ",
+                    make_t_bytes_stencil("arg3"), ");")));
 }
 
 RewriteRule RuleFactory::make_local_write_pipe_xy_rule() {
     // self.write(src_offset, dst, dst_offset, count, x, y);
     // noc_async_write(
-    //     self.addr + (src_offset << T_SHIFT),
-    //     get_noc_addr(x, y, get_write_ptr(dst.cb_id) + (dst_offset << T_SHIFT)),
-    //     count << T_SHIFT);
-    auto t_shift = make_t_shift_stencil();
+    //     self.addr + (BYTES(src_offset)),
+    //     get_noc_addr(x, y, get_write_ptr(dst.cb_id) + (BYTES(dst_offset))),
+    //     BYTES(count));
     return makeRule(
         make_member_call_6_with_t_arg1_matcher("local", "write", "pipe"),
         changeTo(
@@ -441,13 +472,13 @@ RewriteRule RuleFactory::make_local_write_pipe_xy_rule() {
             cat(
                 "noc_async_write(",
                     access("self", "addr"),
-                        " + (", expression("arg0"), " << ", t_shift, "), ",
+                        " + (", make_t_bytes_stencil("arg0"), "), ",
                     "get_noc_addr(", 
                         node("arg4"), ", ", 
                         node("arg5"), ", ", 
                         "get_write_ptr(", access("arg1", "cb_id"), 
-                            ") + (", expression("arg2"), " << ", t_shift, ")), ",
-                    expression("arg3"), " << ", t_shift, ");")));
+                            ") + (", make_t_bytes_stencil("arg2"), ")), ",
+                    make_t_bytes_stencil("arg3"), ");")));
 }
 
 RewriteRule RuleFactory::make_local_write_mcast_local_rule() {
@@ -455,12 +486,11 @@ RewriteRule RuleFactory::make_local_write_mcast_local_rule() {
     //     src_offset, dst, dst_offset, count, x_start, y_start, x_end, y_end, num_dests);
     //     =>
     // noc_async_write_multicast(
-    //     self.addr + (src_offset << T_SHIFT),
+    //     self.addr + (BYTES(src_offset)),
     //     get_noc_multicast_addr(
-    //         x_start, y_start, x_end, y_end, dst.addr + (dst_offset << T_SHIFT)),
-    //     count << T_SHIFT,
+    //         x_start, y_start, x_end, y_end, dst.addr + (BYTES(dst_offset))),
+    //     BYTES(count),
     //     num_dests);
-    auto t_shift = make_t_shift_stencil();
     return makeRule(
         make_member_call_9_with_t_arg1_matcher("local", "write_mcast", "local"),
         changeTo(
@@ -468,15 +498,15 @@ RewriteRule RuleFactory::make_local_write_mcast_local_rule() {
             cat(
                 "noc_async_write_multicast(",
                     access("self", "addr"),
-                        " + (", expression("arg0"), " << ", t_shift, "), ",
+                        " + (", make_t_bytes_stencil("arg0"), "), ",
                     "get_noc_multicast_addr(", 
                         node("arg4"), ", ", 
                         node("arg5"), ", ", 
                         node("arg6"), ", ", 
                         node("arg7"), ", ", 
                         access("arg1", "addr"), 
-                            " + (", expression("arg2"), " << ", t_shift, ")), ",
-                    expression("arg3"), " << ", t_shift, ", ",
+                            " + (", make_t_bytes_stencil("arg2"), ")), ",
+                    make_t_bytes_stencil("arg3"), ", ",
                     node("arg8"), ");")));
 }
 
@@ -485,12 +515,11 @@ RewriteRule RuleFactory::make_local_write_mcast_with_self_local_rule() {
     //     src_offset, dst, dst_offset, count, x_start, y_start, x_end, y_end, num_dests);
     //     =>
     // noc_async_write_multicast_loopback_src(
-    //     self.addr + (src_offset << T_SHIFT),
+    //     self.addr + (BYTES(src_offset)),
     //     get_noc_multicast_addr(
-    //         x_start, y_start, x_end, y_end, dst.addr + (dst_offset << T_SHIFT)),
-    //     count << T_SHIFT,
+    //         x_start, y_start, x_end, y_end, dst.addr + (BYTES(dst_offset))),
+    //     BYTES(count),
     //     num_dests);
-    auto t_shift = make_t_shift_stencil();
     return makeRule(
         make_member_call_9_with_t_arg1_matcher("local", "write_mcast_with_self", "local"),
         changeTo(
@@ -498,15 +527,15 @@ RewriteRule RuleFactory::make_local_write_mcast_with_self_local_rule() {
             cat(
                 "noc_async_write_multicast_loopback_src(",
                     access("self", "addr"),
-                        " + (", expression("arg0"), " << ", t_shift, "), ",
+                        " + (", make_t_bytes_stencil("arg0"), "), ",
                     "get_noc_multicast_addr(", 
                         node("arg4"), ", ", 
                         node("arg5"), ", ", 
                         node("arg6"), ", ", 
                         node("arg7"), ", ", 
                         access("arg1", "addr"), 
-                            " + (", expression("arg2"), " << ", t_shift, ")), ",
-                    expression("arg3"), " << ", t_shift, ", ",
+                            " + (", make_t_bytes_stencil("arg2"), ")), ",
+                    make_t_bytes_stencil("arg3"), ", ",
                     node("arg8"), ");")));
 }
 
@@ -515,12 +544,11 @@ RewriteRule RuleFactory::make_local_write_mcast_pipe_rule() {
     //     src_offset, dst, dst_offset, count, x_start, y_start, x_end, y_end, num_dests);
     //     =>
     // noc_async_write_multicast(
-    //     self.addr + (src_offset << T_SHIFT),
+    //     self.addr + (BYTES(src_offset)),
     //     get_noc_multicast_addr(
-    //         x_start, y_start, x_end, y_end, get_write_ptr(dst.cb_id) + (dst_offset << T_SHIFT)),
-    //     count << T_SHIFT,
+    //         x_start, y_start, x_end, y_end, get_write_ptr(dst.cb_id) + (BYTES(dst_offset))),
+    //     BYTES(count),
     //     num_dests);
-    auto t_shift = make_t_shift_stencil();
     return makeRule(
         make_member_call_9_with_t_arg1_matcher("local", "write_mcast", "pipe"),
         changeTo(
@@ -528,15 +556,15 @@ RewriteRule RuleFactory::make_local_write_mcast_pipe_rule() {
             cat(
                 "noc_async_write_multicast(",
                     access("self", "addr"),
-                        " + (", expression("arg0"), " << ", t_shift, "), ",
+                        " + (", make_t_bytes_stencil("arg0"), "), ",
                     "get_noc_multicast_addr(", 
                         node("arg4"), ", ", 
                         node("arg5"), ", ", 
                         node("arg6"), ", ", 
                         node("arg7"), ", ", 
                         "get_write_ptr(", access("arg1", "cb_id"), 
-                            ") + (", expression("arg2"), " << ", t_shift, ")), ",
-                    expression("arg3"), " << ", t_shift, ", ",
+                            ") + (", make_t_bytes_stencil("arg2"), ")), ",
+                    make_t_bytes_stencil("arg3"), ", ",
                     node("arg8"), ");")));
 }
 
@@ -545,12 +573,11 @@ RewriteRule RuleFactory::make_local_write_mcast_with_self_pipe_rule() {
     //     src_offset, dst, dst_offset, count, x_start, y_start, x_end, y_end, num_dests);
     //     =>
     // noc_async_write_multicast_loopback_src(
-    //     self.addr + (src_offset << T_SHIFT),
+    //     self.addr + (BYTES(src_offset)),
     //     get_noc_multicast_addr(
-    //         x_start, y_start, x_end, y_end, get_write_ptr(dst.cb_id) + (dst_offset << T_SHIFT)),
-    //     count << T_SHIFT,
+    //         x_start, y_start, x_end, y_end, get_write_ptr(dst.cb_id) + (BYTES(dst_offset))),
+    //     BYTES(count),
     //     num_dests);
-    auto t_shift = make_t_shift_stencil();
     return makeRule(
         make_member_call_9_with_t_arg1_matcher("local", "write_mcast_with_self", "pipe"),
         changeTo(
@@ -558,39 +585,37 @@ RewriteRule RuleFactory::make_local_write_mcast_with_self_pipe_rule() {
             cat(
                 "noc_async_write_multicast_loopback_src(",
                     access("self", "addr"),
-                        " + (", expression("arg0"), " << ", t_shift, "), ",
+                        " + (", make_t_bytes_stencil("arg0"), "), ",
                     "get_noc_multicast_addr(", 
                         node("arg4"), ", ", 
                         node("arg5"), ", ", 
                         node("arg6"), ", ", 
                         node("arg7"), ", ", 
                         "get_write_ptr(", access("arg1", "cb_id"), 
-                            ") + (", expression("arg2"), " << ", t_shift, ")), ",
-                    expression("arg3"), " << ", t_shift, ", ",
+                            ") + (", make_t_bytes_stencil("arg2"), ")), ",
+                    make_t_bytes_stencil("arg3"), ", ",
                     node("arg8"), ");")));
 }
 
 RewriteRule RuleFactory::make_local_move_init_rule() {
     // self.move_init(count);
     //     =>
-    // noc_async_read_one_packet_set_state(get_noc_addr(0), count << T_SHIFT);
-    auto t_shift = make_t_shift_stencil();
+    // noc_async_read_one_packet_set_state(get_noc_addr(0), BYTES(count));
     return makeRule(
         make_member_call_1_with_t_matcher("pipe", "move_init"),
         changeTo(
             statement("stmt"),
             cat(
                 "noc_async_read_one_packet_set_state(get_noc_addr(0), ",
-                    expression("arg0"), " << ", t_shift, ");")));
+                    make_t_bytes_stencil("arg0"), ");")));
 }
 
 RewriteRule RuleFactory::make_local_move_local_rule() {
     // self.move(dst_offset, src, src_offset);
     //     =>
     // noc_async_read_one_packet_with_state(
-    //     src.addr + (src_offset << T_SHIFT), 
-    //     self.addr + (dst_offset << T_SHIFT));
-    auto t_shift = make_t_shift_stencil();
+    //     src.addr + (BYTES(src_offset)), 
+    //     self.addr + (BYTES(dst_offset)));
     return makeRule(
         make_member_call_3_with_t_arg1_matcher("local", "move", "local"),
         changeTo(
@@ -598,18 +623,17 @@ RewriteRule RuleFactory::make_local_move_local_rule() {
             cat(
                 "noc_async_read_one_packet_with_state(",
                     access("arg1", "addr"), 
-                        " + (", expression("arg2"), " << ", t_shift, "), ",
+                        " + (", make_t_bytes_stencil("arg2"), "), ",
                     access("self", "addr"),
-                        " + (", expression("arg0"), " << ", t_shift, "));")));
+                        " + (", make_t_bytes_stencil("arg0"), "));")));
 }
 
 RewriteRule RuleFactory::make_local_move_pipe_rule() {
     // self.move(dst_offset, src, src_offset);
     //     =>
     // noc_async_read_one_packet_with_state(
-    //     get_read_ptr(src.cb_id) + (src_offset << T_SHIFT), 
-    //     self.addr + (dst_offset << T_SHIFT));
-    auto t_shift = make_t_shift_stencil();
+    //     get_read_ptr(src.cb_id) + (BYTES(src_offset)), 
+    //     self.addr + (BYTES(dst_offset)));
     return makeRule(
         make_member_call_3_with_t_arg1_matcher("local", "move", "pipe"),
         changeTo(
@@ -617,9 +641,229 @@ RewriteRule RuleFactory::make_local_move_pipe_rule() {
             cat(
                 "noc_async_read_one_packet_with_state(",
                     "get_read_ptr(", access("arg1", "cb_id"), 
-                        ") + (", expression("arg2"), " << ", t_shift, "), ",
+                        ") + (", make_t_bytes_stencil("arg2"), "), ",
+                    access("self", "addr"),
+                        " + (", make_t_bytes_stencil("arg0"), "));")));
+}
+
+RewriteRule RuleFactory::make_local_read_2d_local_rule() {
+    // self.read_2d(dst_offset, src, src_offset, rows, count, dst_stride, src_stride);
+    //     =>
+    // noc_async_read_2d(
+    //     get_noc_addr(src.addr + (BYTES(src_offset))),
+    //     self.addr + (BYTES(dst_offset)),
+    //     rows,
+    //     BYTES(count),
+    //     BYTES(src_stride),
+    //     BYTES(dst_stride));
+    return makeRule(
+        make_member_call_7_with_t_arg1_matcher("local", "read_2d", "local"),
+        changeTo(
+            statement("stmt"),
+            cat(
+                "noc_async_read_2d(",
+                    "get_noc_addr(", access("arg1", "addr"), 
+                        " + (", make_t_bytes_stencil("arg2"), ")), ",
+                    access("self", "addr"),
+                        " + (", make_t_bytes_stencil("arg0"), "), ",
+                    expression("arg3"), ", ",
+                    make_t_bytes_stencil("arg4"), ", ",
+                    make_t_bytes_stencil("arg6"), ", ",
+                    make_t_bytes_stencil("arg5"), ");")));
+}
+
+RewriteRule RuleFactory::make_local_read_2d_local_xy_rule() {
+    // self.read_2d(dst_offset, src, src_offset, rows, count, dst_stride, src_stride, x, y);
+    //     =>
+    // noc_async_read_2d(
+    //     get_noc_addr(x, y, src.addr + (BYTES(src_offset))),
+    //     self.addr + (BYTES(dst_offset)),
+    //     rows,
+    //     BYTES(count),
+    //     BYTES(src_stride),
+    //     BYTES(dst_stride));
+    return makeRule(
+        make_member_call_9_with_t_arg1_matcher("local", "read_2d", "local"),
+        changeTo(
+            statement("stmt"),
+            cat(
+                "noc_async_read_2d(",
+                    "get_noc_addr(", 
+                        node("arg7"), ", ", 
+                        node("arg8"), ", ", 
+                        access("arg1", "addr"), 
+                            " + (", make_t_bytes_stencil("arg2"), ")), ",
+                    access("self", "addr"),
+                        " + (", make_t_bytes_stencil("arg0"), "), ",
+                    expression("arg3"), ", ",
+                    make_t_bytes_stencil("arg4"), ", ",
+                    make_t_bytes_stencil("arg6"), ", ",
+                    make_t_bytes_stencil("arg5"), ");")));
+}
+
+RewriteRule RuleFactory::make_local_read_2d_pipe_rule() {
+    // self.read_2d(dst_offset, src, src_offset, rows, count, dst_stride, src_stride);
+    //     =>
+    // noc_async_read_2d(
+    //     get_noc_addr(get_read_ptr(src.cb_id) + (BYTES(src_offset))),
+    //     self.addr + (BYTES(dst_offset)),
+    //     rows,
+    //     BYTES(count),
+    //     BYTES(src_stride),
+    //     BYTES(dst_stride));
+    return makeRule(
+        make_member_call_7_with_t_arg1_matcher("local", "read_2d", "pipe"),
+        changeTo(
+            statement("stmt"),
+            cat(
+                "noc_async_read_2d(",
+                    "get_noc_addr(get_read_ptr(", access("arg1", "cb_id"), 
+                        ") + (", make_t_bytes_stencil("arg2"), ")), ",
+                    access("self", "addr"),
+                        " + (", make_t_bytes_stencil("arg0"), "), ",
+                    expression("arg3"), ", ",
+                    make_t_bytes_stencil("arg4"), ", ",
+                    make_t_bytes_stencil("arg6"), ", ",
+                    make_t_bytes_stencil("arg5"), ");")));
+}
+
+RewriteRule RuleFactory::make_local_read_2d_pipe_xy_rule() {
+    // self.read_2d(dst_offset, src, src_offset, rows, count, dst_stride, src_stride, x, y);
+    //     =>
+    // noc_async_read_2d(
+    //     get_noc_addr(x, y, get_read_ptr(src.cb_id) + (BYTES(src_offset))),
+    //     self.addr + (BYTES(dst_offset)),
+    //     rows,
+    //     BYTES(count),
+    //     BYTES(src_stride),
+    //     BYTES(dst_stride));
+    return makeRule(
+        make_member_call_9_with_t_arg1_matcher("local", "read_2d", "pipe"),
+        changeTo(
+            statement("stmt"),
+            cat(
+                "noc_async_read_2d(",
+                    "get_noc_addr(", 
+                        node("arg7"), ", ", 
+                        node("arg8"), ", ", 
+                        "get_read_ptr(", access("arg1", "cb_id"), 
+                            ") + (", make_t_bytes_stencil("arg2"), ")), ",
+                    access("self", "addr"),
+                        " + (", make_t_bytes_stencil("arg0"), "), ",
+                    expression("arg3"), ", ",
+                    make_t_bytes_stencil("arg4"), ", ",
+                    make_t_bytes_stencil("arg6"), ", ",
+                    make_t_bytes_stencil("arg5"), ");")));
+}
+
+RewriteRule RuleFactory::make_local_write_2d_local_rule() {
+    // self.write_2d(src_offset, dst, dst_offset, rows, count, src_stride, dst_stride);
+    //     =>
+    // noc_async_write_2d(
+    //     self.addr + (BYTES(src_offset)),
+    //     get_noc_addr(dst.addr + (BYTES(dst_offset))),
+    //     rows,
+    //     BYTES(count),
+    //     BYTES(src_stride),
+    //     BYTES(dst_stride));
+    return makeRule(
+        make_member_call_7_with_t_arg1_matcher("local", "write_2d", "local"),
+        changeTo(
+            statement("stmt"),
+            cat(
+                "noc_async_write_2d(",
+                    access("self", "addr"),
+                        " + (", make_t_bytes_stencil("arg0"), "), ",
+                    "get_noc_addr(", access("arg1", "addr"), 
+                        " + (", make_t_bytes_stencil("arg2"), ")), ",
+                    expression("arg3"), ", ",
+                    make_t_bytes_stencil("arg4"), ", ",
+                    make_t_bytes_stencil("arg5"), ", ",
+                    make_t_bytes_stencil("arg6"), ");")));
+}
+
+RewriteRule RuleFactory::make_local_write_2d_local_xy_rule() {
+    // self.write_2d(src_offset, dst, dst_offset, rows, count, src_stride, dst_stride, x, y);
+    //     =>
+    // noc_async_write_2d(
+    //     self.addr + (BYTES(src_offset)),
+    //     get_noc_addr(x, y, dst.addr + (BYTES(dst_offset))),
+    //     rows,
+    //     BYTES(count),
+    //     BYTES(src_stride),
+    //     BYTES(dst_stride));
+    return makeRule(
+        make_member_call_9_with_t_arg1_matcher("local", "write_2d", "local"),
+        changeTo(
+            statement("stmt"),
+            cat(
+                "noc_async_write_2d(",
+                    access("self", "addr"),
+                        " + (", make_t_bytes_stencil("arg0"), "), ",
+                    "get_noc_addr(", 
+                        node("arg7"), ", ", 
+                        node("arg8"), ", ", 
+                        access("arg1", "addr"), 
+                            " + (", make_t_bytes_stencil("arg2"), ")), ",
+                    expression("arg3"), ", ",
+                    make_t_bytes_stencil("arg4"), ", ",
+                    make_t_bytes_stencil("arg5"), ", ",
+                    make_t_bytes_stencil("arg6"), ");")));
+}
+
+RewriteRule RuleFactory::make_local_write_2d_pipe_rule() {
+    // self.write_2d(src_offset, dst, dst_offset, rows, count, src_stride, dst_stride);
+    //     =>
+    // noc_async_write_2d(
+    //     self.addr + (BYTES(src_offset)),
+    //     get_noc_addr(get_write_ptr(dst.cb_id) + (BYTES(dst_offset))),
+    //     rows,
+    //     BYTES(count),
+    //     BYTES(src_stride),
+    //     BYTES(dst_stride));
+    return makeRule(
+        make_member_call_7_with_t_arg1_matcher("local", "write_2d", "pipe"),
+        changeTo(
+            statement("stmt"),
+            cat(
+                "noc_async_write_2d(",
+                    access("self", "addr"),
+                        " + (", make_t_bytes_stencil("arg0"), "), ",
+                    "get_noc_addr(get_write_ptr(", access("arg1", "cb_id"), 
+                        ") + (", make_t_bytes_stencil("arg2"), ")), ",
+                    expression("arg3"), ", ",
+                    make_t_bytes_stencil("arg4"), ", ",
+                    make_t_bytes_stencil("arg5"), ", ",
+                    make_t_bytes_stencil("arg6"), ");")));
+}
+
+RewriteRule RuleFactory::make_local_write_2d_pipe_xy_rule() {
+    // self.write_2d(src_offset, dst, dst_offset, rows, count, src_stride, dst_stride, x, y);
+    //     =>
+    // noc_async_write_2d(
+    //     self.addr + (BYTES(src_offset)),
+    //     get_noc_addr(x, y, get_write_ptr(dst.cb_id) + (BYTES(dst_offset))),
+    //     rows,
+    //     BYTES(count),
+    //     BYTES(src_stride),
+    //     BYTES(dst_stride));
+    return makeRule(
+        make_member_call_9_with_t_arg1_matcher("local", "write_2d", "pipe"),
+        changeTo(
+            statement("stmt"),
+            cat(
+                "noc_async_write_2d(",
                     access("self", "addr"),
-                        " + (", expression("arg0"), " << ", t_shift, "));")));
+                        " + (", make_t_bytes_stencil("arg0"), "), ",
+                    "get_noc_addr(", 
+                        node("arg7"), ", ", 
+                        node("arg8"), ", ", 
+                        "get_write_ptr(", access("arg1", "cb_id"), 
+                            ") + (", make_t_bytes_stencil("arg2"), ")), ",
+                    expression("arg3"), ", ",
+                    make_t_bytes_stencil("arg4"), ", ",
+                    make_t_bytes_stencil("arg5"), ", ",
+                    make_t_bytes_stencil("arg6"), ");")));
 }
 
 // pipe
@@ -660,12 +904,11 @@ RewriteRule RuleFactory::make_pipe_read_global_rule() {
     // self.read(dst_offset, src, src_offset, count);
     //     =>
     // noc_async_read_global_[dram|l1](
-    //     get_write_ptr(self.cb_id) + (dst_offset << T_SHIFT),
+    //     get_write_ptr(self.cb_id) + (BYTES(dst_offset)),
     //     src.addr,
     //     src.log2_page_size,
-    //     src_offset << T_SHIFT,
-    //     count << T_SHIFT);
-    auto t_shift = make_t_shift_stencil();
+    //     BYTES(src_offset),
+    //     BYTES(count));
     auto dram = make_dram_suffix_stencil();
     return makeRule(
         make_member_call_4_with_t_dist_dram_matcher("pipe", "read"),
@@ -674,24 +917,24 @@ RewriteRule RuleFactory::make_pipe_read_global_rule() {
             cat(
                 "noc_async_read_global_", dram, "(",
                     "get_write_ptr(", access("self", "cb_id"), 
-                        ") + (", expression("arg0"), " << ", t_shift, "), ",
+                        ") + (", make_t_bytes_stencil("arg0"), "), ",
                     access("arg1", "addr"), ", ",
                     access("arg1", "log2_page_size"), ", ",
-                    expression("arg2"), " << ", t_shift, ", ",
-                    expression("arg3"), " << ", t_shift, ");")));
+                    make_t_bytes_stencil("arg2"), ", ",
+                    make_t_bytes_stencil("arg3"), ");")));
 }
 
 RewriteRule RuleFactory::make_pipe_read_global_dist_rule() {
     // self.read(dst_offset, src, src_page, src_offset, count);
     //     =>
     // noc_async_read_[linear|block|cyclic]_dram(
-    //     get_write_ptr(self.cb_id) + (dst_offset << T_SHIFT),
+    //     get_write_ptr(self.cb_id) + (BYTES(dst_offset)),
     //     src.addr,
     //     src.log2_page_size,
+    //     [src.bank_pages,]
     //     src_page,
-    //     src_offset << T_SHIFT,
-    //     count << T_SHIFT);
-    auto t_shift = make_t_shift_stencil();
+    //     BYTES(src_offset),
+    //     BYTES(count));
     auto dist = make_dist_suffix_stencil();
     return makeRule(
         make_member_call_5_with_t_dist_dram_matcher("pipe", "read"),
@@ -700,22 +943,22 @@ RewriteRule RuleFactory::make_pipe_read_global_dist_rule() {
             cat(
                 "noc_async_read_", dist, "_dram(",
                     "get_write_ptr(", access("self", "cb_id"), 
-                        ") + (", expression("arg0"), " << ", t_shift, "), ",
+                        ") + (", make_t_bytes_stencil("arg0"), "), ",
                     access("arg1", "addr"), ", ",
                     access("arg1", "log2_page_size"), ", ",
+                    make_dist_bank_pages_stencil("arg1"),
                     expression("arg2"), ", ",
-                    expression("arg3"), " << ", t_shift, ", ",
-                    expression("arg4"), " << ", t_shift, ");")));
+                    make_t_bytes_stencil("arg3"), ", ",
+                    make_t_bytes_stencil("arg4"), ");")));
 }
 
 RewriteRule RuleFactory::make_pipe_read_local_rule() {
     // self.read(dst_offset, src, src_offset, count);
     //     =>
     // noc_async_read(
-    //     get_noc_addr(src.addr + (src_offset << T_SHIFT)), 
-    //     get_write_ptr(self.cb_id) + (dst_offset << T_SHIFT),
-    //     count << T_SHIFT);
-    auto t_shift = make_t_shift_stencil();
+    //     get_noc_addr(src.addr + (BYTES(src_offset))), 
+    //     get_write_ptr(self.cb_id) + (BYTES(dst_offset)),
+    //     BYTES(count));
     return makeRule(
         make_member_call_4_with_t_arg1_matcher("pipe", "read", "local"),
         changeTo(
@@ -723,20 +966,19 @@ RewriteRule RuleFactory::make_pipe_read_local_rule() {
             cat(
                 "noc_async_read(",
                     "get_noc_addr(", access("arg1", "addr"), 
-                        " + (", expression("arg2"), " << ", t_shift, ")), ",
+                        " + (", make_t_bytes_stencil("arg2"), ")), ",
                     "get_write_ptr(", access("self", "cb_id"),
-                        ") + (", expression("arg0"), " << ", t_shift, "), ",
-                    expression("arg3"), " << ", t_shift, ");")));
+                        ") + (", make_t_bytes_stencil("arg0"), "), ",
+                    make_t_bytes_stencil("arg3"), ");")));
 }
 
 RewriteRule RuleFactory::make_pipe_read_local_xy_rule() {
     // self.read(dst_offset, src, src_offset, count, x, y);
     //     =>
     // noc_async_read(
-    //     get_noc_addr(x, y, src.addr + (src_offset << T_SHIFT)), 
-    //     get_write_ptr(self.cb_id) + (dst_offset << T_SHIFT),
-    //     count << T_SHIFT);
-    auto t_shift = make_t_shift_stencil();
+    //     get_noc_addr(x, y, src.addr + (BYTES(src_offset))), 
+    //     get_write_ptr(self.cb_id) + (BYTES(dst_offset)),
+    //     BYTES(count));
     return makeRule(
         make_member_call_6_with_t_arg1_matcher("pipe", "read", "local"),
         changeTo(
@@ -747,20 +989,19 @@ RewriteRule RuleFactory::make_pipe_read_local_xy_rule() {
                         node("arg4"), ", ", 
                         node("arg5"), ", ", 
                         access("arg1", "addr"), 
-                            " + (", expression("arg2"), " << ", t_shift, ")), ",
+                            " + (", make_t_bytes_stencil("arg2"), ")), ",
                     "get_write_ptr(", access("self", "cb_id"),
-                        ") + (", expression("arg0"), " << ", t_shift, "), ",
-                    expression("arg3"), " << ", t_shift, ");")));
+                        ") + (", make_t_bytes_stencil("arg0"), "), ",
+                    make_t_bytes_stencil("arg3"), ");")));
 }
 
 RewriteRule RuleFactory::make_pipe_read_pipe_rule() {
     // self.read(dst_offset, src, src_offset, count);
     //     =>
     // noc_async_read(
-    //     get_noc_addr(get_read_ptr(src.cb_id) + (src_offset << T_SHIFT)), 
-    //     get_write_ptr(self.cb_id) + (dst_offset << T_SHIFT),
-    //     count << T_SHIFT);
-    auto t_shift = make_t_shift_stencil();
+    //     get_noc_addr(get_read_ptr(src.cb_id) + (BYTES(src_offset))), 
+    //     get_write_ptr(self.cb_id) + (BYTES(dst_offset)),
+    //     BYTES(count));
     return makeRule(
         make_member_call_4_with_t_arg1_matcher("pipe", "read", "pipe"),
         changeTo(
@@ -768,20 +1009,19 @@ RewriteRule RuleFactory::make_pipe_read_pipe_rule() {
             cat(
                 "noc_async_read(",
                     "get_noc_addr(get_read_ptr(", access("arg1", "cb_id"), 
-                        ") + (", expression("arg2"), " << ", t_shift, ")), ",
+                        ") + (", make_t_bytes_stencil("arg2"), ")), ",
                     "get_write_ptr(", access("self", "cb_id"),
-                        ") + (", expression("arg0"), " << ", t_shift, "), ",
-                    expression("arg3"), " << ", t_shift, ");")));
+                        ") + (", make_t_bytes_stencil("arg0"), "), ",
+                    make_t_bytes_stencil("arg3"), ");")));
 }
 
 RewriteRule RuleFactory::make_pipe_read_pipe_xy_rule() {
     // self.read(dst_offset, src, src_offset, count, x, y);
     //     =>
     // noc_async_read(
-    //     get_noc_addr(x, y, get_read_ptr(src.cb_id) + (src_offset << T_SHIFT)), 
-    //     get_write_ptr(self.cb_id) + (dst_offset << T_SHIFT),
-    //     count << T_SHIFT);
-    auto t_shift = make_t_shift_stencil();
+    //     get_noc_addr(x, y, get_read_ptr(src.cb_id) + (BYTES(src_offset))), 
+    //     get_write_ptr(self.cb_id) + (BYTES(dst_offset)),
+    //     BYTES(count));
     return makeRule(
         make_member_call_6_with_t_arg1_matcher("pipe", "read", "pipe"),
         changeTo(
@@ -792,22 +1032,21 @@ RewriteRule RuleFactory::make_pipe_read_pipe_xy_rule() {
                         node("arg4"), ", ", 
                         node("arg5"), ", ", 
                         "get_read_ptr(", access("arg1", "cb_id"), 
-                            ") + (", expression("arg2"), " << ", t_shift, ")), ",
+                            ") + (", make_t_bytes_stencil("arg2"), ")), ",
                     "get_write_ptr(", access("self", "cb_id"),
-                        ") + (", expression("arg0"), " << ", t_shift, "), ",
-                    expression("arg3"), " << ", t_shift, ");")));
+                        ") + (", make_t_bytes_stencil("arg0"), "), ",
+                    make_t_bytes_stencil("arg3"), ");")));
 }
 
 RewriteRule RuleFactory::make_pipe_write_global_rule() {
     // self.write(src_offset, dst, dst_offset, count);
     //     =>
     // noc_async_write_global_[dram|l1](
-    //     get_read_ptr(self.cb_id) + (src_offset << T_SHIFT),
+    //     get_read_ptr(self.cb_id) + (BYTES(src_offset)),
     //     dst.addr,
     //     dst.log2_page_size,
-    //     dst_offset << T_SHIFT,
-    //     count << T_SHIFT);
-    auto t_shift = make_t_shift_stencil();
+    //     BYTES(dst_offset),
+    //     BYTES(count));
     auto dram = make_dram_suffix_stencil();
     return makeRule(
         make_member_call_4_with_t_dist_dram_matcher("pipe", "write"),
@@ -816,24 +1055,24 @@ RewriteRule RuleFactory::make_pipe_write_global_rule() {
             cat(
                 "noc_async_write_global_", dram, "(",
                     "get_read_ptr(", access("self", "cb_id"), 
-                        ") + (", expression("arg0"), " << ", t_shift, "), ",
+                        ") + (", make_t_bytes_stencil("arg0"), "), ",
                     access("arg1", "addr"), ", ",
                     access("arg1", "log2_page_size"), ", ",
-                    expression("arg2"), " << ", t_shift, ", ",
-                    expression("arg3"), " << ", t_shift, ");")));
+                    make_t_bytes_stencil("arg2"), ", ",
+                    make_t_bytes_stencil("arg3"), ");")));
 }
 
 RewriteRule RuleFactory::make_pipe_write_global_dist_rule() {
     // self.write(src_offset, dst, dst_page, dst_offset, count);
     //     =>
     // noc_async_write_[linear|block|cyclic]_dram(
-    //     get_read_ptr(self.cb_id) + (src_offset << T_SHIFT),
+    //     get_read_ptr(self.cb_id) + (BYTES(src_offset)),
     //     dst.addr,
     //     dst.log2_page_size,
+    //     [dst.bank_pages,]
     //     dst_page,
-    //     dst_offset << T_SHIFT,
-    //     count << T_SHIFT);
-    auto t_shift = make_t_shift_stencil();
+    //     BYTES(dst_offset),
+    //     BYTES(count));
     auto dist = make_dist_suffix_stencil();
     return makeRule(
         make_member_call_5_with_t_dist_dram_matcher("pipe", "write"),
@@ -842,22 +1081,22 @@ RewriteRule RuleFactory::make_pipe_write_global_dist_rule() {
             cat(
                 "noc_async_write_", dist, "_dram(",
                     "get_read_ptr(", access("self", "cb_id"), 
-                        ") + (", expression("arg0"), " << ", t_shift, "), ",
+                        ") + (", make_t_bytes_stencil("arg0"), "), ",
                     access("arg1", "addr"), ", ",
                     access("arg1", "log2_page_size"), ", ",
+                    make_dist_bank_pages_stencil("arg1"),
                     expression("arg2"), ", ",
-                    expression("arg3"), " << ", t_shift, ", ",
-                    expression("arg4"), " << ", t_shift, ");")));
+                    make_t_bytes_stencil("arg3"), ", ",
+                    make_t_bytes_stencil("arg4"), ");")));
 }
 
 RewriteRule RuleFactory::make_pipe_write_local_rule() {
     // self.write(src_offset, dst, dst_offset, count);
     //     =>
     // noc_async_write(
-    //     get_read_ptr(self.cb_id) + (src_offset << T_SHIFT),
-    //     get_noc_addr(dst.addr + (dst_offset << T_SHIFT)),
-    //     count << T_SHIFT);
-    auto t_shift = make_t_shift_stencil();
+    //     get_read_ptr(self.cb_id) + (BYTES(src_offset)),
+    //     get_noc_addr(dst.addr + (BYTES(dst_offset))),
+    //     BYTES(count));
     return makeRule(
         make_member_call_4_with_t_arg1_matcher("pipe", "write", "local"),
         changeTo(
@@ -865,20 +1104,19 @@ RewriteRule RuleFactory::make_pipe_write_local_rule() {
             cat(
                 "noc_async_write(",
                     "get_read_ptr(", access("self", "cb_id"),
-                        ") + (", expression("arg0"), " << ", t_shift, "), ",
+                        ") + (", make_t_bytes_stencil("arg0"), "), ",
                     "get_noc_addr(", access("arg1", "addr"), 
-                        " + (", expression("arg2"), " << ", t_shift, ")), ",
-                    expression("arg3"), " << ", t_shift, ");")));
+                        " + (", make_t_bytes_stencil("arg2"), ")), ",
+                    make_t_bytes_stencil("arg3"), ");")));
 }
 
 RewriteRule RuleFactory::make_pipe_write_local_xy_rule() {
     // self.write(src_offset, dst, dst_offset, count, x, y);
     //     =>
     // noc_async_write(
-    //     get_read_ptr(self.cb_id) + (src_offset << T_SHIFT),
-    //     get_noc_addr(x, y, dst.addr + (dst_offset << T_SHIFT)),
-    //     count << T_SHIFT);
-    auto t_shift = make_t_shift_stencil();
+    //     get_read_ptr(self.cb_id) + (BYTES(src_offset)),
+    //     get_noc_addr(x, y, dst.addr + (BYTES(dst_offset))),
+    //     BYTES(count));
     return makeRule(
         make_member_call_6_with_t_arg1_matcher("pipe", "write", "local"),
         changeTo(
@@ -886,23 +1124,22 @@ RewriteRule RuleFactory::make_pipe_write_local_xy_rule() {
             cat(
                 "noc_async_write(",
                     "get_read_ptr(", access("self", "cb_id"),
-                        ") + (", expression("arg0"), " << ", t_shift, "), ",
+                        ") + (", make_t_bytes_stencil("arg0"), "), ",
                     "get_noc_addr(", 
                         node("arg4"), ", ", 
                         node("arg5"), ", ", 
                         access("arg1", "addr"), 
-                            " + (", expression("arg2"), " << ", t_shift, ")), ",
-                    expression("arg3"), " << ", t_shift, ");")));
+                            " + (", make_t_bytes_stencil("arg2"), ")), ",
+                    make_t_bytes_stencil("arg3"), ");")));
 }
 
 RewriteRule RuleFactory::make_pipe_write_pipe_rule() {
     // self.write(src_offset, dst, dst_offset, count);
     //     =>
     // noc_async_write(
-    //     get_read_ptr(self.cb_id) + (src_offset << T_SHIFT),
-    //     get_noc_addr(get_write_ptr(dst.cb_id) + (dst_offset << T_SHIFT)),
-    //     count << T_SHIFT);
-    auto t_shift = make_t_shift_stencil();
+    //     get_read_ptr(self.cb_id) + (BYTES(src_offset)),
+    //     get_noc_addr(get_write_ptr(dst.cb_id) + (BYTES(dst_offset))),
+    //     BYTES(count));
     return makeRule(
         make_member_call_4_with_t_arg1_matcher("pipe", "write", "pipe"),
         changeTo(
@@ -910,20 +1147,19 @@ RewriteRule RuleFactory::make_pipe_write_pipe_rule() {
             cat(
                 "noc_async_write(",
                     "get_read_ptr(", access("self", "cb_id"),
-                        ") + (", expression("arg0"), " << ", t_shift, "), ",
+                        ") + (", make_t_bytes_stencil("arg0"), "), ",
                     "get_noc_addr(get_write_ptr(", access("arg1", "cb_id"), 
-                        ") + (", expression("arg2"), " << ", t_shift, ")), ",
-                    expression("arg3"), " << ", t_shift, ");")));
+                        ") + (", make_t_bytes_stencil("arg2"), ")), ",
+                    make_t_bytes_stencil("arg3"), ");")));
 }
 
 RewriteRule RuleFactory::make_pipe_write_pipe_xy_rule() {
     // self.write(src_offset, dst, dst_offset, count, x, y);
     //     =>
     // noc_async_write(
-    //     get_read_ptr(self.cb_id) + (src_offset << T_SHIFT),
-    //     get_noc_addr(x, y, get_write_ptr(dst.cb_id) + (dst_offset << T_SHIFT)),
-    //     count << T_SHIFT);
-    auto t_shift = make_t_shift_stencil();
+    //     get_read_ptr(self.cb_id) + (BYTES(src_offset)),
+    //     get_noc_addr(x, y, get_write_ptr(dst.cb_id) + (BYTES(dst_offset))),
+    //     BYTES(count));
     return makeRule(
         make_member_call_6_with_t_arg1_matcher("pipe", "write", "pipe"),
         changeTo(
@@ -931,13 +1167,13 @@ RewriteRule RuleFactory::make_pipe_write_pipe_xy_rule() {
             cat(
                 "noc_async_write(",
                     "get_read_ptr(", access("self", "cb_id"),
-                        ") + (", expression("arg0"), " << ", t_shift, "), ",
+                        ") + (", make_t_bytes_stencil("arg0"), "), ",
                     "get_noc_addr(", 
                         node("arg4"), ", ", 
                         node("arg5"), ", ", 
                         "get_write_ptr(", access("arg1", "cb_id"), 
-                            ") + (", expression("arg2"), " << ", t_shift, ")), ",
-                    expression("arg3"), " << ", t_shift, ");")));
+                            ") + (", make_t_bytes_stencil("arg2"), ")), ",
+                    make_t_bytes_stencil("arg3"), ");")));
 }
 
 RewriteRule RuleFactory::make_pipe_write_mcast_local_rule() {
@@ -945,12 +1181,11 @@ RewriteRule RuleFactory::make_pipe_write_mcast_local_rule() {
     //     src_offset, dst, dst_offset, count, x_start, y_start, x_end, y_end, num_dests);
     //     =>
     // noc_async_write_multicast(
-    //     get_write_ptr(self.cb_id) + (src_offset << T_SHIFT),
+    //     get_write_ptr(self.cb_id) + (BYTES(src_offset)),
     //     get_noc_multicast_addr(
-    //         x_start, y_start, x_end, y_end, dst.addr + (dst_offset << T_SHIFT)),
-    //     count << T_SHIFT,
+    //         x_start, y_start, x_end, y_end, dst.addr + (BYTES(dst_offset))),
+    //     BYTES(count),
     //     num_dests);
-    auto t_shift = make_t_shift_stencil();
     return makeRule(
         make_member_call_9_with_t_arg1_matcher("pipe", "write_mcast", "local"),
         changeTo(
@@ -958,15 +1193,15 @@ RewriteRule RuleFactory::make_pipe_write_mcast_local_rule() {
             cat(
                 "noc_async_write_multicast(",
                     "get_write_ptr(", access("self", "cb_id"),
-                        ") + (", expression("arg0"), " << ", t_shift, "), ",
+                        ") + (", make_t_bytes_stencil("arg0"), "), ",
                     "get_noc_multicast_addr(", 
                         node("arg4"), ", ", 
                         node("arg5"), ", ", 
                         node("arg6"), ", ", 
                         node("arg7"), ", ", 
                         access("arg1", "addr"), 
-                            " + (", expression("arg2"), " << ", t_shift, ")), ",
-                    expression("arg3"), " << ", t_shift, ", ",
+                            " + (", make_t_bytes_stencil("arg2"), ")), ",
+                    make_t_bytes_stencil("arg3"), ", ",
                     node("arg8"), ");")));
 }
 
@@ -975,12 +1210,11 @@ RewriteRule RuleFactory::make_pipe_write_mcast_with_self_local_rule() {
     //     src_offset, dst, dst_offset, count, x_start, y_start, x_end, y_end, num_dests);
     //     =>
     // noc_async_write_multicast_loopback_src(
-    //     get_write_ptr(self.cb_id) + (src_offset << T_SHIFT),
+    //     get_write_ptr(self.cb_id) + (BYTES(src_offset)),
     //     get_noc_multicast_addr(
-    //         x_start, y_start, x_end, y_end, dst.addr + (dst_offset << T_SHIFT)),
-    //     count << T_SHIFT,
+    //         x_start, y_start, x_end, y_end, dst.addr + (BYTES(dst_offset))),
+    //     BYTES(count),
     //     num_dests);
-    auto t_shift = make_t_shift_stencil();
     return makeRule(
         make_member_call_9_with_t_arg1_matcher("pipe", "write_mcast_with_self", "local"),
         changeTo(
@@ -988,15 +1222,15 @@ RewriteRule RuleFactory::make_pipe_write_mcast_with_self_local_rule() {
             cat(
                 "noc_async_write_multicast_loopback_src(",
                     "get_write_ptr(", access("self", "cb_id"),
-                        ") + (", expression("arg0"), " << ", t_shift, "), ",
+                        ") + (", make_t_bytes_stencil("arg0"), "), ",
                     "get_noc_multicast_addr(", 
                         node("arg4"), ", ", 
                         node("arg5"), ", ", 
                         node("arg6"), ", ", 
                         node("arg7"), ", ", 
                         access("arg1", "addr"), 
-                            " + (", expression("arg2"), " << ", t_shift, ")), ",
-                    expression("arg3"), " << ", t_shift, ", ",
+                            " + (", make_t_bytes_stencil("arg2"), ")), ",
+                    make_t_bytes_stencil("arg3"), ", ",
                     node("arg8"), ");")));
 }
 
@@ -1005,12 +1239,11 @@ RewriteRule RuleFactory::make_pipe_write_mcast_pipe_rule() {
     //     src_offset, dst, dst_offset, count, x_start, y_start, x_end, y_end, num_dests);
     //     =>
     // noc_async_write_multicast(
-    //     get_write_ptr(self.cb_id) + (src_offset << T_SHIFT),
+    //     get_write_ptr(self.cb_id) + (BYTES(src_offset)),
     //     get_noc_multicast_addr(
-    //         x_start, y_start, x_end, y_end, get_write_ptr(dst.cb_id) + (dst_offset << T_SHIFT)),
-    //     count << T_SHIFT,
+    //         x_start, y_start, x_end, y_end, get_write_ptr(dst.cb_id) + (BYTES(dst_offset))),
+    //     BYTES(count),
     //     num_dests);
-    auto t_shift = make_t_shift_stencil();
     return makeRule(
         make_member_call_9_with_t_arg1_matcher("pipe", "write_mcast", "pipe"),
         changeTo(
@@ -1018,15 +1251,15 @@ RewriteRule RuleFactory::make_pipe_write_mcast_pipe_rule() {
             cat(
                 "noc_async_write_multicast(",
                     "get_write_ptr(", access("self", "cb_id"),
-                        ") + (", expression("arg0"), " << ", t_shift, "), ",
+                        ") + (", make_t_bytes_stencil("arg0"), "), ",
                     "get_noc_multicast_addr(", 
                         node("arg4"), ", ", 
                         node("arg5"), ", ", 
                         node("arg6"), ", ", 
                         node("arg7"), ", ", 
                         "get_write_ptr(", access("arg1", "cb_id"), 
-                            ") + (", expression("arg2"), " << ", t_shift, ")), ",
-                    expression("arg3"), " << ", t_shift, ", ",
+                            ") + (", make_t_bytes_stencil("arg2"), ")), ",
+                    make_t_bytes_stencil("arg3"), ", ",
                     node("arg8"), ");")));
 }
 
@@ -1035,12 +1268,11 @@ RewriteRule RuleFactory::make_pipe_write_mcast_with_self_pipe_rule() {
     //     src_offset, dst, dst_offset, count, x_start, y_start, x_end, y_end);
     //     =>
     // noc_async_write_multicast_loopback_src(
-    //     get_write_ptr(self.cb_id) + (src_offset << T_SHIFT),
+    //     get_write_ptr(self.cb_id) + (BYTES(src_offset)),
     //     get_noc_multicast_addr(
-    //         x_start, y_start, x_end, y_end, get_write_ptr(dst.cb_id) + (dst_offset << T_SHIFT)),
-    //     count << T_SHIFT,
+    //         x_start, y_start, x_end, y_end, get_write_ptr(dst.cb_id) + (BYTES(dst_offset))),
+    //     BYTES(count),
     //     num_dests);
-    auto t_shift = make_t_shift_stencil();
     return makeRule(
         make_member_call_9_with_t_arg1_matcher("pipe", "write_mcast_with_self", "pipe"),
         changeTo(
@@ -1048,39 +1280,37 @@ RewriteRule RuleFactory::make_pipe_write_mcast_with_self_pipe_rule() {
             cat(
                 "noc_async_write_multicast_loopback_src(",
                     "get_write_ptr(", access("self", "cb_id"),
-                        ") + (", expression("arg0"), " << ", t_shift, "), ",
+                        ") + (", make_t_bytes_stencil("arg0"), "), ",
                     "get_noc_multicast_addr(", 
                         node("arg4"), ", ", 
                         node("arg5"), ", ", 
                         node("arg6"), ", ", 
                         node("arg7"), ", ", 
                         "get_write_ptr(", access("arg1", "cb_id"), 
-                            ") + (", expression("arg2"), " << ", t_shift, ")), ",
-                    expression("arg3"), " << ", t_shift, ", ",
+                            ") + (", make_t_bytes_stencil("arg2"), ")), ",
+                    make_t_bytes_stencil("arg3"), ", ",
                     node("arg8"), ");")));
 }
 
 RewriteRule RuleFactory::make_pipe_move_init_rule() {
     // self.move_init(count);
     //     =>
-    // noc_async_read_one_packet_set_state(get_noc_addr(0), count << T_SHIFT);
-    auto t_shift = make_t_shift_stencil();
+    // noc_async_read_one_packet_set_state(get_noc_addr(0), BYTES(count));
     return makeRule(
         make_member_call_1_with_t_matcher("pipe", "move_init"),
         changeTo(
             statement("stmt"),
             cat(
                 "noc_async_read_one_packet_set_state(get_noc_addr(0), ",
-                    expression("arg0"), " << ", t_shift, ");")));
+                    make_t_bytes_stencil("arg0"), ");")));
 }
 
 RewriteRule RuleFactory::make_pipe_move_local_rule() {
     // self.move(dst_offset, src, src_offset);
     //     =>
     // noc_async_read_one_packet_with_state(
-    //     src.addr + (src_offset << T_SHIFT), 
-    //     get_write_ptr(self.cb_id) + (dst_offset << T_SHIFT));
-    auto t_shift = make_t_shift_stencil();
+    //     src.addr + (BYTES(src_offset)), 
+    //     get_write_ptr(self.cb_id) + (BYTES(dst_offset)));
     return makeRule(
         make_member_call_3_with_t_arg1_matcher("pipe", "move", "local"),
         changeTo(
@@ -1088,18 +1318,17 @@ RewriteRule RuleFactory::make_pipe_move_local_rule() {
             cat(
                 "noc_async_read_one_packet_with_state(",
                     access("arg1", "addr"), 
-                        " + (", expression("arg2"), " << ", t_shift, "), ",
+                        " + (", make_t_bytes_stencil("arg2"), "), ",
                     "get_write_ptr(", access("self", "cb_id"),
-                        ") + (", expression("arg0"), " << ", t_shift, "));")));
+                        ") + (", make_t_bytes_stencil("arg0"), "));")));
 }
 
 RewriteRule RuleFactory::make_pipe_move_pipe_rule() {
     // self.move(dst_offset, src, src_offset);
     //     =>
     // noc_async_read_one_packet_with_state(
-    //     get_read_ptr(src.cb_id) + (src_offset << T_SHIFT), 
-    //     get_write_ptr(self.cb_id) + (dst_offset << T_SHIFT));
-    auto t_shift = make_t_shift_stencil();
+    //     get_read_ptr(src.cb_id) + (BYTES(src_offset)), 
+    //     get_write_ptr(self.cb_id) + (BYTES(dst_offset)));
     return makeRule(
         make_member_call_3_with_t_arg1_matcher("pipe", "move", "pipe"),
         changeTo(
@@ -1107,9 +1336,229 @@ RewriteRule RuleFactory::make_pipe_move_pipe_rule() {
             cat(
                 "noc_async_read_one_packet_with_state(",
                     "get_read_ptr(", access("arg1", "cb_id"), 
-                        ") + (", expression("arg2"), " << ", t_shift, "), ",
+                        ") + (", make_t_bytes_stencil("arg2"), "), ",
                     "get_write_ptr(", access("self", "cb_id"),
-                        ") + (", expression("arg0"), " << ", t_shift, "));")));
+                        ") + (", make_t_bytes_stencil("arg0"), "));")));
+}
+
+RewriteRule RuleFactory::make_pipe_read_2d_local_rule() {
+    // self.read_2d(dst_offset, src, src_offset, rows, count, dst_stride, src_stride);
+    //     =>
+    // noc_async_read_2d(
+    //     get_noc_addr(src.addr + (BYTES(src_offset))),
+    //     get_write_ptr(self.cb_id) + (BYTES(dst_offset)),
+    //     rows,
+    //     BYTES(count),
+    //     BYTES(src_stride),
+    //     BYTES(dst_stride));
+    return makeRule(
+        make_member_call_7_with_t_arg1_matcher("pipe", "read_2d", "local"),
+        changeTo(
+            statement("stmt"),
+            cat(
+                "noc_async_read_2d(",
+                    "get_noc_addr(", access("arg1", "addr"), 
+                        " + (", make_t_bytes_stencil("arg2"), ")), ",
+                    "get_write_ptr(", access("self", "cb_id"), 
+                        ") + (", make_t_bytes_stencil("arg0"), "), ",
+                    expression("arg3"), ", ",
+                    make_t_bytes_stencil("arg4"), ", ",
+                    make_t_bytes_stencil("arg6"), ", ",
+                    make_t_bytes_stencil("arg5"), ");")));
+}
+
+RewriteRule RuleFactory::make_pipe_read_2d_local_xy_rule() {
+    // self.read_2d(dst_offset, src, src_offset, rows, count, dst_stride, src_stride, x, y);
+    //     =>
+    // noc_async_read_2d(
+    //     get_noc_addr(x, y, src.addr + (BYTES(src_offset))),
+    //     get_write_ptr(self.cb_id) + (BYTES(dst_offset)),
+    //     rows,
+    //     BYTES(count),
+    //     BYTES(src_stride),
+    //     BYTES(dst_stride));
+    return makeRule(
+        make_member_call_9_with_t_arg1_matcher("pipe", "read_2d", "local"),
+        changeTo(
+            statement("stmt"),
+            cat(
+                "noc_async_read_2d(",
+                    "get_noc_addr(", 
+                        node("arg7"), ", ", 
+                        node("arg8"), ", ", 
+                        access("arg1", "addr"), 
+                            " + (", make_t_bytes_stencil("arg2"), ")), ",
+                    "get_write_ptr(", access("self", "cb_id"), 
+                        ") + (", make_t_bytes_stencil("arg0"), "), ",
+                    expression("arg3"), ", ",
+                    make_t_bytes_stencil("arg4"), ", ",
+                    make_t_bytes_stencil("arg6"), ", ",
+                    make_t_bytes_stencil("arg5"), ");")));
+}
+
+RewriteRule RuleFactory::make_pipe_read_2d_pipe_rule() {
+    // self.read_2d(dst_offset, src, src_offset, rows, count, dst_stride, src_stride);
+    //     =>
+    // noc_async_read_2d(
+    //     get_noc_addr(get_read_ptr(src.cb_id) + (BYTES(src_offset))),
+    //     get_write_ptr(self.cb_id) + (BYTES(dst_offset)),
+    //     rows,
+    //     BYTES(count),
+    //     BYTES(src_stride),
+    //     BYTES(dst_stride));
+    return makeRule(
+        make_member_call_7_with_t_arg1_matcher("pipe", "read_2d", "pipe"),
+        changeTo(
+            statement("stmt"),
+            cat(
+                "noc_async_read_2d(",
+                    "get_noc_addr(get_read_ptr(", access("arg1", "cb_id"), 
+                        ") + (", make_t_bytes_stencil("arg2"), ")), ",
+                    "get_write_ptr(", access("self", "cb_id"), 
+                        ") + (", make_t_bytes_stencil("arg0"), "), ",
+                    expression("arg3"), ", ",
+                    make_t_bytes_stencil("arg4"), ", ",
+                    make_t_bytes_stencil("arg6"), ", ",
+                    make_t_bytes_stencil("arg5"), ");")));
+}
+
+RewriteRule RuleFactory::make_pipe_read_2d_pipe_xy_rule() {
+    // self.read_2d(dst_offset, src, src_offset, rows, count, dst_stride, src_stride, x, y);
+    //     =>
+    // noc_async_read_2d(
+    //     get_noc_addr(x, y, get_read_ptr(src.cb_id) + (BYTES(src_offset))),
+    //     get_write_ptr(self.cb_id) + (BYTES(dst_offset)),
+    //     rows,
+    //     BYTES(count),
+    //     BYTES(src_stride),
+    //     BYTES(dst_stride));
+    return makeRule(
+        make_member_call_9_with_t_arg1_matcher("pipe", "read_2d", "pipe"),
+        changeTo(
+            statement("stmt"),
+            cat(
+                "noc_async_read_2d(",
+                    "get_noc_addr(", 
+                        node("arg7"), ", ", 
+                        node("arg8"), ", ", 
+                        "get_read_ptr(", access("arg1", "cb_id"), 
+                            ") + (", make_t_bytes_stencil("arg2"), ")), ",
+                    "get_write_ptr(", access("self", "cb_id"), 
+                        ") + (", make_t_bytes_stencil("arg0"), "), ",
+                    expression("arg3"), ", ",
+                    make_t_bytes_stencil("arg4"), ", ",
+                    make_t_bytes_stencil("arg6"), ", ",
+                    make_t_bytes_stencil("arg5"), ");")));
+}
+
+RewriteRule RuleFactory::make_pipe_write_2d_local_rule() {
+    // self.write_2d(src_offset, dst, dst_offset, rows, count, src_stride, dst_stride);
+    //     =>
+    // noc_async_write_2d(
+    //     get_read_ptr(self.cb_id) + (BYTES(src_offset)),
+    //     get_noc_addr(dst.addr + (BYTES(dst_offset))),
+    //     rows,
+    //     BYTES(count),
+    //     BYTES(src_stride),
+    //     BYTES(dst_stride));
+    return makeRule(
+        make_member_call_7_with_t_arg1_matcher("pipe", "write_2d", "local"),
+        changeTo(
+            statement("stmt"),
+            cat(
+                "noc_async_write_2d(",
+                    "get_read_ptr(", access("self", "cb_id"), 
+                        ") + (", make_t_bytes_stencil("arg0"), "), ",
+                    "get_noc_addr(", access("arg1", "addr"), 
+                        " + (", make_t_bytes_stencil("arg2"), ")), ",
+                    expression("arg3"), ", ",
+                    make_t_bytes_stencil("arg4"), ", ",
+                    make_t_bytes_stencil("arg5"), ", ",
+                    make_t_bytes_stencil("arg6"), ");")));
+}
+
+RewriteRule RuleFactory::make_pipe_write_2d_local_xy_rule() {
+    // self.write_2d(src_offset, dst, dst_offset, rows, count, src_stride, dst_stride, x, y);
+    //     =>
+    // noc_async_write_2d(
+    //     get_read_ptr(self.cb_id) + (BYTES(src_offset)),
+    //     get_noc_addr(x, y, dst.addr + (BYTES(dst_offset))),
+    //     rows,
+    //     BYTES(count),
+    //     BYTES(src_stride),
+    //     BYTES(dst_stride));
+    return makeRule(
+        make_member_call_9_with_t_arg1_matcher("pipe", "write_2d", "local"),
+        changeTo(
+            statement("stmt"),
+            cat(
+                "noc_async_write_2d(",
+                    "get_read_ptr(", access("self", "cb_id"), 
+                        ") + (", make_t_bytes_stencil("arg0"), "), ",
+                    "get_noc_addr(", 
+                        node("arg7"), ", ", 
+                        node("arg8"), ", ", 
+                        access("arg1", "addr"), 
+                            " + (", make_t_bytes_stencil("arg2"), ")), ",
+                    expression("arg3"), ", ",
+                    make_t_bytes_stencil("arg4"), ", ",
+                    make_t_bytes_stencil("arg5"), ", ",
+                    make_t_bytes_stencil("arg6"), ");")));
+}
+
+RewriteRule RuleFactory::make_pipe_write_2d_pipe_rule() {
+    // self.write_2d(src_offset, dst, dst_offset, rows, count, src_stride, dst_stride);
+    //     =>
+    // noc_async_write_2d(
+    //     get_read_ptr(self.cb_id) + (BYTES(src_offset)),
+    //     get_noc_addr(get_write_ptr(dst.cb_id) + (BYTES(dst_offset))),
+    //     rows,
+    //     BYTES(count),
+    //     BYTES(src_stride),
+    //     BYTES(dst_stride));
+    return makeRule(
+        make_member_call_7_with_t_arg1_matcher("pipe", "write_2d", "pipe"),
+        changeTo(
+            statement("stmt"),
+            cat(
+                "noc_async_write_2d(",
+                    "get_read_ptr(", access("self", "cb_id"), 
+                        ") + (", make_t_bytes_stencil("arg0"), "), ",
+                    "get_noc_addr(get_write_ptr(", access("arg1", "cb_id"), 
+                        ") + (", make_t_bytes_stencil("arg2"), ")), ",
+                    expression("arg3"), ", ",
+                    make_t_bytes_stencil("arg4"), ", ",
+                    make_t_bytes_stencil("arg5"), ", ",
+                    make_t_bytes_stencil("arg6"), ");")));
+}
+
+RewriteRule RuleFactory::make_pipe_write_2d_pipe_xy_rule() {
+    // self.write_2d(src_offset, dst, dst_offset, rows, count, src_stride, dst_stride, x, y);
+    //     =>
+    // noc_async_write_2d(
+    //     get_read_ptr(self.cb_id) + (BYTES(src_offset)),
+    //     get_noc_addr(x, y, get_write_ptr(dst.cb_id) + (BYTES(dst_offset))),
+    //     rows,
+    //     BYTES(count),
+    //     BYTES(src_stride),
+    //     BYTES(dst_stride));
+    return makeRule(
+        make_member_call_9_with_t_arg1_matcher("pipe", "write_2d", "pipe"),
+        changeTo(
+            statement("stmt"),
+            cat(
+                "noc_async_write_2d(",
+                    "get_read_ptr(", access("self", "cb_id"), 
+                        ") + (", make_t_bytes_stencil("arg0"), "), ",
+                    "get_noc_addr(", 
+                        node("arg7"), ", ", 
+                        node("arg8"), ", ", 
+                        "get_write_ptr(", access("arg1", "cb_id"), 
+                            ") + (", make_t_bytes_stencil("arg2"), ")), ",
+                    expression("arg3"), ", ",
+                    make_t_bytes_stencil("arg4"), ", ",
+                    make_t_bytes_stencil("arg5"), ", ",
+                    make_t_bytes_stencil("arg6"), ");")));
 }
 
 // semaphore
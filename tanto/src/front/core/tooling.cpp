@@ -2,13 +2,16 @@
 //
 // SPDX-License-Identifier: Apache-2.0
 
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <memory>
 #include <functional>
+#include <optional>
 
 #include "llvm/Support/raw_ostream.h"
 
+#include "clang/AST/Expr.h"
 #include "clang/Frontend/ASTUnit.h"
 #include "clang/ASTMatchers/ASTMatchFinder.h"
 #include "clang/Tooling/Tooling.h"
@@ -186,6 +189,28 @@ void TransformerTool::error(const std::string &text) {
     }
 }
 
+//
+//    AST utilities
+//
+
+bool get_int_const_expr_value(const Expr *expr, ASTContext &context, int &value) {
+    value = 0;
+    std::optional<llvm::APSInt> aps_int = expr->getIntegerConstantExpr(context);
+    if (!aps_int) {
+        return false;
+    }
+    std::optional<int64_t> sext_value = (*aps_int).trySExtValue();
+    if (!sext_value) {
+        return false;
+    }
+    int64_t value64 = *sext_value;
+    value = int(value64);
+    if (int64_t(value) != value64) {
+        return false;
+    }
+    return true;
+}
+
 //
 //    Code formatting
 //
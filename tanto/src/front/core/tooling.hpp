@@ -9,6 +9,7 @@
 #include <memory>
 #include <functional>
 
+#include "clang/AST/Expr.h"
 #include "clang/Frontend/ASTUnit.h"
 #include "clang/ASTMatchers/ASTMatchFinder.h"
 #include "clang/Tooling/Tooling.h"
@@ -125,6 +126,12 @@ private:
     FileContentMappings m_file_contents; 
 };
 
+//
+//    AST utilities
+//
+
+bool get_int_const_expr_value(const Expr *expr, ASTContext &context, int &value);
+
 //
 //    Code formatting
 //
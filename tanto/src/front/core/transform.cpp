@@ -131,6 +131,7 @@ RewriteRule Transform::make_pass2_compute_rule() {
         rf.make_math_sub_bcast_scalar_rule(),
         rf.make_math_mul_bcast_scalar_rule(),
         rf.make_math_matmul_rule(),
+        rf.make_math_matmul_block_rule(),
         rf.make_math_reduce_max_rows_rule(),
         rf.make_math_reduce_max_cols_rule(),
         rf.make_math_reduce_max_scalar_rule(),
@@ -219,6 +220,7 @@ RewriteRule Transform::make_pass2_compute_rule() {
         rf.make_sub_bcast_scalar_init_rule(),
         rf.make_mul_bcast_scalar_init_rule(),
         rf.make_matmul_init_rule(),
+        rf.make_matmul_block_init_rule(),
         rf.make_reduce_max_rows_init_rule(),
         rf.make_reduce_max_cols_init_rule(),
         rf.make_reduce_max_scalar_init_rule(),
@@ -290,6 +292,7 @@ RewriteRule Transform::make_pass2_compute_rule() {
         rf.make_unpack_bcast_cols_init_rule(),
         rf.make_unpack_bcast_scalar_init_rule(),
         rf.make_unpack_matmul_init_rule(),
+        rf.make_unpack_matmul_block_init_rule(),
         rf.make_unpack_unary_init_rule(),
         rf.make_unpack_reduce_rows_init_rule(),
         rf.make_unpack_reduce_cols_init_rule(),
@@ -348,6 +351,14 @@ RewriteRule Transform::make_pass2_dataflow_rule(bool write_mode) {
         rf.make_local_move_init_rule(),
         rf.make_local_move_local_rule(),
         rf.make_local_move_pipe_rule(),
+        rf.make_local_read_2d_local_rule(),
+        rf.make_local_read_2d_local_xy_rule(),
+        rf.make_local_read_2d_pipe_rule(),
+        rf.make_local_read_2d_pipe_xy_rule(),
+        rf.make_local_write_2d_local_rule(),
+        rf.make_local_write_2d_local_xy_rule(),
+        rf.make_local_write_2d_pipe_rule(),
+        rf.make_local_write_2d_pipe_xy_rule(),
         // pipe (dataflow)
         rf.make_pipe_get_rule(),
         rf.make_pipe_set_rule(),
@@ -370,6 +381,14 @@ RewriteRule Transform::make_pass2_dataflow_rule(bool write_mode) {
         rf.make_pipe_move_init_rule(),
         rf.make_pipe_move_local_rule(),
         rf.make_pipe_move_pipe_rule(),
+        rf.make_pipe_read_2d_local_rule(),
+        rf.make_pipe_read_2d_local_xy_rule(),
+        rf.make_pipe_read_2d_pipe_rule(),
+        rf.make_pipe_read_2d_pipe_xy_rule(),
+        rf.make_pipe_write_2d_local_rule(),
+        rf.make_pipe_write_2d_local_xy_rule(),
+        rf.make_pipe_write_2d_pipe_rule(),
+        rf.make_pipe_write_2d_pipe_xy_rule(),
         // semaphore
         rf.make_semaphore_set_rule(),
         rf.make_semaphore_set_remote_rule(),
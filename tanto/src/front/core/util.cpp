@@ -25,6 +25,22 @@ bool read_file(const std::string &path, std::string &data) {
     return true;
 }
 
+bool write_file(const std::string &path, const std::string &data) {
+    try {
+        std::ofstream stream(path, std::ios::binary);
+        if (!stream) {
+            return false;
+        }
+        stream.write(data.data(), data.size());
+        if (!stream) {
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
 size_t hash_combine(size_t h1, size_t h2) {
     return h1 ^ (h2 + 0x9e3779b9 + (h1 << 6) + (h1 >> 2));
 }
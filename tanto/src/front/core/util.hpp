@@ -11,6 +11,7 @@ namespace tanto {
 namespace front {
 
 bool read_file(const std::string &path, std::string &data);
+bool write_file(const std::string &path, const std::string &data);
 
 size_t hash_combine(size_t h1, size_t h2);
 
@@ -79,7 +79,14 @@ Device::Device(std::shared_ptr<DeviceImpl> &&impl):
         m_impl(std::move(impl)) { }
 
 Device::Device(const Platform &platform, uint32_t id):
-        m_impl(DeviceImpl::create(platform.impl(), id)) { }
+        m_impl(
+            DeviceImpl::create(
+                platform.impl(), 
+                id, 
+                DeviceImpl::DEFAULT_TRACE_REGION_SIZE)) { }
+
+Device::Device(const Platform &platform, uint32_t id, uint32_t trace_region_size):
+        m_impl(DeviceImpl::create(platform.impl(), id, trace_region_size)) { }
 
 Device::~Device() { }
 
@@ -121,6 +128,14 @@ void Device::worker_core_from_logical_core(
     m_impl->worker_core_from_logical_core(logical_x, logical_y, worker_x, worker_y);
 }
 
+void Device::set_local_arena(bool enable) const {
+    m_impl->set_local_arena_enabled(enable);
+}
+
+uint32_t Device::local_arena_bytes(uint32_t x, uint32_t y) const {
+    return m_impl->local_arena_bytes(x, y);
+}
+
 void Device::close() {
     m_impl->close();
 }
@@ -163,6 +178,18 @@ Device Program::device() const {
     return Device(m_impl->device());
 }
 
+std::vector<std::string> Program::check_pipes() const {
+    return m_impl->check_pipes();
+}
+
+void Program::resize_pipes() const {
+    m_impl->resize_pipes();
+}
+
+void Program::set_pipe_sizing(bool enable) const {
+    m_impl->set_pipe_sizing(enable);
+}
+
 //
 //    Grid
 //
@@ -484,6 +511,10 @@ void Pipe::set_local(const Local &local) const {
     m_impl->set_local(local.impl());
 }
 
+void Pipe::resize(uint32_t size) const {
+    m_impl->resize(size);
+}
+
 //
 //    Semaphore
 //
@@ -633,6 +664,10 @@ void Kernel::set_args(const Grid &grid, const std::vector<KernelArg> &args) cons
     m_impl->set_args(grid.impl(), args);
 }
 
+void Kernel::set_pipe_report(const std::string &path) const {
+    m_impl->set_pipe_report(path);
+}
+
 //
 //    Queue
 //
@@ -689,6 +724,78 @@ void Queue::enqueue_write(
     m_impl->enqueue_write(global.impl(), src, blocking);
 }
 
+void Queue::enqueue_read(
+        const Global &global,
+        uint32_t offset,
+        uint32_t bytes,
+        void *dst,
+        bool blocking) const {
+    m_impl->enqueue_read_range(global.impl(), offset, bytes, dst, blocking);
+}
+
+void Queue::enqueue_write(
+        const Global &global,
+        uint32_t offset,
+        uint32_t bytes,
+        const void *src,
+        bool blocking) const {
+    m_impl->enqueue_write_range(global.impl(), offset, bytes, src, blocking);
+}
+
+void Queue::enqueue_read_pages(
+        const Global &global,
+        uint32_t first_page,
+        uint32_t page_count,
+        void *dst,
+        bool blocking) const {
+    m_impl->enqueue_read_pages(global.impl(), first_page, page_count, dst, blocking);
+}
+
+void Queue::enqueue_write_pages(
+        const Global &global,
+        uint32_t first_page,
+        uint32_t page_count,
+        const void *src,
+        bool blocking) const {
+    m_impl->enqueue_write_pages(global.impl(), first_page, page_count, src, blocking);
+}
+
+void Queue::enqueue_read_strided(
+        const Global &global,
+        uint32_t offset,
+        uint32_t stride,
+        uint32_t row_bytes,
+        uint32_t row_count,
+        void *dst,
+        bool blocking) const {
+    m_impl->enqueue_read_strided(
+        global.impl(), 
+        offset, 
+        stride, 
+        row_bytes, 
+        row_count, 
+        dst, 
+        blocking);
+}
+
+void Queue::enqueue_write_strided(
+        const Global &global,
+        uint32_t offset,
+        uint32_t stride,
+        uint32_t row_bytes,
+        uint32_t row_count,
+        const void *src,
+        bool blocking) const {
+    m_impl->enqueue_write_strided(
+        global.impl(), 
+        offset, 
+        stride, 
+        row_bytes, 
+        row_count, 
+        src, 
+        blocking);
+}
+
 void Queue::enqueue_program(const Program &program, bool blocking) const {
     m_impl->enqueue_program(program.impl(), blocking);
 }
@@ -697,6 +804,139 @@ void Queue::finish() const {
     m_impl->finish();
 }
 
+uint32_t Queue::begin_trace() const {
+    return m_impl->begin_trace();
+}
+
+void Queue::end_trace() const {
+    m_impl->end_trace();
+}
+
+void Queue::replay_trace(uint32_t trace_id, bool blocking) const {
+    m_impl->replay_trace(trace_id, blocking);
+}
+
+void Queue::release_trace(uint32_t trace_id) const {
+    m_impl->release_trace(trace_id);
+}
+
+Event Queue::record_event() const {
+    return Event(EventImpl::create(m_impl));
+}
+
+void Queue::wait_event(const Event &event) const {
+    m_impl->wait_event(event.impl());
+}
+
+void Queue::begin_graph(const Graph &graph) const {
+    m_impl->begin_graph(graph.impl());
+}
+
+void Queue::end_graph() const {
+    m_impl->end_graph();
+}
+
+void Queue::enqueue_graph(const Graph &graph, bool blocking) const {
+    m_impl->enqueue_graph(graph.impl(), blocking);
+}
+
+//
+//    Event
+//
+
+Event::Event() { }
+
+Event::Event(const Event &other):
+        m_impl(other.m_impl) { }
+
+Event::Event(Event &&other) noexcept:
+        m_impl(std::move(other.m_impl)) { }
+
+Event::Event(std::shared_ptr<EventImpl> &&impl):
+        m_impl(std::move(impl)) { }
+
+Event::~Event() { }
+
+Event &Event::operator=(const Event &other) {
+    if (this != &other) {
+        m_impl = other.m_impl;
+    }
+    return *this;
+}
+
+Event &Event::operator=(Event &&other) noexcept {
+    if (this != &other) {
+        m_impl = std::move(other.m_impl);
+    }
+    return *this;
+}
+
+Queue Event::queue() const {
+    return Queue(m_impl->queue());
+}
+
+void Event::synchronize() const {
+    m_impl->synchronize();
+}
+
+bool Event::query() const {
+    return m_impl->query();
+}
+
+//
+//    Graph
+//
+
+Graph::Graph() { }
+
+Graph::Graph(const Graph &other):
+        m_impl(other.m_impl) { }
+
+Graph::Graph(Graph &&other) noexcept:
+        m_impl(std::move(other.m_impl)) { }
+
+Graph::Graph(std::shared_ptr<GraphImpl> &&impl):
+        m_impl(std::move(impl)) { }
+
+Graph::Graph(const Device &device):
+        m_impl(GraphImpl::create(device.impl())) { }
+
+Graph::~Graph() { }
+
+Graph &Graph::operator=(const Graph &other) {
+    if (this != &other) {
+        m_impl = other.m_impl;
+    }
+    return *this;
+}
+
+Graph &Graph::operator=(Graph &&other) noexcept {
+    if (this != &other) {
+        m_impl = std::move(other.m_impl);
+    }
+    return *this;
+}
+
+Device Graph::device() const {
+    return Device(m_impl->device());
+}
+
+uint32_t Graph::add_program(const Program &program) const {
+    return m_impl->add_program(program.impl());
+}
+
+void Graph::add_dependency(uint32_t program, uint32_t dependency) const {
+    m_impl->add_dependency(program, dependency);
+}
+
+uint32_t Graph::program_count() const {
+    return m_impl->program_count();
+}
+
+uint32_t Graph::batch_count() const {
+    return m_impl->batch_count();
+}
+
 } // namespace host
 } // namespace tanto
 } // namespace ronin
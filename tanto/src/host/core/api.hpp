@@ -26,6 +26,8 @@ class Pipe;
 class Semaphore;
 class Kernel;
 class Queue;
+class Event;
+class Graph;
 
 class PlatformImpl;
 class DeviceImpl;
@@ -37,13 +39,17 @@ class PipeImpl;
 class SemaphoreImpl;
 class KernelImpl;
 class QueueImpl;
+class EventImpl;
+class GraphImpl;
 
 enum class DataFormat {
     UINT8,
     UINT16,
     UINT32,
     FLOAT32,
-    BFLOAT16
+    BFLOAT16,
+    BFP8_B,
+    BFP4_B
 };
 
 enum class GlobalDist {
@@ -116,6 +122,7 @@ public:
     Device(Device &&other) noexcept;
     explicit Device(std::shared_ptr<DeviceImpl> &&impl);
     explicit Device(const Platform &platform, uint32_t id);
+    explicit Device(const Platform &platform, uint32_t id, uint32_t trace_region_size);
     ~Device();
 public:
     Device &operator=(const Device &other);
@@ -135,6 +142,8 @@ public:
         uint32_t logical_y,
         uint32_t &worker_x,
         uint32_t &worker_y) const;
+    void set_local_arena(bool enable) const;
+    uint32_t local_arena_bytes(uint32_t x, uint32_t y) const;
     void close();
 private:
     std::shared_ptr<DeviceImpl> m_impl;
@@ -158,6 +167,9 @@ public:
         return (m_impl == nullptr);
     }
     Device device() const;
+    std::vector<std::string> check_pipes() const;
+    void resize_pipes() const;
+    void set_pipe_sizing(bool enable) const;
 private:
     std::shared_ptr<ProgramImpl> m_impl;
 };
@@ -311,6 +323,7 @@ public:
     uint32_t size() const;
     uint32_t frame_size() const;
     void set_local(const Local &local) const;
+    void resize(uint32_t size) const;
 private:
     std::shared_ptr<PipeImpl> m_impl;
 };
@@ -386,6 +399,7 @@ public:
         uint32_t y_end,
         const std::vector<KernelArg> &args) const;
     void set_args(const Grid &grid, const std::vector<KernelArg> &args) const;
+    void set_pipe_report(const std::string &path) const;
 private:
     std::shared_ptr<KernelImpl> m_impl;
 };
@@ -417,12 +431,117 @@ public:
         const Global &global, 
         const void *src,
         bool blocking) const;
+    void enqueue_read(
+        const Global &global,
+        uint32_t offset,
+        uint32_t bytes,
+        void *dst,
+        bool blocking) const;
+    void enqueue_write(
+        const Global &global,
+        uint32_t offset,
+        uint32_t bytes,
+        const void *src,
+        bool blocking) const;
+    void enqueue_read_pages(
+        const Global &global,
+        uint32_t first_page,
+        uint32_t page_count,
+        void *dst,
+        bool blocking) const;
+    void enqueue_write_pages(
+        const Global &global,
+        uint32_t first_page,
+        uint32_t page_count,
+        const void *src,
+        bool blocking) const;
+    void enqueue_read_strided(
+        const Global &global,
+        uint32_t offset,
+        uint32_t stride,
+        uint32_t row_bytes,
+        uint32_t row_count,
+        void *dst,
+        bool blocking) const;
+    void enqueue_write_strided(
+        const Global &global,
+        uint32_t offset,
+        uint32_t stride,
+        uint32_t row_bytes,
+        uint32_t row_count,
+        const void *src,
+        bool blocking) const;
     void enqueue_program(const Program &program, bool blocking) const;
     void finish() const;
+    uint32_t begin_trace() const;
+    void end_trace() const;
+    void replay_trace(uint32_t trace_id, bool blocking) const;
+    void release_trace(uint32_t trace_id) const;
+    Event record_event() const;
+    void wait_event(const Event &event) const;
+    void begin_graph(const Graph &graph) const;
+    void end_graph() const;
+    void enqueue_graph(const Graph &graph, bool blocking) const;
 private:
     std::shared_ptr<QueueImpl> m_impl;
 };
 
+class Event {
+public:
+    Event();
+    Event(const Event &other);
+    Event(Event &&other) noexcept;
+    explicit Event(std::shared_ptr<EventImpl> &&impl);
+    ~Event();
+public:
+    Event &operator=(const Event &other);
+    Event &operator=(Event &&other) noexcept;
+    const std::shared_ptr<EventImpl> &impl() const {
+        return m_impl;
+    }
+    bool is_null() const {
+        return (m_impl == nullptr);
+    }
+    Queue queue() const;
+    void synchronize() const;
+    bool query() const;
+private:
+    std::shared_ptr<EventImpl> m_impl;
+};
+
+class Graph {
+public:
+    Graph();
+    Graph(const Graph &other);
+    Graph(Graph &&other) noexcept;
+    explicit Graph(std::shared_ptr<GraphImpl> &&impl);
+    explicit Graph(const Device &device);
+    ~Graph();
+public:
+    Graph &operator=(const Graph &other);
+    Graph &operator=(Graph &&other) noexcept;
+    const std::shared_ptr<GraphImpl> &impl() const {
+        return m_impl;
+    }
+    bool is_null() const {
+        return (m_impl == nullptr);
+    }
+    Device device() const;
+    uint32_t add_program(const Program &program) const;
+    void add_dependency(uint32_t program, uint32_t dependency) const;
+    uint32_t program_count() const;
+    uint32_t batch_count() const;
+private:
+    std::shared_ptr<GraphImpl> m_impl;
+};
+
+//
+//    Data format utilities
+//
+
+bool is_block_float(DataFormat data_format);
+uint32_t get_data_bytes(DataFormat data_format, uint32_t items);
+
 } // namespace host
 } // namespace tanto
 } // namespace ronin
@@ -4,6 +4,10 @@
 
 #include <cstdint>
 #include <memory>
+#include <utility>
+#include <vector>
+#include <set>
+#include <algorithm>
 
 #include "core/api.hpp"
 #include "core/impl.hpp"
@@ -19,6 +23,19 @@ namespace ronin {
 namespace tanto {
 namespace host {
 
+namespace {
+
+bool cores_overlap(const CoreSet &cores1, const CoreSet &cores2) {
+    for (auto &core: cores1) {
+        if (cores2.count(core) != 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
 //
 //    DeviceImpl
 //
@@ -26,26 +43,38 @@ namespace host {
 DeviceImpl::DeviceImpl(const std::shared_ptr<PlatformImpl> &platform, uint32_t id):
         m_platform(platform), 
         m_id(id),
+        m_trace_region_size(DEFAULT_TRACE_REGION_SIZE),
+        m_local_arena_enabled(true),
+        m_local_arena_valid(false),
+        m_local_arena_version(0),
         m_impl(nullptr) { }
 
 DeviceImpl::~DeviceImpl() { 
+    release_local_arenas();
     if (m_impl != nullptr) {
         metal::CloseDevice(m_impl);
     }
 }
 
 std::shared_ptr<DeviceImpl> DeviceImpl::create(
-        const std::shared_ptr<PlatformImpl> &platform, uint32_t id) {
+        const std::shared_ptr<PlatformImpl> &platform, 
+        uint32_t id,
+        uint32_t trace_region_size) {
     std::shared_ptr<DeviceImpl> device = platform->find_device(id);
     if (device != nullptr) {
         if (device->m_impl == nullptr) {
-            device->m_impl = metal::CreateDevice(id);
+            device->m_trace_region_size = trace_region_size;
+            device->open_impl();
+        } else if (trace_region_size > device->m_trace_region_size) {
+            // trace region is reserved when device is opened
+            throw Error("Device is already open with smaller trace region");
         }
         return device;
     }
     device = std::make_shared<DeviceImpl>(platform, id);
     platform->add_device(device);
-    device->m_impl = metal::CreateDevice(id);
+    device->m_trace_region_size = trace_region_size;
+    device->open_impl();
     return device;
 }
 
@@ -99,6 +128,8 @@ void DeviceImpl::worker_core_from_logical_core(
 
 void DeviceImpl::close() {
     validate_impl();
+    release_local_arenas();
+    m_local_arena_valid = false;
     metal::CloseDevice(m_impl);
     m_globals.clear();
     m_programs.clear();
@@ -106,12 +137,115 @@ void DeviceImpl::close() {
     m_impl = nullptr;
 }
 
+uint32_t DeviceImpl::update_local_arena() {
+    if (!m_local_arena_valid) {
+        plan_local_arena();
+        m_local_arena_valid = true;
+        m_local_arena_version++;
+    }
+    return m_local_arena_version;
+}
+
+void DeviceImpl::set_local_arena_enabled(bool enable) {
+    if (enable != m_local_arena_enabled) {
+        m_local_arena_enabled = enable;
+        m_local_arena_valid = false;
+    }
+}
+
+uint32_t DeviceImpl::local_arena_bytes(uint32_t x, uint32_t y) {
+    for (const LocalArena &arena: m_local_arenas) {
+        if (arena.cores.count(std::make_pair(x, y)) != 0) {
+            return arena.bytes;
+        }
+    }
+    return 0;
+}
+
 void DeviceImpl::validate_impl() {
     if (m_impl == nullptr) {
         throw Error("Null TT-Metal device reference");
     }
 }
 
+void DeviceImpl::open_impl() {
+    m_impl = 
+        metal::CreateDevice(
+            m_id, 
+            NUM_QUEUES, 
+            DEFAULT_L1_SMALL_SIZE, 
+            m_trace_region_size);
+}
+
+void DeviceImpl::plan_local_arena() {
+    if (!m_local_arena_enabled) {
+        // program scope locals are allocated per launch
+        release_local_arenas();
+        return;
+    }
+    // programs with overlapping local grids share one arena sized for largest of them;
+    //     arenas span only cores of these grids, other cores stay free for pipes
+    struct Group {
+        CoreSet cores;
+        uint32_t bytes;
+        std::vector<ProgramImpl *> programs;
+    };
+    std::vector<Group> groups;
+    for (auto &program: m_programs) {
+        Group group;
+        group.bytes = program->local_arena_size();
+        if (group.bytes == 0) {
+            program->place_locals(nullptr);
+            continue;
+        }
+        program->get_local_cores(group.cores);
+        group.programs.push_back(program.get());
+        for (size_t i = 0; i < groups.size(); ) {
+            if (cores_overlap(groups[i].cores, group.cores)) {
+                group.cores.insert(groups[i].cores.begin(), groups[i].cores.end());
+                group.bytes = std::max(group.bytes, groups[i].bytes);
+                group.programs.insert(
+                    group.programs.end(), 
+                    groups[i].programs.begin(), 
+                    groups[i].programs.end());
+                groups.erase(groups.begin() + i);
+            } else {
+                i++;
+            }
+        }
+        groups.push_back(std::move(group));
+    }
+    // keep arenas that still fit; release others before creating new ones
+    //     (in-flight programs keep released arenas alive)
+    std::vector<LocalArena> arenas(groups.size());
+    for (size_t i = 0; i < groups.size(); i++) {
+        for (LocalArena &arena: m_local_arenas) {
+            if (arena.impl != nullptr && 
+                    arena.cores == groups[i].cores && 
+                    arena.bytes >= groups[i].bytes) {
+                arenas[i] = std::move(arena);
+                break;
+            }
+        }
+    }
+    release_local_arenas();
+    for (size_t i = 0; i < groups.size(); i++) {
+        if (arenas[i].impl == nullptr) {
+            arenas[i].cores = groups[i].cores;
+            arenas[i].bytes = groups[i].bytes;
+            arenas[i].impl = LocalImpl::create_arena_impl(this, groups[i].cores, groups[i].bytes);
+        }
+        for (ProgramImpl *program: groups[i].programs) {
+            program->place_locals(arenas[i].impl);
+        }
+    }
+    m_local_arenas = std::move(arenas);
+}
+
+void DeviceImpl::release_local_arenas() {
+    m_local_arenas.clear();
+}
+
 } // namespace host
 } // namespace tanto
 } // namespace ronin
@@ -0,0 +1,56 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <memory>
+
+#include "core/api.hpp"
+#include "core/impl.hpp"
+#include "core/metal.hpp"
+
+#ifdef METAL_057
+
+#include "tt-metalium/event.hpp"
+
+#else
+
+#include "tt_metal/impl/event/event.hpp"
+
+#endif
+
+namespace ronin {
+namespace tanto {
+namespace host {
+
+//
+//    EventImpl
+//
+
+EventImpl::EventImpl(const std::shared_ptr<QueueImpl> &queue):
+        m_queue(queue) { }
+
+EventImpl::~EventImpl() { }
+
+std::shared_ptr<EventImpl> EventImpl::create(const std::shared_ptr<QueueImpl> &queue) {
+    auto event = std::make_shared<EventImpl>(queue);
+    event->create_impl();
+    queue->record_event(event);
+    return event;
+}
+
+void EventImpl::synchronize() {
+    metal::EventSynchronize(m_impl);
+}
+
+bool EventImpl::query() {
+    return metal::EventQuery(m_impl);
+}
+
+void EventImpl::create_impl() {
+    m_impl = std::make_shared<metal::Event>();
+}
+
+} // namespace host
+} // namespace tanto
+} // namespace ronin
+
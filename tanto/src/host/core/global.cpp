@@ -36,7 +36,8 @@ GlobalImpl::GlobalImpl(
             m_dist(dist),
             m_is_dram(is_dram),
             m_size(size),
-            m_page_size(page_size) { }
+            m_page_size(page_size),
+            m_bank_pages(0) { }
 
 GlobalImpl::~GlobalImpl() { }
 
@@ -92,9 +93,7 @@ void GlobalImpl::validate_dist_size(
         if (!is_pow2(page_size)) {
             throw Error("Page size of linear global buffer must be power of 2");
         }
-    } else if (dist == GlobalDist::BLOCK) {
-        throw Error("Block distribution of global buffers is not supported");
-     } else {
+    } else {
         // sharded buffer page size in items is fixed to 1024 in this version
         if (page_size % 1024 != 0) {
             throw Error("Page size of distributed global buffer must be multiple of 1024");
@@ -115,9 +114,8 @@ void GlobalImpl::create_impl() {
 
 void GlobalImpl::create_impl_linear() {
     // size parameters are in items
-    uint32_t item_bytes = get_item_bytes(m_data_format);
-    uint32_t bytes = m_size * item_bytes;
-    uint32_t page_bytes = m_page_size * item_bytes;
+    uint32_t bytes = get_data_bytes(m_data_format, m_size);
+    uint32_t page_bytes = this->page_bytes();
     if (bytes < page_bytes) {
         bytes = page_bytes;
     } else if (bytes % page_bytes != 0) {
@@ -136,8 +134,14 @@ void GlobalImpl::create_impl_linear() {
 }
 
 void GlobalImpl::create_impl_dist() {
+    // Distributed buffers are sharded over all DRAM banks in bank order.
+    // L1 sharding and placement of shards in DRAM banks nearest
+    // to specific worker cores are not supported in this version.
     // sharded buffer page size in items is fixed to 1024 in this version
     // not to be mismatched with tanto global buffer page size
+    if (is_block_float(m_data_format)) {
+        throw Error("Block float data format is not supported for distributed global buffers");
+    }
     uint32_t unit_size = 1024;
     std::shared_ptr<DeviceImpl> device = m_device.lock();
 #ifdef METAL_057
@@ -157,10 +161,19 @@ void GlobalImpl::create_impl_dist() {
                 CoreCoord(0, 0),
                 CoreCoord(dram_grid_size.x - 1, dram_grid_size.y - 1))
             }));
-    metal::TensorMemoryLayout memory_layout = metal::TensorMemoryLayout::BLOCK_SHARDED;
-    std::array<uint32_t, 2> page_shape{1, unit_size};
+    // CYCLIC: page i is placed in bank (i % num_banks) at row (i / num_banks)
+    // BLOCK: page i is placed in bank (i / num_rows) at row (i % num_rows)
+    metal::TensorMemoryLayout memory_layout;
     std::array<uint32_t, 2> shard_shape{num_rows, m_page_size};
-    std::array<uint32_t, 2> tensor_shape{num_rows, num_banks * m_page_size / unit_size};
+    std::array<uint32_t, 2> tensor_shape;
+    if (m_dist == GlobalDist::BLOCK) {
+        memory_layout = metal::TensorMemoryLayout::HEIGHT_SHARDED;
+        tensor_shape = {num_banks * num_rows, m_page_size / unit_size};
+    } else {
+        memory_layout = metal::TensorMemoryLayout::BLOCK_SHARDED;
+        tensor_shape = {num_rows, num_banks * m_page_size / unit_size};
+    }
+    std::array<uint32_t, 2> page_shape{1, unit_size};
     uint32_t item_bytes = get_item_bytes(m_data_format);
     uint32_t bytes = num_rows * num_banks * m_page_size * item_bytes;
     uint32_t unit_bytes = unit_size * item_bytes;
@@ -181,6 +194,7 @@ void GlobalImpl::create_impl_dist() {
             tensor_shape)
     };
     m_impl = metal::CreateBuffer(config);
+    m_bank_pages = num_rows;
 }
 
 uint32_t GlobalImpl::bytes() {
@@ -188,9 +202,23 @@ uint32_t GlobalImpl::bytes() {
 }
 
 uint32_t GlobalImpl::page_bytes() {
+    // block float pages are sized in bytes: compressed tile size is not power of 2
+    if (is_block_float(m_data_format)) {
+        return m_page_size;
+    }
     return m_page_size * get_item_bytes(m_data_format);
 }
 
+uint32_t GlobalImpl::page_arg() {
+    // kernel argument describing page size:
+    //     LINEAR: log2 of page size in bytes
+    //     BLOCK, CYCLIC: page size in bytes
+    if (m_dist == GlobalDist::LINEAR) {
+        return u32_log2(m_impl->page_size());
+    }
+    return page_bytes();
+}
+
 } // namespace host
 } // namespace tanto
 } // namespace ronin
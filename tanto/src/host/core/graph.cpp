@@ -0,0 +1,86 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdint>
+#include <vector>
+#include <memory>
+#include <algorithm>
+
+#include "core/api.hpp"
+#include "core/impl.hpp"
+
+namespace ronin {
+namespace tanto {
+namespace host {
+
+//
+//    GraphImpl
+//
+
+GraphImpl::GraphImpl(const std::shared_ptr<DeviceImpl> &device):
+        m_device(device) { }
+
+GraphImpl::~GraphImpl() { }
+
+std::shared_ptr<GraphImpl> GraphImpl::create(const std::shared_ptr<DeviceImpl> &device) {
+    return std::make_shared<GraphImpl>(device);
+}
+
+uint32_t GraphImpl::add_program(const std::shared_ptr<ProgramImpl> &program) {
+    if (program->device() != m_device.lock()) {
+        throw Error("Program and graph belong to different devices");
+    }
+    uint32_t index = uint32_t(m_programs.size());
+    m_programs.emplace_back(program);
+    m_dependencies.emplace_back();
+    return index;
+}
+
+void GraphImpl::add_dependency(uint32_t program, uint32_t dependency) {
+    if (program >= uint32_t(m_programs.size())) {
+        throw Error("Invalid graph program index");
+    }
+    if (dependency >= program) {
+        throw Error("Graph dependency must precede dependent program");
+    }
+    m_dependencies[program].push_back(dependency);
+}
+
+std::vector<bool> GraphImpl::make_barriers() {
+    // programs since last barrier form a batch launched together;
+    //     barrier is needed if program depends on or conflicts with batch member
+    uint32_t count = uint32_t(m_programs.size());
+    std::vector<bool> barriers(count, false);
+    uint32_t batch_start = 0;
+    for (uint32_t i = 1; i < count; i++) {
+        bool barrier = false;
+        for (uint32_t dependency: m_dependencies[i]) {
+            if (dependency >= batch_start) {
+                barrier = true;
+                break;
+            }
+        }
+        for (uint32_t k = batch_start; k < i && !barrier; k++) {
+            barrier = m_programs[i]->conflicts_with(m_programs[k]);
+        }
+        if (barrier) {
+            barriers[i] = true;
+            batch_start = i;
+        }
+    }
+    return barriers;
+}
+
+uint32_t GraphImpl::batch_count() {
+    if (m_programs.empty()) {
+        return 0;
+    }
+    std::vector<bool> barriers = make_barriers();
+    return uint32_t(std::count(barriers.begin(), barriers.end(), true)) + 1;
+}
+
+} // namespace host
+} // namespace tanto
+} // namespace ronin
+
@@ -8,6 +8,8 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <set>
+#include <utility>
 #include <memory>
 #include <variant>
 #include <mutex>
@@ -19,6 +21,9 @@ namespace ronin {
 namespace tanto {
 namespace host {
 
+// logical (x, y) worker cores
+using CoreSet = std::set<std::pair<uint32_t, uint32_t>>;
+
 class PlatformImpl {
 public:
     PlatformImpl();
@@ -41,7 +46,9 @@ public:
     ~DeviceImpl();
 public:
     static std::shared_ptr<DeviceImpl> create(
-        const std::shared_ptr<PlatformImpl> &platform, uint32_t id);
+        const std::shared_ptr<PlatformImpl> &platform, 
+        uint32_t id,
+        uint32_t trace_region_size);
     std::shared_ptr<PlatformImpl> platform() {
         return m_platform.lock();
     }
@@ -61,6 +68,21 @@ public:
         uint32_t &worker_x,
         uint32_t &worker_y);
     void close();
+    // returns layout version, re-plans arena if invalid
+    uint32_t update_local_arena();
+    void invalidate_local_arena() {
+        m_local_arena_valid = false;
+    }
+    // current arena version, 0 if arena must be (re)planned
+    uint32_t local_arena_version() {
+        return m_local_arena_valid ? m_local_arena_version : 0;
+    }
+    void set_local_arena_enabled(bool enable);
+    bool local_arena_enabled() {
+        return m_local_arena_enabled;
+    }
+    // bytes reserved for program scope locals on logical core
+    uint32_t local_arena_bytes(uint32_t x, uint32_t y);
 #ifdef METAL_057
     metal::IDevice *impl() {
         return m_impl;
@@ -71,13 +93,36 @@ public:
     }
  #endif
  void validate_impl();
+private:
+    void plan_local_arena();
+    void release_local_arenas();
+private:
+    // hardware command queues opened per device (IDs 0 and 1)
+    static constexpr uint8_t NUM_QUEUES = 2;
+public:
+    // DRAM bytes reserved for captured traces
+    static constexpr uint32_t DEFAULT_TRACE_REGION_SIZE = 32 * 1024 * 1024;
+private:
+    void open_impl();
 private:
     std::weak_ptr<PlatformImpl> m_platform;
     uint32_t m_id;
+    uint32_t m_trace_region_size;
     std::vector<std::shared_ptr<GlobalImpl>> m_globals;
     std::vector<std::shared_ptr<LocalImpl>> m_locals;
     std::vector<std::shared_ptr<ProgramImpl>> m_programs;
     std::vector<std::shared_ptr<QueueImpl>> m_queues;
+    // L1 arena holding program scope locals of a group of programs
+    //     with overlapping local grids; spans only cores of these grids
+    struct LocalArena {
+        CoreSet cores;
+        uint32_t bytes;
+        std::shared_ptr<metal::Buffer> impl;
+    };
+    std::vector<LocalArena> m_local_arenas;
+    bool m_local_arena_enabled;
+    bool m_local_arena_valid;
+    uint32_t m_local_arena_version;
     // TODO: Figure out whether smart pointer is needed here
 #ifdef METAL_057
     metal::IDevice *m_impl;
@@ -86,6 +131,28 @@ private:
 #endif
 };
 
+//
+//    Access of kernel to its global parameters
+//
+//    Derived from body of 'kernel' function in kernel source (as generated
+//    by the Tanto frontend or written in Tanto): parameter passed only
+//    to read operations is read, only to write operations is written;
+//    any other use (or source that cannot be analyzed) is conservatively
+//    treated as read and write
+//
+
+enum GlobalAccess {
+    GLOBAL_ACCESS_READ = 0x1,
+    GLOBAL_ACCESS_WRITE = 0x2,
+    GLOBAL_ACCESS_READ_WRITE = 0x3
+};
+
+struct GlobalUse {
+    metal::Buffer *buffer;
+    // combined GlobalAccess flags of all kernels of program
+    uint32_t access;
+};
+
 class ProgramImpl {
 public:
     ProgramImpl(const std::shared_ptr<DeviceImpl> &device);
@@ -105,8 +172,30 @@ public:
     }
     void before_enqueue();
     void after_enqueue();
+    std::vector<std::string> check_pipes();
+    void resize_pipes();
+    void set_pipe_sizing(bool enable) {
+        m_pipe_sizing = enable;
+        m_pipes_sized = false;
+    }
+    // bytes per core required by program scope locals
+    uint32_t local_arena_size();
+    // adds cores of grids holding program scope locals
+    void get_local_cores(CoreSet &cores);
+    void place_locals(const std::shared_ptr<metal::Buffer> &arena);
+    void invalidate_locals() {
+        m_local_arena_version = 0;
+    }
+    // true if program can be relaunched without binding locals and pipes
+    bool is_bound();
+    // true if programs cannot run concurrently: they share cores or
+    //     overlapping global buffers written by at least one of them
+    bool conflicts_with(const std::shared_ptr<ProgramImpl> &other);
 private:
     void create_impl();
+    void size_pipes();
+    void get_core_ranges(std::vector<Range> &ranges);
+    void get_global_buffers(std::vector<GlobalUse> &buffers);
 private:
     std::weak_ptr<DeviceImpl> m_device;
     std::vector<std::shared_ptr<GridImpl>> m_grids;
@@ -115,6 +204,13 @@ private:
     std::vector<std::shared_ptr<SemaphoreImpl>> m_semaphores;
     std::vector<std::shared_ptr<KernelImpl>> m_kernels;
     metal::Program m_impl;
+    // device arena holding program scope locals (owned by device)
+    std::weak_ptr<metal::Buffer> m_local_arena;
+    // device arena version seen by last launch, 0 if none
+    uint32_t m_local_arena_version;
+    // automatic pipe sizing and checking at first launch
+    bool m_pipe_sizing;
+    bool m_pipes_sized;
 };
 
 class GridImpl {
@@ -211,6 +307,10 @@ public:
     }
     uint32_t bytes();
     uint32_t page_bytes();
+    uint32_t page_arg();
+    uint32_t bank_pages() {
+        return m_bank_pages;
+    }
 private:
     static void validate_dist_size(
         GlobalDist dist,
@@ -226,6 +326,7 @@ private:
     bool m_is_dram;
     uint32_t m_size;
     uint32_t m_page_size;
+    uint32_t m_bank_pages;
     std::shared_ptr<metal::Buffer> m_impl;
 };
 
@@ -270,8 +371,15 @@ public:
     const std::shared_ptr<metal::Buffer> &impl() const {
         return m_impl;
     }
+    // bytes per core
+    uint32_t bytes();
     void create_impl();
+    void place_impl(uint32_t addr);
     void release_impl();
+    static std::shared_ptr<metal::Buffer> create_arena_impl(
+        DeviceImpl *device,
+        const CoreSet &cores,
+        uint32_t bytes);
 private:
     std::weak_ptr<DeviceImpl> m_device;
     std::weak_ptr<ProgramImpl> m_program;
@@ -325,7 +433,11 @@ public:
     metal::CBHandle impl() {
         return m_impl;
     }
+    bool has_local() {
+        return (m_local != nullptr);
+    }
     void update_dynamic_address();
+    void resize(uint32_t size);
 private:
     void create_impl();
 private:
@@ -373,6 +485,111 @@ private:
     uint32_t m_impl;
 };
 
+//
+//    Pipe reports are produced by the Tanto frontend ("--pipe-report" option)
+//    and describe frame operations of a kernel on its pipe parameters
+//
+
+class PipeReport {
+public:
+    struct PipeEntry {
+        uint32_t index;
+        std::string name;
+        // frame size in tiles set in kernel, 0 if not set, -1 if unknown
+        int frame;
+    };
+    struct LoopEntry {
+        // constant trip count or -1
+        int64_t trip;
+        // index of kernel parameter holding trip count or -1
+        int param;
+    };
+    struct OpEntry {
+        uint32_t index;
+        bool push;
+        uint32_t count;
+        // ids of enclosing loops, outermost first
+        std::vector<int> loops;
+        // inside conditional statement: may be skipped
+        bool cond;
+    };
+public:
+    PipeReport();
+    ~PipeReport();
+public:
+    void load(const std::string &path);
+    void parse(const std::string &text);
+    const std::vector<PipeEntry> &pipes() {
+        return m_pipes;
+    }
+    const std::vector<OpEntry> &ops() {
+        return m_ops;
+    }
+    const LoopEntry &loop(int id);
+private:
+    std::vector<PipeEntry> m_pipes;
+    std::map<int, LoopEntry> m_loops;
+    std::vector<OpEntry> m_ops;
+};
+
+class PipeChecker {
+public:
+    PipeChecker();
+    ~PipeChecker();
+public:
+    void run(
+        const std::vector<std::shared_ptr<PipeImpl>> &pipes,
+        const std::vector<std::shared_ptr<KernelImpl>> &kernels);
+    const std::vector<std::string> &diags() {
+        return m_diags;
+    }
+    // sizes in tiles, 0 if unknown
+    uint32_t min_size(PipeImpl *pipe);
+    uint32_t max_size(PipeImpl *pipe);
+private:
+    struct Instance {
+        KernelImpl *kernel;
+        PipeReport *report;
+        int range_index;
+        // kernel parameter index => pipe
+        std::map<uint32_t, PipeImpl *> pipes;
+    };
+    struct Bounds {
+        // all in frames, 0 if unknown
+        uint32_t frame_size;
+        int64_t min_frames;
+        int64_t max_frames;
+        bool max_unknown;
+    };
+private:
+    void reset();
+    void make_instances(const std::vector<std::shared_ptr<KernelImpl>> &kernels);
+    void check_pipe(PipeImpl *pipe);
+    void check_pair(PipeImpl *pipe, Instance &producer, Instance &consumer, Bounds &bounds);
+    void check_cycles();
+    bool find_cycle(int node, std::vector<int> &state, std::vector<int> &path);
+    bool has_op(Instance &inst, PipeImpl *pipe, bool push);
+    const PipeReport::OpEntry *first_op(Instance &inst);
+    int64_t get_trip(Instance &inst, int loop_id);
+    int64_t get_op_frames(Instance &inst, const PipeReport::OpEntry &op, size_t skip);
+    int64_t get_burst(Instance &inst, PipeImpl *pipe, bool push);
+    int64_t get_total(Instance &inst, PipeImpl *pipe, bool push);
+    int64_t get_frames_before(
+        Instance &inst,
+        PipeImpl *pipe,
+        PipeImpl *other,
+        bool push,
+        bool upper);
+    int get_frame(Instance &inst, PipeImpl *pipe);
+    bool ranges_overlap(Instance &inst1, Instance &inst2);
+    std::string kernel_name(Instance &inst);
+    std::string pipe_name(PipeImpl *pipe);
+private:
+    std::vector<Instance> m_instances;
+    std::map<PipeImpl *, Bounds> m_bounds;
+    std::vector<std::string> m_diags;
+};
+
 class KernelImpl {
 public:
     KernelImpl(
@@ -431,10 +648,29 @@ public:
         return m_impl;
     }
     void set_args_impl();
+    void set_pipe_report(const std::string &path);
+    const std::shared_ptr<PipeReport> &pipe_report() {
+        return m_pipe_report;
+    }
+    int range_args_count() {
+        return int(m_ranges_args.size());
+    }
+    const Range &range_at(int index) {
+        return m_ranges_args[index].range;
+    }
+    const std::vector<KernelArg> &args_at(int index) {
+        return m_ranges_args[index].args;
+    }
+    // access to global argument at given position in argument list
+    uint32_t global_access(int index) {
+        return (index < int(m_global_access.size())) ? 
+            m_global_access[index] : uint32_t(GLOBAL_ACCESS_READ_WRITE);
+    }
 private:
     void set_args(const Range &range, const std::vector<KernelArg> &args);
     void validate_range(const Range &range);
     void create_impl();
+    void scan_global_access();
     static std::shared_ptr<metal::RuntimeArgs> 
         make_args_impl(const std::vector<KernelArg> &args);
     static void update_args_impl(
@@ -455,6 +691,8 @@ private:
     std::vector<uint32_t> m_compile_args;
     std::map<std::string, std::string> m_defines;
     std::vector<RangeArgs> m_ranges_args;
+    std::shared_ptr<PipeReport> m_pipe_report;
+    std::vector<uint32_t> m_global_access;
     metal::KernelHandle m_impl;
 };
 
@@ -479,14 +717,160 @@ public:
         const std::shared_ptr<GlobalImpl> &global, 
         const void *src,
         bool blocking);
+    void enqueue_read_range(
+        const std::shared_ptr<GlobalImpl> &global,
+        uint32_t offset,
+        uint32_t bytes,
+        void *dst,
+        bool blocking);
+    void enqueue_write_range(
+        const std::shared_ptr<GlobalImpl> &global,
+        uint32_t offset,
+        uint32_t bytes,
+        const void *src,
+        bool blocking);
+    void enqueue_read_pages(
+        const std::shared_ptr<GlobalImpl> &global,
+        uint32_t first_page,
+        uint32_t page_count,
+        void *dst,
+        bool blocking);
+    void enqueue_write_pages(
+        const std::shared_ptr<GlobalImpl> &global,
+        uint32_t first_page,
+        uint32_t page_count,
+        const void *src,
+        bool blocking);
+    void enqueue_read_strided(
+        const std::shared_ptr<GlobalImpl> &global,
+        uint32_t offset,
+        uint32_t stride,
+        uint32_t row_bytes,
+        uint32_t row_count,
+        void *dst,
+        bool blocking);
+    void enqueue_write_strided(
+        const std::shared_ptr<GlobalImpl> &global,
+        uint32_t offset,
+        uint32_t stride,
+        uint32_t row_bytes,
+        uint32_t row_count,
+        const void *src,
+        bool blocking);
     void enqueue_program(const std::shared_ptr<ProgramImpl> &program, bool blocking);
     void finish();
+    uint32_t begin_trace();
+    void end_trace();
+    void replay_trace(uint32_t trace_id, bool blocking);
+    void release_trace(uint32_t trace_id);
+    void record_event(const std::shared_ptr<EventImpl> &event);
+    void wait_event(const std::shared_ptr<EventImpl> &event);
+    void begin_graph(const std::shared_ptr<GraphImpl> &graph);
+    void end_graph();
+    void enqueue_graph(const std::shared_ptr<GraphImpl> &graph, bool blocking);
+private:
+    // contiguous byte range of global buffer and matching host memory
+    struct Span {
+        uint32_t offset;
+        uint32_t bytes;
+        uint8_t *host;
+    };
+    // run of global buffer pages staged in host bounce buffer
+    struct PageRun {
+        uint32_t first_page;
+        uint32_t end_page;
+        uint32_t bounce_offset;
+    };
 private:
     void create_impl();
+    void check_bound(const std::shared_ptr<ProgramImpl> &program);
+    void check_not_capturing(const char *what);
+    void read_spans(
+        const std::shared_ptr<GlobalImpl> &global,
+        const std::vector<Span> &spans,
+        bool blocking);
+    void write_spans(
+        const std::shared_ptr<GlobalImpl> &global,
+        const std::vector<Span> &spans,
+        bool blocking);
+    void read_page_runs(
+        const std::shared_ptr<GlobalImpl> &global, 
+        const std::vector<PageRun> &runs,
+        uint8_t *bounce);
+    static void validate_spans(
+        const std::shared_ptr<GlobalImpl> &global,
+        const std::vector<Span> &spans);
+    static bool is_page_aligned(const Span &span, uint32_t page_bytes);
+    static uint32_t make_page_runs(
+        const std::vector<Span> &spans,
+        uint32_t page_bytes,
+        std::vector<PageRun> &runs);
+    static const PageRun &find_page_run(
+        const std::vector<PageRun> &runs, 
+        uint32_t page);
+    static std::vector<Span> make_strided_spans(
+        uint32_t offset,
+        uint32_t stride,
+        uint32_t row_bytes,
+        uint32_t row_count,
+        uint8_t *host);
 private:
     std::weak_ptr<DeviceImpl> m_device;
     uint32_t m_id;
     metal::CommandQueue *m_impl;
+    bool m_trace_active;
+    uint32_t m_trace_id;
+    // graph receiving enqueued programs during graph capture
+    std::shared_ptr<GraphImpl> m_graph;
+};
+
+class GraphImpl {
+public:
+    GraphImpl(const std::shared_ptr<DeviceImpl> &device);
+    ~GraphImpl();
+public:
+    static std::shared_ptr<GraphImpl> create(const std::shared_ptr<DeviceImpl> &device);
+    std::shared_ptr<DeviceImpl> device() {
+        return m_device.lock();
+    }
+    uint32_t add_program(const std::shared_ptr<ProgramImpl> &program);
+    void add_dependency(uint32_t program, uint32_t dependency);
+    uint32_t program_count() {
+        return uint32_t(m_programs.size());
+    }
+    const std::shared_ptr<ProgramImpl> &program_at(uint32_t index) {
+        return m_programs[index];
+    }
+    // barrier flag per program: wait for completion of all preceding programs
+    std::vector<bool> make_barriers();
+    // number of batches of programs launched together
+    uint32_t batch_count();
+private:
+    std::weak_ptr<DeviceImpl> m_device;
+    std::vector<std::shared_ptr<ProgramImpl>> m_programs;
+    std::vector<std::vector<uint32_t>> m_dependencies;
+};
+
+class EventImpl {
+public:
+    EventImpl(const std::shared_ptr<QueueImpl> &queue);
+    ~EventImpl();
+public:
+    // creates event and records it in the queue
+    static std::shared_ptr<EventImpl> create(const std::shared_ptr<QueueImpl> &queue);
+    std::shared_ptr<QueueImpl> queue() {
+        return m_queue.lock();
+    }
+    const std::shared_ptr<metal::Event> &impl() const {
+        return m_impl;
+    }
+    void synchronize();
+    bool query();
+private:
+    void create_impl();
+private:
+    std::weak_ptr<QueueImpl> m_queue;
+    std::shared_ptr<metal::Event> m_impl;
 };
 
 } // namespace host
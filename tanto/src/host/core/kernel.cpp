@@ -3,12 +3,19 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include <cstdint>
+#include <cstdlib>
 #include <cassert>
+#include <cctype>
+#include <string>
 #include <vector>
 #include <map>
+#include <set>
+#include <utility>
 #include <memory>
 #include <variant>
 #include <type_traits>
+#include <fstream>
+#include <sstream>
 
 #include "core/api.hpp"
 #include "core/impl.hpp"
@@ -31,6 +38,273 @@ namespace ronin {
 namespace tanto {
 namespace host {
 
+namespace {
+
+bool is_ident_char(char c) {
+    return (std::isalnum(static_cast<unsigned char>(c)) || c == '_');
+}
+
+bool is_ident_at(const std::string &text, size_t pos, const std::string &ident) {
+    if (text.compare(pos, ident.size(), ident) != 0) {
+        return false;
+    }
+    if (pos != 0 && is_ident_char(text[pos - 1])) {
+        return false;
+    }
+    size_t end = pos + ident.size();
+    return (end >= text.size() || !is_ident_char(text[end]));
+}
+
+size_t skip_space(const std::string &text, size_t pos) {
+    while (pos < text.size() && std::isspace(static_cast<unsigned char>(text[pos]))) {
+        pos++;
+    }
+    return pos;
+}
+
+// replaces comments with spaces
+std::string strip_comments(const std::string &text) {
+    std::string result(text);
+    size_t size = text.size();
+    size_t pos = 0;
+    while (pos + 1 < size) {
+        if (text[pos] == '/' && text[pos + 1] == '/') {
+            while (pos < size && text[pos] != '\n') {
+                result[pos++] = ' ';
+            }
+        } else if (text[pos] == '/' && text[pos + 1] == '*') {
+            size_t end = text.find("*/", pos + 2);
+            end = (end == std::string::npos) ? size : end + 2;
+            while (pos < end) {
+                if (text[pos] != '\n') {
+                    result[pos] = ' ';
+                }
+                pos++;
+            }
+        } else {
+            pos++;
+        }
+    }
+    return result;
+}
+
+// returns position past matching closing bracket or npos
+size_t match_bracket(const std::string &text, size_t pos, char open, char close) {
+    int depth = 0;
+    for (size_t i = pos; i < text.size(); i++) {
+        if (text[i] == open) {
+            depth++;
+        } else if (text[i] == close) {
+            depth--;
+            if (depth == 0) {
+                return i + 1;
+            }
+        }
+    }
+    return std::string::npos;
+}
+
+// splits parameter list at top level commas
+std::vector<std::string> split_params(const std::string &text) {
+    std::vector<std::string> params;
+    int depth = 0;
+    size_t start = 0;
+    for (size_t i = 0; i <= text.size(); i++) {
+        char c = (i < text.size()) ? text[i] : ',';
+        if (c == '(' || c == '<' || c == '[') {
+            depth++;
+        } else if (c == ')' || c == '>' || c == ']') {
+            depth--;
+        } else if (c == ',' && depth == 0) {
+            params.push_back(text.substr(start, i - start));
+            start = i + 1;
+        }
+    }
+    return params;
+}
+
+// name of global parameter or empty string
+std::string get_global_param_name(const std::string &param) {
+    size_t pos = skip_space(param, 0);
+    if (param.compare(pos, 6, "const ") == 0) {
+        pos = skip_space(param, pos + 6);
+    }
+    if (!is_ident_at(param, pos, "Global") && !is_ident_at(param, pos, "global")) {
+        return "";
+    }
+    size_t end = param.size();
+    while (end > 0 && !is_ident_char(param[end - 1])) {
+        end--;
+    }
+    size_t start = end;
+    while (start > 0 && is_ident_char(param[start - 1])) {
+        start--;
+    }
+    return (start > pos + 6) ? param.substr(start, end - start) : "";
+}
+
+// finds function definitions outside of function bodies
+std::map<std::string, std::pair<std::string, std::string>> 
+        find_functions(const std::string &text) {
+    std::map<std::string, std::pair<std::string, std::string>> functions;
+    size_t size = text.size();
+    size_t pos = 0;
+    while (pos < size) {
+        // function bodies are skipped, other blocks (namespaces) are entered
+        char c = text[pos];
+        if (!is_ident_char(c) || (pos != 0 && is_ident_char(text[pos - 1]))) {
+            pos++;
+            continue;
+        }
+        size_t name_end = pos;
+        while (name_end < size && is_ident_char(text[name_end])) {
+            name_end++;
+        }
+        size_t params_start = skip_space(text, name_end);
+        if (params_start >= size || text[params_start] != '(') {
+            pos = name_end;
+            continue;
+        }
+        size_t params_end = match_bracket(text, params_start, '(', ')');
+        if (params_end == std::string::npos) {
+            break;
+        }
+        size_t body_start = skip_space(text, params_end);
+        if (body_start >= size || text[body_start] != '{') {
+            // declaration or macro invocation
+            pos = params_end;
+            continue;
+        }
+        size_t body_end = match_bracket(text, body_start, '{', '}');
+        if (body_end == std::string::npos) {
+            break;
+        }
+        functions[text.substr(pos, name_end - pos)] = 
+            std::make_pair(
+                text.substr(params_start + 1, params_end - params_start - 2),
+                text.substr(body_start, body_end - body_start));
+        pos = body_end;
+    }
+    return functions;
+}
+
+//
+//    GlobalAccessParser
+//
+//    Global parameter is passed to read or write operations directly
+//    or via helper functions defined in the same source
+//
+
+class GlobalAccessParser {
+public:
+    GlobalAccessParser(const std::string &source);
+    ~GlobalAccessParser();
+public:
+    // access per parameter of function, empty if function is not found
+    std::vector<uint32_t> function_access(const std::string &name);
+private:
+    uint32_t use_access(const std::string &body, size_t pos, size_t len);
+private:
+    std::map<std::string, std::pair<std::string, std::string>> m_functions;
+    std::map<std::string, std::vector<uint32_t>> m_access;
+    std::set<std::string> m_active;
+};
+
+GlobalAccessParser::GlobalAccessParser(const std::string &source):
+        m_functions(find_functions(strip_comments(source))) { }
+
+GlobalAccessParser::~GlobalAccessParser() { }
+
+std::vector<uint32_t> GlobalAccessParser::function_access(const std::string &name) {
+    auto cached = m_access.find(name);
+    if (cached != m_access.end()) {
+        return cached->second;
+    }
+    auto function = m_functions.find(name);
+    if (function == m_functions.end()) {
+        return std::vector<uint32_t>();
+    }
+    std::vector<std::string> params = split_params(function->second.first);
+    if (m_active.count(name) != 0) {
+        // recursion
+        return std::vector<uint32_t>(params.size(), GLOBAL_ACCESS_READ_WRITE);
+    }
+    m_active.insert(name);
+    const std::string &body = function->second.second;
+    std::vector<uint32_t> access(params.size(), 0);
+    for (size_t i = 0; i < params.size(); i++) {
+        std::string param_name = get_global_param_name(params[i]);
+        if (param_name.empty()) {
+            continue;
+        }
+        for (size_t k = 0; k < body.size(); k++) {
+            if (is_ident_at(body, k, param_name) && (k == 0 || body[k - 1] != '.')) {
+                access[i] |= use_access(body, k, param_name.size());
+            }
+        }
+    }
+    m_active.erase(name);
+    m_access[name] = access;
+    return access;
+}
+
+uint32_t GlobalAccessParser::use_access(const std::string &body, size_t pos, size_t len) {
+    // find innermost call enclosing position and argument index
+    int depth = 0;
+    int arg_index = 0;
+    size_t call_pos = pos;
+    while (call_pos > 0) {
+        char c = body[--call_pos];
+        if (c == ')' || c == ']') {
+            depth++;
+        } else if (c == '(' || c == '[') {
+            if (depth == 0) {
+                if (c != '(') {
+                    return GLOBAL_ACCESS_READ_WRITE;
+                }
+                break;
+            }
+            depth--;
+        } else if (c == ',' && depth == 0) {
+            arg_index++;
+        } else if ((c == ';' || c == '{' || c == '}') && depth == 0) {
+            return GLOBAL_ACCESS_READ_WRITE;
+        }
+    }
+    size_t end = call_pos;
+    while (end > 0 && std::isspace(static_cast<unsigned char>(body[end - 1]))) {
+        end--;
+    }
+    size_t start = end;
+    while (start > 0 && is_ident_char(body[start - 1])) {
+        start--;
+    }
+    std::string callee = body.substr(start, end - start);
+    if (callee.compare(0, 14, "noc_async_read") == 0 || callee == "read") {
+        return GLOBAL_ACCESS_READ;
+    }
+    if (callee.compare(0, 15, "noc_async_write") == 0 || callee == "write") {
+        return GLOBAL_ACCESS_WRITE;
+    }
+    // global passed as whole argument to helper function
+    size_t next = skip_space(body, pos + len);
+    bool whole = (next < body.size() && (body[next] == ',' || body[next] == ')'));
+    size_t prev = pos;
+    while (prev > 0 && std::isspace(static_cast<unsigned char>(body[prev - 1]))) {
+        prev--;
+    }
+    whole = whole && (prev > 0 && (body[prev - 1] == ',' || body[prev - 1] == '('));
+    if (whole && m_functions.count(callee) != 0) {
+        std::vector<uint32_t> access = function_access(callee);
+        if (arg_index < int(access.size())) {
+            return access[arg_index];
+        }
+    }
+    return GLOBAL_ACCESS_READ_WRITE;
+}
+
+} // namespace
+
 //
 //    KernelImpl
 //
@@ -50,6 +324,7 @@ KernelImpl::KernelImpl(
             m_path(path),
             m_compile_args(compile_args),
             m_defines(defines),
+            m_pipe_report(nullptr),
             m_impl(0) { }
 
 KernelImpl::~KernelImpl() { }
@@ -74,6 +349,7 @@ std::shared_ptr<KernelImpl> KernelImpl::create(
             defines);
     program->add_kernel(kernel);
     kernel->create_impl();
+    kernel->scan_global_access();
     return kernel;
 }
 
@@ -156,6 +432,35 @@ void KernelImpl::set_args_impl() {
     }
 }
 
+void KernelImpl::set_pipe_report(const std::string &path) {
+    if (m_format != KernelFormat::TANTO) {
+        throw Error("Pipe reports are supported for Tanto kernels only");
+    }
+    auto report = std::make_shared<PipeReport>();
+    report->load(path);
+    m_pipe_report = report;
+}
+
+void KernelImpl::scan_global_access() {
+    // kernel paths not found as given are relative to TT_METAL_HOME
+    std::ifstream stream(m_path);
+    if (!stream) {
+        const char *root_dir = std::getenv("TT_METAL_HOME");
+        if (root_dir != nullptr) {
+            stream.open(std::string(root_dir) + "/" + m_path);
+        }
+    }
+    if (!stream) {
+        // unknown access: all global arguments are read and written
+        m_global_access.clear();
+        return;
+    }
+    std::stringstream ss;
+    ss << stream.rdbuf();
+    GlobalAccessParser parser(ss.str());
+    m_global_access = parser.function_access("kernel");
+}
+
 void KernelImpl::validate_range(const Range &range) {
     validate_range_coord(range);
     for (RangeArgs &range_args: m_ranges_args) {
@@ -221,6 +526,7 @@ Tanto mapping of standard objects
 struct Global {
     uint32_t addr;
     uint32_t log2_page_size;
+    uint32_t bank_pages; // block distribution only
 };
 struct Local {
     uint32_t addr;
@@ -281,6 +587,10 @@ std::shared_ptr<metal::RuntimeArgs>
                     // reserve space for buffer pointer and page size
                     args_impl->emplace_back((metal::Buffer *)nullptr);
                     args_impl->emplace_back(uint32_t(0));
+                    if (v.dist() == GlobalDist::BLOCK) {
+                        // reserve space for number of pages per bank
+                        args_impl->emplace_back(uint32_t(0));
+                    }
                 } else if constexpr (std::is_same_v<T, Local>) {
                     // reserve space for buffer pointer
                     args_impl->emplace_back((metal::Buffer *)nullptr);
@@ -306,14 +616,13 @@ void KernelImpl::update_args_impl(
                 if constexpr (std::is_same_v<T, uint32_t>) {
                     pos++;
                 } else if constexpr (std::is_same_v<T, Global>) {
-                    metal::Buffer *buffer = v.impl()->impl().get();
-                    args_impl[pos] = buffer;
-                    if (v.dist() == GlobalDist::LINEAR) {
-                        args_impl[pos+1] = u32_log2(buffer->page_size());
-                    } else {
-                        args_impl[pos+1] = v.page_bytes();
-                    }
+                    args_impl[pos] = v.impl()->impl().get();
+                    args_impl[pos+1] = v.impl()->page_arg();
                     pos += 2;
+                    if (v.dist() == GlobalDist::BLOCK) {
+                        args_impl[pos] = v.impl()->bank_pages();
+                        pos++;
+                    }
                 } else if constexpr (std::is_same_v<T, Local>) {
                     args_impl[pos] = v.impl()->impl().get();
                     pos++;
@@ -4,6 +4,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <set>
 #include <variant>
 #include <type_traits>
 
@@ -18,7 +19,7 @@ namespace host {
 
 namespace {
 
-CoreRangeSet make_device_core_range_set(const std::shared_ptr<DeviceImpl> &device) {
+CoreRangeSet make_device_core_range_set(DeviceImpl *device) {
 #if 0 // TODO: Revise this (temporarily preset for Wormhole)
     uint32_t x, y;
     device->worker_grid_size(x, y);
@@ -29,6 +30,24 @@ CoreRangeSet make_device_core_range_set(const std::shared_ptr<DeviceImpl> &devic
     return CoreRangeSet({CoreRange(CoreCoord(0, 0), CoreCoord(x - 1, y - 1))});
 }
 
+// cores as disjoint row segments
+CoreRangeSet make_core_set_core_range_set(const CoreSet &cores) {
+    std::set<CoreRange> ranges;
+    auto it = cores.begin();
+    while (it != cores.end()) {
+        uint32_t x_start = it->first;
+        uint32_t y = it->second;
+        uint32_t x_end = x_start;
+        ++it;
+        while (it != cores.end() && it->first == x_end + 1 && it->second == y) {
+            x_end++;
+            ++it;
+        }
+        ranges.insert(CoreRange(CoreCoord(x_start, y), CoreCoord(x_end, y)));
+    }
+    return CoreRangeSet(ranges);
+}
+
 CoreRangeSet make_grid_core_range_set(const std::shared_ptr<GridImpl> &grid) {
     return std::visit(
         [](auto &&arg) -> CoreRangeSet {
@@ -44,6 +63,41 @@ CoreRangeSet make_grid_core_range_set(const std::shared_ptr<GridImpl> &grid) {
         grid->impl());
 }
 
+// bytes: per core, multiple of 32 items
+metal::ShardedBufferConfig make_sharded_config(
+        DeviceImpl *device,
+        const CoreRangeSet &core_set,
+        uint32_t bytes,
+        uint32_t item_bytes) {
+    uint32_t size = bytes / item_bytes;
+    uint32_t num_cores = core_set.num_cores();
+    std::array<uint32_t, 2> shard_shape{32, size / 32};
+    std::array<uint32_t, 2> page_shape{32, size / 32};
+    std::array<uint32_t, 2> tensor2d_shape{32, (size / 32) * num_cores};
+    return metal::ShardedBufferConfig{
+        .device = device->impl(),
+        .size = bytes * num_cores,
+        .page_size = bytes,
+        .buffer_type = metal::BufferType::L1,
+        .buffer_layout = metal::TensorMemoryLayout::HEIGHT_SHARDED,
+        .shard_parameters = metal::ShardSpecBuffer(
+            core_set,
+            shard_shape,
+            metal::ShardOrientation::ROW_MAJOR,
+#ifndef METAL_057
+            false,
+#endif
+            page_shape,
+            tensor2d_shape)
+    };
+}
+
+void validate_data_format(DataFormat data_format) {
+    if (is_block_float(data_format)) {
+        throw Error("Block float data format is not supported for local buffers");
+    }
+}
+
 } // namespace
 
 //
@@ -70,6 +124,7 @@ std::shared_ptr<LocalImpl> LocalImpl::create(
         const std::shared_ptr<DeviceImpl> &device,
         DataFormat data_format,
         uint32_t size) {
+    validate_data_format(data_format);
     auto local =
         std::make_shared<LocalImpl>(
             device,
@@ -88,6 +143,7 @@ std::shared_ptr<LocalImpl> LocalImpl::create(
         const std::shared_ptr<GridImpl> &grid,
         DataFormat data_format,
         uint32_t size) {
+    validate_data_format(data_format);
     validate_program_grid(program, grid);
     if (grid->range_count() != 1) {
         throw Error("Grid of local buffer has more than one range");
@@ -101,47 +157,56 @@ std::shared_ptr<LocalImpl> LocalImpl::create(
             size,
             LocalScope::PROGRAM);
     program->add_local(local);
-    // create_impl() is deferred until program launch
+    // place_impl() is deferred until program launch
     return local;
 }
 
-void LocalImpl::create_impl() {
+uint32_t LocalImpl::bytes() {
     // size parameter is in items
     uint32_t size = ((m_size + 31) / 32) * 32;
+    return size * get_item_bytes(m_data_format);
+}
+
+void LocalImpl::create_impl() {
     std::shared_ptr<DeviceImpl> device = m_device.lock();
     CoreRangeSet core_set = 
         (m_grid != nullptr) ?
             make_grid_core_range_set(m_grid) :
-            make_device_core_range_set(device);
-    uint32_t num_cores = core_set.num_cores();
-    std::array<uint32_t, 2> shard_shape{32, size / 32};
-    std::array<uint32_t, 2> page_shape{32, size / 32};
-    std::array<uint32_t, 2> tensor2d_shape{32, (size / 32) * num_cores};
-    uint32_t item_bytes = get_item_bytes(m_data_format);
-    uint32_t bytes = size * item_bytes;
-    metal::ShardedBufferConfig config{
-        .device = device->impl(),
-        .size = bytes * num_cores,
-        .page_size = bytes,
-        .buffer_type = metal::BufferType::L1,
-        .buffer_layout = metal::TensorMemoryLayout::HEIGHT_SHARDED,
-        .shard_parameters = metal::ShardSpecBuffer(
-            core_set,
-            shard_shape,
-            metal::ShardOrientation::ROW_MAJOR,
-#ifndef METAL_057
-            false,
-#endif
-            page_shape,
-            tensor2d_shape)
-    };
+            make_device_core_range_set(device.get());
+    metal::ShardedBufferConfig config = 
+        make_sharded_config(device.get(), core_set, bytes(), get_item_bytes(m_data_format));
+    m_impl = metal::CreateBuffer(config);
+}
+
+void LocalImpl::place_impl(uint32_t addr) {
+    // program scope locals do not own memory: they are placed in device arena
+    std::shared_ptr<DeviceImpl> device = m_device.lock();
+    CoreRangeSet core_set = make_grid_core_range_set(m_grid);
+    metal::ShardedBufferConfig config = 
+        make_sharded_config(device.get(), core_set, bytes(), get_item_bytes(m_data_format));
+#ifdef METAL_057
+    m_impl = metal::CreateBuffer(config, addr);
+#else
+    config.allocate = false;
     m_impl = metal::CreateBuffer(config);
+    m_impl->set_address(addr);
+#endif
 }
 
 void LocalImpl::release_impl() {
     m_impl.reset();
 }
 
+std::shared_ptr<metal::Buffer> LocalImpl::create_arena_impl(
+        DeviceImpl *device,
+        const CoreSet &cores,
+        uint32_t bytes) {
+    // arena spans only cores holding program scope locals
+    CoreRangeSet core_set = make_core_set_core_range_set(cores);
+    metal::ShardedBufferConfig config = make_sharded_config(device, core_set, bytes, 1);
+    return metal::CreateBuffer(config);
+}
+
 } // namespace host
 } // namespace tanto
 } // namespace ronin
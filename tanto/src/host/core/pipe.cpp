@@ -26,6 +26,10 @@ tt::DataFormat map_data_format(DataFormat data_format) {
         return tt::DataFormat::Float32;
     case DataFormat::BFLOAT16:
         return tt::DataFormat::Float16_b;
+    case DataFormat::BFP8_B:
+        return tt::DataFormat::Bfp8_b;
+    case DataFormat::BFP4_B:
+        return tt::DataFormat::Bfp4_b;
     default:
         throw Error("Unsupported data format");
         return tt::DataFormat(0);
@@ -84,11 +88,14 @@ void PipeImpl::set_local(const std::shared_ptr<LocalImpl> &local) {
         throw Error("Grid mismatch of pipe and local buffer");
     }
     m_local = local;
+    // rebind dynamic address on next launch
+    std::shared_ptr<ProgramImpl> program = m_program.lock();
+    program->invalidate_locals();
 }
 
 void PipeImpl::create_impl() {
     // size parameters are in tiles
-    uint32_t tile_bytes = 1024 * get_item_bytes(m_data_format);
+    uint32_t tile_bytes = get_tile_bytes(m_data_format);
     uint32_t bytes = m_size * tile_bytes;
     std::shared_ptr<ProgramImpl> program = m_program.lock();
     m_cbid = m_grid->make_cbid(m_kind);
@@ -97,6 +104,22 @@ void PipeImpl::create_impl() {
     m_impl = metal::CreateCircularBuffer(program->impl(), m_grid->impl(), config);
 }
 
+void PipeImpl::resize(uint32_t size) {
+    if (m_local != nullptr) {
+        throw Error("Cannot resize pipe bound to local buffer");
+    }
+    if (size == 0 || size % m_frame_size != 0) {
+        throw Error("Pipe size must be positive multiple of frame size");
+    }
+    if (size == m_size) {
+        return;
+    }
+    uint32_t tile_bytes = get_tile_bytes(m_data_format);
+    std::shared_ptr<ProgramImpl> program = m_program.lock();
+    metal::UpdateCircularBufferTotalSize(program->impl(), m_impl, size * tile_bytes);
+    m_size = size;
+}
+
 void PipeImpl::update_dynamic_address() {
     if (m_local != nullptr) {
         std::shared_ptr<ProgramImpl> program = m_program.lock();
@@ -0,0 +1,616 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdint>
+#include <cstdlib>
+#include <cerrno>
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+#include <memory>
+#include <variant>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+
+#include "core/api.hpp"
+#include "core/impl.hpp"
+#include "core/util.hpp"
+
+namespace ronin {
+namespace tanto {
+namespace host {
+
+namespace {
+
+// upper bound for frame counts, prevents overflow on large trip counts
+constexpr int64_t MAX_FRAMES = int64_t(1) << 40;
+
+uint32_t frames_to_size(int64_t frames, uint32_t frame_size) {
+    // clamp to largest whole number of frames that fits in 32 bits
+    int64_t max_frames = int64_t(UINT32_MAX / frame_size);
+    return uint32_t(std::min(frames, max_frames) * int64_t(frame_size));
+}
+
+bool parse_int(const std::string &src, int64_t &value) {
+    value = 0;
+    if (src.empty()) {
+        return false;
+    }
+    errno = 0;
+    char *end = nullptr;
+    long long temp = strtoll(src.c_str(), &end, 10);
+    if (errno != 0 || *end != '\0') {
+        errno = 0;
+        return false;
+    }
+    value = int64_t(temp);
+    return true;
+}
+
+bool parse_loops(const std::string &src, std::vector<int> &loops) {
+    loops.clear();
+    if (src == "-") {
+        return true;
+    }
+    std::stringstream ss(src);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        int64_t id = 0;
+        if (!parse_int(item, id) || id <= 0) {
+            return false;
+        }
+        loops.push_back(int(id));
+    }
+    return !loops.empty();
+}
+
+std::string get_base_name(const std::string &path) {
+    size_t pos = path.find_last_of('/');
+    return (pos != std::string::npos) ? path.substr(pos + 1) : path;
+}
+
+size_t common_prefix(const std::vector<int> &loops1, const std::vector<int> &loops2) {
+    size_t n = std::min(loops1.size(), loops2.size());
+    size_t i = 0;
+    while (i < n && loops1[i] == loops2[i]) {
+        i++;
+    }
+    return i;
+}
+
+} // namespace
+
+//
+//    PipeReport
+//
+
+PipeReport::PipeReport() { }
+
+PipeReport::~PipeReport() { }
+
+void PipeReport::load(const std::string &path) {
+    std::ifstream stream(path);
+    if (!stream) {
+        throw Error("Cannot open pipe report file");
+    }
+    std::stringstream ss;
+    ss << stream.rdbuf();
+    parse(ss.str());
+}
+
+void PipeReport::parse(const std::string &text) {
+    m_pipes.clear();
+    m_loops.clear();
+    m_ops.clear();
+    std::stringstream lines(text);
+    std::string line;
+    while (std::getline(lines, line)) {
+        std::stringstream ss(line);
+        std::string tag;
+        if (!(ss >> tag) || tag[0] == '#') {
+            continue;
+        }
+        std::vector<std::string> items;
+        std::string item;
+        while (ss >> item) {
+            items.push_back(item);
+        }
+        if (tag == "pipe") {
+            int64_t index = 0;
+            if (items.size() != 3 || !parse_int(items[0], index) || index < 0) {
+                throw Error("Invalid pipe entry in pipe report");
+            }
+            int64_t frame = 0;
+            if (items[2] == "-") {
+                frame = 0;
+            } else if (items[2] == "?") {
+                frame = -1;
+            } else if (!parse_int(items[2], frame) || frame <= 0) {
+                throw Error("Invalid pipe frame in pipe report");
+            }
+            m_pipes.push_back(PipeEntry{uint32_t(index), items[1], int(frame)});
+        } else if (tag == "loop") {
+            int64_t id = 0;
+            if (items.size() != 2 || !parse_int(items[0], id) || id <= 0) {
+                throw Error("Invalid loop entry in pipe report");
+            }
+            LoopEntry loop{-1, -1};
+            const std::string &trip = items[1];
+            int64_t value = 0;
+            if (trip == "?") {
+                // unknown
+            } else if (trip[0] == '$') {
+                if (!parse_int(trip.substr(1), value) || value < 0) {
+                    throw Error("Invalid loop trip count in pipe report");
+                }
+                loop.param = int(value);
+            } else if (parse_int(trip, value) && value >= 0) {
+                loop.trip = value;
+            } else {
+                throw Error("Invalid loop trip count in pipe report");
+            }
+            m_loops[int(id)] = loop;
+        } else if (tag == "op") {
+            int64_t index = 0;
+            int64_t count = 0;
+            std::vector<int> loops;
+            if ((items.size() != 4 && items.size() != 5) ||
+                    !parse_int(items[0], index) || index < 0 ||
+                    (items[1] != "push" && items[1] != "pop") ||
+                    !parse_int(items[2], count) || count <= 0 ||
+                    !parse_loops(items[3], loops) ||
+                    (items.size() == 5 && items[4] != "cond")) {
+                throw Error("Invalid op entry in pipe report");
+            }
+            bool cond = (items.size() == 5);
+            m_ops.push_back(
+                OpEntry{uint32_t(index), (items[1] == "push"), uint32_t(count), loops, cond});
+        } else {
+            throw Error("Invalid entry in pipe report");
+        }
+    }
+    for (OpEntry &op: m_ops) {
+        for (int id: op.loops) {
+            if (m_loops.find(id) == m_loops.end()) {
+                throw Error("Undefined loop in pipe report");
+            }
+        }
+    }
+}
+
+const PipeReport::LoopEntry &PipeReport::loop(int id) {
+    auto it = m_loops.find(id);
+    if (it == m_loops.end()) {
+        throw Error("Undefined loop in pipe report");
+    }
+    return it->second;
+}
+
+//
+//    PipeChecker
+//
+//    Frame counts are derived from the pipe reports of all kernels bound
+//    to a pipe, with loop trip counts resolved from the kernel arguments of
+//    each core range. For each producer/consumer pair on overlapping ranges:
+//
+//    - minimum depth to avoid stalls is the sum of the largest producer and
+//        consumer bursts (frames pushed or popped in one iteration of
+//        the innermost loop), i.e. 2 frames for simple double buffering
+//    - maximum useful depth is the total number of frames pushed
+//    - if the producer pushes N frames to a pipe before the first push to
+//        another pipe shared with the same consumer, and the consumer pops
+//        only M frames of the first pipe before it waits for the second one,
+//        the first pipe needs at least (N - M) frames of depth, otherwise both
+//        kernels block forever
+//
+//    Conditional operations may be skipped: they count as zero frames
+//    for the minimum depth and as always executed for the maximum depth
+//    and for deadlock diagnostics.
+//
+//    Kernels that wait for each other with the very first pipe operation
+//    are reported as deadlocked regardless of pipe depths.
+//
+
+PipeChecker::PipeChecker() { }
+
+PipeChecker::~PipeChecker() { }
+
+void PipeChecker::run(
+        const std::vector<std::shared_ptr<PipeImpl>> &pipes,
+        const std::vector<std::shared_ptr<KernelImpl>> &kernels) {
+    reset();
+    make_instances(kernels);
+    for (const std::shared_ptr<PipeImpl> &pipe: pipes) {
+        check_pipe(pipe.get());
+    }
+    check_cycles();
+}
+
+uint32_t PipeChecker::min_size(PipeImpl *pipe) {
+    auto it = m_bounds.find(pipe);
+    if (it == m_bounds.end() || it->second.min_frames <= 0) {
+        return 0;
+    }
+    const Bounds &bounds = it->second;
+    return frames_to_size(bounds.min_frames, bounds.frame_size);
+}
+
+uint32_t PipeChecker::max_size(PipeImpl *pipe) {
+    auto it = m_bounds.find(pipe);
+    if (it == m_bounds.end() || it->second.max_unknown || it->second.max_frames <= 0) {
+        return 0;
+    }
+    const Bounds &bounds = it->second;
+    return frames_to_size(bounds.max_frames, bounds.frame_size);
+}
+
+void PipeChecker::reset() {
+    m_instances.clear();
+    m_bounds.clear();
+    m_diags.clear();
+}
+
+void PipeChecker::make_instances(const std::vector<std::shared_ptr<KernelImpl>> &kernels) {
+    for (const std::shared_ptr<KernelImpl> &kernel: kernels) {
+        PipeReport *report = kernel->pipe_report().get();
+        if (report == nullptr) {
+            continue;
+        }
+        int range_count = kernel->range_args_count();
+        for (int i = 0; i < range_count; i++) {
+            const std::vector<KernelArg> &args = kernel->args_at(i);
+            Instance inst{kernel.get(), report, i, {}};
+            for (const PipeReport::PipeEntry &entry: report->pipes()) {
+                if (entry.index >= args.size() || 
+                        !std::holds_alternative<Pipe>(args[entry.index])) {
+                    throw Error("Pipe report does not match kernel arguments");
+                }
+                inst.pipes[entry.index] = std::get<Pipe>(args[entry.index]).impl().get();
+            }
+            for (const PipeReport::OpEntry &op: report->ops()) {
+                if (inst.pipes.find(op.index) == inst.pipes.end()) {
+                    throw Error("Pipe report does not match kernel arguments");
+                }
+            }
+            m_instances.push_back(inst);
+        }
+    }
+}
+
+void PipeChecker::check_pipe(PipeImpl *pipe) {
+    std::vector<Instance *> producers;
+    std::vector<Instance *> consumers;
+    for (Instance &inst: m_instances) {
+        if (has_op(inst, pipe, true)) {
+            producers.push_back(&inst);
+        }
+        if (has_op(inst, pipe, false)) {
+            consumers.push_back(&inst);
+        }
+    }
+    if (producers.empty() && consumers.empty()) {
+        return;
+    }
+    Bounds bounds{pipe->frame_size(), 0, 0, false};
+    // consistency of frame sizes
+    int frame = 0;
+    for (Instance *inst: producers) {
+        frame = std::max(frame, get_frame(*inst, pipe));
+    }
+    for (Instance *inst: consumers) {
+        frame = std::max(frame, get_frame(*inst, pipe));
+    }
+    if (frame > 0) {
+        bounds.frame_size = uint32_t(frame);
+    }
+    std::vector<Instance *> users(producers);
+    users.insert(users.end(), consumers.begin(), consumers.end());
+    for (Instance *inst: users) {
+        int f = get_frame(*inst, pipe);
+        if (f > 0 && uint32_t(f) != bounds.frame_size) {
+            m_diags.push_back(
+                "Frame size mismatch: " + kernel_name(*inst) + " uses " + 
+                    std::to_string(f) + " tiles per frame of " + pipe_name(pipe) + 
+                    " but " + std::to_string(bounds.frame_size) + " is used elsewhere");
+        }
+    }
+    if (bounds.frame_size == 0) {
+        return;
+    }
+    uint32_t depth = pipe->size() / bounds.frame_size;
+    if (consumers.empty()) {
+        for (Instance *inst: producers) {
+            int64_t total = get_total(*inst, pipe, true);
+            if (total < 0 || total > int64_t(depth)) {
+                m_diags.push_back(
+                    "Potential deadlock: " + pipe_name(pipe) + " has no consumer and " + 
+                        kernel_name(*inst) + " may block on it");
+            }
+        }
+        return;
+    }
+    if (producers.empty()) {
+        for (Instance *inst: consumers) {
+            m_diags.push_back(
+                "Potential deadlock: " + pipe_name(pipe) + " has no producer and " + 
+                    kernel_name(*inst) + " may block on it");
+        }
+        return;
+    }
+    for (Instance *producer: producers) {
+        for (Instance *consumer: consumers) {
+            if (producer != consumer && ranges_overlap(*producer, *consumer)) {
+                check_pair(pipe, *producer, *consumer, bounds);
+            }
+        }
+    }
+    m_bounds[pipe] = bounds;
+}
+
+void PipeChecker::check_pair(
+        PipeImpl *pipe, 
+        Instance &producer, 
+        Instance &consumer, 
+        Bounds &bounds) {
+    int64_t burst = get_burst(producer, pipe, true) + get_burst(consumer, pipe, false);
+    bounds.min_frames = std::max(bounds.min_frames, burst);
+    int64_t total = get_total(producer, pipe, true);
+    if (total < 0) {
+        bounds.max_unknown = true;
+    } else {
+        bounds.max_frames = std::max(bounds.max_frames, total);
+    }
+    uint32_t depth = pipe->size() / bounds.frame_size;
+    // ordering against other pipes with same producer and consumer
+    std::set<PipeImpl *> others;
+    for (auto &entry: producer.pipes) {
+        PipeImpl *other = entry.second;
+        if (other != pipe && 
+                has_op(producer, other, true) && 
+                has_op(consumer, other, false)) {
+            others.insert(other);
+        }
+    }
+    for (PipeImpl *other: others) {
+        // worst case: most frames pushed, fewest frames popped
+        int64_t pushed = get_frames_before(producer, pipe, other, true, true);
+        int64_t popped = get_frames_before(consumer, pipe, other, false, false);
+        // depth required in every execution: conditional operations skipped
+        int64_t pushed_min = get_frames_before(producer, pipe, other, true, false);
+        int64_t popped_max = get_frames_before(consumer, pipe, other, false, true);
+        if (pushed_min >= 0 && popped_max >= 0 && pushed_min - popped_max > bounds.min_frames) {
+            bounds.min_frames = pushed_min - popped_max;
+        }
+        if (popped < 0) {
+            // consumer drains unknown number of frames first, assume enough
+            continue;
+        }
+        if (pushed < 0) {
+            m_diags.push_back(
+                "Potential deadlock: " + kernel_name(producer) + 
+                    " pushes unknown number of frames to " + pipe_name(pipe) + 
+                    " before " + pipe_name(other) + " while " + kernel_name(consumer) + 
+                    " pops " + std::to_string(popped));
+            continue;
+        }
+        int64_t required = pushed - popped;
+        if (required > int64_t(depth)) {
+            m_diags.push_back(
+                "Potential deadlock: " + pipe_name(pipe) + " needs depth of at least " +
+                    std::to_string(required) + " frames but has " + std::to_string(depth) +
+                    " (" + kernel_name(producer) + " pushes " + std::to_string(pushed) + 
+                    " frames before " + pipe_name(other) + ", " + kernel_name(consumer) + 
+                    " pops " + std::to_string(popped) + ")");
+        }
+    }
+}
+
+void PipeChecker::check_cycles() {
+    int count = int(m_instances.size());
+    std::vector<int> state(count, 0);
+    std::vector<int> path;
+    for (int i = 0; i < count; i++) {
+        if (state[i] == 0 && find_cycle(i, state, path)) {
+            std::string text = "Deadlock: kernels wait for each other before producing any frames:";
+            for (int k: path) {
+                text += " " + kernel_name(m_instances[k]);
+            }
+            m_diags.push_back(text);
+            return;
+        }
+    }
+}
+
+bool PipeChecker::find_cycle(int node, std::vector<int> &state, std::vector<int> &path) {
+    // state: 0 = not visited, 1 = on current path, 2 = done
+    state[node] = 1;
+    path.push_back(node);
+    Instance &inst = m_instances[node];
+    const PipeReport::OpEntry *op = first_op(inst);
+    // conditional first operation: kernel may proceed to other operations
+    if (op != nullptr && !op->push && !op->cond) {
+        PipeImpl *pipe = inst.pipes[op->index];
+        int count = int(m_instances.size());
+        for (int k = 0; k < count; k++) {
+            Instance &other = m_instances[k];
+            if (k == node || !ranges_overlap(inst, other) || !has_op(other, pipe, true)) {
+                continue;
+            }
+            const PipeReport::OpEntry *other_op = first_op(other);
+            if (other_op == nullptr || other_op->push || other_op->cond) {
+                continue;
+            }
+            if (state[k] == 1) {
+                path.erase(
+                    path.begin(), 
+                    std::find(path.begin(), path.end(), k));
+                return true;
+            }
+            if (state[k] == 0 && find_cycle(k, state, path)) {
+                return true;
+            }
+        }
+    }
+    path.pop_back();
+    state[node] = 2;
+    return false;
+}
+
+bool PipeChecker::has_op(Instance &inst, PipeImpl *pipe, bool push) {
+    for (const PipeReport::OpEntry &op: inst.report->ops()) {
+        if (op.push == push && inst.pipes[op.index] == pipe) {
+            return true;
+        }
+    }
+    return false;
+}
+
+const PipeReport::OpEntry *PipeChecker::first_op(Instance &inst) {
+    // ops inside loops with zero trip count are never executed
+    for (const PipeReport::OpEntry &op: inst.report->ops()) {
+        if (get_op_frames(inst, op, 0) != 0) {
+            return &op;
+        }
+    }
+    return nullptr;
+}
+
+int64_t PipeChecker::get_trip(Instance &inst, int loop_id) {
+    const PipeReport::LoopEntry &loop = inst.report->loop(loop_id);
+    if (loop.trip >= 0) {
+        return loop.trip;
+    }
+    if (loop.param >= 0) {
+        const std::vector<KernelArg> &args = inst.kernel->args_at(inst.range_index);
+        if (size_t(loop.param) < args.size() && 
+                std::holds_alternative<uint32_t>(args[loop.param])) {
+            return int64_t(std::get<uint32_t>(args[loop.param]));
+        }
+    }
+    return -1;
+}
+
+int64_t PipeChecker::get_op_frames(Instance &inst, const PipeReport::OpEntry &op, size_t skip) {
+    int64_t frames = op.count;
+    size_t n = op.loops.size();
+    for (size_t i = skip; i < n; i++) {
+        int64_t trip = get_trip(inst, op.loops[i]);
+        if (trip < 0) {
+            return -1;
+        }
+        frames = std::min(frames * trip, MAX_FRAMES);
+    }
+    return frames;
+}
+
+int64_t PipeChecker::get_burst(Instance &inst, PipeImpl *pipe, bool push) {
+    // contributes to minimum depth: conditional operations are skipped
+    int64_t burst = 0;
+    for (const PipeReport::OpEntry &op: inst.report->ops()) {
+        if (op.push == push && !op.cond && inst.pipes[op.index] == pipe) {
+            burst = std::max(burst, int64_t(op.count));
+        }
+    }
+    return burst;
+}
+
+int64_t PipeChecker::get_total(Instance &inst, PipeImpl *pipe, bool push) {
+    int64_t total = 0;
+    for (const PipeReport::OpEntry &op: inst.report->ops()) {
+        if (op.push == push && inst.pipes[op.index] == pipe) {
+            int64_t frames = get_op_frames(inst, op, 0);
+            if (frames < 0) {
+                return -1;
+            }
+            total = std::min(total + frames, MAX_FRAMES);
+        }
+    }
+    return total;
+}
+
+int64_t PipeChecker::get_frames_before(
+        Instance &inst, 
+        PipeImpl *pipe, 
+        PipeImpl *other, 
+        bool push,
+        bool upper) {
+    // upper bound: conditional operations of pipe are executed and
+    //     first transfer of other pipe is the latest possible one;
+    //     lower bound: vice versa
+    const std::vector<PipeReport::OpEntry> &ops = inst.report->ops();
+    size_t count = ops.size();
+    size_t stop = count;
+    for (size_t i = 0; i < count; i++) {
+        if (ops[i].push != push || inst.pipes[ops[i].index] != other) {
+            continue;
+        }
+        stop = i;
+        if (!upper || !ops[i].cond) {
+            break;
+        }
+    }
+    if (stop == count) {
+        return 0;
+    }
+    // frames of pipe transferred before the first transfer of other pipe
+    // within first iteration of their common loops
+    int64_t frames = 0;
+    for (size_t i = 0; i < stop; i++) {
+        const PipeReport::OpEntry &op = ops[i];
+        if (op.push != push || inst.pipes[op.index] != pipe || (!upper && op.cond)) {
+            continue;
+        }
+        size_t skip = common_prefix(op.loops, ops[stop].loops);
+        int64_t op_frames = get_op_frames(inst, op, skip);
+        if (op_frames < 0) {
+            return -1;
+        }
+        frames = std::min(frames + op_frames, MAX_FRAMES);
+    }
+    return frames;
+}
+
+int PipeChecker::get_frame(Instance &inst, PipeImpl *pipe) {
+    for (const PipeReport::PipeEntry &entry: inst.report->pipes()) {
+        if (inst.pipes[entry.index] == pipe) {
+            return entry.frame;
+        }
+    }
+    return 0;
+}
+
+bool PipeChecker::ranges_overlap(Instance &inst1, Instance &inst2) {
+    return range_overlap(
+        inst1.kernel->range_at(inst1.range_index), 
+        inst2.kernel->range_at(inst2.range_index));
+}
+
+std::string PipeChecker::kernel_name(Instance &inst) {
+    const Range &range = inst.kernel->range_at(inst.range_index);
+    return "kernel [" + get_base_name(inst.kernel->path()) + "] at (" +
+        std::to_string(range.x_start) + ", " + std::to_string(range.y_start) + ")";
+}
+
+std::string PipeChecker::pipe_name(PipeImpl *pipe) {
+    std::string name;
+    for (Instance &inst: m_instances) {
+        for (const PipeReport::PipeEntry &entry: inst.report->pipes()) {
+            if (inst.pipes[entry.index] == pipe) {
+                name = entry.name;
+                break;
+            }
+        }
+        if (!name.empty()) {
+            break;
+        }
+    }
+    return "pipe [" + name + "] (cb " + std::to_string(pipe->cbid()) + ")";
+}
+
+} // namespace host
+} // namespace tanto
+} // namespace ronin
+
@@ -3,10 +3,26 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include <cstdint>
+#include <string>
+#include <vector>
+#include <map>
 #include <memory>
+#include <algorithm>
 
 #include "core/api.hpp"
 #include "core/impl.hpp"
+#include "core/util.hpp"
+#include "core/metal.hpp"
+
+#ifdef METAL_057
+
+#include "tt-metalium/buffer.hpp"
+
+#else
+
+#include "tt_metal/impl/buffers/buffer.hpp"
+
+#endif
 
 namespace ronin {
 namespace tanto {
@@ -17,7 +33,10 @@ namespace host {
 //
 
 ProgramImpl::ProgramImpl(const std::shared_ptr<DeviceImpl> &device):
-        m_device(device) { }
+        m_device(device),
+        m_local_arena_version(0),
+        m_pipe_sizing(false),
+        m_pipes_sized(false) { }
 
 ProgramImpl::~ProgramImpl() { }
 
@@ -35,6 +54,8 @@ void ProgramImpl::add_grid(const std::shared_ptr<GridImpl> &grid) {
 
 void ProgramImpl::add_local(const std::shared_ptr<LocalImpl> &local) {
     m_locals.emplace_back(local);
+    std::shared_ptr<DeviceImpl> device = m_device.lock();
+    device->invalidate_local_arena();
 }
 
 void ProgramImpl::add_pipe(const std::shared_ptr<PipeImpl> &pipe) {
@@ -50,14 +71,35 @@ void ProgramImpl::add_kernel(const std::shared_ptr<KernelImpl> &kernel) {
 }
 
 void ProgramImpl::before_enqueue() {
-    for (auto &local: m_locals) {
-        if (local->scope() == LocalScope::PROGRAM) {
-            local->create_impl();
-            metal::AssignGlobalBufferToProgram(local->impl(), m_impl);
-        }
+    if (m_pipe_sizing && !m_pipes_sized) {
+        size_pipes();
+        m_pipes_sized = true;
     }
-    for (auto &pipe: m_pipes) {
-        pipe->update_dynamic_address();
+    std::shared_ptr<DeviceImpl> device = m_device.lock();
+    uint32_t version = device->update_local_arena();
+    if (!device->local_arena_enabled()) {
+        // arena disabled: locals are allocated for this launch only
+        for (auto &local: m_locals) {
+            if (local->scope() == LocalScope::PROGRAM) {
+                local->create_impl();
+                metal::AssignGlobalBufferToProgram(local->impl(), m_impl);
+            }
+        }
+        for (auto &pipe: m_pipes) {
+            pipe->update_dynamic_address();
+        }
+        m_local_arena_version = 0;
+    } else if (version != m_local_arena_version) {
+        // locals were (re)placed: keep arena alive while program is in flight
+        //     and bind pipes to new local addresses
+        std::shared_ptr<metal::Buffer> arena = m_local_arena.lock();
+        if (arena != nullptr) {
+            metal::AssignGlobalBufferToProgram(arena, m_impl);
+        }
+        for (auto &pipe: m_pipes) {
+            pipe->update_dynamic_address();
+        }
+        m_local_arena_version = version;
     }
     for (auto &kernel: m_kernels) {
         kernel->set_args_impl();
@@ -65,6 +107,10 @@ void ProgramImpl::before_enqueue() {
 }
 
 void ProgramImpl::after_enqueue() {
+    std::shared_ptr<DeviceImpl> device = m_device.lock();
+    if (device->local_arena_enabled()) {
+        return;
+    }
     for (auto &local: m_locals) {
         if (local->scope() == LocalScope::PROGRAM) {
             local->release_impl();
@@ -72,10 +118,172 @@ void ProgramImpl::after_enqueue() {
     }
 }
 
+bool ProgramImpl::is_bound() {
+    if (m_pipe_sizing && !m_pipes_sized) {
+        return false;
+    }
+    std::shared_ptr<DeviceImpl> device = m_device.lock();
+    return (m_local_arena_version != 0 && m_local_arena_version == device->local_arena_version());
+}
+
+bool ProgramImpl::conflicts_with(const std::shared_ptr<ProgramImpl> &other) {
+    std::vector<Range> ranges1;
+    std::vector<Range> ranges2;
+    get_core_ranges(ranges1);
+    other->get_core_ranges(ranges2);
+    for (const Range &range1: ranges1) {
+        for (const Range &range2: ranges2) {
+            if (range_overlap(range1, range2)) {
+                return true;
+            }
+        }
+    }
+    // kernels are assumed to access device memory only via global buffer arguments;
+    //     overlapping buffers conflict unless both programs only read them
+    std::vector<GlobalUse> buffers1;
+    std::vector<GlobalUse> buffers2;
+    get_global_buffers(buffers1);
+    other->get_global_buffers(buffers2);
+    for (const GlobalUse &use1: buffers1) {
+        metal::Buffer *buffer1 = use1.buffer;
+        uint64_t start1 = buffer1->address();
+        uint64_t end1 = start1 + buffer1->size();
+        for (const GlobalUse &use2: buffers2) {
+            metal::Buffer *buffer2 = use2.buffer;
+            if (buffer1->buffer_type() != buffer2->buffer_type()) {
+                continue;
+            }
+            if (((use1.access | use2.access) & GLOBAL_ACCESS_WRITE) == 0) {
+                continue;
+            }
+            uint64_t start2 = buffer2->address();
+            uint64_t end2 = start2 + buffer2->size();
+            if (start1 < end2 && start2 < end1) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+std::vector<std::string> ProgramImpl::check_pipes() {
+    PipeChecker checker;
+    checker.run(m_pipes, m_kernels);
+    return checker.diags();
+}
+
+void ProgramImpl::resize_pipes() {
+    PipeChecker checker;
+    checker.run(m_pipes, m_kernels);
+    for (auto &pipe: m_pipes) {
+        if (pipe->has_local()) {
+            // size is defined by local buffer
+            continue;
+        }
+        uint32_t min_size = checker.min_size(pipe.get());
+        if (min_size == 0) {
+            continue;
+        }
+        uint32_t frame_size = pipe->frame_size();
+        uint32_t size = std::max(pipe->size(), min_size);
+        uint32_t max_size = checker.max_size(pipe.get());
+        if (max_size != 0) {
+            size = std::min(size, std::max(max_size, min_size));
+        }
+        // round up to whole frames
+        size = (size + frame_size - 1) / frame_size * frame_size;
+        pipe->resize(size);
+    }
+}
+
+void ProgramImpl::size_pipes() {
+    // sizes are chosen for kernel arguments set before first launch;
+    //     diagnostics left after resizing cannot be resolved by pipe depth
+    resize_pipes();
+    if (!check_pipes().empty()) {
+        throw Error("Pipe check failed (see Program::check_pipes)");
+    }
+}
+
+uint32_t ProgramImpl::local_arena_size() {
+    uint32_t size = 0;
+    for (auto &local: m_locals) {
+        if (local->scope() == LocalScope::PROGRAM) {
+            size += local->bytes();
+        }
+    }
+    return size;
+}
+
+void ProgramImpl::get_local_cores(CoreSet &cores) {
+    for (auto &local: m_locals) {
+        if (local->scope() != LocalScope::PROGRAM) {
+            continue;
+        }
+        std::shared_ptr<GridImpl> grid = local->grid();
+        int count = grid->range_count();
+        for (int i = 0; i < count; i++) {
+            Range range = grid->range_at(i);
+            for (uint32_t y = range.y_start; y <= range.y_end; y++) {
+                for (uint32_t x = range.x_start; x <= range.x_end; x++) {
+                    cores.emplace(x, y);
+                }
+            }
+        }
+    }
+}
+
+void ProgramImpl::place_locals(const std::shared_ptr<metal::Buffer> &arena) {
+    // locals of one program are disjoint; programs share arena
+    //     as they are never resident at the same time
+    m_local_arena = arena;
+    uint32_t base = (arena != nullptr) ? uint32_t(arena->address()) : 0;
+    uint32_t offset = 0;
+    for (auto &local: m_locals) {
+        if (local->scope() == LocalScope::PROGRAM) {
+            local->place_impl(base + offset);
+            offset += local->bytes();
+        }
+    }
+    m_local_arena_version = 0;
+}
+
 void ProgramImpl::create_impl() {
     m_impl = metal::CreateProgram();
 }
 
+void ProgramImpl::get_core_ranges(std::vector<Range> &ranges) {
+    ranges.clear();
+    for (auto &grid: m_grids) {
+        int count = grid->range_count();
+        for (int i = 0; i < count; i++) {
+            ranges.push_back(grid->range_at(i));
+        }
+    }
+}
+
+void ProgramImpl::get_global_buffers(std::vector<GlobalUse> &buffers) {
+    std::map<metal::Buffer *, uint32_t> access;
+    for (auto &kernel: m_kernels) {
+        int count = kernel->range_args_count();
+        for (int i = 0; i < count; i++) {
+            const std::vector<KernelArg> &args = kernel->args_at(i);
+            int args_count = int(args.size());
+            for (int k = 0; k < args_count; k++) {
+                const KernelArg &arg = args[k];
+                if (std::holds_alternative<Global>(arg)) {
+                    const Global &global = std::get<Global>(arg);
+                    access[global.impl()->impl().get()] |= kernel->global_access(k);
+                }
+            }
+        }
+    }
+    buffers.clear();
+    for (auto &entry: access) {
+        buffers.push_back(GlobalUse{entry.first, entry.second});
+    }
+}
+
 } // namespace host
 } // namespace tanto
 } // namespace ronin
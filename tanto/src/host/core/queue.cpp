@@ -3,7 +3,10 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include <cstdint>
+#include <cstring>
 #include <memory>
+#include <vector>
+#include <algorithm>
 
 #include "core/api.hpp"
 #include "core/impl.hpp"
@@ -26,7 +29,9 @@ namespace host {
 QueueImpl::QueueImpl(const std::shared_ptr<DeviceImpl> &device, uint32_t id):
         m_device(device),
         m_id(id),
-        m_impl(nullptr) { }
+        m_impl(nullptr),
+        m_trace_active(false),
+        m_trace_id(0) { }
 
 QueueImpl::~QueueImpl() { }
 
@@ -36,6 +41,9 @@ std::shared_ptr<QueueImpl> QueueImpl::create(
     if (queue != nullptr) {
         return queue;
     }
+    if (id >= uint32_t(device->impl()->num_hw_cqs())) {
+        throw Error("Queue ID exceeds number of device command queues");
+    }
     queue = std::make_shared<QueueImpl>(device, id);
     device->add_queue(queue);
     queue->create_impl();
@@ -46,6 +54,7 @@ void QueueImpl::enqueue_read(
         const std::shared_ptr<GlobalImpl> &global, 
         void *dst,
         bool blocking) {
+    check_not_capturing("Cannot read global buffer during capture");
     metal::EnqueueReadBuffer(*m_impl, global->impl(), dst, blocking);
 }
 
@@ -53,11 +62,112 @@ void QueueImpl::enqueue_write(
         const std::shared_ptr<GlobalImpl> &global, 
         const void *src,
         bool blocking) {
+    check_not_capturing("Cannot write global buffer during capture");
     metal::EnqueueWriteBuffer(*m_impl, global->impl(), src, blocking);
 }
 
+void QueueImpl::enqueue_read_range(
+        const std::shared_ptr<GlobalImpl> &global,
+        uint32_t offset,
+        uint32_t bytes,
+        void *dst,
+        bool blocking) {
+    std::vector<Span> spans{{offset, bytes, static_cast<uint8_t *>(dst)}};
+    read_spans(global, spans, blocking);
+}
+
+void QueueImpl::enqueue_write_range(
+        const std::shared_ptr<GlobalImpl> &global,
+        uint32_t offset,
+        uint32_t bytes,
+        const void *src,
+        bool blocking) {
+    // write spans never modify host memory
+    uint8_t *host = static_cast<uint8_t *>(const_cast<void *>(src));
+    std::vector<Span> spans{{offset, bytes, host}};
+    write_spans(global, spans, blocking);
+}
+
+void QueueImpl::enqueue_read_pages(
+        const std::shared_ptr<GlobalImpl> &global,
+        uint32_t first_page,
+        uint32_t page_count,
+        void *dst,
+        bool blocking) {
+    uint32_t page_bytes = global->page_bytes();
+    if ((uint64_t(first_page) + page_count) * page_bytes > global->bytes()) {
+        throw Error("Page range exceeds global buffer size");
+    }
+    enqueue_read_range(
+        global, 
+        first_page * page_bytes, 
+        page_count * page_bytes, 
+        dst, 
+        blocking);
+}
+
+void QueueImpl::enqueue_write_pages(
+        const std::shared_ptr<GlobalImpl> &global,
+        uint32_t first_page,
+        uint32_t page_count,
+        const void *src,
+        bool blocking) {
+    uint32_t page_bytes = global->page_bytes();
+    if ((uint64_t(first_page) + page_count) * page_bytes > global->bytes()) {
+        throw Error("Page range exceeds global buffer size");
+    }
+    enqueue_write_range(
+        global, 
+        first_page * page_bytes, 
+        page_count * page_bytes, 
+        src, 
+        blocking);
+}
+
+void QueueImpl::enqueue_read_strided(
+        const std::shared_ptr<GlobalImpl> &global,
+        uint32_t offset,
+        uint32_t stride,
+        uint32_t row_bytes,
+        uint32_t row_count,
+        void *dst,
+        bool blocking) {
+    std::vector<Span> spans = 
+        make_strided_spans(
+            offset, 
+            stride, 
+            row_bytes, 
+            row_count, 
+            static_cast<uint8_t *>(dst));
+    read_spans(global, spans, blocking);
+}
+
+void QueueImpl::enqueue_write_strided(
+        const std::shared_ptr<GlobalImpl> &global,
+        uint32_t offset,
+        uint32_t stride,
+        uint32_t row_bytes,
+        uint32_t row_count,
+        const void *src,
+        bool blocking) {
+    std::vector<Span> spans = 
+        make_strided_spans(
+            offset, 
+            stride, 
+            row_bytes, 
+            row_count, 
+            static_cast<uint8_t *>(const_cast<void *>(src)));
+    write_spans(global, spans, blocking);
+}
+
 void QueueImpl::enqueue_program(
         const std::shared_ptr<ProgramImpl> &program, bool blocking) {
+    if (m_graph != nullptr) {
+        // captured programs are launched by 'enqueue_graph'
+        m_graph->add_program(program);
+        return;
+    }
+    check_bound(program);
     program->before_enqueue();
     metal::EnqueueProgram(*m_impl, program->impl(), blocking);
     program->after_enqueue();
@@ -67,11 +177,332 @@ void QueueImpl::finish() {
     metal::Finish(*m_impl);
 }
 
+uint32_t QueueImpl::begin_trace() {
+    check_not_capturing("Capture is already active");
+    std::shared_ptr<DeviceImpl> device = m_device.lock();
+    m_trace_id = metal::BeginTraceCapture(device->impl(), uint8_t(m_id));
+    m_trace_active = true;
+    return m_trace_id;
+}
+
+void QueueImpl::end_trace() {
+    if (!m_trace_active) {
+        throw Error("Trace capture is not active");
+    }
+    std::shared_ptr<DeviceImpl> device = m_device.lock();
+    metal::EndTraceCapture(device->impl(), uint8_t(m_id), m_trace_id);
+    m_trace_active = false;
+}
+
+void QueueImpl::replay_trace(uint32_t trace_id, bool blocking) {
+    check_not_capturing("Cannot replay trace during capture");
+    std::shared_ptr<DeviceImpl> device = m_device.lock();
+    metal::ReplayTrace(device->impl(), uint8_t(m_id), trace_id, blocking);
+}
+
+void QueueImpl::release_trace(uint32_t trace_id) {
+    check_not_capturing("Cannot release trace during capture");
+    std::shared_ptr<DeviceImpl> device = m_device.lock();
+    metal::ReleaseTrace(device->impl(), trace_id);
+}
+
+void QueueImpl::record_event(const std::shared_ptr<EventImpl> &event) {
+    check_not_capturing("Cannot record event during capture");
+    metal::EnqueueRecordEvent(*m_impl, event->impl());
+}
+
+void QueueImpl::wait_event(const std::shared_ptr<EventImpl> &event) {
+    if (m_graph != nullptr) {
+        throw Error("Cannot wait for event during graph capture");
+    }
+    metal::EnqueueWaitForEvent(*m_impl, event->impl());
+}
+
+void QueueImpl::begin_graph(const std::shared_ptr<GraphImpl> &graph) {
+    check_not_capturing("Capture is already active");
+    if (graph->device() != m_device.lock()) {
+        throw Error("Graph and queue belong to different devices");
+    }
+    m_graph = graph;
+}
+
+void QueueImpl::end_graph() {
+    if (m_graph == nullptr) {
+        throw Error("Graph capture is not active");
+    }
+    m_graph.reset();
+}
+
+void QueueImpl::enqueue_graph(const std::shared_ptr<GraphImpl> &graph, bool blocking) {
+    if (m_graph != nullptr) {
+        throw Error("Cannot enqueue graph during graph capture");
+    }
+    uint32_t count = graph->program_count();
+    for (uint32_t i = 0; i < count; i++) {
+        const std::shared_ptr<ProgramImpl> &program = graph->program_at(i);
+        check_bound(program);
+        program->before_enqueue();
+    }
+#ifdef METAL_057
+    // metal dispatcher runs consecutive programs back to back
+    //     and stalls only when worker resources must be recycled
+    for (uint32_t i = 0; i < count; i++) {
+        metal::EnqueueProgram(*m_impl, graph->program_at(i)->impl(), false);
+    }
+    if (blocking) {
+        metal::Finish(*m_impl);
+    }
+#else
+    std::vector<metal::Program *> programs;
+    for (uint32_t i = 0; i < count; i++) {
+        programs.push_back(&graph->program_at(i)->impl());
+    }
+    std::vector<bool> barriers = graph->make_barriers();
+    metal::EnqueueProgramChain(*m_impl, programs, barriers, blocking);
+#endif
+    for (uint32_t i = 0; i < count; i++) {
+        graph->program_at(i)->after_enqueue();
+    }
+}
+
 void QueueImpl::create_impl() {
     std::shared_ptr<DeviceImpl> device = m_device.lock();
     m_impl = &device->impl()->command_queue(m_id);
 }
 
+void QueueImpl::check_bound(const std::shared_ptr<ProgramImpl> &program) {
+    if (!m_trace_active || program->is_bound()) {
+        return;
+    }
+    // binding may allocate device memory and must precede capture
+    if (!program->device()->local_arena_enabled() && program->local_arena_size() != 0) {
+        throw Error("Program scope local buffers require local arena during trace capture");
+    }
+    throw Error("Program must be enqueued once before trace capture");
+}
+
+void QueueImpl::check_not_capturing(const char *what) {
+    if (m_trace_active || m_graph != nullptr) {
+        throw Error(what);
+    }
+}
+
+//
+//    Sub-range transfers
+//
+//    Metal transfers buffer regions at page granularity. Page aligned spans
+//    map directly onto sub-buffer commands; pages covering unaligned spans
+//    are merged into runs and staged in host bounce buffer. Writes of
+//    unaligned spans read-modify-write edge pages: caller must ensure that
+//    no other queue updates these pages concurrently.
+//
+
+void QueueImpl::read_spans(
+        const std::shared_ptr<GlobalImpl> &global,
+        const std::vector<Span> &spans,
+        bool blocking) {
+    check_not_capturing("Cannot read global buffer during capture");
+    validate_spans(global, spans);
+    uint32_t page_bytes = global->page_bytes();
+    for (const Span &span: spans) {
+        if (span.bytes != 0 && is_page_aligned(span, page_bytes)) {
+            metal::EnqueueReadSubBuffer(
+                *m_impl, 
+                global->impl(), 
+                span.host, 
+                metal::BufferRegion(span.offset, span.bytes), 
+                false);
+        }
+    }
+    std::vector<PageRun> runs;
+    uint32_t bounce_bytes = make_page_runs(spans, page_bytes, runs);
+    if (runs.empty()) {
+        if (blocking) {
+            metal::Finish(*m_impl);
+        }
+        return;
+    }
+    // unaligned spans are copied out of bounce buffer: always blocking
+    std::vector<uint8_t> bounce(bounce_bytes);
+    read_page_runs(global, runs, bounce.data());
+    metal::Finish(*m_impl);
+    for (const Span &span: spans) {
+        if (span.bytes == 0 || is_page_aligned(span, page_bytes)) {
+            continue;
+        }
+        const PageRun &run = find_page_run(runs, span.offset / page_bytes);
+        uint32_t pos = run.bounce_offset + span.offset - run.first_page * page_bytes;
+        memcpy(span.host, bounce.data() + pos, span.bytes);
+    }
+}
+
+void QueueImpl::write_spans(
+        const std::shared_ptr<GlobalImpl> &global,
+        const std::vector<Span> &spans,
+        bool blocking) {
+    check_not_capturing("Cannot write global buffer during capture");
+    validate_spans(global, spans);
+    uint32_t page_bytes = global->page_bytes();
+    // metal copies source data at enqueue time: no need to keep host memory
+    for (const Span &span: spans) {
+        if (span.bytes != 0 && is_page_aligned(span, page_bytes)) {
+            metal::EnqueueWriteSubBuffer(
+                *m_impl, 
+                global->impl(), 
+                static_cast<const void *>(span.host), 
+                metal::BufferRegion(span.offset, span.bytes), 
+                false);
+        }
+    }
+    std::vector<PageRun> runs;
+    uint32_t bounce_bytes = make_page_runs(spans, page_bytes, runs);
+    if (!runs.empty()) {
+        std::vector<uint8_t> bounce(bounce_bytes);
+        read_page_runs(global, runs, bounce.data());
+        metal::Finish(*m_impl);
+        for (const Span &span: spans) {
+            if (span.bytes == 0 || is_page_aligned(span, page_bytes)) {
+                continue;
+            }
+            const PageRun &run = find_page_run(runs, span.offset / page_bytes);
+            uint32_t pos = run.bounce_offset + span.offset - run.first_page * page_bytes;
+            memcpy(bounce.data() + pos, span.host, span.bytes);
+        }
+        for (const PageRun &run: runs) {
+            metal::EnqueueWriteSubBuffer(
+                *m_impl, 
+                global->impl(), 
+                static_cast<const void *>(bounce.data() + run.bounce_offset), 
+                metal::BufferRegion(
+                    run.first_page * page_bytes, 
+                    (run.end_page - run.first_page) * page_bytes), 
+                false);
+        }
+    }
+    if (blocking) {
+        metal::Finish(*m_impl);
+    }
+}
+
+void QueueImpl::read_page_runs(
+        const std::shared_ptr<GlobalImpl> &global, 
+        const std::vector<PageRun> &runs,
+        uint8_t *bounce) {
+    uint32_t page_bytes = global->page_bytes();
+    for (const PageRun &run: runs) {
+        metal::EnqueueReadSubBuffer(
+            *m_impl, 
+            global->impl(), 
+            bounce + run.bounce_offset, 
+            metal::BufferRegion(
+                run.first_page * page_bytes, 
+                (run.end_page - run.first_page) * page_bytes), 
+            false);
+    }
+}
+
+void QueueImpl::validate_spans(
+        const std::shared_ptr<GlobalImpl> &global,
+        const std::vector<Span> &spans) {
+    if (global->dist() != GlobalDist::LINEAR) {
+        throw Error("Sub-range transfers require linear global buffer");
+    }
+    uint64_t global_bytes = global->bytes();
+    for (const Span &span: spans) {
+        if (uint64_t(span.offset) + uint64_t(span.bytes) > global_bytes) {
+            throw Error("Transfer range exceeds global buffer size");
+        }
+    }
+}
+
+bool QueueImpl::is_page_aligned(const Span &span, uint32_t page_bytes) {
+    return (span.offset % page_bytes == 0 && span.bytes % page_bytes == 0);
+}
+
+uint32_t QueueImpl::make_page_runs(
+        const std::vector<Span> &spans,
+        uint32_t page_bytes,
+        std::vector<PageRun> &runs) {
+    runs.clear();
+    for (const Span &span: spans) {
+        if (span.bytes == 0 || is_page_aligned(span, page_bytes)) {
+            continue;
+        }
+        uint32_t first_page = span.offset / page_bytes;
+        uint32_t end_page = (span.offset + span.bytes + page_bytes - 1) / page_bytes;
+        runs.push_back(PageRun{first_page, end_page, 0});
+    }
+    if (runs.empty()) {
+        return 0;
+    }
+    std::sort(runs.begin(), runs.end(), 
+        [](const PageRun &a, const PageRun &b) {
+            return (a.first_page < b.first_page);
+        });
+    // merge overlapping and adjacent runs
+    size_t count = 0;
+    for (size_t i = 1; i < runs.size(); i++) {
+        PageRun &last = runs[count];
+        if (runs[i].first_page <= last.end_page) {
+            last.end_page = std::max(last.end_page, runs[i].end_page);
+        } else {
+            count++;
+            runs[count] = runs[i];
+        }
+    }
+    runs.resize(count + 1);
+    uint32_t bounce_bytes = 0;
+    for (PageRun &run: runs) {
+        run.bounce_offset = bounce_bytes;
+        bounce_bytes += (run.end_page - run.first_page) * page_bytes;
+    }
+    return bounce_bytes;
+}
+
+const QueueImpl::PageRun &QueueImpl::find_page_run(
+        const std::vector<PageRun> &runs, 
+        uint32_t page) {
+    // runs are sorted and disjoint; page is known to be covered
+    auto it = 
+        std::upper_bound(runs.begin(), runs.end(), page, 
+            [](uint32_t page, const PageRun &run) {
+                return (page < run.first_page);
+            });
+    return *(it - 1);
+}
+
+std::vector<QueueImpl::Span> QueueImpl::make_strided_spans(
+        uint32_t offset,
+        uint32_t stride,
+        uint32_t row_bytes,
+        uint32_t row_count,
+        uint8_t *host) {
+    if (row_count > 1 && stride < row_bytes) {
+        throw Error("Stride is less than row size");
+    }
+    std::vector<Span> spans;
+    if (row_count == 0 || row_bytes == 0) {
+        return spans;
+    }
+    if (stride == row_bytes) {
+        // dense rows form single span
+        uint64_t bytes = uint64_t(row_bytes) * uint64_t(row_count);
+        if (bytes > UINT32_MAX) {
+            throw Error("Transfer range exceeds global buffer size");
+        }
+        spans.push_back(Span{offset, uint32_t(bytes), host});
+        return spans;
+    }
+    if (uint64_t(offset) + uint64_t(stride) * uint64_t(row_count - 1) > UINT32_MAX) {
+        throw Error("Transfer range exceeds global buffer size");
+    }
+    spans.reserve(row_count);
+    for (uint32_t i = 0; i < row_count; i++) {
+        spans.push_back(Span{offset + i * stride, row_bytes, host + i * row_bytes});
+    }
+    return spans;
+}
+
 } // namespace host
 } // namespace tanto
 } // namespace ronin
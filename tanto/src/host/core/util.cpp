@@ -40,6 +40,32 @@ uint32_t get_item_bytes(DataFormat data_format) {
     }
 }
 
+bool is_block_float(DataFormat data_format) {
+    return (data_format == DataFormat::BFP8_B || data_format == DataFormat::BFP4_B);
+}
+
+uint32_t get_tile_bytes(DataFormat data_format) {
+    // block float tile: 64 shared exponents followed by packed mantissas
+    switch (data_format) {
+    case DataFormat::BFP8_B:
+        return 64 + 1024;
+    case DataFormat::BFP4_B:
+        return 64 + 512;
+    default:
+        return 1024 * get_item_bytes(data_format);
+    }
+}
+
+uint32_t get_data_bytes(DataFormat data_format, uint32_t items) {
+    if (is_block_float(data_format)) {
+        if (items % 1024 != 0) {
+            throw Error("Size of block float data must be multiple of tile size");
+        }
+        return (items / 1024) * get_tile_bytes(data_format);
+    }
+    return items * get_item_bytes(data_format);
+}
+
 bool range_overlap(const Range &range1, const Range &range2) {
     return (range1.x_start <= range2.x_end && range1.x_end >= range2.x_start &&
         range1.y_start <= range2.y_end && range1.y_end >= range2.y_start);
@@ -18,6 +18,7 @@ bool is_pow2(uint32_t n);
 uint32_t u32_log2(uint32_t n);
 
 uint32_t get_item_bytes(DataFormat data_format);
+uint32_t get_tile_bytes(DataFormat data_format);
 
 bool range_overlap(const Range &range1, const Range &range2);
 
@@ -0,0 +1,42 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "tanto/dataflow.h"
+
+#define T bfloat16
+
+void kernel(Global gx, Local lx, Pipe px, uint32 x_pos, uint32 x_size,
+            uint32 C, uint32 W, uint32 num_blocks) {
+  noc_async_read_global_dram(lx.addr + (0 << 1), gx.addr, gx.log2_page_size,
+                             x_pos << 1, x_size << 1);
+  noc_async_read_barrier();
+  uint32 src_pos = 0;
+  for (uint32 i = 0; i < num_blocks; i++) {
+    cb_reserve_back(px.cb_id, px.frame_size);
+    noc_async_read_2d(get_noc_addr(lx.addr + (src_pos << 1)),
+                      get_write_ptr(px.cb_id) + (0 << 1), 32, C << 1, W << 1,
+                      C << 1);
+    noc_async_read_barrier();
+    cb_push_back(px.cb_id, px.frame_size);
+    src_pos += C;
+  }
+}
+
+void kernel_main() {
+  Global gx;
+  gx.addr = get_arg_val<uint32>(0);
+  gx.log2_page_size = get_arg_val<uint32>(1);
+  Local lx;
+  lx.addr = get_arg_val<uint32>(2);
+  Pipe px;
+  px.cb_id = get_arg_val<uint32>(3);
+  px.frame_size = get_arg_val<uint32>(4);
+  uint32 x_pos = get_arg_val<uint32>(5);
+  uint32 x_size = get_arg_val<uint32>(6);
+  uint32 C = get_arg_val<uint32>(7);
+  uint32 W = get_arg_val<uint32>(8);
+  uint32 num_blocks = get_arg_val<uint32>(9);
+  kernel(gx, lx, px, x_pos, x_size, C, W, num_blocks);
+}
+
@@ -0,0 +1,37 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "tanto/dataflow.h"
+
+#define T bfloat16
+
+void kernel(Global gx, Global gy, Local lx, uint32 num_pages,
+            uint32 page_items) {
+  uint32 dst_pos = 0;
+  for (uint32 i = 0; i < num_pages; i++) {
+    noc_async_read_block_dram(lx.addr + (0 << 1), gx.addr, gx.log2_page_size,
+                              gx.bank_pages, i, 0 << 1, page_items << 1);
+    noc_async_read_barrier();
+    noc_async_write_global_dram(lx.addr + (0 << 1), gy.addr, gy.log2_page_size,
+                                dst_pos << 1, page_items << 1);
+    noc_async_write_barrier();
+    dst_pos += page_items;
+  }
+}
+
+void kernel_main() {
+  Global gx;
+  gx.addr = get_arg_val<uint32>(0);
+  gx.log2_page_size = get_arg_val<uint32>(1);
+  gx.bank_pages = get_arg_val<uint32>(2);
+  Global gy;
+  gy.addr = get_arg_val<uint32>(3);
+  gy.log2_page_size = get_arg_val<uint32>(4);
+  Local lx;
+  lx.addr = get_arg_val<uint32>(5);
+  uint32 num_pages = get_arg_val<uint32>(6);
+  uint32 page_items = get_arg_val<uint32>(7);
+  kernel(gx, gy, lx, num_pages, page_items);
+}
+
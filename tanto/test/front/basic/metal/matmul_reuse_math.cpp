@@ -0,0 +1,68 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "tanto/compute.h"
+
+#define T bfloat16
+
+namespace NAMESPACE {
+
+// Variant of "matmul_block_math.cpp" reusing unpacked tiles of the first
+// operand: read frames of "pb" and write frames of "pc" hold 4 consecutive
+// tiles of one row, Nt is a multiple of 4
+
+void kernel(Pipe pa, Pipe pb, Pipe pc, uint32 batch, uint32 Mt, uint32 Kt,
+            uint32 Nt) {
+  tanto_unpack_matmul_block_init(pa.cb_id, pb.cb_id, false, 4);
+  tanto_matmul_block_init(false, 4);
+  tanto_pack_init(pc.cb_id);
+  for (uint32 nb = 0; nb < batch; nb++) {
+    for (uint32 mt = 0; mt < Mt; mt++) {
+
+      for (uint32 nt_blk = 0; nt_blk < Nt / 4; nt_blk += 2) {
+        static_assert(!DST_ACCUM_MODE, "dst_block exceeds fp32 destination");
+        tile_regs_acquire();
+        tile_regs_wait();
+        for (uint32 nt = nt_blk; nt < Nt / 4 && nt < nt_blk + 2; nt++) {
+          for (uint32 kt = 0; kt < Kt; kt++) {
+            cb_wait_front(pa.cb_id, pa.frame_size);
+            cb_wait_front(pb.cb_id, pb.frame_size);
+            matmul_block(pa.cb_id, pb.cb_id, 0, 0, (nt - nt_blk) * 4, false, 4,
+                         1, 1);
+            cb_pop_front(pb.cb_id, pb.frame_size);
+            cb_pop_front(pa.cb_id, pa.frame_size);
+          }
+          cb_reserve_back(pc.cb_id, pc.frame_size);
+          pack_tile((nt - nt_blk) * 4, pc.cb_id);
+          pack_tile((nt - nt_blk) * 4 + 1, pc.cb_id);
+          pack_tile((nt - nt_blk) * 4 + 2, pc.cb_id);
+          pack_tile((nt - nt_blk) * 4 + 3, pc.cb_id);
+          cb_push_back(pc.cb_id, pc.frame_size);
+        }
+        tile_regs_commit();
+        tile_regs_release();
+      }
+    }
+  }
+}
+
+void MAIN {
+  Pipe pa;
+  pa.cb_id = get_arg_val<uint32>(0);
+  pa.frame_size = get_arg_val<uint32>(1);
+  Pipe pb;
+  pb.cb_id = get_arg_val<uint32>(2);
+  pb.frame_size = get_arg_val<uint32>(3);
+  Pipe pc;
+  pc.cb_id = get_arg_val<uint32>(4);
+  pc.frame_size = get_arg_val<uint32>(5);
+  uint32 batch = get_arg_val<uint32>(6);
+  uint32 Mt = get_arg_val<uint32>(7);
+  uint32 Kt = get_arg_val<uint32>(8);
+  uint32 Nt = get_arg_val<uint32>(9);
+  tanto_compute_init();
+  kernel(pa, pb, pc, batch, Mt, Kt, Nt);
+}
+} // namespace NAMESPACE
+
@@ -0,0 +1,25 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+void kernel(
+        global<T> gx,
+        local<T> lx,
+        pipe<T> px,
+        uint32 x_pos,
+        uint32 x_size,
+        uint32 C,
+        uint32 W,
+        uint32 num_blocks) {
+    lx.read(0, gx, x_pos, x_size);
+    read_barrier();
+    uint32 src_pos = 0;
+    for (uint32 i = 0; i < num_blocks; i++) {
+        px.reserve_back();
+        px.read_2d(0, lx, src_pos, 32, C, C, W);
+        read_barrier();
+        px.push_back();
+        src_pos += C;
+    }
+}
+
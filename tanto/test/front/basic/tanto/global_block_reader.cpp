@@ -0,0 +1,20 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+void kernel(
+        global<T, block> gx,
+        global<T> gy,
+        local<T> lx,
+        uint32 num_pages,
+        uint32 page_items) {
+    uint32 dst_pos = 0;
+    for (uint32 i = 0; i < num_pages; i++) {
+        lx.read(0, gx, i, 0, page_items);
+        read_barrier();
+        lx.write(0, gy, dst_pos, page_items);
+        write_barrier();
+        dst_pos += page_items;
+    }
+}
+
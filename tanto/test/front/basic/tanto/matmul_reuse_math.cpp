@@ -0,0 +1,39 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+// Variant of "matmul_block_math.cpp" reusing unpacked tiles of the first operand:
+// read frames of "pb" and write frames of "pc" hold 4 consecutive tiles of one row,
+// Nt is a multiple of 4
+
+void kernel(
+        pipe<T> pa,
+        pipe<T> pb,
+        pipe<T> pc,
+        uint32 batch,
+        uint32 Mt,
+        uint32 Kt,
+        uint32 Nt) {
+    for (uint32 nb = 0; nb < batch; nb++) {
+        for (uint32 mt = 0; mt < Mt; mt++) {
+#pragma tanto dst_block(2)
+            for (uint32 nt = 0; nt < Nt / 4; nt++) {
+                math<T> acc;
+                for (uint32 kt = 0; kt < Kt; kt++) {
+                    pa.wait_front();
+                    pb.wait_front();
+                    acc.matmul_block(pa, pb, 0, 0, 0, false, 4);
+                    pb.pop_front();
+                    pa.pop_front();
+                }
+                pc.reserve_back();
+                acc.pack(0, pc);
+                acc.pack(1, pc);
+                acc.pack(2, pc);
+                acc.pack(3, pc);
+                pc.push_back();
+            }
+        }
+    }
+}
+
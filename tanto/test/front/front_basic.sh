@@ -82,6 +82,10 @@ $FRONT --mode=write -DT=bfloat16 \
     $TANTO/matmul_multi_writer.cpp >$METAL//matmul_multi_writer.cpp
 $FRONT --mode=compute -DT=bfloat16 \
     $TANTO/matmul_multi_math.cpp >$METAL//matmul_multi_math.cpp
+$FRONT --mode=compute -DT=bfloat16 \
+    $TANTO/matmul_block_math.cpp >$METAL//matmul_block_math.cpp
+$FRONT --mode=compute -DT=bfloat16 \
+    $TANTO/matmul_reuse_math.cpp >$METAL//matmul_reuse_math.cpp
 
 $FRONT --mode=read -DT=bfloat16 \
     $TANTO/matmul_single_reader.cpp >$METAL//matmul_single_reader.cpp
@@ -138,4 +142,9 @@ $FRONT --mode=write -DT=bfloat16 \
 $FRONT --mode=compute -DT=bfloat16 \
     $TANTO/unpack_untilize_math.cpp >$METAL/unpack_untilize_math.cpp
 
+$FRONT --mode=read -DT=bfloat16 \
+    $TANTO/block_2d_reader.cpp >$METAL/block_2d_reader.cpp
+
+$FRONT --mode=read -DT=bfloat16 \
+    $TANTO/global_block_reader.cpp >$METAL/global_block_reader.cpp
 
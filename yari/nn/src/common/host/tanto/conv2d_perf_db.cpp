@@ -2,6 +2,8 @@
 //
 // SPDX-License-Identifier: Apache-2.0
 
+#include <cstdio>
+#include <string>
 #include <vector>
 #include <algorithm>
 
@@ -140,6 +142,45 @@ const Conv2dPerfEntry g_entries[] = {
     {0}
 };
 
+struct AlgoName {
+    Conv2dAlgo algo;
+    const char *name;
+};
+
+const AlgoName g_algo_names[] = {
+    {Conv2dAlgo::BASIC_BATCH, "basic_batch"},
+    {Conv2dAlgo::BASIC_SPLIT_8, "basic_split_8"},
+    {Conv2dAlgo::BASIC_SPLIT_16, "basic_split_16"},
+    {Conv2dAlgo::BASIC_SPATIAL, "basic_spatial"},
+    {Conv2dAlgo::WINOGRAD_BATCH, "winograd_batch"},
+    {Conv2dAlgo::NONE, nullptr}
+};
+
+bool match_tuned_entry(
+        const Conv2dTunedEntry &entry,
+        int N,
+        const Conv2dParam &param,
+        bool bias,
+        bool fuse_add) {
+    return (entry.N == N &&
+        entry.H == param.H &&
+        entry.W == param.W &&
+        entry.C == param.C &&
+        entry.P == param.P &&
+        entry.Q == param.Q &&
+        entry.K == param.K &&
+        entry.R == param.R &&
+        entry.S == param.S &&
+        entry.pad_h == param.pad_h &&
+        entry.pad_w == param.pad_w &&
+        entry.stride_h == param.stride_h &&
+        entry.stride_w == param.stride_w &&
+        entry.dilation_h == param.dilation_h &&
+        entry.dilation_w == param.dilation_w &&
+        entry.bias == bias &&
+        entry.fuse_add == fuse_add);
+}
+
 } // namespace
 
 //
@@ -155,11 +196,15 @@ Conv2dPerfDb::~Conv2dPerfDb() { }
 bool Conv2dPerfDb::select_algo(
         int N,
         const Conv2dParam &param,
+        bool bias,
         bool fuse_add,
         Conv2dAlgo &algo,
         int &batch_size) {
 //printf("@@@ Conv2dPerfDb::select_algo N %d H %d W %d C %d P %d Q %d K %d R %d S %d add %d\n",
 //N, param.H, param.W, param.C, param.P, param.Q, param.K, param.R, param.S, int(fuse_add));
+    if (select_tuned_algo(N, param, bias, fuse_add, algo, batch_size)) {
+        return true;
+    }
     algo = Conv2dAlgo::NONE;
     batch_size = 0;
     int num_ranges = int(m_ranges.size());
@@ -199,6 +244,152 @@ bool Conv2dPerfDb::select_algo(
     return true;
 }
 
+bool Conv2dPerfDb::load(const std::string &path) {
+    // file format:
+    //     conv2d_perf_db <version>
+    //     N H W C P Q K R S pad_h pad_w stride_h stride_w dilation_h dilation_w
+    //         bias fuse_add algo batch_size time
+    // entries of other versions are silently discarded
+    FILE *fp = fopen(path.c_str(), "r");
+    if (fp == nullptr) {
+        return false;
+    }
+    int version = 0;
+    if (fscanf(fp, " conv2d_perf_db %d", &version) != 1 || version != FILE_VERSION) {
+        fclose(fp);
+        return false;
+    }
+    std::vector<Conv2dTunedEntry> entries;
+    bool ok = true;
+    for ( ; ; ) {
+        Conv2dTunedEntry e;
+        int bias = 0;
+        int fuse_add = 0;
+        char name[64];
+        int count =
+            fscanf(
+                fp,
+                " %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %63s %d %f",
+                &e.N, &e.H, &e.W, &e.C, &e.P, &e.Q, &e.K, &e.R, &e.S,
+                &e.pad_h, &e.pad_w, &e.stride_h, &e.stride_w,
+                &e.dilation_h, &e.dilation_w,
+                &bias, &fuse_add, name, &e.batch_size, &e.time);
+        if (count == EOF) {
+            break;
+        }
+        if (count != 20) {
+            ok = false;
+            break;
+        }
+        e.bias = (bias != 0);
+        e.fuse_add = (fuse_add != 0);
+        e.algo = str_to_algo(name);
+        if (e.algo == Conv2dAlgo::NONE || e.batch_size <= 0) {
+            ok = false;
+            break;
+        }
+        entries.push_back(e);
+    }
+    fclose(fp);
+    if (!ok) {
+        return false;
+    }
+    for (Conv2dTunedEntry &e: entries) {
+        Conv2dParam param{
+            e.H, e.W, e.C, e.P, e.Q, e.K, e.R, e.S,
+            e.pad_h, e.pad_w, e.stride_h, e.stride_w,
+            e.dilation_h, e.dilation_w};
+        add_tuned_entry(e.N, param, e.bias, e.fuse_add, e.algo, e.batch_size, e.time);
+    }
+    return true;
+}
+
+bool Conv2dPerfDb::save(const std::string &path) {
+    // write to temporary file first to keep previous version
+    // intact if writing fails half way
+    std::string temp_path = path + ".tmp";
+    FILE *fp = fopen(temp_path.c_str(), "w");
+    if (fp == nullptr) {
+        return false;
+    }
+    fprintf(fp, "conv2d_perf_db %d\n", FILE_VERSION);
+    for (Conv2dTunedEntry &e: m_tuned_entries) {
+        fprintf(
+            fp,
+            "%d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %s %d %g\n",
+            e.N, e.H, e.W, e.C, e.P, e.Q, e.K, e.R, e.S,
+            e.pad_h, e.pad_w, e.stride_h, e.stride_w,
+            e.dilation_h, e.dilation_w,
+            int(e.bias), int(e.fuse_add), algo_to_str(e.algo), e.batch_size, e.time);
+    }
+    bool ok = (ferror(fp) == 0);
+    if (fclose(fp) != 0) {
+        ok = false;
+    }
+    if (!ok || rename(temp_path.c_str(), path.c_str()) != 0) {
+        remove(temp_path.c_str());
+        return false;
+    }
+    return true;
+}
+
+void Conv2dPerfDb::add_tuned_entry(
+        int N,
+        const Conv2dParam &param,
+        bool bias,
+        bool fuse_add,
+        Conv2dAlgo algo,
+        int batch_size,
+        float time) {
+    Conv2dTunedEntry entry{
+        N,
+        param.H,
+        param.W,
+        param.C,
+        param.P,
+        param.Q,
+        param.K,
+        param.R,
+        param.S,
+        param.pad_h,
+        param.pad_w,
+        param.stride_h,
+        param.stride_w,
+        param.dilation_h,
+        param.dilation_w,
+        bias,
+        fuse_add,
+        algo,
+        batch_size,
+        time};
+    // latest measurement wins
+    for (Conv2dTunedEntry &curr: m_tuned_entries) {
+        if (match_tuned_entry(curr, N, param, bias, fuse_add)) {
+            curr = entry;
+            return;
+        }
+    }
+    m_tuned_entries.push_back(entry);
+}
+
+const char *Conv2dPerfDb::algo_to_str(Conv2dAlgo algo) {
+    for (int i = 0; g_algo_names[i].name != nullptr; i++) {
+        if (g_algo_names[i].algo == algo) {
+            return g_algo_names[i].name;
+        }
+    }
+    return "<?>";
+}
+
+Conv2dAlgo Conv2dPerfDb::str_to_algo(const std::string &str) {
+    for (int i = 0; g_algo_names[i].name != nullptr; i++) {
+        if (str == g_algo_names[i].name) {
+            return g_algo_names[i].algo;
+        }
+    }
+    return Conv2dAlgo::NONE;
+}
+
 void Conv2dPerfDb::init() {
     for (int i = 0; g_entries[i].N != 0; i++) {
         add_entry(g_entries[i]);
@@ -206,6 +397,24 @@ void Conv2dPerfDb::init() {
     finalize();
 }
 
+bool Conv2dPerfDb::select_tuned_algo(
+        int N,
+        const Conv2dParam &param,
+        bool bias,
+        bool fuse_add,
+        Conv2dAlgo &algo,
+        int &batch_size) {
+    // tuned entries require exact match of N, full geometry and bias
+    for (Conv2dTunedEntry &entry: m_tuned_entries) {
+        if (match_tuned_entry(entry, N, param, bias, fuse_add)) {
+            algo = entry.algo;
+            batch_size = entry.batch_size;
+            return true;
+        }
+    }
+    return false;
+}
+
 void Conv2dPerfDb::add_entry(const Conv2dPerfEntry &entry) {
     m_entries.push_back(entry);
 }
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <string>
 #include <vector>
 
 #include "host/tanto/layer_base.hpp"
@@ -18,7 +19,10 @@ enum class Conv2dAlgo {
     BASIC_BATCH,
     BASIC_SPLIT_8,
     BASIC_SPLIT_16,
-    BASIC_SPATIAL
+    BASIC_SPATIAL,
+    // Winograd F(2x2, 3x3): 3x3, stride 1, dilation 1, with bias, no fused add;
+    // not used by built-in table, selected only via tuner or perf db file
+    WINOGRAD_BATCH
 };
 
 struct Conv2dPerfEntry {
@@ -35,6 +39,30 @@ struct Conv2dPerfEntry {
     Conv2dAlgo algo;
 };
 
+// measured by Conv2dTuner, persisted in perf db file
+struct Conv2dTunedEntry {
+    int N;
+    int H;
+    int W;
+    int C;
+    int P;
+    int Q;
+    int K;
+    int R;
+    int S;
+    int pad_h;
+    int pad_w;
+    int stride_h;
+    int stride_w;
+    int dilation_h;
+    int dilation_w;
+    bool bias;
+    bool fuse_add;
+    Conv2dAlgo algo;
+    int batch_size;
+    float time;
+};
+
 class Conv2dPerfDb {
 public:
     Conv2dPerfDb();
@@ -43,9 +71,29 @@ public:
     bool select_algo(
         int N,
         const Conv2dParam &param,
+        bool bias,
         bool fuse_add,
         Conv2dAlgo &algo,
         int &batch_size);
+    bool select_tuned_algo(
+        int N,
+        const Conv2dParam &param,
+        bool bias,
+        bool fuse_add,
+        Conv2dAlgo &algo,
+        int &batch_size);
+    bool load(const std::string &path);
+    bool save(const std::string &path);
+    void add_tuned_entry(
+        int N,
+        const Conv2dParam &param,
+        bool bias,
+        bool fuse_add,
+        Conv2dAlgo algo,
+        int batch_size,
+        float time);
+    static const char *algo_to_str(Conv2dAlgo algo);
+    static Conv2dAlgo str_to_algo(const std::string &str);
 private:
     void init();
     void add_entry(const Conv2dPerfEntry &entry);
@@ -57,9 +105,14 @@ private:
         int start;
         int end;
     };
+private:
+    // bump when file format or kernel implementations change
+    // in a way that invalidates previously tuned entries
+    static constexpr int FILE_VERSION = 2;
 private:
     std::vector<Conv2dPerfEntry> m_entries;
     std::vector<PerfRange> m_ranges;
+    std::vector<Conv2dTunedEntry> m_tuned_entries;
 };
 
 } // namespace tanto
@@ -0,0 +1,242 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdint>
+#include <cstdio>
+#include <cassert>
+#include <vector>
+#include <chrono>
+#include <exception>
+
+#include "host/core/api.hpp"
+
+#include "host/tanto/layer_base.hpp"
+#include "host/tanto/layer_global.hpp"
+#include "host/tanto/conv2d_perf_db.hpp"
+#include "host/tanto/conv2d_tuner.hpp"
+
+namespace ronin {
+namespace nn {
+namespace common {
+namespace tanto {
+
+namespace core = ronin::tanto::host;
+
+namespace {
+
+// ACHTUNG: Temporary limit 64 is Wormhole-specific
+constexpr int MAX_CORES = 64;
+
+// ACHTUNG: Same as conv2d_basic_spatial.cpp
+constexpr int SPATIAL_SPLIT_COUNT = 4;
+
+} // namespace
+
+//
+//    Conv2dTuner
+//
+
+Conv2dTuner::Conv2dTuner(const core::Device &device, int N):
+        m_device(device), m_N(N) { }
+
+Conv2dTuner::~Conv2dTuner() { }
+
+void Conv2dTuner::set_repeat(int warmup, int repeat) {
+    assert(warmup >= 0);
+    assert(repeat > 0);
+    m_warmup = warmup;
+    m_repeat = repeat;
+}
+
+bool Conv2dTuner::tune(
+        const Conv2dParam &param,
+        bool bias,
+        bool fuse_add,
+        Conv2dAlgo &algo,
+        int &batch_size,
+        float &time) {
+    algo = Conv2dAlgo::NONE;
+    batch_size = 0;
+    time = 0.0f;
+    std::vector<Candidate> candidates;
+    enum_candidates(param, bias, fuse_add, candidates);
+    for (Candidate &candidate: candidates) {
+        float t = measure(candidate, param, bias, fuse_add);
+        if (t < 0.0f) {
+            continue;
+        }
+        if (algo == Conv2dAlgo::NONE || t < time) {
+            algo = candidate.algo;
+            batch_size = candidate.batch_size;
+            time = t;
+        }
+    }
+    return (algo != Conv2dAlgo::NONE);
+}
+
+void Conv2dTuner::enum_candidates(
+        const Conv2dParam &param,
+        bool bias,
+        bool fuse_add,
+        std::vector<Candidate> &candidates) {
+    // applicability rules mirror assertions in op implementations:
+    // they must be conservative as failed assertions cannot be recovered
+    candidates.clear();
+    if (param.C % 32 != 0 || param.K % 32 != 0) {
+        // all algorithms support padding of C and K, however
+        // tuning is targeting well-shaped layers only
+        return;
+    }
+    std::vector<int> batch_sizes;
+    // basic batch
+    if (!fuse_add || param.K < 2048) {
+        enum_batch_sizes(MAX_CORES, batch_sizes);
+        for (int b: batch_sizes) {
+            candidates.push_back({Conv2dAlgo::BASIC_BATCH, b});
+        }
+    }
+    // basic split
+    for (int b: {8, 16}) {
+        if (m_N % b != 0) {
+            continue;
+        }
+        int block_size = MAX_CORES / b;
+        if (param.K % (block_size * 32) != 0) {
+            continue;
+        }
+        // ACHTUNG: Temporary L1 limit is Wormhole-specific
+        if (param.C * param.K * param.R * param.S > (256 + 32) * 1024 * block_size) {
+            continue;
+        }
+        Conv2dAlgo algo = (b == 8) ? Conv2dAlgo::BASIC_SPLIT_8 : Conv2dAlgo::BASIC_SPLIT_16;
+        candidates.push_back({algo, b});
+    }
+    // basic spatial
+    enum_batch_sizes(MAX_CORES / SPATIAL_SPLIT_COUNT, batch_sizes);
+    for (int b: batch_sizes) {
+        candidates.push_back({Conv2dAlgo::BASIC_SPATIAL, b});
+    }
+    // winograd batch
+    bool winograd =
+        bias &&
+        op::conv::tanto::Conv2dWinogradBatch::is_supported(
+            param.C,
+            param.K,
+            param.R,
+            param.S,
+            param.pad_h,
+            param.pad_w,
+            param.stride_h,
+            param.stride_w,
+            param.dilation_h,
+            param.dilation_w,
+            fuse_add);
+    if (winograd) {
+        enum_batch_sizes(MAX_CORES, batch_sizes);
+        for (int b: batch_sizes) {
+            candidates.push_back({Conv2dAlgo::WINOGRAD_BATCH, b});
+        }
+    }
+}
+
+void Conv2dTuner::enum_batch_sizes(int max_batch_size, std::vector<int> &batch_sizes) {
+    // ACHTUNG: Supported batch sizes are Wormhole-specific
+    batch_sizes.clear();
+    if (m_N < 8) {
+        batch_sizes.push_back(m_N);
+        return;
+    }
+    for (int b = 8; b <= max_batch_size; b *= 2) {
+        if (m_N % b == 0) {
+            batch_sizes.push_back(b);
+        }
+    }
+}
+
+float Conv2dTuner::measure(
+        const Candidate &candidate,
+        const Conv2dParam &param,
+        bool bias,
+        bool fuse_add) {
+    float t = -1.0f;
+    int b = candidate.batch_size;
+    try {
+        switch (candidate.algo) {
+        case Conv2dAlgo::BASIC_BATCH:
+            t = measure_layer<Conv2dBasicBatchLayer>(param, bias, fuse_add, b);
+            break;
+        case Conv2dAlgo::BASIC_SPLIT_8:
+        case Conv2dAlgo::BASIC_SPLIT_16:
+            t = measure_layer<Conv2dBasicSplitLayer>(param, bias, fuse_add, b);
+            break;
+        case Conv2dAlgo::BASIC_SPATIAL:
+            t = measure_layer<Conv2dBasicSpatialLayer>(param, bias, fuse_add, b);
+            break;
+        case Conv2dAlgo::WINOGRAD_BATCH:
+            t = measure_layer<Conv2dWinogradBatchLayer>(param, bias, fuse_add, b);
+            break;
+        default:
+            break;
+        }
+    } catch (std::exception &e) {
+        // e.g., kernel build failure or device memory overflow: skip candidate
+        fprintf(stderr, "Conv2dTuner: skip %s / %d: %s\n",
+            Conv2dPerfDb::algo_to_str(candidate.algo), b, e.what());
+        t = -1.0f;
+    }
+    return t;
+}
+
+template<typename LAYER>
+float Conv2dTuner::measure_layer(
+        const Conv2dParam &param,
+        bool bias,
+        bool fuse_add,
+        int batch_size) {
+    // returns time per iteration in ms
+    LAYER layer(m_N, param, batch_size);
+    uint32_t log2_page_size = 10; // 2 ^ 10 = 1024
+    core::Global gx(m_device, T, uint32_t(layer.input_volume(0)), log2_page_size);
+    core::Global gw(m_device, T, uint32_t(layer.input_volume(1)), log2_page_size);
+    core::Global gb;
+    if (bias) {
+        gb = core::Global(m_device, T, uint32_t(layer.input_volume(2)), log2_page_size);
+    }
+    core::Global gz;
+    if (fuse_add) {
+        gz = core::Global(m_device, T, uint32_t(layer.input_volume(3)), log2_page_size);
+    }
+    core::Global gy(m_device, T, uint32_t(layer.output_volume(0)), log2_page_size);
+    // zero inputs: timing must not depend on garbage (e.g. NaN) values
+    core::Queue queue(m_device, 0);
+    std::vector<uint16_t> zero;
+    for (core::Global *g: {&gx, &gw, &gb, &gz}) {
+        if (!g->is_null()) {
+            zero.assign(g->bytes() / sizeof(uint16_t), 0);
+            queue.enqueue_write(*g, zero.data(), true);
+        }
+    }
+    layer.init(m_device, gx, gw, gb, gz, gy);
+    // warm up (includes kernel compilation on first run)
+    for (int i = 0; i < m_warmup; i++) {
+        layer.run();
+    }
+    queue.finish();
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < m_repeat; i++) {
+        layer.run();
+        queue.finish();
+    }
+    auto end = std::chrono::steady_clock::now();
+    float elapsed =
+        std::chrono::duration_cast<
+            std::chrono::duration<float, std::milli>>(end - start).count();
+    return elapsed / float(m_repeat);
+}
+
+} // namespace tanto
+} // namespace common
+} // namespace nn
+} // namespace ronin
+
@@ -0,0 +1,74 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <vector>
+
+#include "host/core/api.hpp"
+
+#include "host/tanto/layer_base.hpp"
+#include "host/tanto/conv2d_perf_db.hpp"
+
+namespace ronin {
+namespace nn {
+namespace common {
+namespace tanto {
+
+namespace core = ronin::tanto::host;
+
+//
+//    Conv2dTuner
+//
+
+class Conv2dTuner {
+public:
+    Conv2dTuner(const core::Device &device, int N);
+    ~Conv2dTuner();
+public:
+    void set_repeat(int warmup, int repeat);
+    bool tune(
+        const Conv2dParam &param,
+        bool bias,
+        bool fuse_add,
+        Conv2dAlgo &algo,
+        int &batch_size,
+        float &time);
+private:
+    struct Candidate {
+        Conv2dAlgo algo;
+        int batch_size;
+    };
+private:
+    void enum_candidates(
+        const Conv2dParam &param,
+        bool bias,
+        bool fuse_add,
+        std::vector<Candidate> &candidates);
+    void enum_batch_sizes(int max_batch_size, std::vector<int> &batch_sizes);
+    float measure(
+        const Candidate &candidate,
+        const Conv2dParam &param,
+        bool bias,
+        bool fuse_add);
+    template<typename LAYER>
+    float measure_layer(
+        const Conv2dParam &param,
+        bool bias,
+        bool fuse_add,
+        int batch_size);
+private:
+    static const core::DataFormat T = core::DataFormat::BFLOAT16;
+private:
+    core::Device m_device;
+    int m_N = 0;
+    int m_warmup = 2;
+    int m_repeat = 10;
+};
+
+} // namespace tanto
+} // namespace common
+} // namespace nn
+} // namespace ronin
+
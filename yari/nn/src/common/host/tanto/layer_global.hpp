@@ -9,6 +9,7 @@
 #include "conv/host/tanto/conv2d_basic_split.hpp"
 #include "conv/host/tanto/conv2d_basic_spatial.hpp"
 #include "conv/host/tanto/conv2d_image_batch.hpp"
+#include "conv/host/tanto/conv2d_winograd_batch.hpp"
 #include "fc/host/tanto/fc_batch.hpp"
 #include "group_conv/host/tanto/group_conv2d_basic_batch.hpp"
 #include "group_conv/host/tanto/group_conv2d_dw_batch.hpp"
@@ -107,6 +108,17 @@ public:
     ~Conv2dImageBatchLayer();
 };
 
+using op::conv::tanto::Conv2dWinogradBatch;
+
+class Conv2dWinogradBatchLayer: public LayerBase<Conv2dWinogradBatch> {
+public:
+    Conv2dWinogradBatchLayer(
+        int N,
+        const Conv2dParam &param,
+        int batch_size);
+    ~Conv2dWinogradBatchLayer();
+};
+
 //
 //    FC
 //
@@ -3,12 +3,19 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include <cstdint>
+#include <cstdio>
 #include <cstring>
 #include <cassert>
 #include <string>
 #include <vector>
 #include <memory>
 #include <utility>
+#include <functional>
+#include <algorithm>
+#include <map>
+#include <typeinfo>
+
+#include <sys/stat.h>
 
 #include "arhat/runtime/arhat.hpp"
 
@@ -20,6 +27,7 @@
 #include "host/tanto/layer_base.hpp"
 #include "host/tanto/layer_global.hpp"
 #include "host/tanto/conv2d_perf_db.hpp"
+#include "host/tanto/conv2d_tuner.hpp"
 #include "host/tanto/net_global.hpp"
 
 namespace ronin {
@@ -91,7 +99,7 @@ const float *get_tensor_data(const arhat::Tensor &tensor) {
     return static_cast<const float *>(tensor.Data());
 }
 
-std::vector<uint16_t> tensor_to_vector(
+std::vector<float> tensor_to_vector(
         Layer *layer, 
         int input, 
         const arhat::Tensor &tensor) {
@@ -115,18 +123,81 @@ std::vector<uint16_t> tensor_to_vector(
             result = reorder_kcrs_to_rskc(result, C, K, R, S);
         }
     }
-    result = layer->transform_input(input, result);
-    return util::float_to_u16b(result);
+    return layer->transform_input(input, result);
+}
+
+std::vector<uint8_t> encode_buffer(core::DataFormat format, const std::vector<float> &x) {
+    switch (format) {
+    case core::DataFormat::BFP8_B:
+        return util::float_to_bfp8b(x);
+    case core::DataFormat::BFP4_B:
+        return util::float_to_bfp4b(x);
+    default:
+        {
+            std::vector<uint16_t> y = util::float_to_u16b(x);
+            std::vector<uint8_t> result(y.size() * sizeof(uint16_t));
+            memcpy(result.data(), y.data(), result.size());
+            return result;
+        }
+    }
 }
 
 bool select_conv2d_algo(
         NetGlobal *net, 
         const Conv2dParam &param, 
+        bool bias,
         bool fuse_add,
         Conv2dAlgo &algo, 
         int &batch_size) {
     Conv2dPerfDb &db = net->conv2d_perf_db();
-    return db.select_algo(net->N(), param, fuse_add, algo, batch_size);
+    return db.select_algo(net->N(), param, bias, fuse_add, algo, batch_size);
+}
+
+bool tune_conv2d_algo(
+        NetGlobal *net,
+        const Conv2dParam &param,
+        bool bias,
+        bool fuse_add,
+        Conv2dAlgo &algo,
+        int &batch_size) {
+    // tune each shape only once: reuse entries tuned earlier
+    // in this session or loaded from perf db file
+    Conv2dPerfDb &db = net->conv2d_perf_db();
+    if (db.select_tuned_algo(net->N(), param, bias, fuse_add, algo, batch_size)) {
+        return true;
+    }
+    Conv2dTuner tuner(net->device(), net->N());
+    float time = 0.0f;
+    if (!tuner.tune(param, bias, fuse_add, algo, batch_size, time)) {
+        return false;
+    }
+    printf(
+        "Conv2d tuning: HWC [%d %d %d] PQK [%d %d %d] RS [%d %d] bias [%d] add [%d] => %s / %d (%g ms)\n",
+            param.H, param.W, param.C,
+            param.P, param.Q, param.K,
+            param.R, param.S, int(bias), int(fuse_add),
+            Conv2dPerfDb::algo_to_str(algo), batch_size, time);
+    db.add_tuned_entry(net->N(), param, bias, fuse_add, algo, batch_size, time);
+    const std::string &path = net->conv2d_perf_db_path();
+    if (!path.empty() && !db.save(path)) {
+        fprintf(stderr, "Warning: cannot save conv2d perf db to %s\n", path.c_str());
+    }
+    return true;
+}
+
+bool is_conv2d_winograd_supported(const Conv2dParam &param, bool fuse_add) {
+    return op::conv::tanto::Conv2dWinogradBatch::is_supported(
+        param.C,
+        param.K,
+        param.R,
+        param.S,
+        param.pad_h,
+        param.pad_w,
+        param.stride_h,
+        param.stride_w,
+        param.dilation_h,
+        param.dilation_w,
+        fuse_add);
 }
 
 void init_conv2d_algo(
@@ -174,6 +245,30 @@ void init_conv2d_algo(
             param,
             batch_size);
         break;
+    case Conv2dAlgo::WINOGRAD_BATCH:
+        // Winograd kernels always use bias
+        if (ib >= 0 && is_conv2d_winograd_supported(param, (iz >= 0))) {
+            init_conv2d_winograd_batch(
+                net,
+                ix,
+                iw,
+                ib,
+                iz,
+                iy,
+                param,
+                batch_size);
+        } else {
+            init_conv2d_basic_batch(
+                net,
+                ix,
+                iw,
+                ib,
+                iz,
+                iy,
+                param,
+                batch_size);
+        }
+        break;
     default:
         assert(false);
         break;
@@ -202,10 +297,148 @@ void NetGlobal::set_data_dir(const std::string &data_dir) {
     }
 }
 
+bool NetGlobal::set_conv2d_perf_db_path(const std::string &path) {
+    // tuned entries found in this file take precedence over
+    // built-in perf table; newly tuned entries are saved to it
+    m_conv2d_perf_db_path = path;
+    if (path.empty()) {
+        return true;
+    }
+    return m_conv2d_perf_db.load(path);
+}
+
+void NetGlobal::set_conv2d_tuning(bool tuning) {
+    m_conv2d_tuning = tuning;
+}
+
+void NetGlobal::set_buffer_planning(bool planning) {
+    // must be called before layers are initialized
+    assert(m_layers.empty());
+    m_buffer_planning = planning;
+}
+
+void NetGlobal::set_trace(bool trace) {
+    // when enabled, program sequence of 'run' is captured once
+    // and replayed on subsequent runs
+    if (!trace && m_trace_id >= 0) {
+        core::Queue queue(m_device, 0);
+        queue.release_trace(uint32_t(m_trace_id));
+        m_trace_id = -1;
+    }
+    m_trace = trace;
+    m_trace_warm = false;
+}
+
+void NetGlobal::set_chain(bool chain) {
+    // when enabled, programs of all layers are captured once into graph
+    //     and enqueued as single chain on each run
+    m_chain = chain;
+    m_graph = core::Graph();
+}
+
+void NetGlobal::set_conv2d_weight_format(core::DataFormat format) {
+    // default format of weights of subsequently added conv2d layers
+    m_conv2d_weight_format = format;
+}
+
+bool NetGlobal::set_conv2d_weight_format(const std::string &name) {
+    // names as used in command line options
+    if (name == "bf16") {
+        m_conv2d_weight_format = core::DataFormat::BFLOAT16;
+    } else if (name == "bfp8") {
+        m_conv2d_weight_format = core::DataFormat::BFP8_B;
+    } else if (name == "bfp4") {
+        m_conv2d_weight_format = core::DataFormat::BFP4_B;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+void NetGlobal::set_weight_format(int buffer, core::DataFormat format) {
+    // per-layer override, must be called before layer is added
+    m_weight_formats[buffer] = format;
+}
+
+core::DataFormat NetGlobal::weight_format(int buffer) {
+    auto it = m_weight_formats.find(buffer);
+    return (it != m_weight_formats.end()) ? it->second : m_conv2d_weight_format;
+}
+
+void NetGlobal::plan_buffers() {
+    // must be called after all layers were added and before
+    // any buffer data is loaded; no-op if planning is disabled
+    if (!m_buffer_planning || m_buffers_planned) {
+        return;
+    }
+    std::vector<int> arena_map;
+    std::vector<uint32_t> arena_sizes;
+    assign_arenas(arena_map, arena_sizes);
+    uint32_t log2_page_size = 10; // 2 ^ 10 = 1024
+    std::vector<core::Global> arenas;
+    for (uint32_t size: arena_sizes) {
+        arenas.emplace_back(m_device, T, size, log2_page_size);
+    }
+    int num_buffers = int(m_buffers.size());
+    for (int i = 0; i < num_buffers; i++) {
+        BufferInfo &info = m_buffer_infos[i];
+        if (info.layer == nullptr) {
+            continue;
+        }
+        int arena = arena_map[i];
+        if (arena >= 0) {
+            m_buffers[i] = arenas[arena];
+        } else {
+            m_buffers[i] = core::Global(m_device, info.format, info.size, log2_page_size);
+        }
+    }
+    compute_plan_stats(arena_sizes);
+    m_buffers_planned = true;
+    // layers can be initialized only now as they require buffers
+    for (auto &init: m_layer_inits) {
+        init();
+    }
+    m_layer_inits.clear();
+}
+
 void NetGlobal::run() {
-    for (auto &layer: m_layers) {
-        layer->run();
+    if (!m_trace) {
+        run_layers();
+        return;
+    }
+    core::Queue queue(m_device, 0);
+    if (m_trace_id < 0) {
+        if (!m_trace_warm) {
+            // first run binds programs: it may allocate and cannot be captured
+            run_layers();
+            m_trace_warm = true;
+            return;
+        }
+        m_trace_id = int(queue.begin_trace());
+        run_layers();
+        queue.end_trace();
+    }
+    queue.replay_trace(uint32_t(m_trace_id), false);
+}
+
+void NetGlobal::run_layers() {
+    if (!m_chain) {
+        for (auto &layer: m_layers) {
+            layer->run();
+        }
+        return;
+    }
+    core::Queue queue(m_device, 0);
+    if (m_graph.is_null()) {
+        // layers enqueue their programs into graph instead of launching them
+        m_graph = core::Graph(m_device);
+        queue.begin_graph(m_graph);
+        for (auto &layer: m_layers) {
+            layer->run();
+        }
+        queue.end_graph();
     }
+    queue.enqueue_graph(m_graph, false);
 }
 
 void NetGlobal::init_input(
@@ -215,6 +448,14 @@ void NetGlobal::init_input(
     init_buffer(buffer, layer, input, -1);
 }
 
+void NetGlobal::init_input(
+        int buffer, 
+        Layer *layer, 
+        int input,
+        core::DataFormat format) {
+    init_buffer(buffer, layer, input, -1, format);
+}
+
 void NetGlobal::init_output(
         int buffer, 
         Layer *layer, 
@@ -226,7 +467,8 @@ void NetGlobal::init_buffer(
         int buffer, 
         Layer *layer, 
         int input, 
-        int output) {
+        int output,
+        core::DataFormat format) {
     if (buffer < 0) {
         return;
     }
@@ -238,14 +480,39 @@ void NetGlobal::init_buffer(
         m_buffers.resize(buffer + 1);
         m_buffer_infos.resize(buffer + 1);
     }
+    // layer has been already added
+    int layer_index = int(m_layers.size()) - 1;
+    BufferInfo &info = m_buffer_infos[buffer];
+    if (info.first < 0) {
+        info.first = layer_index;
+        info.external = (input >= 0);
+        info.format = format;
+    }
+    // buffers in block float format cannot be shared
+    assert(info.format == format);
+    info.last = layer_index;
+    if (input >= 0) {
+        info.consumed = true;
+    }
+    if (m_buffer_planning) {
+        // allocation is deferred until plan_buffers
+        assert(!m_buffers_planned);
+        if (info.layer == nullptr) {
+            info.layer = layer;
+            info.input = input;
+            info.output = output;
+        }
+        info.size = std::max(info.size, uint32_t(size));
+        return;
+    }
     if (!m_buffers[buffer].is_null()) {
         // throw exception instead?
         // using >= to support pre-allocated reused buffers
         assert(m_buffers[buffer].size() >= uint32_t(size));
     } else {
         uint32_t log2_page_size = 10; // 2 ^ 10 = 1024
-        m_buffers[buffer] = core::Global(m_device, T, uint32_t(size), log2_page_size);
-        BufferInfo &info = m_buffer_infos[buffer];
+        m_buffers[buffer] = core::Global(m_device, format, uint32_t(size), log2_page_size);
+        info.size = uint32_t(size);
         info.layer = layer;
         info.input = input;
         info.output = output;
@@ -258,22 +525,161 @@ void NetGlobal::load_buffer(int index, const std::string &fn) {
     assert(!global.is_null());
     assert(info.layer != nullptr && info.input >= 0);
     std::string path = m_data_dir + "/" + fn;
+    uint64_t layout = layout_fingerprint(index);
+    uint64_t source = source_fingerprint(path);
+    if (m_weight_pack.is_open()) {
+        const uint8_t *data = 
+            m_weight_pack.find(
+                index, 
+                uint32_t(global.data_format()), 
+                global.bytes(), 
+                layout, 
+                source);
+        if (data != nullptr) {
+            // write directly from mapping that stays valid until pack is closed
+            core::Queue queue(m_device, 0);
+            queue.enqueue_write(global, data, false);
+            return;
+        }
+        // pack built for other configuration or data: use data file
+        m_pack_fallback_count++;
+    }
     arhat::Tensor tensor;
     tensor.Read(path);
-    std::vector<uint16_t> buffer = tensor_to_vector(info.layer, info.input, tensor);
-    assert(buffer.size() * sizeof(uint16_t) == global.bytes());
+    std::vector<float> data = tensor_to_vector(info.layer, info.input, tensor);
+    std::vector<uint8_t> buffer = encode_buffer(global.data_format(), data);
+    // block float data size is not multiple of page size
+    assert(buffer.size() <= global.bytes());
+    buffer.resize(global.bytes(), 0);
     core::Queue queue(m_device, 0);
     queue.enqueue_write(global, buffer.data(), false);
+    if (m_pack_recording) {
+        m_pack_writer.add(
+            index, 
+            uint32_t(global.data_format()), 
+            layout, 
+            source, 
+            buffer.data(), 
+            buffer.size());
+    }
+}
+
+uint64_t NetGlobal::layout_fingerprint(int index) {
+    // buffer image layout is defined by layer kind (including selected
+    // algorithm), input position and layer shapes
+    const BufferInfo &info = m_buffer_infos[index];
+    Layer *layer = info.layer;
+    std::string kind(typeid(*layer).name());
+    uint64_t h = WeightPack::hash(WeightPack::HASH_SEED, kind.data(), kind.size());
+    int32_t values[] = {
+        int32_t(info.format),
+        info.input,
+        layer->input_volume(0),
+        layer->input_volume(info.input),
+        layer->output_volume(0),
+        m_N
+    };
+    return WeightPack::hash(h, values, sizeof(values));
+}
+
+uint64_t NetGlobal::source_fingerprint(const std::string &path) {
+    // data files may be absent when pack is deployed alone
+    struct stat st;
+    if (stat(path.c_str(), &st) != 0) {
+        return WeightPack::NO_SOURCE;
+    }
+    uint64_t h = WeightPack::hash(WeightPack::HASH_SEED, path.data(), path.size());
+    int64_t values[] = {
+        int64_t(st.st_size),
+        int64_t(st.st_mtim.tv_sec),
+        int64_t(st.st_mtim.tv_nsec)
+    };
+    h = WeightPack::hash(h, values, sizeof(values));
+    // never collide with "no source" marker
+    return (h != WeightPack::NO_SOURCE) ? h : 1;
+}
+
+bool NetGlobal::load_pack(const std::string &path) {
+    // must be called before buffers are loaded; buffers found in pack 
+    // are then loaded from pack instead of data files
+    m_pack_fallback_count = 0;
+    return m_weight_pack.open(path);
+}
+
+void NetGlobal::set_pack_recording(bool recording) {
+    // when enabled, buffers loaded from data files are kept for save_pack
+    m_pack_recording = recording;
+    if (!recording) {
+        m_pack_writer.clear();
+    }
+}
+
+bool NetGlobal::save_pack(const std::string &path) {
+    bool ok = m_pack_writer.save(path);
+    m_pack_writer.clear();
+    return ok;
 }
 
 const core::Global &NetGlobal::get_buffer(int index) {
     return (index >= 0) ? m_buffers[index] : null_global;
 }
 
+void NetGlobal::write_input(int index, const void *data, uint32_t bytes) {
+    // host-supplied buffers are never written by device: after the first
+    // write only page runs that differ from previous data are transferred
+    const core::Global &global = m_buffers[index];
+    assert(!global.is_null());
+    assert(m_buffer_infos[index].external);
+    assert(bytes <= global.bytes());
+    const uint8_t *src = static_cast<const uint8_t *>(data);
+    std::vector<uint8_t> &shadow = m_input_shadows[index];
+    core::Queue queue(m_device, 0);
+    if (shadow.size() != bytes) {
+        queue.enqueue_write(global, 0, bytes, src, false);
+        shadow.assign(src, src + bytes);
+        return;
+    }
+    uint32_t page_bytes = global.page_bytes();
+    uint32_t pos = 0;
+    while (pos < bytes) {
+        // find next run of changed pages
+        uint32_t run_start = pos;
+        while (run_start < bytes) {
+            uint32_t len = std::min(page_bytes, bytes - run_start);
+            if (memcmp(shadow.data() + run_start, src + run_start, len) != 0) {
+                break;
+            }
+            run_start += len;
+        }
+        uint32_t run_end = run_start;
+        while (run_end < bytes) {
+            uint32_t len = std::min(page_bytes, bytes - run_end);
+            if (memcmp(shadow.data() + run_end, src + run_end, len) == 0) {
+                break;
+            }
+            run_end += len;
+        }
+        if (run_end > run_start) {
+            uint32_t run_bytes = run_end - run_start;
+            queue.enqueue_write(global, run_start, run_bytes, src + run_start, false);
+            memcpy(shadow.data() + run_start, src + run_start, run_bytes);
+        }
+        pos = run_end;
+    }
+}
+
 void NetGlobal::add_layer(std::unique_ptr<Layer> &&layer) {
     m_layers.push_back(std::move(layer));
 }
 
+void NetGlobal::add_layer_init(std::function<void ()> &&init) {
+    if (m_buffer_planning && !m_buffers_planned) {
+        m_layer_inits.push_back(std::move(init));
+    } else {
+        init();
+    }
+}
+
 int NetGlobal::layer_count() {
     return int(m_layers.size());
 }
@@ -285,6 +691,8 @@ Layer *NetGlobal::layer_at(int index) {
 std::vector<float> NetGlobal::read_buffer(int index) {
     // introduced mainly for diagnostics
     // not recommended for regular use
+    // with buffer planning, activation data remain valid
+    // only until overwritten by other buffers sharing the same arena
     core::Global &global = m_buffers[index];
     assert(!global.is_null());
     BufferInfo &info = m_buffer_infos[index];
@@ -293,10 +701,12 @@ std::vector<float> NetGlobal::read_buffer(int index) {
     assert(layer != nullptr);
     assert(output >= 0);
     int volume = layer->output_volume(output);
+    // global may be larger than volume if shared with other buffers:
+    // read only the bytes holding the output
     std::vector<uint16_t> data(volume);
     core::Queue queue(m_device, 0);
     // blocking read
-    queue.enqueue_read(global, data.data(), true);
+    queue.enqueue_read(global, 0, uint32_t(volume * sizeof(uint16_t)), data.data(), true);
     std::vector<float> temp = util::u16b_to_float(data);
     return layer->transform_output(output, temp);
 }
@@ -312,13 +722,125 @@ std::vector<float> NetGlobal::read_buffer_raw(int index) {
     assert(layer != nullptr);
     assert(output >= 0);
     int volume = layer->output_volume(output);
+    // global may be larger than volume if shared with other buffers:
+    // read only the bytes holding the output
     std::vector<uint16_t> data(volume);
     core::Queue queue(m_device, 0);
     // blocking read
-    queue.enqueue_read(global, data.data(), true);
+    queue.enqueue_read(global, 0, uint32_t(volume * sizeof(uint16_t)), data.data(), true);
     return util::u16b_to_float(data);
 }
 
+std::string NetGlobal::diag_buffer_plan() {
+    static constexpr double MB = 1024.0 * 1024.0;
+    const BufferPlanStats &s = m_plan_stats;
+    char buf[512];
+    snprintf(
+        buf,
+        sizeof(buf),
+        "Buffer plan: params %d (%.1f MB), activations %d (%.1f MB unshared), "
+            "peak live %.1f MB, arenas %d (%.1f MB), total %.1f MB",
+        s.param_count, double(s.param_bytes) / MB,
+        s.activation_count, double(s.activation_bytes) / MB,
+        double(s.peak_bytes) / MB,
+        s.arena_count, double(s.arena_bytes) / MB,
+        double(s.param_bytes + s.arena_bytes) / MB);
+    return std::string(buf);
+}
+
+bool NetGlobal::is_activation(const BufferInfo &info) {
+    // activations are produced and consumed by layers: data of
+    // external (host-supplied) buffers and of net outputs (never
+    // consumed) must persist across runs and thus are not shared
+    return (info.layer != nullptr && !info.external && info.consumed);
+}
+
+void NetGlobal::assign_arenas(std::vector<int> &arena_map, std::vector<uint32_t> &arena_sizes) {
+    // greedy interval graph coloring: processing live ranges
+    // in order of start yields minimum number of arenas
+    // (equal to maximum number of simultaneously live activations)
+    int num_buffers = int(m_buffers.size());
+    arena_map.assign(num_buffers, -1);
+    arena_sizes.clear();
+    std::vector<int> order;
+    for (int i = 0; i < num_buffers; i++) {
+        if (is_activation(m_buffer_infos[i])) {
+            order.push_back(i);
+        }
+    }
+    std::stable_sort(
+        order.begin(),
+        order.end(),
+        [this](int a, int b) -> bool {
+            return (m_buffer_infos[a].first < m_buffer_infos[b].first);
+        });
+    // last layer using each arena
+    std::vector<int> arena_last;
+    for (int i: order) {
+        BufferInfo &info = m_buffer_infos[i];
+        // among free arenas prefer the smallest sufficient one,
+        // otherwise the largest one (to be grown)
+        int best = -1;
+        int num_arenas = int(arena_sizes.size());
+        for (int k = 0; k < num_arenas; k++) {
+            if (arena_last[k] >= info.first) {
+                continue;
+            }
+            if (best < 0) {
+                best = k;
+                continue;
+            }
+            bool fit = (arena_sizes[k] >= info.size);
+            bool best_fit = (arena_sizes[best] >= info.size);
+            if (fit && (!best_fit || arena_sizes[k] < arena_sizes[best])) {
+                best = k;
+            } else if (!fit && !best_fit && arena_sizes[k] > arena_sizes[best]) {
+                best = k;
+            }
+        }
+        if (best < 0) {
+            best = num_arenas;
+            arena_sizes.push_back(0);
+            arena_last.push_back(-1);
+        }
+        arena_sizes[best] = std::max(arena_sizes[best], info.size);
+        arena_last[best] = info.last;
+        arena_map[i] = best;
+    }
+}
+
+void NetGlobal::compute_plan_stats(const std::vector<uint32_t> &arena_sizes) {
+    BufferPlanStats &s = m_plan_stats;
+    s = BufferPlanStats();
+    int num_layers = int(m_layers.size());
+    std::vector<uint64_t> live_bytes(num_layers, 0);
+    int num_buffers = int(m_buffers.size());
+    for (int i = 0; i < num_buffers; i++) {
+        BufferInfo &info = m_buffer_infos[i];
+        if (info.layer == nullptr) {
+            continue;
+        }
+        uint64_t bytes = core::get_data_bytes(info.format, info.size);
+        if (!is_activation(info)) {
+            s.param_count++;
+            s.param_bytes += bytes;
+            continue;
+        }
+        s.activation_count++;
+        s.activation_bytes += bytes;
+        for (int k = info.first; k <= info.last; k++) {
+            live_bytes[k] += bytes;
+        }
+    }
+    for (uint64_t bytes: live_bytes) {
+        s.peak_bytes = std::max(s.peak_bytes, bytes);
+    }
+    s.arena_count = int(arena_sizes.size());
+    for (uint32_t size: arena_sizes) {
+        s.arena_bytes += core::get_data_bytes(T, size);
+    }
+}
+
 std::string NetGlobal::diag_buffer_stats(int index) {
     std::vector<float> data = read_buffer(index);
     // Temporary solution: restrict to first batch item, assume batch size 16
@@ -346,11 +868,13 @@ void init_binary(
     net->init_input(ia, layer, 0);
     net->init_input(ib, layer, 1);
     net->init_output(ic, layer, 0);
-    layer->init(
-        net->device(),
-        net->get_buffer(ia), 
-        net->get_buffer(ib), 
-        net->get_buffer(ic));
+    net->add_layer_init([=]() {
+        layer->init(
+            net->device(),
+            net->get_buffer(ia), 
+            net->get_buffer(ib), 
+            net->get_buffer(ic));
+    });
 }
 
 } // namespace
@@ -429,7 +953,10 @@ void init_conv2d(
         const Conv2dParam &param,
         int batch_size) {
     // placeholder for generic version with
-    // automated implementation choice based on param
+    // automated implementation choice based on param;
+    // weight format does not affect the choice: only basic batch
+    // algorithm uses block float weights, other algorithms fall back
+    // to bfloat16 weights for the layer
     Conv2dAlgo algo = Conv2dAlgo::NONE;
     int algo_batch_size = 0;
     bool fuse_add = (iz >= 0);
@@ -443,8 +970,20 @@ void init_conv2d(
             iy,
             param,
             batch_size);
+    } else if (ENABLE_CONV2D_PERF_DB && net->conv2d_tuning() && 
+            tune_conv2d_algo(net, param, (ib >= 0), fuse_add, algo, algo_batch_size)) {
+        init_conv2d_algo(
+            algo,
+            net,
+            ix,
+            iw,
+            ib,
+            iz,
+            iy,
+            param,
+            algo_batch_size);
     } else if (ENABLE_CONV2D_PERF_DB && 
-            select_conv2d_algo(net, param, fuse_add, algo, algo_batch_size)) {
+            select_conv2d_algo(net, param, (ib >= 0), fuse_add, algo, algo_batch_size)) {
         init_conv2d_algo(
             algo,
             net,
@@ -505,17 +1044,19 @@ void init_conv2d_basic_batch(
     auto layer = layer_unique.get();
     net->add_layer(std::move(layer_unique));
     net->init_input(ix, layer, 0);
-    net->init_input(iw, layer, 1);
+    net->init_input(iw, layer, 1, net->weight_format(iw));
     net->init_input(ib, layer, 2);
     net->init_input(iz, layer, 3);
     net->init_output(iy, layer, 0);
-    layer->init(
-        net->device(), 
-        net->get_buffer(ix), 
-        net->get_buffer(iw), 
-        net->get_buffer(ib), 
-        net->get_buffer(iz), 
-        net->get_buffer(iy));
+    net->add_layer_init([=]() {
+        layer->init(
+            net->device(), 
+            net->get_buffer(ix), 
+            net->get_buffer(iw), 
+            net->get_buffer(ib), 
+            net->get_buffer(iz), 
+            net->get_buffer(iy));
+    });
 }
 
 void init_conv2d_basic_split(
@@ -537,13 +1078,15 @@ void init_conv2d_basic_split(
     net->init_input(ib, layer, 2);
     net->init_input(iz, layer, 3);
     net->init_output(iy, layer, 0);
-    layer->init(
-        net->device(), 
-        net->get_buffer(ix), 
-        net->get_buffer(iw), 
-        net->get_buffer(ib), 
-        net->get_buffer(iz), 
-        net->get_buffer(iy));
+    net->add_layer_init([=]() {
+        layer->init(
+            net->device(), 
+            net->get_buffer(ix), 
+            net->get_buffer(iw), 
+            net->get_buffer(ib), 
+            net->get_buffer(iz), 
+            net->get_buffer(iy));
+    });
 }
 
 void init_conv2d_basic_spatial(
@@ -565,13 +1108,15 @@ void init_conv2d_basic_spatial(
     net->init_input(ib, layer, 2);
     net->init_input(iz, layer, 3);
     net->init_output(iy, layer, 0);
-    layer->init(
-        net->device(), 
-        net->get_buffer(ix), 
-        net->get_buffer(iw), 
-        net->get_buffer(ib), 
-        net->get_buffer(iz), 
-        net->get_buffer(iy));
+    net->add_layer_init([=]() {
+        layer->init(
+            net->device(), 
+            net->get_buffer(ix), 
+            net->get_buffer(iw), 
+            net->get_buffer(ib), 
+            net->get_buffer(iz), 
+            net->get_buffer(iy));
+    });
 }
 
 void init_conv2d_image_batch(
@@ -593,13 +1138,45 @@ void init_conv2d_image_batch(
     net->init_input(ib, layer, 2);
     net->init_input(iz, layer, 3);
     net->init_output(iy, layer, 0);
-    layer->init(
-        net->device(), 
-        net->get_buffer(ix), 
-        net->get_buffer(iw), 
-        net->get_buffer(ib), 
-        net->get_buffer(iz), 
-        net->get_buffer(iy));
+    net->add_layer_init([=]() {
+        layer->init(
+            net->device(), 
+            net->get_buffer(ix), 
+            net->get_buffer(iw), 
+            net->get_buffer(ib), 
+            net->get_buffer(iz), 
+            net->get_buffer(iy));
+    });
+}
+
+void init_conv2d_winograd_batch(
+        NetGlobal *net,
+        int ix,
+        int iw,
+        int ib,
+        int iz,
+        int iy,
+        const Conv2dParam &param,
+        int batch_size) {
+    auto layer_unique = 
+        std::make_unique<Conv2dWinogradBatchLayer>(
+            net->N(), param, batch_size);
+    auto layer = layer_unique.get();
+    net->add_layer(std::move(layer_unique));
+    net->init_input(ix, layer, 0);
+    net->init_input(iw, layer, 1);
+    net->init_input(ib, layer, 2);
+    net->init_input(iz, layer, 3);
+    net->init_output(iy, layer, 0);
+    net->add_layer_init([=]() {
+        layer->init(
+            net->device(), 
+            net->get_buffer(ix), 
+            net->get_buffer(iw), 
+            net->get_buffer(ib), 
+            net->get_buffer(iz), 
+            net->get_buffer(iy));
+    });
 }
 
 //
@@ -639,12 +1216,14 @@ void init_fc_batch(
     net->init_input(iw, layer, 1);
     net->init_input(ib, layer, 2);
     net->init_output(iy, layer, 0);
-    layer->init(
-        net->device(),
-        net->get_buffer(ix), 
-        net->get_buffer(iw), 
-        net->get_buffer(ib), 
-        net->get_buffer(iy));
+    net->add_layer_init([=]() {
+        layer->init(
+            net->device(),
+            net->get_buffer(ix), 
+            net->get_buffer(iw), 
+            net->get_buffer(ib), 
+            net->get_buffer(iy));
+    });
 }
 
 //
@@ -715,13 +1294,15 @@ void init_group_conv2d_basic_batch(
     net->init_input(ib, layer, 2);
     net->init_input(iz, layer, 3);
     net->init_output(iy, layer, 0);
-    layer->init(
-        net->device(), 
-        net->get_buffer(ix), 
-        net->get_buffer(iw), 
-        net->get_buffer(ib), 
-        net->get_buffer(iz), 
-        net->get_buffer(iy));
+    net->add_layer_init([=]() {
+        layer->init(
+            net->device(), 
+            net->get_buffer(ix), 
+            net->get_buffer(iw), 
+            net->get_buffer(ib), 
+            net->get_buffer(iz), 
+            net->get_buffer(iy));
+    });
 }
 
 void init_group_conv2d_dw_batch(
@@ -743,13 +1324,15 @@ void init_group_conv2d_dw_batch(
     net->init_input(ib, layer, 2);
     net->init_input(iz, layer, 3);
     net->init_output(iy, layer, 0);
-    layer->init(
-        net->device(), 
-        net->get_buffer(ix), 
-        net->get_buffer(iw), 
-        net->get_buffer(ib), 
-        net->get_buffer(iz), 
-        net->get_buffer(iy));
+    net->add_layer_init([=]() {
+        layer->init(
+            net->device(), 
+            net->get_buffer(ix), 
+            net->get_buffer(iw), 
+            net->get_buffer(ib), 
+            net->get_buffer(iz), 
+            net->get_buffer(iy));
+    });
 }
 
 
@@ -772,13 +1355,15 @@ void init_group_conv2d_dw_spatial(
     net->init_input(ib, layer, 2);
     net->init_input(iz, layer, 3);
     net->init_output(iy, layer, 0);
-    layer->init(
-        net->device(), 
-        net->get_buffer(ix), 
-        net->get_buffer(iw), 
-        net->get_buffer(ib), 
-        net->get_buffer(iz), 
-        net->get_buffer(iy));
+    net->add_layer_init([=]() {
+        layer->init(
+            net->device(), 
+            net->get_buffer(ix), 
+            net->get_buffer(iw), 
+            net->get_buffer(ib), 
+            net->get_buffer(iz), 
+            net->get_buffer(iy));
+    });
 }
 
 void init_ds_conv2d(
@@ -804,15 +1389,17 @@ void init_ds_conv2d(
     net->init_input(ib2, layer, 4);
     net->init_input(iz, layer, 5);
     net->init_output(iy, layer, 0);
-    layer->init(
-        net->device(), 
-        net->get_buffer(ix), 
-        net->get_buffer(iw), 
-        net->get_buffer(ib), 
-        net->get_buffer(iw2), 
-        net->get_buffer(ib2), 
-        net->get_buffer(iz), 
-        net->get_buffer(iy));
+    net->add_layer_init([=]() {
+        layer->init(
+            net->device(), 
+            net->get_buffer(ix), 
+            net->get_buffer(iw), 
+            net->get_buffer(ib), 
+            net->get_buffer(iw2), 
+            net->get_buffer(ib2), 
+            net->get_buffer(iz), 
+            net->get_buffer(iy));
+    });
 }
 
 //
@@ -833,10 +1420,12 @@ void init_pool2d(
     net->add_layer(std::move(layer_unique));
     net->init_input(ix, layer, 0);
     net->init_output(iy, layer, 0);
-    layer->init(
-        net->device(),
-        net->get_buffer(ix), 
-        net->get_buffer(iy));
+    net->add_layer_init([=]() {
+        layer->init(
+            net->device(),
+            net->get_buffer(ix), 
+            net->get_buffer(iy));
+    });
 }
 
 } // namespace
@@ -895,10 +1484,12 @@ void init_reduce(
     net->add_layer(std::move(layer_unique));
     net->init_input(ix, layer, 0);
     net->init_output(iy, layer, 0);
-    layer->init(
-        net->device(),
-        net->get_buffer(ix), 
-        net->get_buffer(iy));
+    net->add_layer_init([=]() {
+        layer->init(
+            net->device(),
+            net->get_buffer(ix), 
+            net->get_buffer(iy));
+    });
 }
 
 } // namespace
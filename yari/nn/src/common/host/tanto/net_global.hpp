@@ -4,15 +4,19 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <memory>
 #include <utility>
+#include <functional>
+#include <map>
 
 #include "host/core/api.hpp"
 
 #include "host/tanto/layer_base.hpp"
 #include "host/tanto/conv2d_perf_db.hpp"
+#include "host/tanto/weight_pack.hpp"
 
 namespace ronin {
 namespace nn {
@@ -31,10 +35,26 @@ public:
     ~NetGlobal();
 public:
     void set_data_dir(const std::string &data_dir);
+    bool set_conv2d_perf_db_path(const std::string &path);
+    void set_conv2d_tuning(bool tuning);
+    void set_buffer_planning(bool planning);
+    void set_trace(bool trace);
+    void set_chain(bool chain);
+    void set_conv2d_weight_format(core::DataFormat format);
+    bool set_conv2d_weight_format(const std::string &name);
+    void set_weight_format(int buffer, core::DataFormat format);
+    core::DataFormat weight_format(int buffer);
+    void plan_buffers();
     void run();
     Conv2dPerfDb &conv2d_perf_db() {
         return m_conv2d_perf_db;
     }
+    const std::string &conv2d_perf_db_path() {
+        return m_conv2d_perf_db_path;
+    }
+    bool conv2d_tuning() {
+        return m_conv2d_tuning;
+    }
     const core::Device &device() {
         return m_device;
     }
@@ -45,6 +65,11 @@ public:
         int buffer, 
         Layer *layer, 
         int input); 
+    void init_input(
+        int buffer, 
+        Layer *layer, 
+        int input,
+        core::DataFormat format); 
     void init_output(
         int buffer, 
         Layer *layer, 
@@ -53,15 +78,25 @@ public:
         int buffer, 
         Layer *layer, 
         int input, 
-        int output);
+        int output,
+        core::DataFormat format = T);
     void load_buffer(int index, const std::string &fn);
+    bool load_pack(const std::string &path);
+    void set_pack_recording(bool recording);
+    bool save_pack(const std::string &path);
+    int pack_fallback_count() {
+        return m_pack_fallback_count;
+    }
     const core::Global &get_buffer(int index);
+    void write_input(int index, const void *data, uint32_t bytes);
     void add_layer(std::unique_ptr<Layer> &&layer);
+    void add_layer_init(std::function<void ()> &&init);
     int layer_count();
     Layer *layer_at(int index);
     std::vector<float> read_buffer(int index);
     std::vector<float> read_buffer_raw(int index);
     std::string diag_buffer_stats(int index);
+    std::string diag_buffer_plan();
 private:
     static const core::DataFormat T = core::DataFormat::BFLOAT16;
 protected:
@@ -69,15 +104,59 @@ protected:
         Layer *layer = nullptr;
         int input = 0;
         int output = 0;
+        // block float formats are used for weights only
+        core::DataFormat format = T;
+        // liveness in terms of layer order
+        uint32_t size = 0;
+        int first = -1;
+        int last = -1;
+        // data supplied by host (first use as input)
+        bool external = false;
+        bool consumed = false;
     };
+    struct BufferPlanStats {
+        int param_count = 0;
+        int activation_count = 0;
+        int arena_count = 0;
+        uint64_t param_bytes = 0;
+        uint64_t activation_bytes = 0;
+        uint64_t peak_bytes = 0;
+        uint64_t arena_bytes = 0;
+    };
+protected:
+    bool is_activation(const BufferInfo &info);
+    uint64_t layout_fingerprint(int index);
+    uint64_t source_fingerprint(const std::string &path);
+    void run_layers();
+    void assign_arenas(std::vector<int> &arena_map, std::vector<uint32_t> &arena_sizes);
+    void compute_plan_stats(const std::vector<uint32_t> &arena_sizes);
 protected:
     Conv2dPerfDb m_conv2d_perf_db;
+    std::string m_conv2d_perf_db_path;
+    bool m_conv2d_tuning = false;
     core::Device m_device;
     int m_N = 0;
     std::string m_data_dir;
     std::vector<core::Global> m_buffers;
     std::vector<BufferInfo> m_buffer_infos;
     std::vector<std::unique_ptr<Layer>> m_layers;
+    bool m_buffer_planning = true;
+    core::DataFormat m_conv2d_weight_format = T;
+    std::map<int, core::DataFormat> m_weight_formats;
+    bool m_buffers_planned = false;
+    std::vector<std::function<void ()>> m_layer_inits;
+    BufferPlanStats m_plan_stats;
+    WeightPack m_weight_pack;
+    WeightPackWriter m_pack_writer;
+    bool m_pack_recording = false;
+    int m_pack_fallback_count = 0;
+    bool m_trace = false;
+    bool m_trace_warm = false;
+    int m_trace_id = -1;
+    bool m_chain = false;
+    core::Graph m_graph;
+    // last data written to host-supplied inputs
+    std::map<int, std::vector<uint8_t>> m_input_shadows;
 };
 
 //
@@ -178,6 +257,15 @@ void init_conv2d_image_batch(
     int iy,
     const Conv2dParam &param,
     int batch_size);
+void init_conv2d_winograd_batch(
+    NetGlobal *net,
+    int ix,
+    int iw,
+    int ib,
+    int iz,
+    int iy,
+    const Conv2dParam &param,
+    int batch_size);
 
 //
 //    FC
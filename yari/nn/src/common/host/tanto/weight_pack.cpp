@@ -0,0 +1,216 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "host/tanto/weight_pack.hpp"
+
+namespace ronin {
+namespace nn {
+namespace common {
+namespace tanto {
+
+namespace {
+
+uint64_t align_up(uint64_t a, uint64_t b) {
+    return ((a + b - 1) / b) * b;
+}
+
+} // namespace
+
+//
+//    WeightPack
+//
+
+WeightPack::WeightPack() { }
+
+WeightPack::~WeightPack() {
+    close();
+}
+
+bool WeightPack::open(const std::string &path) {
+    close();
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || uint64_t(st.st_size) < sizeof(Header)) {
+        ::close(fd);
+        return false;
+    }
+    uint64_t size = uint64_t(st.st_size);
+    void *base = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // mapping remains valid after file is closed
+    ::close(fd);
+    if (base == MAP_FAILED) {
+        return false;
+    }
+    m_base = static_cast<uint8_t *>(base);
+    m_size = size;
+    Header header;
+    memcpy(&header, m_base, sizeof(Header));
+    uint64_t index_end = sizeof(Header) + uint64_t(header.entry_count) * sizeof(Entry);
+    if (header.magic != MAGIC || header.version != VERSION || index_end > m_size) {
+        close();
+        return false;
+    }
+    m_entries.resize(header.entry_count);
+    memcpy(m_entries.data(), m_base + sizeof(Header), header.entry_count * sizeof(Entry));
+    for (int i = 0; i < int(m_entries.size()); i++) {
+        const Entry &entry = m_entries[i];
+        if (entry.offset < index_end || 
+                entry.bytes > m_size || 
+                entry.offset > m_size - entry.bytes) {
+            close();
+            return false;
+        }
+        if (entry.buffer >= m_entry_map.size()) {
+            m_entry_map.resize(entry.buffer + 1, -1);
+        }
+        m_entry_map[entry.buffer] = i;
+    }
+    // buffer images are read once in order
+    madvise(m_base, m_size, MADV_SEQUENTIAL);
+    return true;
+}
+
+void WeightPack::close() {
+    if (m_base != nullptr) {
+        munmap(m_base, m_size);
+    }
+    m_base = nullptr;
+    m_size = 0;
+    m_entry_map.clear();
+    m_entries.clear();
+}
+
+const uint8_t *WeightPack::find(
+        int buffer, 
+        uint32_t format, 
+        uint64_t bytes, 
+        uint64_t layout, 
+        uint64_t source) {
+    // returns nullptr unless entry matches buffer format, size and layout exactly
+    // and was built from the same source data (if source file is available)
+    if (m_base == nullptr || buffer < 0 || buffer >= int(m_entry_map.size())) {
+        return nullptr;
+    }
+    int index = m_entry_map[buffer];
+    if (index < 0) {
+        return nullptr;
+    }
+    const Entry &entry = m_entries[index];
+    if (entry.format != format || entry.bytes != bytes || entry.layout != layout) {
+        return nullptr;
+    }
+    if (source != NO_SOURCE && entry.source != source) {
+        return nullptr;
+    }
+    return m_base + entry.offset;
+}
+
+uint64_t WeightPack::hash(uint64_t seed, const void *data, uint64_t size) {
+    // FNV-1a: fingerprints are stored in files, std::hash is not portable
+    const uint8_t *ptr = static_cast<const uint8_t *>(data);
+    uint64_t h = seed;
+    for (uint64_t i = 0; i < size; i++) {
+        h ^= uint64_t(ptr[i]);
+        h *= 0x100000001b3ULL;
+    }
+    return h;
+}
+
+//
+//    WeightPackWriter
+//
+
+WeightPackWriter::WeightPackWriter() { }
+
+WeightPackWriter::~WeightPackWriter() { }
+
+void WeightPackWriter::add(
+        int buffer, 
+        uint32_t format, 
+        uint64_t layout,
+        uint64_t source,
+        const void *data, 
+        uint64_t bytes) {
+    WeightPack::Entry entry;
+    entry.buffer = uint32_t(buffer);
+    entry.format = format;
+    entry.offset = 0;
+    entry.bytes = bytes;
+    entry.layout = layout;
+    entry.source = source;
+    m_entries.push_back(entry);
+    const uint8_t *ptr = static_cast<const uint8_t *>(data);
+    m_data.emplace_back(ptr, ptr + bytes);
+}
+
+bool WeightPackWriter::save(const std::string &path) {
+    uint32_t entry_count = uint32_t(m_entries.size());
+    uint64_t offset = sizeof(WeightPack::Header) + entry_count * sizeof(WeightPack::Entry);
+    for (WeightPack::Entry &entry: m_entries) {
+        offset = align_up(offset, WeightPack::DATA_ALIGN);
+        entry.offset = offset;
+        offset += entry.bytes;
+    }
+    // write to temporary file first to keep existing pack intact on failure
+    std::string temp_path = path + ".tmp";
+    FILE *fp = fopen(temp_path.c_str(), "wb");
+    if (fp == nullptr) {
+        return false;
+    }
+    WeightPack::Header header;
+    header.magic = WeightPack::MAGIC;
+    header.version = WeightPack::VERSION;
+    header.entry_count = entry_count;
+    header.reserved = 0;
+    bool ok = (fwrite(&header, sizeof(header), 1, fp) == 1);
+    if (ok && entry_count > 0) {
+        ok = (fwrite(m_entries.data(), sizeof(WeightPack::Entry), entry_count, fp) == entry_count);
+    }
+    uint64_t pos = sizeof(WeightPack::Header) + entry_count * sizeof(WeightPack::Entry);
+    std::vector<uint8_t> pad(WeightPack::DATA_ALIGN, 0);
+    for (uint32_t i = 0; ok && i < entry_count; i++) {
+        const WeightPack::Entry &entry = m_entries[i];
+        uint64_t gap = entry.offset - pos;
+        if (gap > 0) {
+            ok = (fwrite(pad.data(), 1, gap, fp) == gap);
+        }
+        if (ok && entry.bytes > 0) {
+            ok = (fwrite(m_data[i].data(), 1, entry.bytes, fp) == entry.bytes);
+        }
+        pos = entry.offset + entry.bytes;
+    }
+    if (fclose(fp) != 0) {
+        ok = false;
+    }
+    if (!ok || rename(temp_path.c_str(), path.c_str()) != 0) {
+        remove(temp_path.c_str());
+        return false;
+    }
+    return true;
+}
+
+void WeightPackWriter::clear() {
+    m_entries.clear();
+    m_data.clear();
+}
+
+} // namespace tanto
+} // namespace common
+} // namespace nn
+} // namespace ronin
+
@@ -0,0 +1,106 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace ronin {
+namespace nn {
+namespace common {
+namespace tanto {
+
+//
+//    Weight pack: single file holding parameter buffers of a net
+//    in final device byte layout, ready to be written to globals
+//
+//    File layout (little endian):
+//        header: magic, version, entry count
+//        index: entry count x {buffer, format, offset, bytes, layout, source}
+//        data: buffer images, each aligned to DATA_ALIGN bytes
+//
+//    Each entry carries two fingerprints supplied by the net:
+//        layout: layer kind and shapes that define the buffer image layout
+//        source: path, size and modification time of the source data file
+//    An entry is used only if both match (source is not checked when
+//    the source file is not available)
+//
+
+class WeightPack {
+public:
+    WeightPack();
+    ~WeightPack();
+public:
+    bool open(const std::string &path);
+    void close();
+    bool is_open() {
+        return (m_base != nullptr);
+    }
+    const uint8_t *find(
+        int buffer, 
+        uint32_t format, 
+        uint64_t bytes, 
+        uint64_t layout, 
+        uint64_t source);
+    static uint64_t hash(uint64_t seed, const void *data, uint64_t size);
+public:
+    struct Header {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t entry_count;
+        uint32_t reserved;
+    };
+    struct Entry {
+        uint32_t buffer;
+        uint32_t format;
+        uint64_t offset;
+        uint64_t bytes;
+        uint64_t layout;
+        uint64_t source;
+    };
+public:
+    static constexpr uint32_t MAGIC = 0x4b505752; // "RWPK"
+    // bump when layout of any buffer image changes
+    static constexpr uint32_t VERSION = 2;
+    static constexpr uint64_t DATA_ALIGN = 4096;
+    static constexpr uint64_t HASH_SEED = 0xcbf29ce484222325ULL;
+    // source fingerprint of unavailable file
+    static constexpr uint64_t NO_SOURCE = 0;
+private:
+    uint8_t *m_base = nullptr;
+    uint64_t m_size = 0;
+    // indexed by buffer, -1 if absent
+    std::vector<int> m_entry_map;
+    std::vector<Entry> m_entries;
+};
+
+class WeightPackWriter {
+public:
+    WeightPackWriter();
+    ~WeightPackWriter();
+public:
+    void add(
+        int buffer, 
+        uint32_t format, 
+        uint64_t layout,
+        uint64_t source,
+        const void *data, 
+        uint64_t bytes);
+    bool save(const std::string &path);
+    void clear();
+    int entry_count() {
+        return int(m_entries.size());
+    }
+private:
+    std::vector<WeightPack::Entry> m_entries;
+    std::vector<std::vector<uint8_t>> m_data;
+};
+
+} // namespace tanto
+} // namespace common
+} // namespace nn
+} // namespace ronin
+
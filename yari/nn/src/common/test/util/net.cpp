@@ -40,6 +40,9 @@ bool parse_net_cmd_args(int argc, char **argv, NetCmdArgs &args) {
     args.batch = 0;
     args.compare = false;
     args.repeat = 0;
+    args.tune = false;
+    args.trace = false;
+    args.chain = false;
     for (int i = 1; i < argc; i++) {
         const char *arg = argv[i];
         if (!strcmp(arg, "--mode")) {
@@ -96,6 +99,33 @@ bool parse_net_cmd_args(int argc, char **argv, NetCmdArgs &args) {
                 fprintf(stderr, "Invalid repeat count\n");
                 return false;
             }
+        } else if (!strcmp(arg, "--perf-db")) {
+            i++;
+            if (i == argc) {
+                fprintf(stderr, "Perf database path must be provided after --perf-db\n");
+                return false;
+            }
+            args.perf_db = argv[i];
+        } else if (!strcmp(arg, "--tune")) {
+            args.tune = true;
+        } else if (!strcmp(arg, "--weights")) {
+            i++;
+            if (i == argc) {
+                fprintf(stderr, "Weight format must be provided after --weights\n");
+                return false;
+            }
+            args.weights = argv[i];
+        } else if (!strcmp(arg, "--pack")) {
+            i++;
+            if (i == argc) {
+                fprintf(stderr, "Weight pack path must be provided after --pack\n");
+                return false;
+            }
+            args.pack = argv[i];
+        } else if (!strcmp(arg, "--trace")) {
+            args.trace = true;
+        } else if (!strcmp(arg, "--chain")) {
+            args.chain = true;
         } else {
             fprintf(stderr, "Unrecognized option: %s\n", argv[i]);
             return false;
@@ -22,6 +22,12 @@ struct NetCmdArgs {
     std::vector<std::string> outputs;
     bool compare;
     int repeat;
+    std::string perf_db;
+    bool tune;
+    std::string weights;
+    std::string pack;
+    bool trace;
+    bool chain;
 };
 
 bool parse_net_cmd_args(int argc, char **argv, NetCmdArgs &args);
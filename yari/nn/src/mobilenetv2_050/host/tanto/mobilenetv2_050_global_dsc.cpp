@@ -107,6 +107,7 @@ MobileNetV2_050_GlobalDsc::~MobileNetV2_050_GlobalDsc() { }
 void MobileNetV2_050_GlobalDsc::init(const std::string &data_dir) {
     NetGlobal::set_data_dir(data_dir);
     init_layers();
+    plan_buffers();
     load_buffers();
 }
 
@@ -123,8 +124,8 @@ void MobileNetV2_050_GlobalDsc::set_input(int index, const std::vector<float> &d
     const core::Global &global = get_buffer(buffer_index);
     assert(!global.is_null());
     assert(input.size() * sizeof(uint16_t) <= global.bytes());
-    core::Queue queue(device(), 0);
-    queue.enqueue_write(global, input.data(), false);
+    // only pages changed since previous input are transferred
+    write_input(buffer_index, input.data(), uint32_t(input.size() * sizeof(uint16_t)));
 }
 
 int MobileNetV2_050_GlobalDsc::output_count() {
@@ -97,7 +97,31 @@ void MobileNetV2_050_GlobalDscRunner::create_net() {
 }
 
 void MobileNetV2_050_GlobalDscRunner::init_net(const std::string &data_dir) {
+    if (!m_args->perf_db.empty() && !m_net->set_conv2d_perf_db_path(m_args->perf_db)) {
+        printf("Conv2d perf database %s not loaded\n", m_args->perf_db.c_str());
+    }
+    m_net->set_conv2d_tuning(m_args->tune);
+    if (!m_args->weights.empty() && !m_net->set_conv2d_weight_format(m_args->weights)) {
+        printf("Unsupported weight format %s\n", m_args->weights.c_str());
+    }
+    // weight pack is created on first use and loaded via mmap afterwards
+    const std::string &pack = m_args->pack;
+    bool pack_loaded = (!pack.empty() && m_net->load_pack(pack));
+    m_net->set_pack_recording(!pack.empty() && !pack_loaded);
     m_net->init(data_dir);
+    if (pack_loaded) {
+        printf("Weight pack %s loaded, %d buffers read from data files\n", 
+            pack.c_str(), m_net->pack_fallback_count());
+    } else if (!pack.empty()) {
+        if (m_net->save_pack(pack)) {
+            printf("Weight pack %s created\n", pack.c_str());
+        } else {
+            printf("Weight pack %s not saved\n", pack.c_str());
+        }
+    }
+    printf("%s\n", m_net->diag_buffer_plan().c_str());
+    m_net->set_trace(m_args->trace);
+    m_net->set_chain(m_args->chain);
 }
 
 void MobileNetV2_050_GlobalDscRunner::sync_run() {
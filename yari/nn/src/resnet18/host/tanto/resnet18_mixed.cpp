@@ -7,6 +7,7 @@
 #include <cassert>
 #include <string>
 #include <vector>
+#include <thread>
 
 #include "host/core/api.hpp"
 
@@ -289,6 +290,7 @@ ResNet18MixedMain::~ResNet18MixedMain() { }
 void ResNet18MixedMain::init(const std::string &data_dir) {
     NetGlobal::set_data_dir(data_dir);
     init_layers();
+    plan_buffers();
     load_buffers();
 }
 
@@ -298,13 +300,8 @@ int ResNet18MixedMain::input_count() {
 
 void ResNet18MixedMain::set_input(int index, const std::vector<float> &data) {
     assert(index == 0);
-    std::vector<uint16_t> input = transform_input(data, N());
-    int buffer_index = 11;
-    const core::Global &global = get_buffer(buffer_index);
-    assert(!global.is_null());
-    assert(input.size() * sizeof(uint16_t) == global.bytes());
-    core::Queue queue(device(), 0);
-    queue.enqueue_write(global, input.data(), false);
+    stage_input(0, data);
+    enqueue_input(0);
 }
 
 int ResNet18MixedMain::output_count() {
@@ -313,23 +310,121 @@ int ResNet18MixedMain::output_count() {
 
 void ResNet18MixedMain::get_output(int index, std::vector<float> &data) {
     assert(index == 0);
+    enqueue_output(0);
+    finish();
+    unstage_output(0, data);
+}
+
+void ResNet18MixedMain::run() {
+    NetGlobal::run();
+}
+
+//
+//    Staging slots hold host copies of device input and output buffers.
+//    Non-blocking transfers read from or write to the slot memory
+//    until the next finish(), so the slot must not be touched
+//    by host code until then. Slot 0 is used by set_input / get_output.
+//
+
+void ResNet18MixedMain::stage_input(int slot, const std::vector<float> &data) {
+    assert(slot >= 0 && slot < SLOT_COUNT);
+    m_input_stage[slot] = transform_input(data, N());
+}
+
+void ResNet18MixedMain::enqueue_input(int slot) {
+    enqueue_input(core::Queue(device(), COMPUTE_QUEUE), slot);
+}
+
+void ResNet18MixedMain::enqueue_output(int slot) {
+    enqueue_output(core::Queue(device(), COMPUTE_QUEUE), slot);
+}
+
+void ResNet18MixedMain::unstage_output(int slot, std::vector<float> &data) {
+    assert(slot >= 0 && slot < SLOT_COUNT);
+    data = transform_output(m_output_stage[slot], N());
+}
+
+void ResNet18MixedMain::finish() {
+    core::Queue transfer_queue(device(), TRANSFER_QUEUE);
+    transfer_queue.finish();
+    core::Queue compute_queue(device(), COMPUTE_QUEUE);
+    compute_queue.finish();
+}
+
+//
+//    Overlapped mode uses compute queue for layers and transfer queue
+//    for input and output buffers. Input of the next batch is written
+//    as soon as the last layer reading the input buffer is done, and
+//    output of the previous batch is read while the next batch is computed
+//    up to the layer producing the output buffer. Host code must call
+//    sync_input / sync_output before touching the respective slot.
+//
+
+void ResNet18MixedMain::enqueue_overlapped(int slot) {
+    assert(slot >= 0 && slot < SLOT_COUNT);
+    core::Queue compute_queue(device(), COMPUTE_QUEUE);
+    core::Queue transfer_queue(device(), TRANSFER_QUEUE);
+    int input_last = m_buffer_infos[11].last;
+    int output_first = m_buffer_infos[87].first;
+    if (!m_input_free.is_null()) {
+        transfer_queue.wait_event(m_input_free);
+    }
+    enqueue_input(transfer_queue, slot);
+    m_input_written[slot] = transfer_queue.record_event();
+    compute_queue.wait_event(m_input_written[slot]);
+    int count = layer_count();
+    for (int i = 0; i < count; i++) {
+        if (i == output_first && !m_output_free.is_null()) {
+            compute_queue.wait_event(m_output_free);
+        }
+        layer_at(i)->run();
+        if (i == input_last) {
+            m_input_free = compute_queue.record_event();
+        }
+    }
+    transfer_queue.wait_event(compute_queue.record_event());
+    enqueue_output(transfer_queue, slot);
+    m_output_read[slot] = transfer_queue.record_event();
+    m_output_free = m_output_read[slot];
+}
+
+void ResNet18MixedMain::sync_input(int slot) {
+    assert(slot >= 0 && slot < SLOT_COUNT);
+    if (!m_input_written[slot].is_null()) {
+        m_input_written[slot].synchronize();
+    }
+}
+
+void ResNet18MixedMain::sync_output(int slot) {
+    assert(slot >= 0 && slot < SLOT_COUNT);
+    if (!m_output_read[slot].is_null()) {
+        m_output_read[slot].synchronize();
+    }
+}
+
+void ResNet18MixedMain::enqueue_input(const core::Queue &queue, int slot) {
+    assert(slot >= 0 && slot < SLOT_COUNT);
+    const std::vector<uint16_t> &input = m_input_stage[slot];
+    int buffer_index = 11;
+    const core::Global &global = get_buffer(buffer_index);
+    assert(!global.is_null());
+    assert(input.size() * sizeof(uint16_t) == global.bytes());
+    queue.enqueue_write(global, input.data(), false);
+}
+
+void ResNet18MixedMain::enqueue_output(const core::Queue &queue, int slot) {
+    assert(slot >= 0 && slot < SLOT_COUNT);
     int P = 7;
     int Q = 7;
     int K = 512;
     int PQ_rnd = round_up(P * Q, 32);
-    std::vector<uint16_t> output(N() * PQ_rnd * K);
+    std::vector<uint16_t> &output = m_output_stage[slot];
+    output.resize(N() * PQ_rnd * K);
     int buffer_index = 87;
     const core::Global &global = get_buffer(buffer_index);
     assert(!global.is_null());
     assert(output.size() * sizeof(uint16_t) == global.bytes());
-    core::Queue queue(device(), 0);
-    // blocking read
-    queue.enqueue_read(global, output.data(), true);
-    data = transform_output(output, N());
-}
-
-void ResNet18MixedMain::run() {
-    NetGlobal::run();
+    queue.enqueue_read(global, output.data(), false);
 }
 
 void ResNet18MixedMain::init_layers() {
@@ -477,6 +572,86 @@ void ResNet18Mixed::run_head() {
     m_head.run();
 }
 
+//
+//    Three-stage pipeline: at each step, host tail of batch (step),
+//    device main of batch (step - 1) and host head of batch (step - 2)
+//    run concurrently. Tail runs on a worker thread, head runs on
+//    the calling thread while device executes queued commands.
+//    Batches alternate between staging slots, therefore each stage
+//    only touches the slot that is not used by its neighbours.
+//    Callbacks "input" and "output" may be called concurrently.
+//    On return, get_output yields output of the last batch.
+//
+
+void ResNet18Mixed::run_stream(
+        int count,
+        const StreamInput &input,
+        const StreamOutput &output,
+        bool overlap) {
+    // with overlap, device transfers use separate queue and run concurrently
+    // with computation; slots are synchronized via events instead of
+    // finishing the device queue at each step
+    for (int step = 0; step < count + 2; step++) {
+        int tail_batch = step;
+        int main_batch = step - 1;
+        int head_batch = step - 2;
+        if (main_batch >= 0 && main_batch < count) {
+            int slot = main_batch % ResNet18MixedMain::SLOT_COUNT;
+            if (overlap) {
+                m_main.enqueue_overlapped(slot);
+            } else {
+                m_main.enqueue_input(slot);
+                m_main.run();
+                m_main.enqueue_output(slot);
+            }
+        }
+        std::thread tail_thread;
+        if (tail_batch < count) {
+            if (overlap) {
+                m_main.sync_input(tail_batch % ResNet18MixedMain::SLOT_COUNT);
+            }
+            tail_thread = std::thread([this, tail_batch, &input]() {
+                stream_tail(tail_batch, input);
+            });
+        }
+        if (head_batch >= 0) {
+            if (overlap) {
+                m_main.sync_output(head_batch % ResNet18MixedMain::SLOT_COUNT);
+            }
+            stream_head(head_batch, output);
+        }
+        if (tail_thread.joinable()) {
+            tail_thread.join();
+        }
+        if (!overlap) {
+            m_main.finish();
+        }
+    }
+    if (overlap) {
+        m_main.finish();
+    }
+}
+
+void ResNet18Mixed::stream_tail(int batch, const StreamInput &input) {
+    std::vector<float> data;
+    input(batch, data);
+    m_tail.set_input(0, data);
+    m_tail.run();
+    std::vector<float> temp;
+    m_tail.get_output(0, temp);
+    m_main.stage_input(batch % ResNet18MixedMain::SLOT_COUNT, temp);
+}
+
+void ResNet18Mixed::stream_head(int batch, const StreamOutput &output) {
+    std::vector<float> temp;
+    m_main.unstage_output(batch % ResNet18MixedMain::SLOT_COUNT, temp);
+    m_head.set_input(0, temp);
+    m_head.run();
+    std::vector<float> data;
+    m_head.get_output(0, data);
+    output(batch, data);
+}
+
 } // namespace tanto
 } // namespace resnet18
 } // namespace nn
@@ -4,7 +4,10 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
+#include <vector>
+#include <functional>
 
 #include "host/core/api.hpp"
 
@@ -88,6 +91,18 @@ public:
     int output_count();
     void get_output(int index, std::vector<float> &data);
     void run();
+    void stage_input(int slot, const std::vector<float> &data);
+    void enqueue_input(int slot);
+    void enqueue_output(int slot);
+    void unstage_output(int slot, std::vector<float> &data);
+    void finish();
+    void enqueue_overlapped(int slot);
+    void sync_input(int slot);
+    void sync_output(int slot);
+public:
+    static constexpr int SLOT_COUNT = 2;
+    static constexpr int COMPUTE_QUEUE = 0;
+    static constexpr int TRANSFER_QUEUE = 1;
 private:
     void init_layers();
     void load_buffers();
@@ -98,11 +113,24 @@ private:
         int iz,
         int iy,
         const base::Conv2dParam &param);
+    void enqueue_input(const core::Queue &queue, int slot);
+    void enqueue_output(const core::Queue &queue, int slot);
 private:
     int m_batch_size;
+    std::vector<uint16_t> m_input_stage[SLOT_COUNT];
+    std::vector<uint16_t> m_output_stage[SLOT_COUNT];
+    // overlapped mode: completion of slot transfers
+    core::Event m_input_written[SLOT_COUNT];
+    core::Event m_output_read[SLOT_COUNT];
+    // overlapped mode: last layers using input and output buffers are done
+    core::Event m_input_free;
+    core::Event m_output_free;
 };
 
 class ResNet18Mixed {
+public:
+    using StreamInput = std::function<void (int batch, std::vector<float> &data)>;
+    using StreamOutput = std::function<void (int batch, const std::vector<float> &data)>;
 public:
     ResNet18Mixed(
         const core::Device &device, 
@@ -119,6 +147,14 @@ public:
     void run_tail();
     void run_main();
     void run_head();
+    void run_stream(
+        int count,
+        const StreamInput &input,
+        const StreamOutput &output,
+        bool overlap);
+private:
+    void stream_tail(int batch, const StreamInput &input);
+    void stream_head(int batch, const StreamOutput &output);
 private:
     ResNet18MixedTail m_tail;
     ResNet18MixedMain m_main;
@@ -26,6 +26,14 @@ bool run(const util::NetCmdArgs &args) {
         run_mixed(args);
         return true;
     }
+    if (args.mode == "stream") {
+        run_stream(args);
+        return true;
+    }
+    if (args.mode == "pack") {
+        run_pack(args);
+        return true;
+    }
     fprintf(stderr, "Invalid mode: %s\n", args.mode.c_str());
     return false;
 }
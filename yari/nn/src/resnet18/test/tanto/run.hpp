@@ -10,4 +10,6 @@ using namespace ronin::nn::common::test;
 
 void run_global(const util::NetCmdArgs &args);
 void run_mixed(const util::NetCmdArgs &args);
+void run_stream(const util::NetCmdArgs &args);
+void run_pack(const util::NetCmdArgs &args);
 
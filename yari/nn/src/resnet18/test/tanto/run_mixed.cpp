@@ -2,6 +2,7 @@
 //
 // SPDX-License-Identifier: Apache-2.0
 
+#include <cstdio>
 #include <cstring>
 #include <cmath>
 #include <memory>
@@ -44,6 +45,7 @@ public:
     ~ResNet18MixedRunner();
 public:
     void run(const util::NetCmdArgs &args);
+    void run_stream(const util::NetCmdArgs &args);
 protected:
     void reorder_inputs() override;
     void infer_batch_size() override;
@@ -107,6 +109,49 @@ void ResNet18MixedRunner::run(const util::NetCmdArgs &args) {
     print_outputs();
 }
 
+void ResNet18MixedRunner::run_stream(const util::NetCmdArgs &args) {
+    // streams the same input batch through pipelined tail / main / head
+    reset(args);
+    read_inputs();
+    infer_batch_size();
+    reorder_inputs();
+    create_net();
+    validate_input_count();
+    validate_output_count();
+    init_net(args.data);
+    const std::vector<float> &frames = m_inputs[0];
+    auto input = [&frames](int batch, std::vector<float> &data) {
+        data = frames;
+    };
+    auto output = [](int batch, const std::vector<float> &data) { };
+    int count = std::max(args.repeat, 1);
+    float images = float(count) * float(m_batch_size);
+    // warmup
+    m_net->run_stream(1, input, output, false);
+    // baseline: device transfers and computation share one queue
+    util::Timer timer;
+    timer.start();
+    m_net->run_stream(count, input, output, false);
+    timer.stop();
+    float single_time = timer.elapsed();
+    printf("Single queue: throughput %g images/sec\n", images * 1000.0f / single_time);
+    // transfers on second queue overlap with computation
+    timer.reset();
+    timer.start();
+    m_net->run_stream(count, input, output, true);
+    timer.stop();
+    m_elapsed_time = timer.elapsed();
+    print_elapsed_time(count);
+    printf("Two queues: throughput %g images/sec (%.2fx)\n", 
+        images * 1000.0f / m_elapsed_time, single_time / m_elapsed_time);
+    if (args.compare) {
+        compare_outputs();
+    } else if (!args.outputs.empty()) {
+        write_outputs();
+    }
+    print_outputs();
+}
+
 void ResNet18MixedRunner::reorder_inputs() {
     m_inputs[0] = util::reorder_nchw_to_nhwc(m_inputs[0], m_batch_size, 224, 224, 3);
 }
@@ -186,3 +231,14 @@ void run_mixed(const util::NetCmdArgs &args) {
     device.close();
 }
 
+void run_stream(const util::NetCmdArgs &args) {
+    core::Platform platform = core::Platform::get_default();
+    core::Device device(platform, 0);
+    int algo_batch_size = get_algo_batch_size(args);
+    ResNet18MixedRunner runner(device, algo_batch_size);
+    runner.run_stream(args);
+    core::Queue queue(device, 0);
+    queue.finish();
+    device.close();
+}
+
@@ -0,0 +1,117 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "host/core/api.hpp"
+
+#include "host/tanto/weight_pack.hpp"
+#include "host/tanto/resnet18_global.hpp"
+
+#include "test/util/net.hpp"
+
+#include "test/tanto/run.hpp"
+
+namespace core = ronin::tanto::host;
+
+using namespace ronin::nn::common::test;
+
+namespace {
+
+using ronin::nn::common::tanto::WeightPack;
+using ronin::nn::common::tanto::WeightPackWriter;
+using ronin::nn::resnet18::tanto::ResNet18Global;
+
+constexpr uint32_t FORMAT = 0;
+constexpr uint64_t LAYOUT = 0x1234;
+constexpr uint64_t SOURCE = 0x5678;
+
+void report(const char *check, bool ok) {
+    printf("%s = %s\n", check, ok ? "OK" : "FAIL");
+}
+
+std::vector<uint8_t> make_data(uint32_t size, uint32_t seed) {
+    std::vector<uint8_t> data(size);
+    for (uint32_t i = 0; i < size; i++) {
+        data[i] = uint8_t(i * 7 + seed);
+    }
+    return data;
+}
+
+void run_pack_file(const std::string &path) {
+    printf("---- Pack file\n");
+    std::vector<uint8_t> data0 = make_data(5000, 1);
+    std::vector<uint8_t> data2 = make_data(1024, 2);
+    WeightPackWriter writer;
+    writer.add(0, FORMAT, LAYOUT, SOURCE, data0.data(), data0.size());
+    writer.add(2, FORMAT, LAYOUT + 2, SOURCE + 2, data2.data(), data2.size());
+    report("Save", writer.save(path));
+    WeightPack pack;
+    report("Open", pack.open(path));
+    const uint8_t *ptr0 = pack.find(0, FORMAT, data0.size(), LAYOUT, SOURCE);
+    const uint8_t *ptr2 = pack.find(2, FORMAT, data2.size(), LAYOUT + 2, SOURCE + 2);
+    bool match =
+        (ptr0 != nullptr && memcmp(ptr0, data0.data(), data0.size()) == 0 &&
+            ptr2 != nullptr && memcmp(ptr2, data2.data(), data2.size()) == 0);
+    report("Match", match);
+    // source file not available: layout is still checked
+    report("Match without source",
+        (pack.find(0, FORMAT, data0.size(), LAYOUT, WeightPack::NO_SOURCE) == ptr0));
+    report("Reject buffer", (pack.find(1, FORMAT, data0.size(), LAYOUT, SOURCE) == nullptr));
+    report("Reject format", (pack.find(0, FORMAT + 1, data0.size(), LAYOUT, SOURCE) == nullptr));
+    report("Reject size", (pack.find(0, FORMAT, data0.size() + 1, LAYOUT, SOURCE) == nullptr));
+    report("Reject layout", (pack.find(0, FORMAT, data0.size(), LAYOUT + 1, SOURCE) == nullptr));
+    report("Reject source", (pack.find(0, FORMAT, data0.size(), LAYOUT, SOURCE + 1) == nullptr));
+    report("Reject layout without source",
+        (pack.find(0, FORMAT, data0.size(), LAYOUT + 1, WeightPack::NO_SOURCE) == nullptr));
+    pack.close();
+    remove(path.c_str());
+}
+
+void run_pack_net(const std::string &data_dir, const std::string &path) {
+    printf("---- Pack net\n");
+    core::Platform platform = core::Platform::get_default();
+    core::Device device(platform, 0);
+    int batch_size = 16;
+    remove(path.c_str());
+    {
+        ResNet18Global net(device, batch_size, batch_size);
+        report("No pack", !net.load_pack(path));
+        net.set_pack_recording(true);
+        net.init(data_dir);
+        report("Save", net.save_pack(path));
+    }
+    {
+        // same layout and data: all buffers are read from pack
+        ResNet18Global net(device, batch_size, batch_size);
+        report("Open", net.load_pack(path));
+        net.init(data_dir);
+        report("All from pack", (net.pack_fallback_count() == 0));
+    }
+    {
+        // other weight format: conv buffers are rejected and read from data files
+        ResNet18Global net(device, batch_size, batch_size);
+        net.set_conv2d_weight_format("bfp8");
+        report("Open", net.load_pack(path));
+        net.init(data_dir);
+        report("Reject other format", (net.pack_fallback_count() > 0));
+    }
+    remove(path.c_str());
+    core::Queue queue(device, 0);
+    queue.finish();
+    device.close();
+}
+
+} // namespace
+
+void run_pack(const util::NetCmdArgs &args) {
+    std::string path = args.pack.empty() ? std::string("resnet18_test.pack") : args.pack;
+    run_pack_file(path);
+    run_pack_net(args.data, path);
+}
+
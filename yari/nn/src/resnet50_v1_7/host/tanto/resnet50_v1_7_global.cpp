@@ -128,6 +128,7 @@ ResNet50V17Global::~ResNet50V17Global() { }
 void ResNet50V17Global::init(const std::string &data_dir) {
     NetGlobal::set_data_dir(data_dir);
     init_layers();
+    plan_buffers();
     load_buffers();
 }
 
@@ -144,8 +145,8 @@ void ResNet50V17Global::set_input(int index, const std::vector<float> &data) {
     const core::Global &global = get_buffer(buffer_index);
     assert(!global.is_null());
     assert(input.size() * sizeof(uint16_t) == global.bytes());
-    core::Queue queue(device(), 0);
-    queue.enqueue_write(global, input.data(), false);
+    // only pages changed since previous input are transferred
+    write_input(buffer_index, input.data(), uint32_t(input.size() * sizeof(uint16_t)));
 }
 
 int ResNet50V17Global::output_count() {
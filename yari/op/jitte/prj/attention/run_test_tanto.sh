@@ -0,0 +1,20 @@
+#!/bin/bash
+
+# SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+#
+# SPDX-License-Identifier: Apache-2.0
+
+# Numeric check of attention device kernels on Jitte against the reference
+# implementation; TT-Metalium kernels of this operation are currently
+# written by hand (see src/attention/device/front.sh).
+# Kernels must be deployed with ../deploy_jitte.sh before running.
+# Exit status is nonzero if PCC of any configuration is too low.
+
+NAME=attention
+
+export TT_METAL_HOME=../../../../../jitte/home
+export TT_ARCH=wormhole_b0
+
+BIN=../../bin
+
+$BIN/$NAME/test_tanto attention_batch 16
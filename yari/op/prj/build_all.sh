@@ -9,6 +9,11 @@ cd ./common
 ./build_all.sh
 cd ..
 
+echo "Build attention"
+cd ./attention
+./build_all.sh
+cd ..
+
 echo "Build binary"
 cd ./binary
 ./build_all.sh
@@ -44,6 +49,11 @@ cd ./move
 ./build_all.sh
 cd ..
 
+echo "Build norm"
+cd ./norm
+./build_all.sh
+cd ..
+
 echo "Build pool"
 cd ./pool
 ./build_all.sh
@@ -54,6 +64,11 @@ cd ./reduce
 ./build_all.sh
 cd ..
 
+echo "Build softmax"
+cd ./softmax
+./build_all.sh
+cd ..
+
 echo "Done"
 
 
@@ -0,0 +1,11 @@
+#!/bin/bash
+
+# SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+#
+# SPDX-License-Identifier: Apache-2.0
+
+./build_host_ref.sh
+./build_host_tanto.sh
+./build_test_tanto.sh
+
+
@@ -13,6 +13,7 @@ LIB=../../lib
 
 $CXX -c -std=c++20 -stdlib=libstdc++ -O3 \
     -I $SRC/$NAME \
+    -I $SRC/common \
     $SRC/$NAME/host/ref/*.cpp
 
 mkdir -p $LIB/$NAME
@@ -24,6 +24,7 @@ $CXX -std=c++20 -stdlib=libstdc++ -O3 -o $BIN/$NAME/test_tanto \
     $SRC/$NAME/test/tanto/*.cpp \
     $LIB/$NAME/host_tanto.a \
     $LIB/$NAME/host_ref.a \
+    $LIB/common/host_base.a \
     $LIB/common/host_util.a \
     $LIB/common/test_util.a \
     $TANTO/lib/host/core.a \
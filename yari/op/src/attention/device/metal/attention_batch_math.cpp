@@ -0,0 +1,332 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "tanto/compute.h"
+
+#define T bfloat16
+
+namespace NAMESPACE {
+
+void matmul_slice(
+
+    Pipe pq, Pipe pk, uint32 idst, uint32 tiles) {
+  for (uint32 i = 0; i < tiles; i++) {
+    matmul_tiles(pq.cb_id, pk.cb_id, i, i, idst, true);
+  }
+}
+
+//
+//    Online softmax step for one block of 32 keys
+//
+//    pmax_old, psum, po_old hold the running state after previous blocks
+//    (ignored if j == 0); new state is produced in pmax_new, psum, po_new
+//
+
+void attend_block(Pipe pq_im, Pipe pk, Pipe pv, Pipe ps, Pipe ps_im, Pipe pp,
+                  Pipe palpha, Pipe pmax_old, Pipe pmax_new, Pipe psum,
+                  Pipe po_old, Pipe po_new, uint32 Dt, uint32 j,
+                  uint32 scale) {
+  // ps_im = (pq_im * pk^T) * scale
+  cb_wait_front(pk.cb_id, pk.frame_size);
+  {
+    tanto_unpack_matmul_init(pq_im.cb_id, pk.cb_id, true);
+    tanto_matmul_init(true);
+    tanto_pack_init(ps_im.cb_id);
+    tile_regs_acquire();
+    tile_regs_wait();
+    matmul_slice(pq_im, pk, 0, Dt);
+    tanto_binary_scalar_init();
+    mul_unary_tile(0, scale);
+    cb_reserve_back(ps_im.cb_id, ps_im.frame_size);
+    pack_tile(0, ps_im.cb_id);
+    cb_push_back(ps_im.cb_id, ps_im.frame_size);
+    tile_regs_commit();
+    tile_regs_release();
+  }
+  cb_pop_front(pk.cb_id, pk.frame_size);
+  // pmax_new = max(pmax_old, max(ps_im))
+  cb_wait_front(ps_im.cb_id, ps_im.frame_size);
+  if (j != 0) {
+    cb_wait_front(pmax_old.cb_id, pmax_old.frame_size);
+  }
+  {
+    tile_regs_acquire();
+    tile_regs_wait();
+    if (j != 0) {
+      tanto_unpack_unary_init(pmax_old.cb_id);
+      tanto_copy_init();
+      copy_tile(pmax_old.cb_id, 0, 0);
+    }
+    tanto_unpack_reduce_rows_init(ps_im.cb_id, ps.cb_id);
+    tanto_reduce_max_rows_init();
+    tanto_pack_row_init(pmax_new.cb_id);
+    reduce_tile<PoolType::MAX, ReduceDim::REDUCE_ROW>(ps_im.cb_id, ps.cb_id, 0,
+                                                      0, 0);
+    cb_reserve_back(pmax_new.cb_id, pmax_new.frame_size);
+    pack_tile(0, pmax_new.cb_id);
+    cb_push_back(pmax_new.cb_id, pmax_new.frame_size);
+    tile_regs_commit();
+    tile_regs_release();
+  }
+  // pp = exp(ps_im - pmax_new)
+  cb_wait_front(pmax_new.cb_id, pmax_new.frame_size);
+  {
+    tanto_unpack_bcast_cols_init(ps_im.cb_id, pmax_new.cb_id);
+    tanto_sub_bcast_cols_init();
+    tanto_pack_init(pp.cb_id);
+    tile_regs_acquire();
+    tile_regs_wait();
+    any_tiles_bcast<EltwiseBinaryType::ELWSUB, BroadcastType::COL>(
+        ps_im.cb_id, pmax_new.cb_id, 0, 0, 0);
+    tanto_exp_init();
+    exp_tile(0, FAST_AND_APPROX);
+    cb_reserve_back(pp.cb_id, pp.frame_size);
+    pack_tile(0, pp.cb_id);
+    cb_push_back(pp.cb_id, pp.frame_size);
+    tile_regs_commit();
+    tile_regs_release();
+  }
+  cb_pop_front(ps_im.cb_id, ps_im.frame_size);
+  // palpha = exp(pmax_old - pmax_new)
+  if (j != 0) {
+    {
+      tanto_unpack_binary_init(pmax_old.cb_id, pmax_new.cb_id);
+      tanto_sub_init();
+      tanto_pack_init(palpha.cb_id);
+      tile_regs_acquire();
+      tile_regs_wait();
+      sub_tiles(pmax_old.cb_id, pmax_new.cb_id, 0, 0, 0);
+      tanto_exp_init();
+      exp_tile(0, FAST_AND_APPROX);
+      cb_reserve_back(palpha.cb_id, palpha.frame_size);
+      pack_tile(0, palpha.cb_id);
+      cb_push_back(palpha.cb_id, palpha.frame_size);
+      tile_regs_commit();
+      tile_regs_release();
+    }
+    cb_pop_front(pmax_old.cb_id, pmax_old.frame_size);
+    cb_wait_front(palpha.cb_id, palpha.frame_size);
+  }
+  // psum = psum * palpha + sum(pp)
+  cb_wait_front(pp.cb_id, pp.frame_size);
+  {
+    tile_regs_acquire();
+    tile_regs_wait();
+    if (j != 0) {
+      cb_wait_front(psum.cb_id, psum.frame_size);
+      tanto_unpack_binary_init(psum.cb_id, palpha.cb_id);
+      tanto_mul_init();
+      mul_tiles(psum.cb_id, palpha.cb_id, 0, 0, 0);
+      cb_pop_front(psum.cb_id, psum.frame_size);
+    }
+    tanto_unpack_reduce_rows_init(pp.cb_id, ps.cb_id);
+    tanto_reduce_sum_rows_init();
+    tanto_pack_row_init(psum.cb_id);
+    reduce_tile<PoolType::SUM, ReduceDim::REDUCE_ROW>(pp.cb_id, ps.cb_id, 0, 0,
+                                                      0);
+    cb_reserve_back(psum.cb_id, psum.frame_size);
+    pack_tile(0, psum.cb_id);
+    cb_push_back(psum.cb_id, psum.frame_size);
+    tile_regs_commit();
+    tile_regs_release();
+  }
+  // po_new = po_old * palpha + pp * pv
+  cb_wait_front(pv.cb_id, pv.frame_size);
+  if (j != 0) {
+    cb_wait_front(po_old.cb_id, po_old.frame_size);
+  }
+  cb_reserve_back(po_new.cb_id, po_new.frame_size);
+  tanto_pack_init(po_new.cb_id);
+  for (uint32 d = 0; d < Dt; d++) {
+    tile_regs_acquire();
+    tile_regs_wait();
+    if (j != 0) {
+      tanto_unpack_bcast_cols_init(po_old.cb_id, palpha.cb_id);
+      tanto_mul_bcast_cols_init();
+      any_tiles_bcast<EltwiseBinaryType::ELWMUL, BroadcastType::COL>(
+          po_old.cb_id, palpha.cb_id, d, 0, 0);
+    }
+    tanto_unpack_matmul_init(pp.cb_id, pv.cb_id, false);
+    tanto_matmul_init(false);
+    matmul_tiles(pp.cb_id, pv.cb_id, 0, d, 0, false);
+    pack_tile(0, po_new.cb_id);
+    tile_regs_commit();
+    tile_regs_release();
+  }
+  cb_push_back(po_new.cb_id, po_new.frame_size);
+  if (j != 0) {
+    cb_pop_front(po_old.cb_id, po_old.frame_size);
+    cb_pop_front(palpha.cb_id, palpha.frame_size);
+  }
+  cb_pop_front(pv.cb_id, pv.frame_size);
+  cb_pop_front(pp.cb_id, pp.frame_size);
+}
+
+void normalize(Pipe pmax, Pipe psum, Pipe po, Pipe palpha, Pipe py_im,
+               uint32 Dt) {
+  // running maximum is not needed anymore
+  cb_wait_front(pmax.cb_id, pmax.frame_size);
+  cb_pop_front(pmax.cb_id, pmax.frame_size);
+  // palpha = recip(psum)
+  cb_wait_front(psum.cb_id, psum.frame_size);
+  {
+    tanto_unpack_unary_init(psum.cb_id);
+    tanto_copy_init();
+    tanto_pack_init(palpha.cb_id);
+    tile_regs_acquire();
+    tile_regs_wait();
+    copy_tile(psum.cb_id, 0, 0);
+    tanto_recip_init();
+    recip_tile(0);
+    cb_reserve_back(palpha.cb_id, palpha.frame_size);
+    pack_tile(0, palpha.cb_id);
+    cb_push_back(palpha.cb_id, palpha.frame_size);
+    tile_regs_commit();
+    tile_regs_release();
+  }
+  cb_pop_front(psum.cb_id, psum.frame_size);
+  // py_im = po * palpha
+  cb_wait_front(palpha.cb_id, palpha.frame_size);
+  cb_wait_front(po.cb_id, po.frame_size);
+  cb_reserve_back(py_im.cb_id, py_im.frame_size);
+  tanto_unpack_bcast_cols_init(po.cb_id, palpha.cb_id);
+  tanto_mul_bcast_cols_init();
+  tanto_pack_init(py_im.cb_id);
+  for (uint32 d = 0; d < Dt; d++) {
+    tile_regs_acquire();
+    tile_regs_wait();
+    any_tiles_bcast<EltwiseBinaryType::ELWMUL, BroadcastType::COL>(
+        po.cb_id, palpha.cb_id, d, 0, 0);
+    pack_tile(0, py_im.cb_id);
+    tile_regs_commit();
+    tile_regs_release();
+  }
+  cb_push_back(py_im.cb_id, py_im.frame_size);
+  cb_pop_front(po.cb_id, po.frame_size);
+  cb_pop_front(palpha.cb_id, palpha.frame_size);
+}
+
+void kernel(Pipe pq, Pipe pk, Pipe pv, Pipe ps, Pipe py, Pipe pq_im,
+            Pipe ps_im, Pipe pp, Pipe palpha, Pipe pmax0, Pipe pmax1,
+            Pipe psum, Pipe po0, Pipe po1, Pipe py_im, uint32 N, uint32 Sq,
+            uint32 Skv, uint32 D, uint32 scale) {
+  uint32 Qt = Sq / 32;
+  uint32 Jt = Skv / 32;
+  uint32 Dt = D / 32;
+  pq.frame_size = Dt;
+  pk.frame_size = Dt;
+  pv.frame_size = Dt;
+  ps.frame_size = 1;
+  py.frame_size = Dt;
+  pq_im.frame_size = Dt;
+  ps_im.frame_size = 1;
+  pp.frame_size = 1;
+  palpha.frame_size = 1;
+  pmax0.frame_size = 1;
+  pmax1.frame_size = 1;
+  psum.frame_size = 1;
+  po0.frame_size = Dt;
+  po1.frame_size = Dt;
+  py_im.frame_size = Dt;
+  cb_wait_front(ps.cb_id, ps.frame_size);
+  for (uint32 n = 0; n < N; n++) {
+    for (uint32 q = 0; q < Qt; q++) {
+      // pq_im = tilize(pq)
+      cb_reserve_back(pq_im.cb_id, pq_im.frame_size);
+      cb_wait_front(pq.cb_id, pq.frame_size);
+      tanto_unpack_tilize_block_init(pq.cb_id, Dt);
+      tanto_copy_init();
+      tanto_pack_init(pq_im.cb_id);
+      tilize_block(pq.cb_id, Dt, pq_im.cb_id);
+      cb_pop_front(pq.cb_id, pq.frame_size);
+      cb_push_back(pq_im.cb_id, pq_im.frame_size);
+      cb_wait_front(pq_im.cb_id, pq_im.frame_size);
+      // running state alternates between pipe pairs 0 and 1
+      for (uint32 j = 0; j < Jt; j++) {
+        if (j % 2 == 0) {
+          attend_block(pq_im, pk, pv, ps, ps_im, pp, palpha, pmax1, pmax0,
+                       psum, po1, po0, Dt, j, scale);
+        } else {
+          attend_block(pq_im, pk, pv, ps, ps_im, pp, palpha, pmax0, pmax1,
+                       psum, po0, po1, Dt, j, scale);
+        }
+      }
+      cb_pop_front(pq_im.cb_id, pq_im.frame_size);
+      // py_im = po / psum
+      if (Jt % 2 != 0) {
+        normalize(pmax0, psum, po0, palpha, py_im, Dt);
+      } else {
+        normalize(pmax1, psum, po1, palpha, py_im, Dt);
+      }
+      // py = untilize(py_im)
+      cb_reserve_back(py.cb_id, py.frame_size);
+      cb_wait_front(py_im.cb_id, py_im.frame_size);
+      tanto_unpack_untilize_block_init(py_im.cb_id);
+      tanto_copy_init();
+      tanto_pack_init(py.cb_id);
+      untilize_block<1>(py_im.cb_id, Dt, py.cb_id);
+      cb_pop_front(py_im.cb_id, py_im.frame_size);
+      cb_push_back(py.cb_id, py.frame_size);
+    }
+  }
+  cb_pop_front(ps.cb_id, ps.frame_size);
+}
+
+void MAIN {
+  Pipe pq;
+  pq.cb_id = get_arg_val<uint32>(0);
+  pq.frame_size = get_arg_val<uint32>(1);
+  Pipe pk;
+  pk.cb_id = get_arg_val<uint32>(2);
+  pk.frame_size = get_arg_val<uint32>(3);
+  Pipe pv;
+  pv.cb_id = get_arg_val<uint32>(4);
+  pv.frame_size = get_arg_val<uint32>(5);
+  Pipe ps;
+  ps.cb_id = get_arg_val<uint32>(6);
+  ps.frame_size = get_arg_val<uint32>(7);
+  Pipe py;
+  py.cb_id = get_arg_val<uint32>(8);
+  py.frame_size = get_arg_val<uint32>(9);
+  Pipe pq_im;
+  pq_im.cb_id = get_arg_val<uint32>(10);
+  pq_im.frame_size = get_arg_val<uint32>(11);
+  Pipe ps_im;
+  ps_im.cb_id = get_arg_val<uint32>(12);
+  ps_im.frame_size = get_arg_val<uint32>(13);
+  Pipe pp;
+  pp.cb_id = get_arg_val<uint32>(14);
+  pp.frame_size = get_arg_val<uint32>(15);
+  Pipe palpha;
+  palpha.cb_id = get_arg_val<uint32>(16);
+  palpha.frame_size = get_arg_val<uint32>(17);
+  Pipe pmax0;
+  pmax0.cb_id = get_arg_val<uint32>(18);
+  pmax0.frame_size = get_arg_val<uint32>(19);
+  Pipe pmax1;
+  pmax1.cb_id = get_arg_val<uint32>(20);
+  pmax1.frame_size = get_arg_val<uint32>(21);
+  Pipe psum;
+  psum.cb_id = get_arg_val<uint32>(22);
+  psum.frame_size = get_arg_val<uint32>(23);
+  Pipe po0;
+  po0.cb_id = get_arg_val<uint32>(24);
+  po0.frame_size = get_arg_val<uint32>(25);
+  Pipe po1;
+  po1.cb_id = get_arg_val<uint32>(26);
+  po1.frame_size = get_arg_val<uint32>(27);
+  Pipe py_im;
+  py_im.cb_id = get_arg_val<uint32>(28);
+  py_im.frame_size = get_arg_val<uint32>(29);
+  uint32 N = get_arg_val<uint32>(30);
+  uint32 Sq = get_arg_val<uint32>(31);
+  uint32 Skv = get_arg_val<uint32>(32);
+  uint32 D = get_arg_val<uint32>(33);
+  uint32 scale = get_arg_val<uint32>(34);
+  tanto_compute_init();
+  kernel(pq, pk, pv, ps, py, pq_im, ps_im, pp, palpha, pmax0, pmax1, psum, po0,
+         po1, py_im, N, Sq, Skv, D, scale);
+}
+} // namespace NAMESPACE
+
@@ -0,0 +1,120 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "tanto/dataflow.h"
+
+#define T bfloat16
+
+void read_pq(Global gq, Local lzero, Pipe pq, uint32 Sq, uint32 D,
+             uint32 q_start, uint32 h_start) {
+  uint32 src_pos = q_start;
+  uint32 dst_pos = 0;
+  cb_reserve_back(pq.cb_id, pq.frame_size);
+  for (uint32 i = 0; i < 32; i++) {
+    if (h_start + i >= Sq) {
+      noc_async_read(get_noc_addr(lzero.addr + (0 << 1)),
+                     get_write_ptr(pq.cb_id) + (dst_pos << 1), D << 1);
+    } else {
+      noc_async_read_global_dram(get_write_ptr(pq.cb_id) + (dst_pos << 1),
+                                 gq.addr, gq.log2_page_size, src_pos << 1,
+                                 D << 1);
+    }
+    src_pos += D;
+    dst_pos += D;
+  }
+  noc_async_read_barrier();
+  cb_push_back(pq.cb_id, pq.frame_size);
+}
+
+void read_pkv(Global gk, Global gv, Pipe pk, Pipe pv, uint32 D,
+              uint32 kv_start) {
+  // K and V are pre-tilized: block of 32 rows is contiguous
+  cb_reserve_back(pk.cb_id, pk.frame_size);
+  cb_reserve_back(pv.cb_id, pv.frame_size);
+  noc_async_read_global_dram(get_write_ptr(pk.cb_id) + (0 << 1), gk.addr,
+                             gk.log2_page_size, kv_start << 1, (D * 32) << 1);
+  noc_async_read_global_dram(get_write_ptr(pv.cb_id) + (0 << 1), gv.addr,
+                             gv.log2_page_size, kv_start << 1, (D * 32) << 1);
+  noc_async_read_barrier();
+  cb_push_back(pk.cb_id, pk.frame_size);
+  cb_push_back(pv.cb_id, pv.frame_size);
+}
+
+void kernel(Global gq, Global gk, Global gv, Global gs, Global gzero,
+            Local lzero, Pipe pq, Pipe pk, Pipe pv, Pipe ps, uint32 N,
+            uint32 Sq, uint32 Skv, uint32 D, uint32 zero_size, uint32 q_pos,
+            uint32 q_stride, uint32 kv_pos, uint32 kv_stride) {
+  uint32 Dt = D / 32;
+  noc_async_read_global_dram(lzero.addr + (0 << 1), gzero.addr,
+                             gzero.log2_page_size, 0 << 1, zero_size << 1);
+  // read_barrier is below
+  pq.frame_size = Dt;
+  pk.frame_size = Dt;
+  pv.frame_size = Dt;
+  ps.frame_size = 1;
+  cb_reserve_back(ps.cb_id, ps.frame_size);
+  noc_async_read_global_dram(get_write_ptr(ps.cb_id) + (0 << 1), gs.addr,
+                             gs.log2_page_size, 0 << 1, 1024 << 1);
+  noc_async_read_barrier();
+  cb_push_back(ps.cb_id, ps.frame_size);
+  uint32 q_start = q_pos;
+  uint32 kv_base = kv_pos;
+  for (uint32 n = 0; n < N; n++) {
+    for (uint32 h_start = 0; h_start < Sq; h_start += 32) {
+      read_pq(gq, lzero, pq, Sq, D, q_start, h_start);
+      uint32 kv_start = kv_base;
+      for (uint32 j = 0; j < Skv; j += 32) {
+        read_pkv(gk, gv, pk, pv, D, kv_start);
+        kv_start += D * 32;
+      }
+      q_start += D * 32;
+    }
+    q_start += q_stride;
+    kv_base += kv_stride;
+  }
+}
+
+void kernel_main() {
+  Global gq;
+  gq.addr = get_arg_val<uint32>(0);
+  gq.log2_page_size = get_arg_val<uint32>(1);
+  Global gk;
+  gk.addr = get_arg_val<uint32>(2);
+  gk.log2_page_size = get_arg_val<uint32>(3);
+  Global gv;
+  gv.addr = get_arg_val<uint32>(4);
+  gv.log2_page_size = get_arg_val<uint32>(5);
+  Global gs;
+  gs.addr = get_arg_val<uint32>(6);
+  gs.log2_page_size = get_arg_val<uint32>(7);
+  Global gzero;
+  gzero.addr = get_arg_val<uint32>(8);
+  gzero.log2_page_size = get_arg_val<uint32>(9);
+  Local lzero;
+  lzero.addr = get_arg_val<uint32>(10);
+  Pipe pq;
+  pq.cb_id = get_arg_val<uint32>(11);
+  pq.frame_size = get_arg_val<uint32>(12);
+  Pipe pk;
+  pk.cb_id = get_arg_val<uint32>(13);
+  pk.frame_size = get_arg_val<uint32>(14);
+  Pipe pv;
+  pv.cb_id = get_arg_val<uint32>(15);
+  pv.frame_size = get_arg_val<uint32>(16);
+  Pipe ps;
+  ps.cb_id = get_arg_val<uint32>(17);
+  ps.frame_size = get_arg_val<uint32>(18);
+  uint32 N = get_arg_val<uint32>(19);
+  uint32 Sq = get_arg_val<uint32>(20);
+  uint32 Skv = get_arg_val<uint32>(21);
+  uint32 D = get_arg_val<uint32>(22);
+  uint32 zero_size = get_arg_val<uint32>(23);
+  uint32 q_pos = get_arg_val<uint32>(24);
+  uint32 q_stride = get_arg_val<uint32>(25);
+  uint32 kv_pos = get_arg_val<uint32>(26);
+  uint32 kv_stride = get_arg_val<uint32>(27);
+  kernel(gq, gk, gv, gs, gzero, lzero, pq, pk, pv, ps, N, Sq, Skv, D,
+         zero_size, q_pos, q_stride, kv_pos, kv_stride);
+}
+
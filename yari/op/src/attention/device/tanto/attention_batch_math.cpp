@@ -0,0 +1,265 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+void matmul_slice(
+        math<T> acc,
+        pipe<T> pq,
+        pipe<T> pk,
+        uint32 idst,
+        uint32 tiles) {
+    for (uint32 i = 0; i < tiles; i++) {
+        acc.matmul(pq, pk, i, i, idst, true);
+    }
+}
+
+//
+//    Online softmax step for one block of 32 keys
+//
+//    pmax_old, psum, po_old hold the running state after previous blocks
+//    (ignored if j == 0); new state is produced in pmax_new, psum, po_new
+//
+
+void attend_block(
+        pipe<T> pq_im,
+        pipe<T> pk,
+        pipe<T> pv,
+        pipe<T> ps,
+        pipe<T> ps_im,
+        pipe<T> pp,
+        pipe<T> palpha,
+        pipe<T> pmax_old,
+        pipe<T> pmax_new,
+        pipe<T> psum,
+        pipe<T> po_old,
+        pipe<T> po_new,
+        uint32 Dt,
+        uint32 j,
+        uint32 scale) {
+    // ps_im = (pq_im * pk^T) * scale
+    pk.wait_front();
+    {
+        math<T> acc;
+        matmul_slice(acc, pq_im, pk, 0, Dt);
+        acc.mul_scalar(0, scale);
+        ps_im.reserve_back();
+        acc.pack(0, ps_im);
+        ps_im.push_back();
+    }
+    pk.pop_front();
+    // pmax_new = max(pmax_old, max(ps_im))
+    ps_im.wait_front();
+    if (j != 0) {
+        pmax_old.wait_front();
+    }
+    {
+        math<T> acc;
+        if (j != 0) {
+            acc.copy(pmax_old, 0, 0);
+        }
+        acc.reduce_max_rows(ps_im, ps, 0, 0, 0);
+        pmax_new.reserve_back();
+        acc.pack_row(0, pmax_new);
+        pmax_new.push_back();
+    }
+    // pp = exp(ps_im - pmax_new)
+    pmax_new.wait_front();
+    {
+        math<T> acc;
+        acc.sub_bcast_cols(ps_im, pmax_new, 0, 0, 0);
+        acc.exp(0);
+        pp.reserve_back();
+        acc.pack(0, pp);
+        pp.push_back();
+    }
+    ps_im.pop_front();
+    // palpha = exp(pmax_old - pmax_new)
+    if (j != 0) {
+        {
+            math<T> acc;
+            acc.sub(pmax_old, pmax_new, 0, 0, 0);
+            acc.exp(0);
+            palpha.reserve_back();
+            acc.pack(0, palpha);
+            palpha.push_back();
+        }
+        pmax_old.pop_front();
+        palpha.wait_front();
+    }
+    // psum = psum * palpha + sum(pp)
+    pp.wait_front();
+    {
+        math<T> acc;
+        if (j != 0) {
+            psum.wait_front();
+            acc.mul(psum, palpha, 0, 0, 0);
+            psum.pop_front();
+        }
+        acc.reduce_sum_rows(pp, ps, 0, 0, 0);
+        psum.reserve_back();
+        acc.pack_row(0, psum);
+        psum.push_back();
+    }
+    // po_new = po_old * palpha + pp * pv
+    pv.wait_front();
+    if (j != 0) {
+        po_old.wait_front();
+    }
+    po_new.reserve_back();
+    for (uint32 d = 0; d < Dt; d++) {
+        math<T> acc;
+        if (j != 0) {
+            acc.mul_bcast_cols(po_old, palpha, d, 0, 0);
+        }
+        acc.matmul(pp, pv, 0, d, 0, false);
+        acc.pack(0, po_new);
+    }
+    po_new.push_back();
+    if (j != 0) {
+        po_old.pop_front();
+        palpha.pop_front();
+    }
+    pv.pop_front();
+    pp.pop_front();
+}
+
+void normalize(
+        pipe<T> pmax,
+        pipe<T> psum,
+        pipe<T> po,
+        pipe<T> palpha,
+        pipe<T> py_im,
+        uint32 Dt) {
+    // running maximum is not needed anymore
+    pmax.wait_front();
+    pmax.pop_front();
+    // palpha = recip(psum)
+    psum.wait_front();
+    {
+        math<T> acc;
+        acc.copy(psum, 0, 0);
+        acc.recip(0);
+        palpha.reserve_back();
+        acc.pack(0, palpha);
+        palpha.push_back();
+    }
+    psum.pop_front();
+    // py_im = po * palpha
+    palpha.wait_front();
+    po.wait_front();
+    py_im.reserve_back();
+    for (uint32 d = 0; d < Dt; d++) {
+        math<T> acc;
+        acc.mul_bcast_cols(po, palpha, d, 0, 0);
+        acc.pack(0, py_im);
+    }
+    py_im.push_back();
+    po.pop_front();
+    palpha.pop_front();
+}
+
+void kernel(
+        pipe<T> pq,
+        pipe<T> pk,
+        pipe<T> pv,
+        pipe<T> ps,
+        pipe<T> py,
+        pipe<T> pq_im,
+        pipe<T> ps_im,
+        pipe<T> pp,
+        pipe<T> palpha,
+        pipe<T> pmax0,
+        pipe<T> pmax1,
+        pipe<T> psum,
+        pipe<T> po0,
+        pipe<T> po1,
+        pipe<T> py_im,
+        uint32 N,
+        uint32 Sq,
+        uint32 Skv,
+        uint32 D,
+        uint32 scale) {
+    uint32 Qt = Sq / 32;
+    uint32 Jt = Skv / 32;
+    uint32 Dt = D / 32;
+    pq.set_frame(Dt);
+    pk.set_frame(Dt);
+    pv.set_frame(Dt);
+    ps.set_frame(1);
+    py.set_frame(Dt);
+    pq_im.set_frame(Dt);
+    ps_im.set_frame(1);
+    pp.set_frame(1);
+    palpha.set_frame(1);
+    pmax0.set_frame(1);
+    pmax1.set_frame(1);
+    psum.set_frame(1);
+    po0.set_frame(Dt);
+    po1.set_frame(Dt);
+    py_im.set_frame(Dt);
+    ps.wait_front();
+    for (uint32 n = 0; n < N; n++) {
+        for (uint32 q = 0; q < Qt; q++) {
+            // pq_im = tilize(pq)
+            pq_im.reserve_back();
+            pq.wait_front();
+            tilize_block(pq, Dt, pq_im);
+            pq.pop_front();
+            pq_im.push_back();
+            pq_im.wait_front();
+            // running state alternates between pipe pairs 0 and 1
+            for (uint32 j = 0; j < Jt; j++) {
+                if (j % 2 == 0) {
+                    attend_block(
+                        pq_im,
+                        pk,
+                        pv,
+                        ps,
+                        ps_im,
+                        pp,
+                        palpha,
+                        pmax1,
+                        pmax0,
+                        psum,
+                        po1,
+                        po0,
+                        Dt,
+                        j,
+                        scale);
+                } else {
+                    attend_block(
+                        pq_im,
+                        pk,
+                        pv,
+                        ps,
+                        ps_im,
+                        pp,
+                        palpha,
+                        pmax0,
+                        pmax1,
+                        psum,
+                        po0,
+                        po1,
+                        Dt,
+                        j,
+                        scale);
+                }
+            }
+            pq_im.pop_front();
+            // py_im = po / psum
+            if (Jt % 2 != 0) {
+                normalize(pmax0, psum, po0, palpha, py_im, Dt);
+            } else {
+                normalize(pmax1, psum, po1, palpha, py_im, Dt);
+            }
+            // py = untilize(py_im)
+            py.reserve_back();
+            py_im.wait_front();
+            untilize_block(py_im, Dt, py);
+            py_im.pop_front();
+            py.push_back();
+        }
+    }
+    ps.pop_front();
+}
+
@@ -0,0 +1,106 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+void read_pq(
+        global<T> gq,
+        local<T> lzero,
+        pipe<T> pq,
+        uint32 Sq,
+        uint32 D,
+        uint32 q_start,
+        uint32 h_start) {
+    uint32 src_pos = q_start;
+    uint32 dst_pos = 0;
+    pq.reserve_back();
+    for (uint32 i = 0; i < 32; i++) {
+        if (h_start + i >= Sq) {
+            pq.read(dst_pos, lzero, 0, D);
+        } else {
+            pq.read(dst_pos, gq, src_pos, D);
+        }
+        src_pos += D;
+        dst_pos += D;
+    }
+    read_barrier();
+    pq.push_back();
+}
+
+void read_pkv(
+        global<T> gk,
+        global<T> gv,
+        pipe<T> pk,
+        pipe<T> pv,
+        uint32 D,
+        uint32 kv_start) {
+    // K and V are pre-tilized: block of 32 rows is contiguous
+    pk.reserve_back();
+    pv.reserve_back();
+    pk.read(0, gk, kv_start, D * 32);
+    pv.read(0, gv, kv_start, D * 32);
+    read_barrier();
+    pk.push_back();
+    pv.push_back();
+}
+
+void kernel(
+        global<T> gq,
+        global<T> gk,
+        global<T> gv,
+        global<T> gs,
+        global<T> gzero,
+        local<T> lzero,
+        pipe<T> pq,
+        pipe<T> pk,
+        pipe<T> pv,
+        pipe<T> ps,
+        uint32 N,
+        uint32 Sq,
+        uint32 Skv,
+        uint32 D,
+        uint32 zero_size,
+        uint32 q_pos,
+        uint32 q_stride,
+        uint32 kv_pos,
+        uint32 kv_stride) {
+    uint32 Dt = D / 32;
+    lzero.read(0, gzero, 0, zero_size);
+    // read_barrier is below
+    pq.set_frame(Dt);
+    pk.set_frame(Dt);
+    pv.set_frame(Dt);
+    ps.set_frame(1);
+    ps.reserve_back();
+    ps.read(0, gs, 0, 1024);
+    read_barrier();
+    ps.push_back();
+    uint32 q_start = q_pos;
+    uint32 kv_base = kv_pos;
+    for (uint32 n = 0; n < N; n++) {
+        for (uint32 h_start = 0; h_start < Sq; h_start += 32) {
+            read_pq(
+                gq,
+                lzero,
+                pq,
+                Sq,
+                D,
+                q_start,
+                h_start);
+            uint32 kv_start = kv_base;
+            for (uint32 j = 0; j < Skv; j += 32) {
+                read_pkv(
+                    gk,
+                    gv,
+                    pk,
+                    pv,
+                    D,
+                    kv_start);
+                kv_start += D * 32;
+            }
+            q_start += D * 32;
+        }
+        q_start += q_stride;
+        kv_base += kv_stride;
+    }
+}
+
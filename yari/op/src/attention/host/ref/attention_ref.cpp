@@ -0,0 +1,112 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <algorithm>
+
+#include "host/ref/attention_ref.hpp"
+
+namespace ronin {
+namespace op {
+namespace attention {
+namespace ref {
+
+//
+//    AttentionRef
+//
+
+AttentionRef::AttentionRef(
+        int N,
+        int Sq,
+        int Skv,
+        int D,
+        float scale):
+            m_N(N),
+            m_Sq(Sq),
+            m_Skv(Skv),
+            m_D(D),
+            m_scale(scale) { }
+
+AttentionRef::~AttentionRef() { }
+
+void AttentionRef::init(
+        const float *q,
+        const float *k,
+        const float *v,
+        const float *mask,
+        float *y) {
+    m_q = q;
+    m_k = k;
+    m_v = v;
+    m_mask = mask;
+    m_y = y;
+}
+
+void AttentionRef::run() {
+    std::vector<float> s(m_Skv);
+    for (int n = 0; n < m_N; n++) {
+        const float *pk = m_k + n * m_Skv * m_D;
+        const float *pv = m_v + n * m_Skv * m_D;
+        for (int i = 0; i < m_Sq; i++) {
+            const float *pq = m_q + (n * m_Sq + i) * m_D;
+            const float *pm = (m_mask != nullptr) ? m_mask + i * m_Skv : nullptr;
+            float *py = m_y + (n * m_Sq + i) * m_D;
+            float vmax = std::numeric_limits<float>::lowest();
+            for (int j = 0; j < m_Skv; j++) {
+                float t = 0.0f;
+                for (int d = 0; d < m_D; d++) {
+                    t += pq[d] * pk[j * m_D + d];
+                }
+                t *= m_scale;
+                if (pm != nullptr) {
+                    t += pm[j];
+                }
+                s[j] = t;
+                vmax = std::max(vmax, t);
+            }
+            float sum = 0.0f;
+            for (int j = 0; j < m_Skv; j++) {
+                s[j] = std::exp(s[j] - vmax);
+                sum += s[j];
+            }
+            float inv = 1.0f / sum;
+            for (int d = 0; d < m_D; d++) {
+                float t = 0.0f;
+                for (int j = 0; j < m_Skv; j++) {
+                    t += s[j] * pv[j * m_D + d];
+                }
+                py[d] = t * inv;
+            }
+        }
+    }
+}
+
+int AttentionRef::input_volume(int index) {
+    switch (index) {
+    case 0:
+        return m_N * m_Sq * m_D;
+    case 1:
+    case 2:
+        return m_N * m_Skv * m_D;
+    case 3:
+        return m_Sq * m_Skv;
+    default:
+        assert(false);
+        return 0;
+    }
+}
+
+int AttentionRef::output_volume(int index) {
+    assert(index == 0);
+    return m_N * m_Sq * m_D;
+}
+
+} // namespace ref
+} // namespace attention
+} // namespace op
+} // namespace ronin
+
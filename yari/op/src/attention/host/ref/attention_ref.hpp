@@ -0,0 +1,49 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+namespace ronin {
+namespace op {
+namespace attention {
+namespace ref {
+
+class AttentionRef {
+public:
+    AttentionRef(
+        int N,
+        int Sq,
+        int Skv,
+        int D,
+        float scale);
+    ~AttentionRef();
+public:
+    // mask [Sq, Skv] is optional (nullptr if not used)
+    void init(
+        const float *q,
+        const float *k,
+        const float *v,
+        const float *mask,
+        float *y);
+    void run();
+    int input_volume(int index);
+    int output_volume(int index);
+private:
+    const float *m_q = nullptr;
+    const float *m_k = nullptr;
+    const float *m_v = nullptr;
+    const float *m_mask = nullptr;
+    float *m_y = nullptr;
+    int m_N = 0;
+    int m_Sq = 0;
+    int m_Skv = 0;
+    int m_D = 0;
+    float m_scale = 0.0f;
+};
+
+} // namespace ref
+} // namespace attention
+} // namespace op
+} // namespace ronin
+
@@ -0,0 +1,577 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdint>
+#include <cassert>
+#include <string>
+#include <vector>
+
+#include "host/core/api.hpp"
+
+#include "host/util/transform.hpp"
+
+#include "host/tanto/util.hpp"
+#include "host/tanto/attention_batch.hpp"
+
+namespace ronin {
+namespace op {
+namespace attention {
+namespace tanto {
+
+namespace core = ronin::tanto::host;
+namespace util = ronin::op::common::util;
+
+namespace {
+
+uint32_t float_as_u32(float x) {
+    union U32 {
+        float f;
+        uint32_t i;
+    } u32;
+    u32.f = x;
+    return u32.i;
+}
+
+uint16_t float_to_u16b(float x) {
+    return uint16_t(float_as_u32(x) >> 16);
+}
+
+} // namespace
+
+//
+//    AttentionBatch
+//
+
+AttentionBatch::AttentionBatch(
+        int N,
+        int Sq,
+        int Skv,
+        int D,
+        float scale,
+        bool mask,
+        int batch_size):
+            m_N(N),
+            m_Sq(Sq),
+            m_Skv(Skv),
+            m_D(D),
+            m_scale(scale),
+            m_mask(mask),
+            m_batch_size(batch_size) { }
+
+AttentionBatch::~AttentionBatch() { }
+
+void AttentionBatch::init(
+        const core::Device &device,
+        const core::Global &gq,
+        const core::Global &gk,
+        const core::Global &gv,
+        const core::Global &gm,
+        const core::Global &gy) {
+    m_device = device;
+    m_gq = gq;
+    m_gk = gk;
+    m_gv = gv;
+    m_gm = gm;
+    m_gy = gy;
+
+    assert(m_batch_size < 8 || m_batch_size % 8 == 0);
+    // ACHTUNG: Temporary limit 64 is Wormhole-specific
+    assert(m_batch_size <= 64);
+    assert(m_N % m_batch_size == 0);
+
+    // K and V are streamed in blocks of 32 keys
+    assert(m_Skv % 32 == 0);
+    assert(m_D % 32 == 0);
+
+    m_program = core::Program(m_device);
+
+    uint32_t grid_x, grid_y;
+    compute_grid_dims(grid_x, grid_y);
+
+    m_x_start = 0;
+    m_y_start = 0;
+    m_x_end = grid_x - 1;
+    m_y_end = grid_y - 1;
+
+    m_grid = core::Grid(m_program, m_x_start, m_y_start, m_x_end, m_y_end);
+
+    m_zero_size = m_D;
+
+    // all row pipes hold one block of 32 rows (D / 32 tiles)
+    m_row_frame_size = m_D / 32;
+
+    m_kernel_base_path = "op/attention/device/metal";
+    m_defines = {{"T", "bfloat16"}};
+
+    validate_globals();
+
+    create_globals();
+    create_locals();
+    create_pipes();
+    create_kernels();
+
+    init_locals();
+}
+
+void AttentionBatch::run() {
+    core::Queue queue(m_device, 0);
+    queue.enqueue_program(m_program, false);
+}
+
+int AttentionBatch::input_volume(int index) {
+    switch (index) {
+    case 0:
+        return m_N * u32_align(m_Sq, 32) * m_D;
+    case 1:
+    case 2:
+        return m_N * m_Skv * m_D;
+    case 3:
+        assert(m_mask);
+        return u32_align(m_Sq, 32) * m_Skv;
+    default:
+        assert(false);
+        return 0;
+    }
+}
+
+int AttentionBatch::output_volume(int index) {
+    assert(index == 0);
+    return m_N * u32_align(m_Sq, 32) * m_D;
+}
+
+std::vector<float> AttentionBatch::transform_input(int index, const std::vector<float> &x) {
+    std::vector<float> y;
+    switch (index) {
+    case 0:
+        y = util::pad(x, m_N, m_Sq, m_D, m_N, u32_align(m_Sq, 32), m_D);
+        break;
+    case 1:
+    case 2:
+        y = util::tilize(x, m_N * m_Skv, m_D);
+        y = util::make_faces(y);
+        break;
+    case 3:
+        assert(m_mask);
+        y = util::pad(x, m_Sq, m_Skv, u32_align(m_Sq, 32), m_Skv);
+        y = util::tilize(y, u32_align(m_Sq, 32), m_Skv);
+        y = util::make_faces(y);
+        break;
+    default:
+        assert(false);
+        break;
+    }
+    return y;
+}
+
+std::vector<float> AttentionBatch::transform_output(int index, const std::vector<float> &x) {
+    assert(index == 0);
+    return util::unpad(x, m_N, u32_align(m_Sq, 32), m_D, m_N, m_Sq, m_D);
+}
+
+void AttentionBatch::validate_globals() {
+    uint32_t item_bytes = get_item_bytes(T);
+    assert(!m_gq.is_null());
+    assert(!m_gk.is_null());
+    assert(!m_gv.is_null());
+    assert(!m_gy.is_null());
+    assert(m_gq.bytes() >= input_volume(0) * item_bytes);
+    assert(m_gk.bytes() >= input_volume(1) * item_bytes);
+    assert(m_gv.bytes() >= input_volume(2) * item_bytes);
+    if (m_mask) {
+        assert(!m_gm.is_null());
+        assert(m_gm.bytes() >= input_volume(3) * item_bytes);
+    }
+    assert(m_gy.bytes() >= output_volume(0) * item_bytes);
+}
+
+void AttentionBatch::create_globals() {
+    uint32_t log2_page_size = 10; // 2 ^ 10 = 1024
+    m_gs = core::Global(m_device, T, 1024, log2_page_size);
+    m_gzero = core::Global(m_device, T, m_zero_size, log2_page_size);
+}
+
+void AttentionBatch::create_locals() {
+    m_lzero = core::Local(m_program, m_grid, T, m_zero_size);
+}
+
+void AttentionBatch::create_pipes() {
+    m_pq =
+        core::Pipe(
+            m_program,
+            m_grid,
+            core::PipeKind::INPUT,
+            T,
+            m_row_frame_size * 2,
+            m_row_frame_size);
+    m_pk =
+        core::Pipe(
+            m_program,
+            m_grid,
+            core::PipeKind::INPUT,
+            T,
+            m_row_frame_size * 2,
+            m_row_frame_size);
+    m_pv =
+        core::Pipe(
+            m_program,
+            m_grid,
+            core::PipeKind::INPUT,
+            T,
+            m_row_frame_size * 2,
+            m_row_frame_size);
+    // no double buffering for scaler
+    m_ps =
+        core::Pipe(
+            m_program,
+            m_grid,
+            core::PipeKind::INPUT,
+            T,
+            1,
+            1);
+    if (m_mask) {
+        m_pm =
+            core::Pipe(
+                m_program,
+                m_grid,
+                core::PipeKind::INPUT,
+                T,
+                2,
+                1);
+    }
+    m_py =
+        core::Pipe(
+            m_program,
+            m_grid,
+            core::PipeKind::OUTPUT,
+            T,
+            m_row_frame_size * 2,
+            m_row_frame_size);
+    m_pq_im =
+        core::Pipe(
+            m_program,
+            m_grid,
+            core::PipeKind::INTERMED,
+            T,
+            m_row_frame_size,
+            m_row_frame_size);
+    m_ps_im =
+        core::Pipe(
+            m_program,
+            m_grid,
+            core::PipeKind::INTERMED,
+            T,
+            1,
+            1);
+    m_pp =
+        core::Pipe(
+            m_program,
+            m_grid,
+            core::PipeKind::INTERMED,
+            T,
+            1,
+            1);
+    m_palpha =
+        core::Pipe(
+            m_program,
+            m_grid,
+            core::PipeKind::INTERMED,
+            T,
+            1,
+            1);
+    // running state: ping-pong between pipes 0 and 1
+    m_pmax0 =
+        core::Pipe(
+            m_program,
+            m_grid,
+            core::PipeKind::INTERMED,
+            T,
+            1,
+            1);
+    m_pmax1 =
+        core::Pipe(
+            m_program,
+            m_grid,
+            core::PipeKind::INTERMED,
+            T,
+            1,
+            1);
+    m_psum =
+        core::Pipe(
+            m_program,
+            m_grid,
+            core::PipeKind::INTERMED,
+            T,
+            1,
+            1);
+    m_po0 =
+        core::Pipe(
+            m_program,
+            m_grid,
+            core::PipeKind::INTERMED,
+            T,
+            m_row_frame_size,
+            m_row_frame_size);
+    m_po1 =
+        core::Pipe(
+            m_program,
+            m_grid,
+            core::PipeKind::INTERMED,
+            T,
+            m_row_frame_size,
+            m_row_frame_size);
+    m_py_im =
+        core::Pipe(
+            m_program,
+            m_grid,
+            core::PipeKind::INTERMED,
+            T,
+            m_row_frame_size,
+            m_row_frame_size);
+}
+
+void AttentionBatch::create_kernels() {
+    create_reader();
+    create_writer();
+    create_math();
+}
+
+void AttentionBatch::create_reader() {
+    std::string path = m_kernel_base_path + "/" + make_kernel_name("reader") + ".cpp";
+    m_reader = 
+        core::Kernel(
+            m_program, 
+            m_grid, 
+            core::KernelKind::READER, 
+            core::KernelFormat::METAL,
+            path, 
+            {}, 
+            m_defines);
+/*
+void kernel(
+        global<T> gq,
+        global<T> gk,
+        global<T> gv,
+        global<T> gs,
+        global<T> gm,      // mask only
+        global<T> gzero,
+        local<T> lzero,
+        pipe<T> pq,
+        pipe<T> pk,
+        pipe<T> pv,
+        pipe<T> ps,
+        pipe<T> pm,        // mask only
+        uint32 N,
+        uint32 Sq,
+        uint32 Skv,
+        uint32 D,
+        uint32 zero_size,
+        uint32 q_pos,
+        uint32 q_stride,
+        uint32 kv_pos,
+        uint32 kv_stride)
+*/
+    uint32_t Sq_rnd = u32_align(m_Sq, 32);
+    uint32_t q_stride = (m_batch_size - 1) * Sq_rnd * m_D;
+    // K and V block start is not advanced by the inner loops
+    uint32_t kv_stride = m_batch_size * m_Skv * m_D;
+    std::vector<core::KernelArg> args;
+    if (m_mask) {
+        args = {
+            m_gq,
+            m_gk,
+            m_gv,
+            m_gs,
+            m_gm,
+            m_gzero,
+            m_lzero,
+            m_pq,
+            m_pk,
+            m_pv,
+            m_ps,
+            m_pm
+        };
+    } else {
+        args = {
+            m_gq,
+            m_gk,
+            m_gv,
+            m_gs,
+            m_gzero,
+            m_lzero,
+            m_pq,
+            m_pk,
+            m_pv,
+            m_ps
+        };
+    }
+    uint32_t q_pos_index = uint32_t(args.size()) + 5;
+    uint32_t kv_pos_index = q_pos_index + 2;
+    args.push_back(m_N / m_batch_size);
+    args.push_back(m_Sq);
+    args.push_back(m_Skv);
+    args.push_back(m_D);
+    args.push_back(m_zero_size);
+    args.push_back(uint32_t(0)); // q_pos
+    args.push_back(q_stride);
+    args.push_back(uint32_t(0)); // kv_pos
+    args.push_back(kv_stride);
+    uint32_t q_inc = Sq_rnd * m_D;
+    uint32_t kv_inc = m_Skv * m_D;
+    uint32_t q_pos = 0;
+    uint32_t kv_pos = 0;
+    for (uint32_t x = m_x_start; x <= m_x_end; x++) {
+        for (uint32_t y = m_y_start; y <= m_y_end; y++) {
+            args[q_pos_index] = q_pos;
+            args[kv_pos_index] = kv_pos;
+            m_reader.set_args(x, y, args);
+            q_pos += q_inc;
+            kv_pos += kv_inc;
+        }
+    }
+}
+
+void AttentionBatch::create_writer() {
+    std::string path = m_kernel_base_path + "/attention_batch_writer.cpp";
+    m_writer = 
+        core::Kernel(
+            m_program, 
+            m_grid, 
+            core::KernelKind::WRITER, 
+            core::KernelFormat::METAL,
+            path, 
+            {}, 
+            m_defines);
+/*
+void kernel(
+        global<T> gy,
+        pipe<T> py,
+        uint32 N,
+        uint32 H,
+        uint32 W,
+        uint32 y_pos,
+        uint32 y_stride)
+*/
+    uint32_t Sq_rnd = u32_align(m_Sq, 32);
+    uint32_t y_stride = (m_batch_size - 1) * Sq_rnd * m_D;
+    std::vector<core::KernelArg> args{
+        m_gy,
+        m_py,
+        m_N / m_batch_size,
+        Sq_rnd,
+        m_D,
+        uint32_t(0), // [5] y_pos
+        y_stride
+    };
+    uint32_t y_inc = Sq_rnd * m_D;
+    uint32_t y_pos = 0;
+    for (uint32_t x = m_x_start; x <= m_x_end; x++) {
+        for (uint32_t y = m_y_start; y <= m_y_end; y++) {
+            args[5] = y_pos;
+            m_writer.set_args(x, y, args);
+            y_pos += y_inc;
+        }
+    }
+}
+
+void AttentionBatch::create_math() {
+    std::string path = m_kernel_base_path + "/" + make_kernel_name("math") + ".cpp";
+    m_math = 
+        core::Kernel(
+            m_program, 
+            m_grid, 
+            core::KernelKind::MATH, 
+            core::KernelFormat::METAL,
+            path, 
+            {}, 
+            m_defines);
+/*
+void kernel(
+        pipe<T> pq,
+        pipe<T> pk,
+        pipe<T> pv,
+        pipe<T> ps,
+        pipe<T> pm,        // mask only
+        pipe<T> py,
+        pipe<T> pq_im,
+        pipe<T> ps_im,
+        pipe<T> pp,
+        pipe<T> palpha,
+        pipe<T> pmax0,
+        pipe<T> pmax1,
+        pipe<T> psum,
+        pipe<T> po0,
+        pipe<T> po1,
+        pipe<T> py_im,
+        uint32 N,
+        uint32 Sq,
+        uint32 Skv,
+        uint32 D,
+        uint32 scale)
+*/
+    uint32_t Sq_rnd = u32_align(m_Sq, 32);
+    std::vector<core::KernelArg> args;
+    if (m_mask) {
+        args = {
+            m_pq,
+            m_pk,
+            m_pv,
+            m_ps,
+            m_pm
+        };
+    } else {
+        args = {
+            m_pq,
+            m_pk,
+            m_pv,
+            m_ps
+        };
+    }
+    args.push_back(m_py);
+    args.push_back(m_pq_im);
+    args.push_back(m_ps_im);
+    args.push_back(m_pp);
+    args.push_back(m_palpha);
+    args.push_back(m_pmax0);
+    args.push_back(m_pmax1);
+    args.push_back(m_psum);
+    args.push_back(m_po0);
+    args.push_back(m_po1);
+    args.push_back(m_py_im);
+    args.push_back(m_N / m_batch_size);
+    args.push_back(Sq_rnd);
+    args.push_back(m_Skv);
+    args.push_back(m_D);
+    args.push_back(float_as_u32(m_scale));
+    m_math.set_args(m_grid, args);
+}
+
+void AttentionBatch::init_locals() {
+    // same unit scaler is used for max and sum reductions
+    std::vector<uint16_t> vscale(1024, float_to_u16b(1.0f));
+    std::vector<uint32_t> vzero(m_gzero.bytes() / sizeof(uint32_t), 0);
+    core::Queue queue(m_device, 0);
+    queue.enqueue_write(m_gs, vscale.data(), true);
+    queue.enqueue_write(m_gzero, vzero.data(), true);
+}
+
+void AttentionBatch::compute_grid_dims(uint32_t &x, uint32_t &y) {
+    // ACHTUNG: Temporary limit 8 is Wormhole-specific
+    if (m_batch_size <= 8) {
+        x = m_batch_size;
+        y = 1;
+    } else {
+        x = 8;
+        y = m_batch_size / 8;
+    }
+}
+
+std::string AttentionBatch::make_kernel_name(const std::string &role) {
+    return m_mask ? "attention_batch_mask_" + role : "attention_batch_" + role;
+}
+
+} // namespace tanto
+} // namespace attention
+} // namespace op
+} // namespace ronin
+
@@ -0,0 +1,129 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <map>
+
+#include "host/core/api.hpp"
+
+namespace ronin {
+namespace op {
+namespace attention {
+namespace tanto {
+
+namespace core = ronin::tanto::host;
+
+//
+//    Scaled dot-product attention
+//
+//        y = softmax(q * k^T * scale + mask) * v
+//
+//    Each core processes blocks of 32 query rows and streams K and V
+//    in blocks of 32 keys, maintaining running row maximum, row sum
+//    and output accumulator (online softmax). The score matrix
+//    [Sq, Skv] is never written to DRAM. Skv and D must be multiples
+//    of 32. Optional additive mask has shape [Sq, Skv] and is shared
+//    by all N.
+//    Input indices:
+//        0: q [N, Sq, D]
+//        1: k [N, Skv, D]
+//        2: v [N, Skv, D]
+//        3: mask [Sq, Skv] (if enabled)
+//
+
+class AttentionBatch {
+public:
+    AttentionBatch(
+        int N,
+        int Sq,
+        int Skv,
+        int D,
+        float scale,
+        bool mask,
+        int batch_size);
+    ~AttentionBatch();
+public:
+    void init(
+        const core::Device &device,
+        const core::Global &gq,
+        const core::Global &gk,
+        const core::Global &gv,
+        const core::Global &gm,
+        const core::Global &gy);
+    void run();
+    int input_volume(int index);
+    int output_volume(int index);
+    std::vector<float> transform_input(int index, const std::vector<float> &x);
+    std::vector<float> transform_output(int index, const std::vector<float> &x);
+private:
+    void validate_globals();
+    void create_globals();
+    void create_locals();
+    void create_pipes();
+    void create_kernels();
+    void create_reader();
+    void create_writer();
+    void create_math();
+    void init_locals();
+    void compute_grid_dims(uint32_t &x, uint32_t &y);
+    std::string make_kernel_name(const std::string &role);
+private:
+    static const core::DataFormat T = core::DataFormat::BFLOAT16;
+private:
+    core::Device m_device;
+    uint32_t m_batch_size = 0;
+    uint32_t m_N = 0;
+    uint32_t m_Sq = 0;
+    uint32_t m_Skv = 0;
+    uint32_t m_D = 0;
+    float m_scale = 0.0f;
+    bool m_mask = false;
+    core::Program m_program;
+    uint32_t m_x_start = 0;
+    uint32_t m_y_start = 0;
+    uint32_t m_x_end = 0;
+    uint32_t m_y_end = 0;
+    core::Grid m_grid;
+    core::Global m_gq;
+    core::Global m_gk;
+    core::Global m_gv;
+    core::Global m_gs;
+    core::Global m_gm;
+    core::Global m_gy;
+    core::Global m_gzero;
+    core::Local m_lzero;
+    core::Pipe m_pq;
+    core::Pipe m_pk;
+    core::Pipe m_pv;
+    core::Pipe m_ps;
+    core::Pipe m_pm;
+    core::Pipe m_py;
+    core::Pipe m_pq_im;
+    core::Pipe m_ps_im;
+    core::Pipe m_pp;
+    core::Pipe m_palpha;
+    core::Pipe m_pmax0;
+    core::Pipe m_pmax1;
+    core::Pipe m_psum;
+    core::Pipe m_po0;
+    core::Pipe m_po1;
+    core::Pipe m_py_im;
+    core::Kernel m_reader;
+    core::Kernel m_writer;
+    core::Kernel m_math;
+    uint32_t m_zero_size = 0;
+    uint32_t m_row_frame_size = 0;
+    std::string m_kernel_base_path;
+    std::map<std::string, std::string> m_defines;
+};
+
+} // namespace tanto
+} // namespace attention
+} // namespace op
+} // namespace ronin
+
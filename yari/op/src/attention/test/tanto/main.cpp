@@ -0,0 +1,375 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <cassert>
+#include <vector>
+#include <array>
+#include <unordered_map>
+#include <exception>
+
+#include "host/core/api.hpp"
+
+#include "host/tanto/attention_batch.hpp"
+
+#include "host/ref/attention_ref.hpp"
+
+#include "host/util/transform.hpp"
+
+#include "test/util/gen.hpp"
+#include "test/util/comp.hpp"
+#include "test/util/timer.hpp"
+
+using namespace ronin::op::attention;
+using namespace ronin::op::common::util;
+using namespace ronin::op::common::test;
+
+namespace core = ronin::tanto::host;
+
+enum class Algo {
+    ATTENTION_BATCH
+};
+
+bool str_to_int(const char *s, int &v) {
+    char *p;
+    long t = strtol(s, &p, 10);
+    if (*p != '\0') {
+        return false;
+    }
+    int r = int(t);
+    if (long(r) != t) {
+        return false;
+    }
+    if (r <= 0) {
+        return false;
+    }
+    v = r;
+    return true;
+}
+
+struct AttentionParam {
+    int Sq;
+    int Skv;
+    int D;
+    float scale;
+};
+
+std::vector<AttentionParam> param_config = {
+    // Sq, Skv, D, scale
+    {1, 1024, 64, 0.125f},
+    {128, 128, 64, 0.125f},
+    {197, 224, 64, 0.125f},
+    {256, 256, 128, 0.0883883f}
+};
+
+std::vector<bool> mask_config = {false, true};
+
+void run_attention_batch(
+        const std::vector<float> &q,
+        const std::vector<float> &k,
+        const std::vector<float> &v,
+        const std::vector<float> &m,
+        std::vector<float> &y,
+        const AttentionParam &param,
+        int N,
+        int batch_size,
+        int repeat) {
+    bool mask = !m.empty();
+    tanto::AttentionBatch solver(
+        N, param.Sq, param.Skv, param.D, param.scale, mask, batch_size);
+    std::vector<uint16_t> tq = float_to_u16b(solver.transform_input(0, q));
+    std::vector<uint16_t> tk = float_to_u16b(solver.transform_input(1, k));
+    std::vector<uint16_t> tv = float_to_u16b(solver.transform_input(2, v));
+    std::vector<uint16_t> tm;
+    if (mask) {
+        tm = float_to_u16b(solver.transform_input(3, m));
+    }
+    std::vector<uint16_t> ty(solver.output_volume(0));
+    core::Platform platform = core::Platform::get_default();
+    core::Device device(platform, 0);
+    core::DataFormat T = core::DataFormat::BFLOAT16;
+    uint32_t log2_page_size = 10; // 2 ^ 10 = 1024
+    core::Global gq(device, T, solver.input_volume(0), log2_page_size);
+    core::Global gk(device, T, solver.input_volume(1), log2_page_size);
+    core::Global gv(device, T, solver.input_volume(2), log2_page_size);
+    core::Global gm;
+    if (mask) {
+        gm = core::Global(device, T, solver.input_volume(3), log2_page_size);
+    }
+    core::Global gy(device, T, solver.output_volume(0), log2_page_size);
+    solver.init(device, gq, gk, gv, gm, gy);
+    core::Queue queue(device, 0);
+    queue.enqueue_write(gq, tq.data(), false);
+    queue.enqueue_write(gk, tk.data(), false);
+    queue.enqueue_write(gv, tv.data(), false);
+    if (mask) {
+        queue.enqueue_write(gm, tm.data(), false);
+    }
+    if (repeat <= 0) {
+        solver.run();
+    } else {
+        // warm up
+        solver.run();
+        queue.finish();
+        util::Timer timer;
+        timer.start();
+        for (int i = 0; i < repeat; i++) {
+            solver.run();
+            queue.finish();
+        }
+        timer.stop();
+        float t = timer.elapsed();
+        printf("Elapsed time %g ms / %d iterations = %g\n", t, repeat, t / float(repeat));
+    }
+    queue.enqueue_read(gy, ty.data(), false);
+    queue.finish();
+    device.close();
+    y = solver.transform_output(0, u16b_to_float(ty));
+}
+
+void run_ref(
+        const std::vector<float> &q,
+        const std::vector<float> &k,
+        const std::vector<float> &v,
+        const std::vector<float> &m,
+        std::vector<float> &y,
+        const AttentionParam &param,
+        int N) {
+    y.resize(N * param.Sq * param.D);
+    ref::AttentionRef solver(N, param.Sq, param.Skv, param.D, param.scale);
+    solver.init(
+        q.data(),
+        k.data(),
+        v.data(),
+        m.empty() ? nullptr : m.data(),
+        y.data());
+    solver.run();
+}
+
+void run_algo(
+        Algo algo,
+        const std::vector<float> &q,
+        const std::vector<float> &k,
+        const std::vector<float> &v,
+        const std::vector<float> &m,
+        std::vector<float> &y,
+        const AttentionParam &param,
+        int N,
+        int batch_size,
+        int repeat) {
+    switch (algo) {
+    case Algo::ATTENTION_BATCH:
+        run_attention_batch(q, k, v, m, y, param, N, batch_size, repeat);
+        break;
+    default:
+        assert(false);
+        break;
+    }
+}
+
+std::vector<float> make_causal_mask(int H, int W) {
+    std::vector<float> m(H * W);
+    for (int h = 0; h < H; h++) {
+        for (int w = 0; w < W; w++) {
+            m[h * W + w] = (w > h) ? -1.0e4f : 0.0f;
+        }
+    }
+    return m;
+}
+
+bool compare(const std::vector<float> &y, const std::vector<float> &yref) {
+    float rtol = 1.0e-1f;
+    float atol = 1.0e-3f;
+    float rtol_delta = 0.0f;
+    float atol_delta = 0.0f;
+    int num_outliers = 0;
+
+    bool allclose = 
+        util::comp_allclose(
+            yref, 
+            y, 
+            rtol, 
+            atol, 
+            rtol_delta, 
+            atol_delta, 
+            num_outliers);
+    printf("All close = %s\n", allclose ? "OK" : "FAIL");
+    printf("Max ATOL delta: %g, max RTOL delta: %g, outliers: %d / %zd\n", 
+        atol_delta, rtol_delta, num_outliers, y.size());
+
+    float pcc = util::comp_pcc(yref, y);
+    bool pcc_ok = (pcc >= 0.9999f);
+    printf("Pcc = %s\n", pcc_ok ? "OK" : "FAIL"); 
+    printf("PCC: %g\n", pcc);
+
+    // exit status reflects PCC only (tolerances are too rigid for bfloat16)
+    return pcc_ok;
+}
+
+bool run(
+        Algo algo, 
+        const AttentionParam &param, 
+        bool mask,
+        int N, 
+        int batch_size,
+        int repeat) {
+    printf(
+        "---- Batch [%d / %d] Sq %d Skv %d D %d scale %g mask %s\n",
+            N, 
+            batch_size, 
+            param.Sq, 
+            param.Skv, 
+            param.D, 
+            param.scale, 
+            mask ? "yes" : "no");
+
+    int qsize = N * param.Sq * param.D;
+    int kvsize = N * param.Skv * param.D;
+
+    util::manual_seed(1234);
+    std::vector<float> q = util::normal(0.0f, 1.0f, qsize);
+    std::vector<float> k = util::normal(0.0f, 1.0f, kvsize);
+    std::vector<float> v = util::normal(0.0f, 1.0f, kvsize);
+    std::vector<float> m;
+    if (mask) {
+        m = make_causal_mask(param.Sq, param.Skv);
+    }
+
+    std::vector<float> y;
+    std::vector<float> yref;
+
+    run_algo(algo, q, k, v, m, y, param, N, batch_size, repeat);
+    run_ref(q, k, v, m, yref, param, N);
+
+    return compare(y, yref);
+}
+
+std::unordered_map<std::string, Algo> str_algo_map = {
+    {"attention_batch", Algo::ATTENTION_BATCH}
+};
+
+bool validate_args(Algo algo, int N, int batch_size) {
+    if (N % batch_size != 0) {
+        return false;
+    }
+    switch (algo) {
+    case Algo::ATTENTION_BATCH:
+        if (batch_size != 8 && 
+                batch_size != 16 && 
+                batch_size != 32 && 
+                batch_size != 64) {
+            return false;
+        }
+        break;
+    default:
+        assert(false);
+        return false;
+    }
+    return true;
+}
+
+bool parse_args(
+        int argc, 
+        char **argv, 
+        Algo &algo, 
+        int &N, 
+        int &batch_size,
+        int &repeat) {
+    int argp = 1;
+    // repeat
+    repeat = 0;
+    if (argp < argc && !strcmp(argv[argp], "-r")) {
+        argp++;
+        if (argp >= argc) {
+            return false;
+        }
+        if (!str_to_int(argv[argp], repeat)) {
+            return false;
+        }
+        argp++;
+    }
+    // algo
+    if (argp >= argc) {
+        return false;
+    }
+    auto it = str_algo_map.find(argv[argp]);
+    if (it == str_algo_map.end()) {
+        return false;
+    }
+    algo = it->second;
+    argp++;
+    // N
+    switch (algo) {
+    case Algo::ATTENTION_BATCH:
+        N = 16;
+        break;
+    default:
+        assert(false);
+        return false;
+    }
+    if (argp < argc) {
+        if (!str_to_int(argv[argp], N)) {
+            return false;
+        }
+        argp++;
+    }
+    // batch_size
+    switch (algo) {
+    case Algo::ATTENTION_BATCH:
+        batch_size = (N > 64) ? 64 : N;
+        break;
+    default:
+        assert(false);
+        return false;
+    }
+    if (argp < argc) {
+        if (!str_to_int(argv[argp], batch_size)) {
+            return false;
+        }
+        argp++;
+    }
+    if (argp < argc) {
+        return false;
+    }
+    return true;
+}
+
+void usage() {
+    fprintf(stderr, "Usage: test_tanto [-r <repeat>] <op> [<N>] [<B>]\n");
+    fprintf(stderr, "\n");
+    fprintf(stderr, "<op> is one of\n");
+    fprintf(stderr, "    attention_batch\n");
+    fprintf(stderr, "\n");
+}
+
+int main(int argc, char **argv) {
+    Algo algo = Algo(0);
+    int N = 0;
+    int batch_size = 0;
+    int repeat = 0;
+    if (!parse_args(argc, argv, algo, N, batch_size, repeat)) {
+        usage();
+        return 1;
+    }
+    if (!validate_args(algo, N, batch_size)) {
+        fprintf(stderr, "Invalid combination of command line arguments\n");
+        return 1;
+    }
+    bool ok = true;
+    try {
+        for (AttentionParam &param: param_config) {
+        for (bool mask: mask_config) {
+            ok &= run(algo, param, mask, N, batch_size, repeat);
+        }
+        }
+    } catch (std::exception &e) {
+        fprintf(stderr, "Error: %s\n", e.what());
+        return 1;
+    }
+    return ok ? 0 : 1;
+}
+
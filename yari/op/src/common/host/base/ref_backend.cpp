@@ -0,0 +1,108 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdlib>
+#include <cstring>
+#include <cassert>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <functional>
+
+#include "host/base/ref_backend.hpp"
+
+namespace ronin {
+namespace op {
+namespace common {
+namespace base {
+
+namespace {
+
+std::once_flag g_init_flag;
+RefBackend g_backend = RefBackend::FAST;
+int g_thread_count = 1;
+
+void init_settings() {
+    unsigned hw_count = std::thread::hardware_concurrency();
+    g_thread_count = (hw_count > 0) ? int(hw_count) : 1;
+    const char *backend = std::getenv("RONIN_REF_BACKEND");
+    if (backend != nullptr && !strcmp(backend, "naive")) {
+        g_backend = RefBackend::NAIVE;
+    }
+    const char *threads = std::getenv("RONIN_REF_THREADS");
+    if (threads != nullptr) {
+        int count = atoi(threads);
+        if (count > 0) {
+            g_thread_count = count;
+        }
+    }
+}
+
+void init_once() {
+    std::call_once(g_init_flag, init_settings);
+}
+
+} // namespace
+
+void set_ref_backend(RefBackend backend) {
+    init_once();
+    g_backend = backend;
+}
+
+RefBackend get_ref_backend() {
+    init_once();
+    return g_backend;
+}
+
+bool is_ref_backend_fast() {
+    return (get_ref_backend() == RefBackend::FAST);
+}
+
+void set_ref_thread_count(int count) {
+    assert(count > 0);
+    init_once();
+    g_thread_count = count;
+}
+
+int get_ref_thread_count() {
+    init_once();
+    return g_thread_count;
+}
+
+void ref_parallel_for(int count, const std::function<void (int index)> &body) {
+    int thread_count = std::min(get_ref_thread_count(), count);
+    if (thread_count <= 1) {
+        for (int index = 0; index < count; index++) {
+            body(index);
+        }
+        return;
+    }
+    // dynamic scheduling: tasks may vary in cost (edge tiles)
+    std::atomic<int> next(0);
+    auto worker = [&]() {
+        for ( ; ; ) {
+            int index = next.fetch_add(1);
+            if (index >= count) {
+                break;
+            }
+            body(index);
+        }
+    };
+    std::vector<std::thread> threads;
+    for (int i = 1; i < thread_count; i++) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (std::thread &thread: threads) {
+        thread.join();
+    }
+}
+
+} // namespace base
+} // namespace common
+} // namespace op
+} // namespace ronin
+
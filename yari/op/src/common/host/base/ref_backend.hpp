@@ -0,0 +1,47 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <functional>
+
+namespace ronin {
+namespace op {
+namespace common {
+namespace base {
+
+//
+//    Reference operator backend
+//
+//    NAIVE: original scalar loops, used as golden reference
+//    FAST: multithreaded, cache-blocked implementation
+//
+//    Both backends accumulate in FP32; FAST may use different summation
+//    order and fused multiply-add, therefore results can differ from
+//    NAIVE within FP32 rounding error.
+//
+//    Initial settings are taken from environment variables
+//    RONIN_REF_BACKEND ("naive" or "fast", default "fast") and
+//    RONIN_REF_THREADS (default: number of hardware threads).
+//
+
+enum class RefBackend {
+    NAIVE,
+    FAST
+};
+
+void set_ref_backend(RefBackend backend);
+RefBackend get_ref_backend();
+bool is_ref_backend_fast();
+void set_ref_thread_count(int count);
+int get_ref_thread_count();
+
+// calls body(index) for index in [0 .. count) using worker threads
+void ref_parallel_for(int count, const std::function<void (int index)> &body);
+
+} // namespace base
+} // namespace common
+} // namespace op
+} // namespace ronin
+
@@ -0,0 +1,534 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstring>
+#include <cassert>
+#include <algorithm>
+#include <vector>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define REF_GEMM_X86
+#include <immintrin.h>
+#endif
+
+#include "host/base/post_op.hpp"
+#include "host/base/ref_backend.hpp"
+#include "host/base/ref_gemm.hpp"
+
+namespace ronin {
+namespace op {
+namespace common {
+namespace base {
+
+namespace {
+
+//
+//    Micro-kernels
+//
+//    Compute MR x NR block of C from packed A (kc x MR, row-interleaved)
+//    and packed B (kc x NR). With "accumulate" set, result is added to C.
+//
+
+using KernelFunc =
+    void (*)(
+        int kc,
+        const float *a,
+        const float *b,
+        float *c,
+        int ldc,
+        bool accumulate);
+
+struct GemmKernel {
+    int mr;
+    int nr;
+    KernelFunc func;
+};
+
+constexpr int KC = 256;
+constexpr int MAX_MR = 12;
+constexpr int MAX_NR = 32;
+
+template<int MR, int NR>
+void kernel_generic(
+        int kc,
+        const float *a,
+        const float *b,
+        float *c,
+        int ldc,
+        bool accumulate) {
+    float acc[MR][NR];
+    for (int i = 0; i < MR; i++) {
+        for (int j = 0; j < NR; j++) {
+            acc[i][j] = 0.0f;
+        }
+    }
+    for (int k = 0; k < kc; k++) {
+        for (int i = 0; i < MR; i++) {
+            float ai = a[i];
+            for (int j = 0; j < NR; j++) {
+                acc[i][j] += ai * b[j];
+            }
+        }
+        a += MR;
+        b += NR;
+    }
+    for (int i = 0; i < MR; i++) {
+        float *ci = c + i * ldc;
+        for (int j = 0; j < NR; j++) {
+            ci[j] = accumulate ? ci[j] + acc[i][j] : acc[i][j];
+        }
+    }
+}
+
+#ifdef REF_GEMM_X86
+
+__attribute__((target("avx2,fma")))
+void kernel_avx2_6x16(
+        int kc,
+        const float *a,
+        const float *b,
+        float *c,
+        int ldc,
+        bool accumulate) {
+    __m256 acc[6][2];
+    for (int i = 0; i < 6; i++) {
+        acc[i][0] = _mm256_setzero_ps();
+        acc[i][1] = _mm256_setzero_ps();
+    }
+    for (int k = 0; k < kc; k++) {
+        __m256 b0 = _mm256_loadu_ps(b);
+        __m256 b1 = _mm256_loadu_ps(b + 8);
+        for (int i = 0; i < 6; i++) {
+            __m256 ai = _mm256_broadcast_ss(a + i);
+            acc[i][0] = _mm256_fmadd_ps(ai, b0, acc[i][0]);
+            acc[i][1] = _mm256_fmadd_ps(ai, b1, acc[i][1]);
+        }
+        a += 6;
+        b += 16;
+    }
+    for (int i = 0; i < 6; i++) {
+        float *ci = c + i * ldc;
+        if (accumulate) {
+            acc[i][0] = _mm256_add_ps(acc[i][0], _mm256_loadu_ps(ci));
+            acc[i][1] = _mm256_add_ps(acc[i][1], _mm256_loadu_ps(ci + 8));
+        }
+        _mm256_storeu_ps(ci, acc[i][0]);
+        _mm256_storeu_ps(ci + 8, acc[i][1]);
+    }
+}
+
+__attribute__((target("avx512f")))
+void kernel_avx512_12x32(
+        int kc,
+        const float *a,
+        const float *b,
+        float *c,
+        int ldc,
+        bool accumulate) {
+    __m512 acc[12][2];
+    for (int i = 0; i < 12; i++) {
+        acc[i][0] = _mm512_setzero_ps();
+        acc[i][1] = _mm512_setzero_ps();
+    }
+    for (int k = 0; k < kc; k++) {
+        __m512 b0 = _mm512_loadu_ps(b);
+        __m512 b1 = _mm512_loadu_ps(b + 16);
+        for (int i = 0; i < 12; i++) {
+            __m512 ai = _mm512_set1_ps(a[i]);
+            acc[i][0] = _mm512_fmadd_ps(ai, b0, acc[i][0]);
+            acc[i][1] = _mm512_fmadd_ps(ai, b1, acc[i][1]);
+        }
+        a += 12;
+        b += 32;
+    }
+    for (int i = 0; i < 12; i++) {
+        float *ci = c + i * ldc;
+        if (accumulate) {
+            acc[i][0] = _mm512_add_ps(acc[i][0], _mm512_loadu_ps(ci));
+            acc[i][1] = _mm512_add_ps(acc[i][1], _mm512_loadu_ps(ci + 16));
+        }
+        _mm512_storeu_ps(ci, acc[i][0]);
+        _mm512_storeu_ps(ci + 16, acc[i][1]);
+    }
+}
+
+#endif // REF_GEMM_X86
+
+GemmKernel detect_kernel() {
+#ifdef REF_GEMM_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        return GemmKernel{12, 32, kernel_avx512_12x32};
+    }
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        return GemmKernel{6, 16, kernel_avx2_6x16};
+    }
+#endif
+    return GemmKernel{4, 16, kernel_generic<4, 16>};
+}
+
+const GemmKernel &select_kernel() {
+    static const GemmKernel kernel = detect_kernel();
+    return kernel;
+}
+
+int round_up(int a, int b) {
+    return ((a + b - 1) / b) * b;
+}
+
+//
+//    Packed B: for each KC block of rows, sequence of kc x NR panels
+//
+
+class PackedB {
+public:
+    PackedB() { }
+    ~PackedB() { }
+public:
+    void pack(
+            const GemmKernel &kernel,
+            int N,
+            int K,
+            const float *b,
+            int ldb) {
+        int nr = kernel.nr;
+        m_N_pad = round_up(N, nr);
+        m_data.resize(size_t(m_N_pad) * K);
+        for (int k0 = 0; k0 < K; k0 += KC) {
+            int kc = std::min(KC, K - k0);
+            for (int j0 = 0; j0 < m_N_pad; j0 += nr) {
+                float *dst = panel_data(k0, kc, j0);
+                for (int jj = 0; jj < nr; jj++) {
+                    int j = j0 + jj;
+                    if (j < N) {
+                        const float *src = b + size_t(j) * ldb + k0;
+                        for (int kk = 0; kk < kc; kk++) {
+                            dst[kk * nr + jj] = src[kk];
+                        }
+                    } else {
+                        for (int kk = 0; kk < kc; kk++) {
+                            dst[kk * nr + jj] = 0.0f;
+                        }
+                    }
+                }
+            }
+        }
+    }
+    const float *panel(int k0, int kc, int j0) const {
+        return m_data.data() + size_t(k0) * m_N_pad + size_t(j0) * kc;
+    }
+private:
+    float *panel_data(int k0, int kc, int j0) {
+        return m_data.data() + size_t(k0) * m_N_pad + size_t(j0) * kc;
+    }
+private:
+    int m_N_pad = 0;
+    std::vector<float> m_data;
+};
+
+void pack_a(
+        const GemmKernel &kernel,
+        int mc,
+        int kc,
+        const float *a,
+        int lda,
+        float *dst) {
+    int mr = kernel.mr;
+    for (int i0 = 0; i0 < mc; i0 += mr) {
+        for (int ii = 0; ii < mr; ii++) {
+            int i = i0 + ii;
+            if (i < mc) {
+                const float *src = a + size_t(i) * lda;
+                for (int kk = 0; kk < kc; kk++) {
+                    dst[kk * mr + ii] = src[kk];
+                }
+            } else {
+                for (int kk = 0; kk < kc; kk++) {
+                    dst[kk * mr + ii] = 0.0f;
+                }
+            }
+        }
+        dst += mr * kc;
+    }
+}
+
+// computes mc x nc tile of C starting at column n0 of packed B
+void gemm_tile(
+        const GemmKernel &kernel,
+        int mc,
+        int nc,
+        int K,
+        const float *a,
+        int lda,
+        const PackedB &packed_b,
+        int n0,
+        float *c,
+        int ldc) {
+    int mr = kernel.mr;
+    int nr = kernel.nr;
+    std::vector<float> apack(size_t(round_up(mc, mr)) * std::min(K, KC));
+    float temp[MAX_MR * MAX_NR];
+    for (int k0 = 0; k0 < K; k0 += KC) {
+        int kc = std::min(KC, K - k0);
+        bool accumulate = (k0 > 0);
+        pack_a(kernel, mc, kc, a + k0, lda, apack.data());
+        for (int jt = 0; jt < nc; jt += nr) {
+            const float *bp = packed_b.panel(k0, kc, n0 + jt);
+            int nb = std::min(nr, nc - jt);
+            for (int it = 0; it < mc; it += mr) {
+                int mb = std::min(mr, mc - it);
+                const float *ap = apack.data() + size_t(it) * kc;
+                float *ct = c + size_t(it) * ldc + jt;
+                if (mb == mr && nb == nr) {
+                    kernel.func(kc, ap, bp, ct, ldc, accumulate);
+                    continue;
+                }
+                kernel.func(kc, ap, bp, temp, nr, false);
+                for (int i = 0; i < mb; i++) {
+                    for (int j = 0; j < nb; j++) {
+                        float v = temp[i * nr + j];
+                        ct[i * ldc + j] = accumulate ? ct[i * ldc + j] + v : v;
+                    }
+                }
+            }
+        }
+    }
+}
+
+struct Tiling {
+    int mc;
+    int nc;
+    int m_tiles;
+    int n_tiles;
+};
+
+Tiling make_tiling(const GemmKernel &kernel, int M, int N, int groups) {
+    // shrink tiles until there is enough tasks for all threads
+    int threads = get_ref_thread_count();
+    int mr = kernel.mr;
+    int nr = kernel.nr;
+    Tiling t;
+    t.mc = mr * 16;
+    t.nc = nr * 8;
+    for ( ; ; ) {
+        t.m_tiles = (M + t.mc - 1) / t.mc;
+        t.n_tiles = (N + t.nc - 1) / t.nc;
+        if (groups * t.m_tiles * t.n_tiles >= threads) {
+            break;
+        }
+        int nc_half = round_up(t.nc / 2, nr);
+        int mc_half = round_up(t.mc / 2, mr);
+        if (nc_half < t.nc && nc_half < N) {
+            t.nc = nc_half;
+        } else if (mc_half < t.mc && mc_half < M) {
+            t.mc = mc_half;
+        } else {
+            break;
+        }
+    }
+    return t;
+}
+
+void im2col(
+        const RefConv2dShape &shape,
+        int g,
+        int m0,
+        int mc,
+        const float *x,
+        float *cols) {
+    int PQ = shape.P * shape.Q;
+    int Cg = shape.C / shape.groups;
+    for (int i = 0; i < mc; i++) {
+        int m = m0 + i;
+        int n = m / PQ;
+        int p = (m % PQ) / shape.Q;
+        int q = m % shape.Q;
+        for (int r = 0; r < shape.R; r++) {
+            int th = p * shape.stride_h - shape.pad_h + r * shape.dilation_h;
+            for (int s = 0; s < shape.S; s++) {
+                int tw = q * shape.stride_w - shape.pad_w + s * shape.dilation_w;
+                if (th < 0 || th >= shape.H || tw < 0 || tw >= shape.W) {
+                    memset(cols, 0, Cg * sizeof(float));
+                } else {
+                    size_t xpos =
+                        ((size_t(n) * shape.H + th) * shape.W + tw) * shape.C + g * Cg;
+                    memcpy(cols, x + xpos, Cg * sizeof(float));
+                }
+                cols += Cg;
+            }
+        }
+    }
+}
+
+void depthwise_conv2d(
+        const RefConv2dShape &shape,
+        const float *x,
+        const float *w,
+        const float *b,
+        const float *z,
+        float *y,
+        const PostOpSpec &post_op) {
+    // same summation order as naive version
+    int C = shape.C;
+    ref_parallel_for(shape.N * shape.P, [&](int index) {
+        int n = index / shape.P;
+        int p = index % shape.P;
+        std::vector<float> acc(C);
+        for (int q = 0; q < shape.Q; q++) {
+            std::fill(acc.begin(), acc.end(), 0.0f);
+            for (int r = 0; r < shape.R; r++) {
+                int th = p * shape.stride_h - shape.pad_h + r * shape.dilation_h;
+                if (th < 0 || th >= shape.H) {
+                    continue;
+                }
+                for (int s = 0; s < shape.S; s++) {
+                    int tw = q * shape.stride_w - shape.pad_w + s * shape.dilation_w;
+                    if (tw < 0 || tw >= shape.W) {
+                        continue;
+                    }
+                    const float *xs = x + ((size_t(n) * shape.H + th) * shape.W + tw) * C;
+                    const float *ws = w + (r * shape.S + s) * C;
+                    for (int c = 0; c < C; c++) {
+                        acc[c] += xs[c] * ws[c];
+                    }
+                }
+            }
+            size_t ypos = ((size_t(n) * shape.P + p) * shape.Q + q) * C;
+            for (int c = 0; c < C; c++) {
+                float v = acc[c];
+                if (b != nullptr) {
+                    v += b[c];
+                }
+                if (z != nullptr) {
+                    v += z[ypos + c];
+                }
+                y[ypos + c] = post_op.eval(v);
+            }
+        }
+    });
+}
+
+} // namespace
+
+//
+//    Public functions
+//
+
+void ref_sgemm_nt(
+        int M,
+        int N,
+        int K,
+        const float *a,
+        int lda,
+        const float *b,
+        int ldb,
+        float *c,
+        int ldc) {
+    const GemmKernel &kernel = select_kernel();
+    PackedB packed_b;
+    packed_b.pack(kernel, N, K, b, ldb);
+    Tiling t = make_tiling(kernel, M, N, 1);
+    ref_parallel_for(t.m_tiles * t.n_tiles, [&](int index) {
+        int m0 = (index / t.n_tiles) * t.mc;
+        int n0 = (index % t.n_tiles) * t.nc;
+        int mc = std::min(t.mc, M - m0);
+        int nc = std::min(t.nc, N - n0);
+        gemm_tile(
+            kernel,
+            mc,
+            nc,
+            K,
+            a + size_t(m0) * lda,
+            lda,
+            packed_b,
+            n0,
+            c + size_t(m0) * ldc + n0,
+            ldc);
+    });
+}
+
+void ref_conv2d(
+        const RefConv2dShape &shape,
+        const float *x,
+        const float *w,
+        const float *b,
+        const float *z,
+        float *y,
+        const PostOpSpec &post_op) {
+    int G = shape.groups;
+    assert(shape.C % G == 0);
+    assert(shape.K % G == 0);
+    int Cg = shape.C / G;
+    int Kg = shape.K / G;
+    if (G > 1 && Cg == 1 && Kg == 1) {
+        depthwise_conv2d(shape, x, w, b, z, y, post_op);
+        return;
+    }
+    int RS = shape.R * shape.S;
+    int RSCg = RS * Cg;
+    int M = shape.N * shape.P * shape.Q;
+    int K = shape.K;
+    bool direct =
+        (shape.R == 1 && shape.S == 1 &&
+            shape.pad_h == 0 && shape.pad_w == 0 &&
+            shape.stride_h == 1 && shape.stride_w == 1 &&
+            shape.P == shape.H && shape.Q == shape.W);
+    // weights RSGKgCg => G x [Kg, RSCg]
+    const GemmKernel &kernel = select_kernel();
+    std::vector<PackedB> packed_w(G);
+    std::vector<float> wg(size_t(Kg) * RSCg);
+    for (int g = 0; g < G; g++) {
+        for (int kg = 0; kg < Kg; kg++) {
+            for (int rs = 0; rs < RS; rs++) {
+                const float *src = w + (size_t(rs * G + g) * Kg + kg) * Cg;
+                memcpy(wg.data() + size_t(kg) * RSCg + rs * Cg, src, Cg * sizeof(float));
+            }
+        }
+        packed_w[g].pack(kernel, Kg, RSCg, wg.data(), RSCg);
+    }
+    Tiling t = make_tiling(kernel, M, Kg, G);
+    int tiles = t.m_tiles * t.n_tiles;
+    ref_parallel_for(G * tiles, [&](int index) {
+        int g = index / tiles;
+        int m0 = ((index % tiles) / t.n_tiles) * t.mc;
+        int n0 = (index % t.n_tiles) * t.nc;
+        int mc = std::min(t.mc, M - m0);
+        int nc = std::min(t.nc, Kg - n0);
+        const float *a = nullptr;
+        int lda = 0;
+        std::vector<float> cols;
+        if (direct) {
+            a = x + size_t(m0) * shape.C + g * Cg;
+            lda = shape.C;
+        } else {
+            cols.resize(size_t(mc) * RSCg);
+            im2col(shape, g, m0, mc, x, cols.data());
+            a = cols.data();
+            lda = RSCg;
+        }
+        int k0 = g * Kg + n0;
+        float *yt = y + size_t(m0) * K + k0;
+        gemm_tile(kernel, mc, nc, RSCg, a, lda, packed_w[g], n0, yt, K);
+        // epilogue in the same order as naive version
+        for (int i = 0; i < mc; i++) {
+            size_t ypos = size_t(m0 + i) * K + k0;
+            for (int j = 0; j < nc; j++) {
+                float v = y[ypos + j];
+                if (b != nullptr) {
+                    v += b[k0 + j];
+                }
+                if (z != nullptr) {
+                    v += z[ypos + j];
+                }
+                y[ypos + j] = post_op.eval(v);
+            }
+        }
+    });
+}
+
+} // namespace base
+} // namespace common
+} // namespace op
+} // namespace ronin
+
@@ -0,0 +1,63 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "host/base/post_op.hpp"
+
+namespace ronin {
+namespace op {
+namespace common {
+namespace base {
+
+//
+//    Building blocks of FAST reference backend
+//
+
+struct RefConv2dShape {
+    int N;
+    int H;
+    int W;
+    int C;
+    int P;
+    int Q;
+    int K;
+    int R;
+    int S;
+    int pad_h;
+    int pad_w;
+    int stride_h;
+    int stride_w;
+    int dilation_h;
+    int dilation_w;
+    int groups;
+};
+
+// C[M, N] = A[M, K] * B[N, K]^T
+void ref_sgemm_nt(
+    int M,
+    int N,
+    int K,
+    const float *a,
+    int lda,
+    const float *b,
+    int ldb,
+    float *c,
+    int ldc);
+
+// x: NHWC, w: RSGKgCg, b: K (optional), z: NPQK (optional), y: NPQK
+void ref_conv2d(
+    const RefConv2dShape &shape,
+    const float *x,
+    const float *w,
+    const float *b,
+    const float *z,
+    float *y,
+    const PostOpSpec &post_op);
+
+} // namespace base
+} // namespace common
+} // namespace op
+} // namespace ronin
+
@@ -4,6 +4,7 @@
 
 #include <cstdint>
 #include <cstring>
+#include <cmath>
 #include <cassert>
 #include <vector>
 
@@ -61,6 +62,131 @@ std::vector<float> u16b_to_float(const std::vector<uint16_t> &x) {
     return y;
 }
 
+//
+//    float32 <-> block float conversions
+//
+//    Input is expected in tiled layout with faces (see make_faces).
+//    Each row of 16 values within a face shares one 8-bit exponent.
+//    Tile layout: 64 exponent bytes followed by 1024 packed mantissas
+//    (sign bit and mantissa with explicit leading one) in the same row order.
+//    BFP4_B mantissas are packed two per byte, lower nibble first.
+//
+
+namespace {
+
+uint32_t encode_bfp_value(uint32_t u, uint32_t shared_exp, int mant_bits) {
+    uint32_t sign = u >> 31;
+    uint32_t exp = (u >> 23) & 0xff;
+    if (exp == 0) {
+        return 0;
+    }
+    uint32_t mant = (u & 0x7fffff) | 0x800000;
+    uint32_t shift = shared_exp - exp;
+    mant = (shift < 24) ? (mant >> shift) : 0;
+    // round to nearest keeping mant_bits of 24-bit mantissa
+    uint32_t round_shift = 24 - mant_bits;
+    uint32_t max_mant = (1 << mant_bits) - 1;
+    mant = (mant + (1 << (round_shift - 1))) >> round_shift;
+    if (mant > max_mant) {
+        mant = max_mant;
+    }
+    if (mant == 0) {
+        return 0;
+    }
+    return (sign << mant_bits) | mant;
+}
+
+float decode_bfp_value(uint32_t v, uint32_t shared_exp, int mant_bits) {
+    uint32_t mant = v & ((1 << mant_bits) - 1);
+    if (mant == 0) {
+        return 0.0f;
+    }
+    float y = ldexpf(float(mant), int(shared_exp) - 127 - (mant_bits - 1));
+    return ((v >> mant_bits) & 1) ? -y : y;
+}
+
+// returns encoded mantissas of one tile, exponents are stored in exps
+void encode_bfp_tile(const float *x, uint8_t *exps, uint32_t *mants, int mant_bits) {
+    U32 u32;
+    for (int r = 0; r < 64; r++) {
+        const float *row = x + r * 16;
+        uint32_t shared_exp = 0;
+        for (int i = 0; i < 16; i++) {
+            u32.f = row[i];
+            uint32_t exp = (u32.i >> 23) & 0xff;
+            if (exp > shared_exp) {
+                shared_exp = exp;
+            }
+        }
+        exps[r] = uint8_t(shared_exp);
+        for (int i = 0; i < 16; i++) {
+            u32.f = row[i];
+            mants[r * 16 + i] = encode_bfp_value(u32.i, shared_exp, mant_bits);
+        }
+    }
+}
+
+} // namespace
+
+std::vector<uint8_t> float_to_bfp8b(const std::vector<float> &x) {
+    size_t n = x.size();
+    assert(n % 1024 == 0);
+    size_t tiles = n / 1024;
+    std::vector<uint8_t> y(tiles * (64 + 1024));
+    uint32_t mants[1024];
+    for (size_t t = 0; t < tiles; t++) {
+        uint8_t *py = y.data() + t * (64 + 1024);
+        encode_bfp_tile(x.data() + t * 1024, py, mants, 7);
+        for (int i = 0; i < 1024; i++) {
+            py[64 + i] = uint8_t(mants[i]);
+        }
+    }
+    return y;
+}
+
+std::vector<float> bfp8b_to_float(const std::vector<uint8_t> &x) {
+    size_t tiles = x.size() / (64 + 1024);
+    std::vector<float> y(tiles * 1024);
+    for (size_t t = 0; t < tiles; t++) {
+        const uint8_t *px = x.data() + t * (64 + 1024);
+        float *py = y.data() + t * 1024;
+        for (int i = 0; i < 1024; i++) {
+            py[i] = decode_bfp_value(px[64 + i], px[i / 16], 7);
+        }
+    }
+    return y;
+}
+
+std::vector<uint8_t> float_to_bfp4b(const std::vector<float> &x) {
+    size_t n = x.size();
+    assert(n % 1024 == 0);
+    size_t tiles = n / 1024;
+    std::vector<uint8_t> y(tiles * (64 + 512));
+    uint32_t mants[1024];
+    for (size_t t = 0; t < tiles; t++) {
+        uint8_t *py = y.data() + t * (64 + 512);
+        encode_bfp_tile(x.data() + t * 1024, py, mants, 3);
+        for (int i = 0; i < 512; i++) {
+            py[64 + i] = uint8_t(mants[2 * i] | (mants[2 * i + 1] << 4));
+        }
+    }
+    return y;
+}
+
+std::vector<float> bfp4b_to_float(const std::vector<uint8_t> &x) {
+    size_t tiles = x.size() / (64 + 512);
+    std::vector<float> y(tiles * 1024);
+    for (size_t t = 0; t < tiles; t++) {
+        const uint8_t *px = x.data() + t * (64 + 512);
+        float *py = y.data() + t * 1024;
+        for (int i = 0; i < 1024; i++) {
+            uint32_t v = (px[64 + i / 2] >> ((i & 1) * 4)) & 0xf;
+            py[i] = decode_bfp_value(v, px[i / 16], 3);
+        }
+    }
+    return y;
+}
+
 //
 //    Tilize / untilize
 //
@@ -14,6 +14,10 @@ namespace util {
 
 std::vector<uint16_t> float_to_u16b(const std::vector<float> &x);
 std::vector<float> u16b_to_float(const std::vector<uint16_t> &x);
+std::vector<uint8_t> float_to_bfp8b(const std::vector<float> &x);
+std::vector<float> bfp8b_to_float(const std::vector<uint8_t> &x);
+std::vector<uint8_t> float_to_bfp4b(const std::vector<float> &x);
+std::vector<float> bfp4b_to_float(const std::vector<uint8_t> &x);
 std::vector<float> tilize(const std::vector<float> &x, int H, int W);
 std::vector<float> untilize(const std::vector<float> &x, int H, int W);
 std::vector<float> make_faces(const std::vector<float> &x);
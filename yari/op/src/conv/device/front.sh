@@ -15,11 +15,15 @@ $FRONT --mode=read -DT=bfloat16 $TANTO/basic_batch_bias_reader.cpp >$METAL/basic
 $FRONT --mode=read -DT=bfloat16 $TANTO/basic_batch_lx_bias_reader.cpp >$METAL/basic_batch_lx_bias_reader.cpp
 $FRONT --mode=read -DT=bfloat16 $TANTO/basic_batch_pw_bias_reader.cpp >$METAL/basic_batch_pw_bias_reader.cpp
 
-$FRONT --mode=write -DT=bfloat16 $TANTO/basic_batch_writer.cpp >$METAL/basic_batch_writer.cpp
+$FRONT --mode=write -DT=bfloat16 -DTW=bfloat16 $TANTO/basic_batch_writer.cpp >$METAL/basic_batch_writer.cpp
+$FRONT --mode=write -DT=bfloat16 -DTW=bfp8_b $TANTO/basic_batch_writer.cpp >$METAL/basic_batch_writer_bfp8.cpp
+$FRONT --mode=write -DT=bfloat16 -DTW=bfp4_b $TANTO/basic_batch_writer.cpp >$METAL/basic_batch_writer_bfp4.cpp
 $FRONT --mode=write -DT=bfloat16 $TANTO/basic_batch_mcast_writer.cpp >$METAL/basic_batch_mcast_writer.cpp
 $FRONT --mode=write -DT=bfloat16 $TANTO/basic_batch_lw_writer.cpp >$METAL/basic_batch_lw_writer.cpp
 $FRONT --mode=write -DT=bfloat16 $TANTO/basic_batch_lw_mcast_writer.cpp >$METAL/basic_batch_lw_mcast_writer.cpp
-$FRONT --mode=write -DT=bfloat16 $TANTO/basic_batch_add_writer.cpp >$METAL/basic_batch_add_writer.cpp
+$FRONT --mode=write -DT=bfloat16 -DTW=bfloat16 $TANTO/basic_batch_add_writer.cpp >$METAL/basic_batch_add_writer.cpp
+$FRONT --mode=write -DT=bfloat16 -DTW=bfp8_b $TANTO/basic_batch_add_writer.cpp >$METAL/basic_batch_add_writer_bfp8.cpp
+$FRONT --mode=write -DT=bfloat16 -DTW=bfp4_b $TANTO/basic_batch_add_writer.cpp >$METAL/basic_batch_add_writer_bfp4.cpp
 $FRONT --mode=write -DT=bfloat16 $TANTO/basic_batch_mcast_add_writer.cpp >$METAL/basic_batch_mcast_add_writer.cpp
 $FRONT --mode=write -DT=bfloat16 $TANTO/basic_batch_lw_add_writer.cpp >$METAL/basic_batch_lw_add_writer.cpp
 $FRONT --mode=write -DT=bfloat16 $TANTO/basic_batch_lw_mcast_add_writer.cpp >$METAL/basic_batch_lw_mcast_add_writer.cpp
@@ -39,6 +43,7 @@ $FRONT --mode=compute -DT=bfloat16 -P0=1 $TANTO/basic_batch_lw_bias_add_unary_ma
 
 $FRONT --mode=read -DT=bfloat16 $TANTO/basic_spatial_bias_reader.cpp >$METAL/basic_spatial_bias_reader.cpp
 $FRONT --mode=read -DT=bfloat16 $TANTO/basic_spatial_lx_bias_reader.cpp >$METAL/basic_spatial_lx_bias_reader.cpp
+$FRONT --mode=read -DT=bfloat16 $TANTO/basic_spatial_halo_bias_reader.cpp >$METAL/basic_spatial_halo_bias_reader.cpp
 $FRONT --mode=read -DT=bfloat16 $TANTO/basic_spatial_pw_bias_reader.cpp >$METAL/basic_spatial_pw_bias_reader.cpp
 
 $FRONT --mode=write -DT=bfloat16 $TANTO/basic_spatial_mcast_writer.cpp >$METAL/basic_spatial_mcast_writer.cpp
@@ -65,4 +70,12 @@ $FRONT --mode=compute -DT=bfloat16 $TANTO/image_batch_bias_math.cpp >$METAL/imag
 $FRONT --mode=compute -DT=bfloat16 -P0=0 $TANTO/image_batch_bias_unary_math.cpp >$METAL/image_batch_bias_relu_math.cpp
 $FRONT --mode=compute -DT=bfloat16 -P0=1 $TANTO/image_batch_bias_unary_math.cpp >$METAL/image_batch_bias_relu6_math.cpp
 
+$FRONT --mode=read -DT=bfloat16 $TANTO/winograd_batch_bias_reader.cpp >$METAL/winograd_batch_bias_reader.cpp
+
+$FRONT --mode=write -DT=bfloat16 $TANTO/winograd_batch_writer.cpp >$METAL/winograd_batch_writer.cpp
+
+$FRONT --mode=compute -DT=bfloat16 $TANTO/winograd_batch_bias_math.cpp >$METAL/winograd_batch_bias_math.cpp
+$FRONT --mode=compute -DT=bfloat16 -P0=0 $TANTO/winograd_batch_bias_unary_math.cpp >$METAL/winograd_batch_bias_relu_math.cpp
+$FRONT --mode=compute -DT=bfloat16 -P0=1 $TANTO/winograd_batch_bias_unary_math.cpp >$METAL/winograd_batch_bias_relu6_math.cpp
+
 
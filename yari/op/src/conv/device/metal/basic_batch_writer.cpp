@@ -5,6 +5,7 @@
 #include "tanto/dataflow.h"
 
 #define T bfloat16
+#define TW bfloat16
 
 void kernel(Global gw, Global gy, Pipe pw, Pipe py, uint32 N, uint32 C,
             uint32 K, uint32 PQ, uint32 RS, uint32 y_pos, uint32 y_stride) {
@@ -0,0 +1,256 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "tanto/compute.h"
+
+#define T bfloat16
+
+namespace NAMESPACE {
+
+static constexpr uint32 UNARY_OP_RELU = 0, UNARY_OP_RELU6 = 1;
+
+static constexpr uint32 unary_op_code = uint32(0);
+
+void unary_op(uint32 index, uint32 param0) { relu_tile(index); }
+
+// Winograd F(2x2, 3x3)
+//
+// px_im: input tile d[a][b], a, b in [0 .. 3], Ct tiles each
+// pv_im: row i of V = B^T d B, V[i][j] of channel slice ct at (ct * 4 + j)
+// dst[0 .. 3]: M[i][j] = V[i][j] * U[i][j]
+// dst[4 .. 7]: Y = A^T M A, tile Y[u][v] in slot (4 + u * 2 + v)
+
+void transform_input(Pipe px_im, Pipe pv_im, uint32 Ct, uint32 i) {
+  // row i of B^T: d[a0] - d[a1] (or d[a0] + d[a1] for i == 1)
+  //     [1 0 -1 0], [0 1 1 0], [0 -1 1 0], [0 1 0 -1]
+  uint32 a0 = 1;
+  uint32 a1 = 3;
+  if (i == 0) {
+    a0 = 0;
+    a1 = 2;
+  } else if (i == 1) {
+    a1 = 2;
+  } else if (i == 2) {
+    a0 = 2;
+    a1 = 1;
+  }
+  uint32 row0 = a0 * 4 * Ct;
+  uint32 row1 = a1 * 4 * Ct;
+  cb_reserve_back(pv_im.cb_id, pv_im.frame_size);
+  tanto_unpack_binary_init(px_im.cb_id, px_im.cb_id);
+  tanto_pack_init(pv_im.cb_id);
+  for (uint32 ct = 0; ct < Ct; ct++) {
+    tile_regs_acquire();
+    tile_regs_wait();
+    // $b = (B^T d)[i][b]
+    for (uint32 b = 0; b < 4; b++) {
+      uint32 col = b * Ct + ct;
+      if (i == 1) {
+        tanto_add_init();
+        add_tiles(px_im.cb_id, px_im.cb_id, row0 + col, row1 + col, b);
+      } else {
+        tanto_sub_init();
+        sub_tiles(px_im.cb_id, px_im.cb_id, row0 + col, row1 + col, b);
+      }
+    }
+    // $(4 + j) = (B^T d B)[i][j]
+    tanto_copy_dst_init();
+    copy_dest_values(4, 0);
+    tanto_sub_dst_init();
+    sub_binary_tile(4, 2);
+    tanto_copy_dst_init();
+    copy_dest_values(5, 1);
+    tanto_add_dst_init();
+    add_binary_tile(5, 2);
+    tanto_copy_dst_init();
+    copy_dest_values(6, 2);
+    tanto_sub_dst_init();
+    sub_binary_tile(6, 1);
+    tanto_copy_dst_init();
+    copy_dest_values(7, 1);
+    tanto_sub_dst_init();
+    sub_binary_tile(7, 3);
+    for (uint32 j = 0; j < 4; j++) {
+      pack_tile(4 + j, pv_im.cb_id);
+    }
+    tile_regs_commit();
+    tile_regs_release();
+  }
+  cb_push_back(pv_im.cb_id, pv_im.frame_size);
+}
+
+void matmul_slice(
+
+    Pipe pv, Pipe pw, uint32 j, uint32 tiles) {
+  uint32 iv = j;
+  for (uint32 i = 0; i < tiles; i++) {
+    matmul_tiles(pv.cb_id, pw.cb_id, iv, i, j, true);
+    iv += 4;
+  }
+}
+
+void transform_output(uint32 i) {
+  // $0 = (M A)[i][0] = M[i][0] + M[i][1] + M[i][2]
+  tanto_add_dst_init();
+  add_binary_tile(0, 1);
+  add_binary_tile(0, 2);
+  // $1 = (M A)[i][1] = M[i][1] - M[i][2] - M[i][3]
+  tanto_sub_dst_init();
+  sub_binary_tile(1, 2);
+  sub_binary_tile(1, 3);
+  // Y += column i of A^T times row i of (M A)
+  //     A^T = [1 1 1 0], [0 1 -1 -1]
+  if (i != 3) {
+    tanto_add_dst_init();
+    add_binary_tile(4, 0);
+    add_binary_tile(5, 1);
+  }
+  if (i == 1) {
+    tanto_add_dst_init();
+    add_binary_tile(6, 0);
+    add_binary_tile(7, 1);
+  } else if (i != 0) {
+    tanto_sub_dst_init();
+    sub_binary_tile(6, 0);
+    sub_binary_tile(7, 1);
+  }
+}
+
+void kernel(Pipe px, Pipe pw, Pipe pb, Pipe py, Pipe px_im, Pipe pv_im,
+            Pipe py_im, Pipe pt_im, uint32 N, uint32 C, uint32 K, uint32 PQ,
+            uint32 unary_param0) {
+  uint32 Ct = C / 32;
+  uint32 Kt = K / 32;
+  px.frame_size = Ct;
+  pw.frame_size = Ct;
+  pb.frame_size = Kt;
+  py.frame_size = Kt;
+  px_im.frame_size = Ct * 16;
+  pv_im.frame_size = Ct * 4;
+  py_im.frame_size = 4;
+  pt_im.frame_size = Kt;
+  cb_wait_front(pb.cb_id, pb.frame_size);
+  for (uint32 n = 0; n < N; n++) {
+    for (uint32 pq_start = 0; pq_start < PQ; pq_start += 32) {
+      // px_im = tilize(px)
+      cb_reserve_back(px_im.cb_id, px_im.frame_size);
+      tanto_unpack_tilize_block_init(px.cb_id, Ct);
+      tanto_copy_init();
+      tanto_pack_init(px_im.cb_id);
+      for (uint32 ab = 0; ab < 16; ab++) {
+        cb_wait_front(px.cb_id, px.frame_size);
+        tilize_block(px.cb_id, Ct, px_im.cb_id);
+        cb_pop_front(px.cb_id, px.frame_size);
+      }
+      cb_push_back(px_im.cb_id, px_im.frame_size);
+      cb_wait_front(px_im.cb_id, px_im.frame_size);
+      for (uint32 i = 0; i < 4; i++) {
+        // pv_im = (B^T d B)[i]
+        transform_input(px_im, pv_im, Ct, i);
+        cb_wait_front(pv_im.cb_id, pv_im.frame_size);
+        tanto_pack_init(py_im.cb_id);
+        for (uint32 k = 0; k < Kt; k++) {
+          tile_regs_acquire();
+          tile_regs_wait();
+          if (i != 0) {
+            tanto_unpack_unary_init(py_im.cb_id);
+            tanto_copy_init();
+            cb_wait_front(py_im.cb_id, py_im.frame_size);
+            for (uint32 uv = 0; uv < 4; uv++) {
+              copy_tile(py_im.cb_id, uv, 4 + uv);
+            }
+            cb_pop_front(py_im.cb_id, py_im.frame_size);
+          }
+          // M[i][j] = V[i][j] * U[i][j]
+          tanto_unpack_matmul_init(pv_im.cb_id, pw.cb_id, true);
+          tanto_matmul_init(true);
+          for (uint32 j = 0; j < 4; j++) {
+            cb_wait_front(pw.cb_id, pw.frame_size);
+            matmul_slice(pv_im, pw, j, Ct);
+            cb_pop_front(pw.cb_id, pw.frame_size);
+          }
+          transform_output(i);
+          cb_reserve_back(py_im.cb_id, py_im.frame_size);
+          for (uint32 uv = 0; uv < 4; uv++) {
+            pack_tile(4 + uv, py_im.cb_id);
+          }
+          cb_push_back(py_im.cb_id, py_im.frame_size);
+          tile_regs_commit();
+          tile_regs_release();
+        } // k
+        cb_pop_front(pv_im.cb_id, pv_im.frame_size);
+      } // i
+      cb_pop_front(px_im.cb_id, px_im.frame_size);
+      // py = untilize(unary(Y[u][v] + pb))
+      py_im.frame_size = Kt * 4;
+      cb_wait_front(py_im.cb_id, py_im.frame_size);
+      for (uint32 uv = 0; uv < 4; uv++) {
+        cb_reserve_back(pt_im.cb_id, pt_im.frame_size);
+        tanto_unpack_bcast_rows_init(py_im.cb_id, pb.cb_id);
+        tanto_add_bcast_rows_init();
+        tanto_pack_init(pt_im.cb_id);
+        tanto_relu_init();
+        for (uint32 k = 0; k < Kt; k++) {
+          tile_regs_acquire();
+          tile_regs_wait();
+          any_tiles_bcast<EltwiseBinaryType::ELWADD, BroadcastType::ROW>(
+              py_im.cb_id, pb.cb_id, k * 4 + uv, k, 0);
+          unary_op(0, unary_param0);
+          pack_tile(0, pt_im.cb_id);
+          tile_regs_commit();
+          tile_regs_release();
+        }
+        cb_push_back(pt_im.cb_id, pt_im.frame_size);
+        cb_reserve_back(py.cb_id, py.frame_size);
+        cb_wait_front(pt_im.cb_id, pt_im.frame_size);
+        tanto_unpack_untilize_block_init(pt_im.cb_id);
+        tanto_copy_init();
+        tanto_pack_init(py.cb_id);
+        untilize_block<1>(pt_im.cb_id, Kt, py.cb_id);
+        cb_pop_front(pt_im.cb_id, pt_im.frame_size);
+        cb_push_back(py.cb_id, py.frame_size);
+      } // uv
+      cb_pop_front(py_im.cb_id, py_im.frame_size);
+      py_im.frame_size = 4;
+    } // pq_start
+  }   // n
+  cb_pop_front(pb.cb_id, pb.frame_size);
+}
+
+void MAIN {
+  Pipe px;
+  px.cb_id = get_arg_val<uint32>(0);
+  px.frame_size = get_arg_val<uint32>(1);
+  Pipe pw;
+  pw.cb_id = get_arg_val<uint32>(2);
+  pw.frame_size = get_arg_val<uint32>(3);
+  Pipe pb;
+  pb.cb_id = get_arg_val<uint32>(4);
+  pb.frame_size = get_arg_val<uint32>(5);
+  Pipe py;
+  py.cb_id = get_arg_val<uint32>(6);
+  py.frame_size = get_arg_val<uint32>(7);
+  Pipe px_im;
+  px_im.cb_id = get_arg_val<uint32>(8);
+  px_im.frame_size = get_arg_val<uint32>(9);
+  Pipe pv_im;
+  pv_im.cb_id = get_arg_val<uint32>(10);
+  pv_im.frame_size = get_arg_val<uint32>(11);
+  Pipe py_im;
+  py_im.cb_id = get_arg_val<uint32>(12);
+  py_im.frame_size = get_arg_val<uint32>(13);
+  Pipe pt_im;
+  pt_im.cb_id = get_arg_val<uint32>(14);
+  pt_im.frame_size = get_arg_val<uint32>(15);
+  uint32 N = get_arg_val<uint32>(16);
+  uint32 C = get_arg_val<uint32>(17);
+  uint32 K = get_arg_val<uint32>(18);
+  uint32 PQ = get_arg_val<uint32>(19);
+  uint32 unary_param0 = get_arg_val<uint32>(20);
+  tanto_compute_init();
+  kernel(px, pw, pb, py, px_im, pv_im, py_im, pt_im, N, C, K, PQ,
+         unary_param0);
+}
+} // namespace NAMESPACE
+
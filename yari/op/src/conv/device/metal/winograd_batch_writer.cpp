@@ -0,0 +1,124 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "tanto/dataflow.h"
+
+#define T bfloat16
+
+void write_py(Global gy, Pipe py, uint32 K, uint32 delta_p, uint32 delta_q,
+              uint32 end_q, uint32 start, uint32 &p_term, uint32 &q_term,
+              uint32 u_term, uint32 v_term, uint32 mask) {
+  uint32 src_pos = 0;
+  cb_wait_front(py.cb_id, py.frame_size);
+  for (uint32 i = 0; i < 32; i++) {
+    if ((mask & 1) != 0) {
+      uint32 dst_pos = start + p_term + q_term + u_term + v_term;
+      noc_async_write_global_dram(get_read_ptr(py.cb_id) + (src_pos << 1),
+                                  gy.addr, gy.log2_page_size, dst_pos << 1,
+                                  K << 1);
+    }
+    q_term += delta_q;
+    if (q_term >= end_q) {
+      q_term = 0;
+      p_term += delta_p;
+    }
+    mask >>= 1;
+    src_pos += K;
+  }
+  noc_async_write_barrier();
+  cb_pop_front(py.cb_id, py.frame_size);
+}
+
+void kernel(Global gw, Global gy, Global gmask, Local lmask, Pipe pw, Pipe py,
+            uint32 N, uint32 C, uint32 K, uint32 PQ, uint32 delta_p,
+            uint32 delta_q, uint32 delta_u, uint32 delta_v, uint32 end_q,
+            uint32 mask_size, uint32 y_pos, uint32 y_stride) {
+  noc_async_read_global_dram(lmask.addr + (0 << 2), gmask.addr,
+                             gmask.log2_page_size, 0 << 2, mask_size << 2);
+  noc_async_read_barrier();
+  pw.frame_size = (C / 32);
+  py.frame_size = (K / 32);
+  uint32 KC = K * C;
+  uint32 y_start = y_pos;
+  for (uint32 n = 0; n < N; n++) {
+    uint32 p_start = 0;
+    uint32 q_start = 0;
+    uint32 p_term = 0;
+    uint32 q_term = 0;
+    uint32 mask_pos = 0;
+    for (uint32 pq_start = 0; pq_start < PQ; pq_start += 32) {
+      // transformed weights U[i][j] in order of use by math kernel
+      uint32 i_start = 0;
+      for (uint32 i = 0; i < 4; i++) {
+        for (uint32 k_start = 0; k_start < K; k_start += 32) {
+          uint32 w_start = i_start + k_start * C;
+          for (uint32 j = 0; j < 4; j++) {
+            cb_reserve_back(pw.cb_id, pw.frame_size);
+            noc_async_read_global_dram(get_write_ptr(pw.cb_id) + (0 << 1),
+                                       gw.addr, gw.log2_page_size,
+                                       w_start << 1, (C * 32) << 1);
+            noc_async_read_barrier();
+            cb_push_back(pw.cb_id, pw.frame_size);
+            w_start += KC;
+          } // j
+        }   // k_start
+        i_start += 4 * KC;
+      } // i
+      // 2 x 2 output block
+      uint32 u_term = 0;
+      for (uint32 u = 0; u < 2; u++) {
+        uint32 v_term = 0;
+        for (uint32 v = 0; v < 2; v++) {
+          p_term = p_start;
+          q_term = q_start;
+          uint32 mask = reinterpret_cast<volatile tt_l1_ptr uint32_t *>(
+              lmask.addr)[mask_pos];
+          write_py(gy, py, K, delta_p, delta_q, end_q, y_start, p_term, q_term,
+                   u_term, v_term, mask);
+          mask_pos++;
+          v_term += delta_v;
+        } // v
+        u_term += delta_u;
+      } // u
+      p_start = p_term;
+      q_start = q_term;
+    } // pq_start
+    y_start += y_stride;
+  } // n
+}
+
+void kernel_main() {
+  Global gw;
+  gw.addr = get_arg_val<uint32>(0);
+  gw.log2_page_size = get_arg_val<uint32>(1);
+  Global gy;
+  gy.addr = get_arg_val<uint32>(2);
+  gy.log2_page_size = get_arg_val<uint32>(3);
+  Global gmask;
+  gmask.addr = get_arg_val<uint32>(4);
+  gmask.log2_page_size = get_arg_val<uint32>(5);
+  Local lmask;
+  lmask.addr = get_arg_val<uint32>(6);
+  Pipe pw;
+  pw.cb_id = get_arg_val<uint32>(7);
+  pw.frame_size = get_arg_val<uint32>(8);
+  Pipe py;
+  py.cb_id = get_arg_val<uint32>(9);
+  py.frame_size = get_arg_val<uint32>(10);
+  uint32 N = get_arg_val<uint32>(11);
+  uint32 C = get_arg_val<uint32>(12);
+  uint32 K = get_arg_val<uint32>(13);
+  uint32 PQ = get_arg_val<uint32>(14);
+  uint32 delta_p = get_arg_val<uint32>(15);
+  uint32 delta_q = get_arg_val<uint32>(16);
+  uint32 delta_u = get_arg_val<uint32>(17);
+  uint32 delta_v = get_arg_val<uint32>(18);
+  uint32 end_q = get_arg_val<uint32>(19);
+  uint32 mask_size = get_arg_val<uint32>(20);
+  uint32 y_pos = get_arg_val<uint32>(21);
+  uint32 y_stride = get_arg_val<uint32>(22);
+  kernel(gw, gy, gmask, lmask, pw, py, N, C, K, PQ, delta_p, delta_q, delta_u,
+         delta_v, end_q, mask_size, y_pos, y_stride);
+}
+
@@ -0,0 +1,132 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+param<uint32> C;
+param<uint32> K;
+param<uint32> R;
+param<uint32> S;
+param<uint32> PQ;
+param<uint32> start_q;
+param<uint32> delta_p;
+param<uint32> delta_q;
+param<uint32> delta_r;
+param<uint32> delta_s;
+param<uint32> end_q;
+param<uint32> zero_size;
+param<uint32> mask_size;
+param<uint32> halo_size;
+param<uint32> x_stride;
+param<uint32> x_row_stride;
+param<uint32> lx_row_stride;
+
+void read_px(
+        local<T> lx,
+        local<T> lzero,
+        pipe<T> px,
+        uint32 x_base,
+        uint32 &p_term,
+        uint32 &q_term,
+        uint32 r_term, 
+        uint32 s_term,
+        uint32 mask) {
+    uint32 dst_pos = 0;
+    px.reserve_back();
+    px.move_init(C);
+    for (uint32 i = 0; i < 32; i++) {
+        if ((mask & 1) == 0) {
+            px.move(dst_pos, lzero, 0);
+        } else {
+            uint32 src_pos = p_term + q_term + r_term + s_term - x_base;
+            px.move(dst_pos, lx, src_pos);
+        }
+        q_term += delta_q;
+        if (q_term >= end_q) {
+            q_term = start_q;
+            p_term += delta_p;
+        }
+        mask >>= 1;
+        dst_pos += C;
+    }
+    read_barrier();
+    px.push_back();
+}
+
+void kernel(
+        global<T> gx,
+        global<T> gb,
+        global<T> gzero,
+        global<uint32> gmask,
+        global<uint32> ghalo,
+        local<T> lx,
+        local<T> lzero,
+        local<uint32> lmask,
+        local<uint32> lhalo,
+        pipe<T> px,
+        pipe<T> pb,
+        uint32 N,
+        uint32 start_p,
+        uint32 x_pos,
+        uint32 mask_pos,
+        uint32 halo_pos) {
+    lzero.read(0, gzero, 0, zero_size);
+    lmask.read(0, gmask, 0, mask_size);
+    lhalo.read(0, ghalo, 0, halo_size);
+    // read_barrier is below
+    px.set_frame(C / 32);
+    pb.set_frame(K / 32);
+    pb.reserve_back();
+    pb.read(0, gb, 0, K * 32);
+    read_barrier();
+    pb.push_back();
+    uint32 x_start = x_pos;
+    for (uint32 n = 0; n < N; n++) {
+        uint32 p_start = start_p;
+        uint32 q_start = start_q;
+        uint32 p_term = 0;
+        uint32 q_term = 0;
+        uint32 mask_start = mask_pos;
+        uint32 halo_start = halo_pos;
+        for (uint32 pq_start = 0; pq_start < PQ; pq_start += 32) {
+            // load input neighborhood of output tile (including halo) once
+            uint32 src_pos = x_start + lhalo.get(halo_start);
+            uint32 rows = lhalo.get(halo_start + 1);
+            uint32 row_size = lhalo.get(halo_start + 2);
+            uint32 x_base = lhalo.get(halo_start + 3);
+            halo_start += 4;
+            uint32 dst_pos = 0;
+            for (uint32 h = 0; h < rows; h++) {
+                lx.read(dst_pos, gx, src_pos, row_size);
+                src_pos += x_row_stride;
+                dst_pos += lx_row_stride;
+            }
+            read_barrier();
+            uint32 r_term = 0;
+            for (uint32 r = 0; r < R; r++) {
+                uint32 s_term = 0;
+                for (uint32 s = 0; s < S; s++) {
+                    p_term = p_start;
+                    q_term = q_start;
+                    uint32 mask = lmask.get(mask_start);
+                    read_px(
+                        lx, 
+                        lzero,
+                        px,
+                        x_base,
+                        p_term, 
+                        q_term, 
+                        r_term, 
+                        s_term, 
+                        mask);
+                    mask_start++;
+                    s_term += delta_s;
+                } // s
+                r_term += delta_r;
+            } // r
+            p_start = p_term;
+            q_start = q_term;
+        } // pq_start
+        x_start += x_stride;
+    } // n
+}
+
@@ -3,10 +3,10 @@
 // SPDX-License-Identifier: Apache-2.0
 
 void kernel(
-        global<T> gw,
+        global<TW> gw,
         global<T> gz,
         global<T> gy,
-        pipe<T> pw,
+        pipe<TW> pw,
         pipe<T> pz,
         pipe<T> py,
         uint32 N,
@@ -3,9 +3,9 @@
 // SPDX-License-Identifier: Apache-2.0
 
 void kernel(
-        global<T> gw,
+        global<TW> gw,
         global<T> gy,
-        pipe<T> pw,
+        pipe<TW> pw,
         pipe<T> py,
         uint32 N,
         uint32 C,
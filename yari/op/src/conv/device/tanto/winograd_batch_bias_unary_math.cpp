@@ -0,0 +1,198 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+static constexpr uint32
+    UNARY_OP_RELU = 0,
+    UNARY_OP_RELU6 = 1;
+
+param<uint32> unary_op_code;
+
+void unary_op(math<T> acc, uint32 index, uint32 param0) {
+    if (unary_op_code == UNARY_OP_RELU) {
+        acc.relu(index);
+    } else if (unary_op_code == UNARY_OP_RELU6) {
+        acc.relu_max(index, 0x40c00000);
+    }
+}
+
+// Winograd F(2x2, 3x3)
+//
+// px_im: input tile d[a][b], a, b in [0 .. 3], Ct tiles each
+// pv_im: row i of V = B^T d B, V[i][j] of channel slice ct at (ct * 4 + j)
+// dst[0 .. 3]: M[i][j] = V[i][j] * U[i][j]
+// dst[4 .. 7]: Y = A^T M A, tile Y[u][v] in slot (4 + u * 2 + v)
+
+void transform_input(
+        pipe<T> px_im,
+        pipe<T> pv_im,
+        uint32 Ct,
+        uint32 i) {
+    // row i of B^T: d[a0] - d[a1] (or d[a0] + d[a1] for i == 1)
+    //     [1 0 -1 0], [0 1 1 0], [0 -1 1 0], [0 1 0 -1]
+    uint32 a0 = 1;
+    uint32 a1 = 3;
+    if (i == 0) {
+        a0 = 0;
+        a1 = 2;
+    } else if (i == 1) {
+        a1 = 2;
+    } else if (i == 2) {
+        a0 = 2;
+        a1 = 1;
+    }
+    uint32 row0 = a0 * 4 * Ct;
+    uint32 row1 = a1 * 4 * Ct;
+    pv_im.reserve_back();
+    for (uint32 ct = 0; ct < Ct; ct++) {
+        math<T> acc;
+        // $b = (B^T d)[i][b]
+        for (uint32 b = 0; b < 4; b++) {
+            uint32 col = b * Ct + ct;
+            if (i == 1) {
+                acc.add(px_im, px_im, row0 + col, row1 + col, b);
+            } else {
+                acc.sub(px_im, px_im, row0 + col, row1 + col, b);
+            }
+        }
+        // $(4 + j) = (B^T d B)[i][j]
+        acc.copy_dst(4, 0);
+        acc.sub_dst(4, 2);
+        acc.copy_dst(5, 1);
+        acc.add_dst(5, 2);
+        acc.copy_dst(6, 2);
+        acc.sub_dst(6, 1);
+        acc.copy_dst(7, 1);
+        acc.sub_dst(7, 3);
+        for (uint32 j = 0; j < 4; j++) {
+            acc.pack(4 + j, pv_im);
+        }
+    }
+    pv_im.push_back();
+}
+
+void matmul_slice(
+        math<T> acc,
+        pipe<T> pv,
+        pipe<T> pw,
+        uint32 j,
+        uint32 tiles) {
+    uint32 iv = j;
+    for (uint32 i = 0; i < tiles; i++) {
+        acc.matmul(pv, pw, iv, i, j, true);
+        iv += 4;
+    }
+}
+
+void transform_output(math<T> acc, uint32 i) {
+    // $0 = (M A)[i][0] = M[i][0] + M[i][1] + M[i][2]
+    acc.add_dst(0, 1);
+    acc.add_dst(0, 2);
+    // $1 = (M A)[i][1] = M[i][1] - M[i][2] - M[i][3]
+    acc.sub_dst(1, 2);
+    acc.sub_dst(1, 3);
+    // Y += column i of A^T times row i of (M A)
+    //     A^T = [1 1 1 0], [0 1 -1 -1]
+    if (i != 3) {
+        acc.add_dst(4, 0);
+        acc.add_dst(5, 1);
+    }
+    if (i == 1) {
+        acc.add_dst(6, 0);
+        acc.add_dst(7, 1);
+    } else if (i != 0) {
+        acc.sub_dst(6, 0);
+        acc.sub_dst(7, 1);
+    }
+}
+
+void kernel(
+        pipe<T> px,
+        pipe<T> pw,
+        pipe<T> pb,
+        pipe<T> py,
+        pipe<T> px_im,
+        pipe<T> pv_im,
+        pipe<T> py_im,
+        pipe<T> pt_im,
+        uint32 N,
+        uint32 C,
+        uint32 K,
+        uint32 PQ,
+        uint32 unary_param0) {
+    uint32 Ct = C / 32;
+    uint32 Kt = K / 32;
+    px.set_frame(Ct);
+    pw.set_frame(Ct);
+    pb.set_frame(Kt);
+    py.set_frame(Kt);
+    px_im.set_frame(Ct * 16);
+    pv_im.set_frame(Ct * 4);
+    py_im.set_frame(4);
+    pt_im.set_frame(Kt);
+    pb.wait_front();
+    for (uint32 n = 0; n < N; n++) {
+        for (uint32 pq_start = 0; pq_start < PQ; pq_start += 32) {
+            // px_im = tilize(px)
+            px_im.reserve_back();
+            for (uint32 ab = 0; ab < 16; ab++) {
+                px.wait_front();
+                tilize_block(px, Ct, px_im);
+                px.pop_front();
+            }
+            px_im.push_back();
+            px_im.wait_front();
+            for (uint32 i = 0; i < 4; i++) {
+                // pv_im = (B^T d B)[i]
+                transform_input(px_im, pv_im, Ct, i);
+                pv_im.wait_front();
+                for (uint32 k = 0; k < Kt; k++) {
+                    math<T> acc;
+                    if (i != 0) {
+                        py_im.wait_front();
+                        for (uint32 uv = 0; uv < 4; uv++) {
+                            acc.copy(py_im, uv, 4 + uv);
+                        }
+                        py_im.pop_front();
+                    }
+                    // M[i][j] = V[i][j] * U[i][j]
+                    for (uint32 j = 0; j < 4; j++) {
+                        pw.wait_front();
+                        matmul_slice(acc, pv_im, pw, j, Ct);
+                        pw.pop_front();
+                    }
+                    transform_output(acc, i);
+                    py_im.reserve_back();
+                    for (uint32 uv = 0; uv < 4; uv++) {
+                        acc.pack(4 + uv, py_im);
+                    }
+                    py_im.push_back();
+                } // k
+                pv_im.pop_front();
+            } // i
+            px_im.pop_front();
+            // py = untilize(unary(Y[u][v] + pb))
+            py_im.set_frame(Kt * 4);
+            py_im.wait_front();
+            for (uint32 uv = 0; uv < 4; uv++) {
+                pt_im.reserve_back();
+                for (uint32 k = 0; k < Kt; k++) {
+                    math<T> acc;
+                    acc.add_bcast_rows(py_im, pb, k * 4 + uv, k, 0);
+                    unary_op(acc, 0, unary_param0);
+                    acc.pack(0, pt_im);
+                }
+                pt_im.push_back();
+                py.reserve_back();
+                pt_im.wait_front();
+                untilize_block(pt_im, Kt, py);
+                pt_im.pop_front();
+                py.push_back();
+            } // uv
+            py_im.pop_front();
+            py_im.set_frame(4);
+        } // pq_start
+    } // n
+    pb.pop_front();
+}
+
@@ -0,0 +1,116 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+void write_py(
+        global<T> gy,
+        pipe<T> py,
+        uint32 K,
+        uint32 delta_p,
+        uint32 delta_q,
+        uint32 end_q,
+        uint32 start,
+        uint32 &p_term,
+        uint32 &q_term,
+        uint32 u_term,
+        uint32 v_term,
+        uint32 mask) {
+    uint32 src_pos = 0;
+    py.wait_front();
+    for (uint32 i = 0; i < 32; i++) {
+        if ((mask & 1) != 0) {
+            uint32 dst_pos = start + p_term + q_term + u_term + v_term;
+            py.write(src_pos, gy, dst_pos, K);
+        }
+        q_term += delta_q;
+        if (q_term >= end_q) {
+            q_term = 0;
+            p_term += delta_p;
+        }
+        mask >>= 1;
+        src_pos += K;
+    }
+    write_barrier();
+    py.pop_front();
+}
+
+void kernel(
+        global<T> gw,
+        global<T> gy,
+        global<uint32> gmask,
+        local<uint32> lmask,
+        pipe<T> pw,
+        pipe<T> py,
+        uint32 N,
+        uint32 C,
+        uint32 K,
+        uint32 PQ,
+        uint32 delta_p,
+        uint32 delta_q,
+        uint32 delta_u,
+        uint32 delta_v,
+        uint32 end_q,
+        uint32 mask_size,
+        uint32 y_pos,
+        uint32 y_stride) {
+    lmask.read(0, gmask, 0, mask_size);
+    read_barrier();
+    pw.set_frame(C / 32);
+    py.set_frame(K / 32);
+    uint32 KC = K * C;
+    uint32 y_start = y_pos;
+    for (uint32 n = 0; n < N; n++) {
+        uint32 p_start = 0;
+        uint32 q_start = 0;
+        uint32 p_term = 0;
+        uint32 q_term = 0;
+        uint32 mask_pos = 0;
+        for (uint32 pq_start = 0; pq_start < PQ; pq_start += 32) {
+            // transformed weights U[i][j] in order of use by math kernel
+            uint32 i_start = 0;
+            for (uint32 i = 0; i < 4; i++) {
+                for (uint32 k_start = 0; k_start < K; k_start += 32) {
+                    uint32 w_start = i_start + k_start * C;
+                    for (uint32 j = 0; j < 4; j++) {
+                        pw.reserve_back();
+                        pw.read(0, gw, w_start, C * 32);
+                        read_barrier();
+                        pw.push_back();
+                        w_start += KC;
+                    } // j
+                } // k_start
+                i_start += 4 * KC;
+            } // i
+            // 2 x 2 output block
+            uint32 u_term = 0;
+            for (uint32 u = 0; u < 2; u++) {
+                uint32 v_term = 0;
+                for (uint32 v = 0; v < 2; v++) {
+                    p_term = p_start;
+                    q_term = q_start;
+                    uint32 mask = lmask.get(mask_pos);
+                    write_py(
+                        gy,
+                        py,
+                        K,
+                        delta_p,
+                        delta_q,
+                        end_q,
+                        y_start,
+                        p_term,
+                        q_term,
+                        u_term,
+                        v_term,
+                        mask);
+                    mask_pos++;
+                    v_term += delta_v;
+                } // v
+                u_term += delta_u;
+            } // u
+            p_start = p_term;
+            q_start = q_term;
+        } // pq_start
+        y_start += y_stride;
+    } // n
+}
+
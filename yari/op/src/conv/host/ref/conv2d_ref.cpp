@@ -6,6 +6,8 @@
 #include <algorithm>
 
 #include "host/base/post_op.hpp"
+#include "host/base/ref_backend.hpp"
+#include "host/base/ref_gemm.hpp"
 
 #include "host/ref/conv2d_ref.hpp"
 
@@ -69,7 +71,16 @@ void Conv2dRef::init(
     m_z = z;
 }
 
-void Conv2dRef::run() { 
+void Conv2dRef::run() {
+    // fast version requires output distinct from residual input
+    if (base::is_ref_backend_fast() && m_z != m_y) {
+        run_fast();
+    } else {
+        run_naive();
+    }
+}
+
+void Conv2dRef::run_naive() { 
     int WC = m_W * m_C;
     int HWC = m_H * WC;
     int KC = m_K * m_C;
@@ -115,6 +126,28 @@ void Conv2dRef::run() {
     } // n
 }
 
+void Conv2dRef::run_fast() {
+    base::RefConv2dShape shape = {
+        m_N,
+        m_H,
+        m_W,
+        m_C,
+        m_P,
+        m_Q,
+        m_K,
+        m_R,
+        m_S,
+        m_pad_h,
+        m_pad_w,
+        m_stride_h,
+        m_stride_w,
+        m_dilation_h,
+        m_dilation_w,
+        1
+    };
+    base::ref_conv2d(shape, m_x, m_w, m_b, m_z, m_y, m_post_op);
+}
+
 int Conv2dRef::input_volume(int index) {
     switch (index) {
     case 0:
@@ -0,0 +1,238 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cassert>
+#include <algorithm>
+#include <vector>
+
+#include "host/base/post_op.hpp"
+
+#include "host/ref/conv2d_winograd_ref.hpp"
+
+namespace ronin {
+namespace op {
+namespace conv {
+namespace ref {
+
+namespace base = ronin::op::common::base;
+
+namespace {
+
+// Winograd F(2x2, 3x3) transform matrices
+
+const float BT[4][4] = {
+    {1.0f, 0.0f, -1.0f, 0.0f},
+    {0.0f, 1.0f, 1.0f, 0.0f},
+    {0.0f, -1.0f, 1.0f, 0.0f},
+    {0.0f, 1.0f, 0.0f, -1.0f}
+};
+
+const float G[4][3] = {
+    {1.0f, 0.0f, 0.0f},
+    {0.5f, 0.5f, 0.5f},
+    {0.5f, -0.5f, 0.5f},
+    {0.0f, 0.0f, 1.0f}
+};
+
+const float AT[2][4] = {
+    {1.0f, 1.0f, 1.0f, 0.0f},
+    {0.0f, 1.0f, -1.0f, -1.0f}
+};
+
+} // namespace
+
+//
+//    Conv2dWinogradRef
+//
+
+Conv2dWinogradRef::Conv2dWinogradRef(
+        int N,
+        int H,
+        int W,
+        int C,
+        int P,
+        int Q,
+        int K,
+        int R,
+        int S,
+        int pad_h,
+        int pad_w,
+        int stride_h,
+        int stride_w,
+        int dilation_h,
+        int dilation_w,
+        const base::PostOpSpec &post_op):
+            m_N(N),
+            m_H(H),
+            m_W(W),
+            m_C(C),
+            m_P(P),
+            m_Q(Q),
+            m_K(K),
+            m_R(R),
+            m_S(S),
+            m_pad_h(pad_h),
+            m_pad_w(pad_w),
+            m_stride_h(stride_h),
+            m_stride_w(stride_w),
+            m_dilation_h(dilation_h),
+            m_dilation_w(dilation_w),
+            m_post_op(post_op) { }
+
+Conv2dWinogradRef::~Conv2dWinogradRef() { }
+
+void Conv2dWinogradRef::init(
+        const float *x,
+        const float *w,
+        const float *b,
+        const float *z,
+        float *y) {
+    m_x = x;
+    m_w = w;
+    m_b = b;
+    m_y = y;
+    m_z = z;
+}
+
+void Conv2dWinogradRef::run() {
+    // reference for Winograd algorithm: supports only 3 x 3 stride 1 convolutions
+    assert(m_R == 3 && m_S == 3);
+    assert(m_stride_h == 1 && m_stride_w == 1);
+    assert(m_dilation_h == 1 && m_dilation_w == 1);
+    transform_weights();
+    int KC = m_K * m_C;
+    int QK = m_Q * m_K;
+    int PQK = m_P * QK;
+    int P2 = (m_P + 1) / 2;
+    int Q2 = (m_Q + 1) / 2;
+    std::vector<float> v(16 * m_C);
+    for (int n = 0; n < m_N; n++) {
+    for (int p2 = 0; p2 < P2; p2++) {
+    for (int q2 = 0; q2 < Q2; q2++) {
+        transform_block(n, p2, q2, v.data());
+        for (int k = 0; k < m_K; k++) {
+            // M = U * V (elementwise, summed over channels)
+            float mt[4][4];
+            for (int i = 0; i < 4; i++) {
+                for (int j = 0; j < 4; j++) {
+                    int ij = i * 4 + j;
+                    const float *pv = v.data() + ij * m_C;
+                    const float *pu = m_u.data() + ij * KC + k * m_C;
+                    float acc = 0.0f;
+                    for (int c = 0; c < m_C; c++) {
+                        acc += pv[c] * pu[c];
+                    }
+                    mt[i][j] = acc;
+                }
+            }
+            // Y = A^T M A
+            for (int u = 0; u < 2; u++) {
+                int p = p2 * 2 + u;
+                if (p >= m_P) {
+                    continue;
+                }
+                for (int t = 0; t < 2; t++) {
+                    int q = q2 * 2 + t;
+                    if (q >= m_Q) {
+                        continue;
+                    }
+                    float acc = 0.0f;
+                    for (int i = 0; i < 4; i++) {
+                        for (int j = 0; j < 4; j++) {
+                            acc += AT[u][i] * mt[i][j] * AT[t][j];
+                        }
+                    }
+                    if (m_b != nullptr) {
+                        acc += m_b[k];
+                    }
+                    int ypos = n * PQK + p * QK + q * m_K + k;
+                    if (m_z != nullptr) {
+                        acc += m_z[ypos];
+                    }
+                    acc = m_post_op.eval(acc);
+                    m_y[ypos] = acc;
+                } // t
+            } // u
+        } // k
+    } // q2
+    } // p2
+    } // n
+}
+
+int Conv2dWinogradRef::input_volume(int index) {
+    switch (index) {
+    case 0:
+        return m_N *  m_H * m_W * m_C;
+    case 1:
+        return m_R * m_S * m_K * m_C;
+    case 2:
+        return m_K;
+    case 3:
+        return m_N * m_P * m_Q * m_K;
+    default:
+        assert(false);
+        return 0;
+    }
+}
+
+int Conv2dWinogradRef::output_volume(int index) {
+    assert(index == 0);
+    return m_N * m_P * m_Q * m_K;
+}
+
+void Conv2dWinogradRef::transform_weights() {
+    // U = G g G^T: [3, 3, K, C] => [4, 4, K, C]
+    int KC = m_K * m_C;
+    m_u.assign(16 * KC, 0.0f);
+    for (int kc = 0; kc < KC; kc++) {
+        for (int i = 0; i < 4; i++) {
+            for (int j = 0; j < 4; j++) {
+                float acc = 0.0f;
+                for (int r = 0; r < 3; r++) {
+                    for (int s = 0; s < 3; s++) {
+                        acc += G[i][r] * m_w[(r * 3 + s) * KC + kc] * G[j][s];
+                    }
+                }
+                m_u[(i * 4 + j) * KC + kc] = acc;
+            }
+        }
+    }
+}
+
+void Conv2dWinogradRef::transform_block(int n, int p2, int q2, float *v) {
+    // V = B^T d B: 4 x 4 input tile d of output block (p2, q2) => [4, 4, C]
+    int WC = m_W * m_C;
+    int HWC = m_H * WC;
+    for (int c = 0; c < m_C; c++) {
+        float d[4][4];
+        for (int a = 0; a < 4; a++) {
+            int h = p2 * 2 - m_pad_h + a;
+            for (int b = 0; b < 4; b++) {
+                int w = q2 * 2 - m_pad_w + b;
+                if (h < 0 || h >= m_H || w < 0 || w >= m_W) {
+                    d[a][b] = 0.0f;
+                } else {
+                    d[a][b] = m_x[n * HWC + h * WC + w * m_C + c];
+                }
+            }
+        }
+        for (int i = 0; i < 4; i++) {
+            for (int j = 0; j < 4; j++) {
+                float acc = 0.0f;
+                for (int a = 0; a < 4; a++) {
+                    for (int b = 0; b < 4; b++) {
+                        acc += BT[i][a] * d[a][b] * BT[j][b];
+                    }
+                }
+                v[(i * 4 + j) * m_C + c] = acc;
+            }
+        }
+    }
+}
+
+} // namespace ref
+} // namespace conv
+} // namespace op
+} // namespace ronin
+
@@ -94,6 +94,9 @@ void Conv2dBasicBatch::init(
     m_gz = gz;
     m_gy = gy;
 
+    // weights may be stored in block float format, all other data is T
+    m_TW = m_gw.data_format();
+
     assert(m_batch_size < 8 || m_batch_size % 8 == 0);
     // ACHTUNG: Temporary limit 64 is Wormhole-specific
     assert(m_batch_size <= 64);
@@ -154,10 +157,10 @@ void Conv2dBasicBatch::init(
     m_delta_s = m_dilation_w * m_C;
     m_end_q = m_start_q + m_Q * m_delta_q;
 
-    m_enable_param_kernels = ENABLE_PARAM_KERNELS;
+    m_enable_param_kernels = ENABLE_PARAM_KERNELS && !core::is_block_float(m_TW);
     m_metal_kernel_base_path = "op/conv/device/metal";
     m_param_kernel_base_path = "op/conv/device/param";
-    m_defines = {{"T", "bfloat16"}};
+    m_defines = {{"T", "bfloat16"}, {"TW", get_weight_type_name()}};
 
     init_options();
     validate_globals();
@@ -251,6 +254,12 @@ void Conv2dBasicBatch::init_config() {
         m_cache_lx = true;
     }
     m_mcast = ENABLE_MCAST && (m_batch_size >= 16);
+    if (core::is_block_float(m_TW)) {
+        // block float weights are supported by basic writers only
+        m_cache_lx = false;
+        m_cache_lw = false;
+        m_mcast = false;
+    }
 #if 0
 printf("@@@ CACHE_LX: %d CACHE_LW: %d MCAST %d PWISE %d\n", 
 int(m_cache_lx), int(m_cache_lw), int(m_mcast), int(m_pwise));
@@ -277,7 +286,12 @@ void Conv2dBasicBatch::validate_globals() {
     assert(!m_gw.is_null());
     assert(!m_gy.is_null());
     assert(m_gx.bytes() >= input_volume(0) * item_bytes);
-    assert(m_gw.bytes() == input_volume(1) * item_bytes);
+    if (core::is_block_float(m_TW)) {
+        assert(m_gw.bytes() >= core::get_data_bytes(m_TW, input_volume(1)));
+    } else {
+        assert(m_gw.data_format() == T);
+        assert(m_gw.bytes() == input_volume(1) * item_bytes);
+    }
     if (!m_gb.is_null()) {
         assert(m_gb.bytes() == input_volume(2) * item_bytes);
     }
@@ -319,7 +333,7 @@ void Conv2dBasicBatch::create_pipes() {
             m_program,
             m_grid,
             core::PipeKind::INPUT,
-            T,
+            m_TW,
             pw_size,
             m_pw_frame_size);
     if (!m_gb.is_null()) {
@@ -686,7 +700,8 @@ void Conv2dBasicBatch::create_writer() {
         create_param_writer();
         return;
     }
-    std::string path = m_metal_kernel_base_path + "/basic_batch_writer.cpp";
+    std::string path = 
+        m_metal_kernel_base_path + "/basic_batch_writer" + get_weight_kernel_suffix() + ".cpp";
     m_writer = 
         core::Kernel(
             m_program, 
@@ -956,7 +971,8 @@ void Conv2dBasicBatch::create_add_writer() {
         create_param_add_writer();
         return;
     }
-    std::string path = m_metal_kernel_base_path + "/basic_batch_add_writer.cpp";
+    std::string path = 
+        m_metal_kernel_base_path + "/basic_batch_add_writer" + get_weight_kernel_suffix() + ".cpp";
     m_writer = 
         core::Kernel(
             m_program, 
@@ -1726,6 +1742,28 @@ void Conv2dBasicBatch::compute_mask(std::vector<uint32_t> &vmask) {
     }
 }
 
+std::string Conv2dBasicBatch::get_weight_type_name() {
+    switch (m_TW) {
+    case core::DataFormat::BFP8_B:
+        return "bfp8_b";
+    case core::DataFormat::BFP4_B:
+        return "bfp4_b";
+    default:
+        return "bfloat16";
+    }
+}
+
+std::string Conv2dBasicBatch::get_weight_kernel_suffix() {
+    switch (m_TW) {
+    case core::DataFormat::BFP8_B:
+        return "_bfp8";
+    case core::DataFormat::BFP4_B:
+        return "_bfp4";
+    default:
+        return "";
+    }
+}
+
 std::string Conv2dBasicBatch::get_unary_kernel_suffix() {
     base::PostOp op = m_post_op.op();
     switch (op) {
@@ -105,6 +105,8 @@ private:
     void init_locals();
     void compute_grid_dims(uint32_t &x, uint32_t &y);
     void compute_mask(std::vector<uint32_t> &vmask);
+    std::string get_weight_type_name();
+    std::string get_weight_kernel_suffix();
     std::string get_unary_kernel_suffix();
     uint32_t get_unary_op_code();
     uint32_t encode_unary_param0();
@@ -118,6 +120,7 @@ private:
         OPT_UNARY = 0x04;
 private:
     core::Device m_device;
+    core::DataFormat m_TW = T;
     uint32_t m_batch_size = 0;
     uint32_t m_N = 0;
     uint32_t m_H = 0;
@@ -37,6 +37,26 @@
 //    For use in reader kernels, [h_start, h_end) are clipped by [0, H)
 //
 
+//
+//    Notes on halo (per output tile activation cache)
+//
+//    If the whole LX does not fit in L1, the input neighborhood of each
+//    output tile (32 output pixels) including the filter halo is loaded
+//    into L1 once and all R * S shifted frames are then built from L1.
+//    For each tile, the window [h_start, h_end) x [w_start, w_end) is the
+//    bounding box of all valid input pixels referenced by the tile. Windows
+//    are stored in L1 with the fixed row stride of (max window width) * C.
+//    The reader uses the same term arithmetic as the LX reader with
+//    p and r terms computed using this row stride.
+//
+//    Per tile window descriptor (4 words):
+//
+//        [0] offset of first window item in input image
+//        [1] number of window rows
+//        [2] number of items per window row
+//        [3] term value (see reader) of first window item
+//
+
 namespace ronin {
 namespace op {
 namespace conv {
@@ -47,6 +67,7 @@ namespace base = ronin::op::common::base;
 namespace util = ronin::op::common::util;
 
 constexpr bool ENABLE_CACHE_LX = true;
+constexpr bool ENABLE_HALO_LX = true;
 constexpr bool ENABLE_CACHE_LW = true;
 constexpr bool ENABLE_MCAST = true;
 constexpr bool ENABLE_PWISE = true;
@@ -141,6 +162,8 @@ void Conv2dBasicSpatial::init(
     m_zero_size = m_C;
     m_mask_size = (m_split_stride * m_Q + 31) / 32;
     m_mask_size *= m_R * m_S * m_split_count;
+    m_halo_size = (m_split_stride * m_Q + 31) / 32;
+    m_halo_size *= 4 * m_split_count;
 
     uint32_t Ct = m_C / 32;
     uint32_t Kt = m_K / 32;
@@ -262,21 +285,29 @@ void Conv2dBasicSpatial::init_config() {
     // ACHTUNG: Temporary L1 limit for input caching is Wormhole-specific
     int volume_limit = (128 + 256) * 1024;
     m_cache_lx = false;
+    m_halo_lx = false;
     m_cache_lw = false;
     bool may_cache_lx = (ENABLE_CACHE_LX && !m_pwise);
-    if (may_cache_lx && ENABLE_CACHE_LW && volume_x + volume_w <= volume_limit) {
+    // halo is used only if it reduces DRAM traffic compared to per-tap reads
+    bool may_halo_lx = (ENABLE_HALO_LX && !m_pwise && init_halo_config());
+    int volume_h = may_halo_lx ? get_halo_volume() : 0;
+    if (m_prefer_halo_lx && may_halo_lx && volume_h <= volume_limit) {
+        m_halo_lx = true;
+        m_cache_lw = (ENABLE_CACHE_LW && volume_h + volume_w <= volume_limit);
+    } else if (may_cache_lx && ENABLE_CACHE_LW && volume_x + volume_w <= volume_limit) {
         m_cache_lx = true;
         m_cache_lw = true;
+    } else if (may_halo_lx && ENABLE_CACHE_LW && volume_h + volume_w <= volume_limit) {
+        m_halo_lx = true;
+        m_cache_lw = true;
     } else if (ENABLE_CACHE_LW && volume_w <= volume_limit) {
         m_cache_lw = true;
     } else if (may_cache_lx && volume_x <= volume_limit) {
         m_cache_lx = true;
+    } else if (may_halo_lx && volume_h <= volume_limit) {
+        m_halo_lx = true;
     }
     m_mcast = ENABLE_MCAST;
-#if 0
-printf("@@@ CACHE_LX: %d CACHE_LW: %d MCAST %d PWISE %d\n", 
-int(m_cache_lx), int(m_cache_lw), int(m_mcast), int(m_pwise));
-#endif
 }
 
 void Conv2dBasicSpatial::init_options() {
@@ -313,12 +344,19 @@ void Conv2dBasicSpatial::create_globals() {
     uint32_t log2_page_size = 10; // 2 ^ 10 = 1024 items
     m_gzero = core::Global(m_device, T, m_zero_size, log2_page_size);
     m_gmask = core::Global(m_device, core::DataFormat::UINT32, m_mask_size, log2_page_size);
+    if (m_halo_lx) {
+        m_ghalo = core::Global(m_device, core::DataFormat::UINT32, m_halo_size, log2_page_size);
+    }
 }
 
 void Conv2dBasicSpatial::create_locals() {
     if (m_cache_lx) {
         uint32_t x_size = get_lx_volume();
         m_lx = core::Local(m_program, m_grid, T, x_size);
+    } else if (m_halo_lx) {
+        uint32_t x_size = get_halo_volume();
+        m_lx = core::Local(m_program, m_grid, T, x_size);
+        m_lhalo = core::Local(m_program, m_grid, core::DataFormat::UINT32, m_halo_size);
     }
     m_lzero = core::Local(m_program, m_grid, T, m_zero_size);
     m_lmask = core::Local(m_program, m_grid, core::DataFormat::UINT32, m_mask_size);
@@ -417,6 +455,8 @@ void Conv2dBasicSpatial::create_kernels() {
             create_pw_bias_reader();
         } else if (m_cache_lx) {
             create_lx_bias_reader();
+        } else if (m_halo_lx) {
+            create_halo_bias_reader();
         } else {
             create_bias_reader();
         }
@@ -671,6 +711,115 @@ void kernel(
     }
 }
 
+void Conv2dBasicSpatial::create_halo_bias_reader() {
+    if (m_enable_param_kernels) {
+        create_param_halo_bias_reader();
+        return;
+    }
+    std::string path = m_metal_kernel_base_path + "/basic_spatial_halo_bias_reader.cpp";
+    m_reader = 
+        core::Kernel(
+            m_program, 
+            m_grid, 
+            core::KernelKind::READER, 
+            core::KernelFormat::METAL,
+            path, 
+            {}, 
+            m_defines);
+/*
+void kernel(
+        global<T> gx,
+        global<T> gb,
+        global<T> gzero,
+        global<uint32> gmask,
+        global<uint32> ghalo,
+        local<T> lx,
+        local<T> lzero,
+        local<uint32> lmask,
+        local<uint32> lhalo,
+        pipe<T> px,
+        pipe<T> pb,
+        uint32 N,
+        uint32 C,
+        uint32 K,
+        uint32 R,
+        uint32 S,
+        uint32 PQ,
+        uint32 start_p,
+        uint32 start_q,
+        uint32 delta_p,
+        uint32 delta_q,
+        uint32 delta_r,
+        uint32 delta_s,
+        uint32 end_q,
+        uint32 zero_size,
+        uint32 mask_size,
+        uint32 halo_size,
+        uint32 x_pos,
+        uint32 x_stride,
+        uint32 x_row_stride,
+        uint32 lx_row_stride,
+        uint32 mask_pos,
+        uint32 halo_pos)
+*/
+    uint32_t HW_rnd = u32_align(m_H * m_W, 32);
+    uint32_t x_stride = m_batch_size * HW_rnd * m_C;
+    // p and r terms use row stride of halo windows
+    uint32_t lx_row_stride = m_halo_w * m_C;
+    uint32_t start_p = uint32_t(0) - m_pad_h * lx_row_stride;
+    uint32_t delta_p = m_stride_h * lx_row_stride;
+    uint32_t delta_r = m_dilation_h * lx_row_stride;
+    std::vector<core::KernelArg> args{
+        m_gx,
+        m_gb,
+        m_gzero,
+        m_gmask,
+        m_ghalo,
+        m_lx,
+        m_lzero,
+        m_lmask,
+        m_lhalo,
+        m_px,
+        m_pb,
+        m_N / m_batch_size,
+        m_C,
+        m_K,
+        m_R,
+        m_S,
+        m_split_stride * m_Q,
+        uint32_t(0), // [17] start_p
+        m_start_q,
+        delta_p,
+        m_delta_q,
+        delta_r,
+        m_delta_s,
+        m_end_q,
+        m_zero_size,
+        m_mask_size,
+        m_halo_size,
+        uint32_t(0), // [27] x_pos
+        x_stride,
+        m_W * m_C,
+        lx_row_stride,
+        uint32_t(0), // [31] mask_pos
+        uint32_t(0)  // [32] halo_pos
+    };
+    for (uint32_t x = 0; x < m_grid_x; x++) {
+        for (uint32_t y = 0; y < m_grid_y; y++) {
+            uint32_t py = y / m_split_count;
+            uint32_t qy = y % m_split_count;
+            uint32_t batch_index = py * m_grid_x + x;
+            uint32_t batch_offset = qy * m_split_stride;
+            uint32_t tile_count = (m_split_stride * m_Q + 31) / 32;
+            args[17] = start_p + batch_offset * delta_p;
+            args[27] = batch_index * HW_rnd * m_C;
+            args[31] = qy * tile_count * m_R * m_S;
+            args[32] = qy * tile_count * 4;
+            m_reader.set_args(x, y, args);
+        }
+    }
+}
+
 void Conv2dBasicSpatial::create_pw_bias_reader() {
     if (m_enable_param_kernels) {
         create_param_pw_bias_reader();
@@ -1530,6 +1679,11 @@ void Conv2dBasicSpatial::init_locals() {
     core::Queue queue(m_device, 0);
     queue.enqueue_write(m_gzero, vzero.data(), true);
     queue.enqueue_write(m_gmask, vmask.data(), true);
+    if (m_halo_lx) {
+        std::vector<uint32_t> vhalo(m_ghalo.bytes() / sizeof(uint32_t), 0);
+        compute_halo(vhalo);
+        queue.enqueue_write(m_ghalo, vhalo.data(), true);
+    }
 }
 
 void Conv2dBasicSpatial::compute_grid_dims(uint32_t &x, uint32_t &y) {
@@ -1580,11 +1734,115 @@ void Conv2dBasicSpatial::compute_mask(std::vector<uint32_t> &vmask) {
     } // split
 }
 
+void Conv2dBasicSpatial::compute_halo(std::vector<uint32_t> &vhalo) {
+    std::vector<HaloWindow> windows;
+    uint32_t tap_count = 0;
+    compute_halo_windows(windows, tap_count);
+    assert(windows.size() * 4 <= vhalo.size());
+    uint32_t lx_row_stride = m_halo_w * m_C;
+    int k = 0;
+    for (HaloWindow &window: windows) {
+        uint32_t rows = window.h_end - window.h_start;
+        uint32_t cols = window.w_end - window.w_start;
+        vhalo[k] = window.h_start * m_W * m_C + window.w_start * m_C;
+        vhalo[k + 1] = rows;
+        vhalo[k + 2] = cols * m_C;
+        vhalo[k + 3] = window.h_start * lx_row_stride + window.w_start * m_C;
+        k += 4;
+    }
+}
+
+void Conv2dBasicSpatial::compute_halo_windows(
+        std::vector<HaloWindow> &windows, 
+        uint32_t &tap_count) {
+    // tap_count: number of valid (pixel, r, s) combinations, i.e.
+    //     number of pixels read from DRAM by the basic reader
+    windows.clear();
+    tap_count = 0;
+    int PQ = m_split_stride * m_Q;
+    int H = int(m_H);
+    int W = int(m_W);
+    for (int split = 0; split < int(m_split_count); split++) {
+        for (int pq_start = 0; pq_start < PQ; pq_start += 32) {
+            int h_start = H;
+            int h_end = 0;
+            int w_start = W;
+            int w_end = 0;
+            for (int i = 0; i < 32; i++) {
+                int pq = pq_start + i;
+                if (pq >= PQ) {
+                    break;
+                }
+                int p = pq / m_Q + split * m_split_stride;
+                int q = pq % m_Q;
+                if (p >= int(m_P)) {
+                    break;
+                }
+                int h0 = p * m_stride_h - m_pad_h;
+                int w0 = q * m_stride_w - m_pad_w;
+                int valid_r = 0;
+                int valid_s = 0;
+                for (int r = 0; r < int(m_R); r++) {
+                    int h = h0 + r * m_dilation_h;
+                    if (h >= 0 && h < H) {
+                        h_start = std::min(h_start, h);
+                        h_end = std::max(h_end, h + 1);
+                        valid_r++;
+                    }
+                }
+                for (int s = 0; s < int(m_S); s++) {
+                    int w = w0 + s * m_dilation_w;
+                    if (w >= 0 && w < W) {
+                        w_start = std::min(w_start, w);
+                        w_end = std::max(w_end, w + 1);
+                        valid_s++;
+                    }
+                }
+                tap_count += uint32_t(valid_r * valid_s);
+            }
+            if (h_start >= h_end || w_start >= w_end) {
+                windows.push_back(HaloWindow{0, 0, 0, 0});
+            } else {
+                windows.push_back(
+                    HaloWindow{
+                        uint32_t(h_start), 
+                        uint32_t(h_end), 
+                        uint32_t(w_start), 
+                        uint32_t(w_end)});
+            }
+        } // pq_start
+    } // split
+}
+
+bool Conv2dBasicSpatial::init_halo_config() {
+    std::vector<HaloWindow> windows;
+    uint32_t tap_count = 0;
+    compute_halo_windows(windows, tap_count);
+    uint32_t max_rows = 0;
+    uint32_t max_cols = 0;
+    uint32_t halo_count = 0;
+    for (HaloWindow &window: windows) {
+        uint32_t rows = window.h_end - window.h_start;
+        uint32_t cols = window.w_end - window.w_start;
+        max_rows = std::max(max_rows, rows);
+        max_cols = std::max(max_cols, cols);
+        halo_count += rows * cols;
+    }
+    m_halo_h = max_rows;
+    m_halo_w = max_cols;
+    return (max_rows != 0 && halo_count < tap_count);
+}
+
 uint32_t Conv2dBasicSpatial::get_lx_volume() {
     // h = p * stride_h - pad_h + r * dilation_h
     return ((m_split_stride - 1) * m_stride_h + (m_R - 1) * m_dilation_h + 1) * m_W * m_C;
 }
 
+uint32_t Conv2dBasicSpatial::get_halo_volume() {
+    // valid after init_halo_config
+    return m_halo_h * m_halo_w * m_C;
+}
+
 std::string Conv2dBasicSpatial::get_unary_kernel_suffix() {
     base::PostOp op = m_post_op.op();
     switch (op) {
@@ -51,10 +51,24 @@ public:
         const core::Global &gz,
         const core::Global &gy);
     void run();
+    // select halo input reader whenever it fits, call before init
+    void set_prefer_halo_lx(bool enable) {
+        m_prefer_halo_lx = enable;
+    }
+    bool uses_halo_lx() {
+        return m_halo_lx;
+    }
     int input_volume(int index);
     int output_volume(int index);
     std::vector<float> transform_input(int index, const std::vector<float> &x);
     std::vector<float> transform_output(int index, const std::vector<float> &x);
+private:
+    struct HaloWindow {
+        uint32_t h_start;
+        uint32_t h_end;
+        uint32_t w_start;
+        uint32_t w_end;
+    };
 private:
     void init_config();
     void init_options();
@@ -66,6 +80,7 @@ private:
     void create_kernels();
     void create_bias_reader();
     void create_lx_bias_reader();
+    void create_halo_bias_reader();
     void create_pw_bias_reader();
     void create_mcast_writer();
     void create_lw_mcast_writer();
@@ -81,6 +96,7 @@ private:
     void create_lw_bias_add_unary_math();
     void create_param_bias_reader();
     void create_param_lx_bias_reader();
+    void create_param_halo_bias_reader();
     void create_param_pw_bias_reader();
     void create_param_mcast_writer();
     void create_param_lw_mcast_writer();
@@ -97,7 +113,11 @@ private:
     void init_locals();
     void compute_grid_dims(uint32_t &x, uint32_t &y);
     void compute_mask(std::vector<uint32_t> &vmask);
+    void compute_halo(std::vector<uint32_t> &vhalo);
+    void compute_halo_windows(std::vector<HaloWindow> &windows, uint32_t &tap_count);
+    bool init_halo_config();
     uint32_t get_lx_volume();
+    uint32_t get_halo_volume();
     std::string get_unary_kernel_suffix();
     uint32_t get_unary_op_code();
     uint32_t encode_unary_param0();
@@ -128,6 +148,8 @@ private:
     uint32_t m_dilation_h = 0;
     uint32_t m_dilation_w = 0;
     bool m_cache_lx = false;
+    bool m_halo_lx = false;
+    bool m_prefer_halo_lx = false;
     bool m_cache_lw = false;
     bool m_mcast = false;
     bool m_pwise = false;
@@ -144,9 +166,11 @@ private:
     core::Global m_gy;
     core::Global m_gzero;
     core::Global m_gmask;
+    core::Global m_ghalo;
     core::Local m_lx;
     core::Local m_lzero;
     core::Local m_lmask;
+    core::Local m_lhalo;
     core::Pipe m_px;
     core::Pipe m_pw;
     core::Pipe m_pb;
@@ -166,6 +190,9 @@ private:
     uint32_t m_Ki = 0;
     uint32_t m_zero_size = 0;
     uint32_t m_mask_size = 0;
+    uint32_t m_halo_size = 0;
+    uint32_t m_halo_h = 0;
+    uint32_t m_halo_w = 0;
     uint32_t m_px_frame_size = 0;
     uint32_t m_pw_frame_size = 0;
     uint32_t m_pb_frame_size = 0;
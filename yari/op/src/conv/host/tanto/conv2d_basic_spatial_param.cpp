@@ -221,6 +221,115 @@ void kernel(
     }
 }
 
+void Conv2dBasicSpatial::create_param_halo_bias_reader() {
+    std::string path = m_param_kernel_base_path + "/basic_spatial_halo_bias_reader.cpp";
+/*
+param<uint32> C;
+param<uint32> K;
+param<uint32> R;
+param<uint32> S;
+param<uint32> PQ;
+param<uint32> start_q;
+param<uint32> delta_p;
+param<uint32> delta_q;
+param<uint32> delta_r;
+param<uint32> delta_s;
+param<uint32> end_q;
+param<uint32> zero_size;
+param<uint32> mask_size;
+param<uint32> halo_size;
+param<uint32> x_stride;
+param<uint32> x_row_stride;
+param<uint32> lx_row_stride;
+*/
+    uint32_t HW_rnd = u32_align(m_H * m_W, 32);
+    uint32_t x_stride = m_batch_size * HW_rnd * m_C;
+    // p and r terms use row stride of halo windows
+    uint32_t lx_row_stride = m_halo_w * m_C;
+    uint32_t start_p = uint32_t(0) - m_pad_h * lx_row_stride;
+    uint32_t delta_p = m_stride_h * lx_row_stride;
+    uint32_t delta_r = m_dilation_h * lx_row_stride;
+    std::vector<uint32_t> params{
+        m_C,
+        m_K,
+        m_R,
+        m_S,
+        m_split_stride * m_Q,
+        m_start_q,
+        delta_p,
+        m_delta_q,
+        delta_r,
+        m_delta_s,
+        m_end_q,
+        m_zero_size,
+        m_mask_size,
+        m_halo_size,
+        x_stride,
+        m_W * m_C,
+        lx_row_stride
+    };
+    m_reader = 
+        core::Kernel(
+            m_program, 
+            m_grid, 
+            core::KernelKind::READER, 
+            core::KernelFormat::TANTO,
+            path, 
+            params, 
+            m_defines);
+/*
+void kernel(
+        global<T> gx,
+        global<T> gb,
+        global<T> gzero,
+        global<uint32> gmask,
+        global<uint32> ghalo,
+        local<T> lx,
+        local<T> lzero,
+        local<uint32> lmask,
+        local<uint32> lhalo,
+        pipe<T> px,
+        pipe<T> pb,
+        uint32 N,
+        uint32 start_p,
+        uint32 x_pos,
+        uint32 mask_pos,
+        uint32 halo_pos)
+*/
+    std::vector<core::KernelArg> args{
+        m_gx,
+        m_gb,
+        m_gzero,
+        m_gmask,
+        m_ghalo,
+        m_lx,
+        m_lzero,
+        m_lmask,
+        m_lhalo,
+        m_px,
+        m_pb,
+        m_N / m_batch_size,
+        uint32_t(0), // [12] start_p
+        uint32_t(0), // [13] x_pos
+        uint32_t(0), // [14] mask_pos
+        uint32_t(0)  // [15] halo_pos
+    };
+    for (uint32_t x = 0; x < m_grid_x; x++) {
+        for (uint32_t y = 0; y < m_grid_y; y++) {
+            uint32_t py = y / m_split_count;
+            uint32_t qy = y % m_split_count;
+            uint32_t batch_index = py * m_grid_x + x;
+            uint32_t batch_offset = qy * m_split_stride;
+            uint32_t tile_count = (m_split_stride * m_Q + 31) / 32;
+            args[12] = start_p + batch_offset * delta_p;
+            args[13] = batch_index * HW_rnd * m_C;
+            args[14] = qy * tile_count * m_R * m_S;
+            args[15] = qy * tile_count * 4;
+            m_reader.set_args(x, y, args);
+        }
+    }
+}
+
 void Conv2dBasicSpatial::create_param_pw_bias_reader() {
     std::string path = m_param_kernel_base_path + "/basic_spatial_pw_bias_reader.cpp";
 /*
@@ -0,0 +1,820 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdint>
+#include <cassert>
+#include <string>
+#include <vector>
+
+#include "host/core/api.hpp"
+
+#include "host/base/post_op.hpp"
+
+#include "host/util/transform.hpp"
+
+#include "host/tanto/util.hpp"
+#include "host/tanto/conv2d_winograd_batch.hpp"
+
+namespace ronin {
+namespace op {
+namespace conv {
+namespace tanto {
+
+namespace core = ronin::tanto::host;
+namespace base = ronin::op::common::base;
+namespace util = ronin::op::common::util;
+
+//
+//    Winograd F(2x2, 3x3) convolution
+//
+//    Each 2 x 2 output block is computed from the 4 x 4 input tile d as
+//
+//        Y = A^T [(G g G^T) * (B^T d B)] A
+//
+//    where g is 3 x 3 filter and "*" is elementwise product in the 4 x 4
+//    transformed domain. Blocks are processed in groups of 32 (one tile row).
+//    Filter transform U = G g G^T is computed once on host in transform_input.
+//    Input and output transforms use only additions and subtractions and
+//    are performed by the math kernel. Elementwise products summed over
+//    channels are 16 independent matrix multiplications (one per element
+//    of the transformed domain) which reduces number of multiplications
+//    from 36 to 16 per output block compared to the direct (im2col) algorithm.
+//
+
+namespace {
+
+// ACHTUNG: Temporary L1 limit for pipes is Wormhole-specific
+constexpr uint32_t L1_PIPE_LIMIT = (512 + 256) * 1024;
+
+constexpr uint32_t TILE_BYTES = 32 * 32 * 2;
+
+// G = [1 0 0], [1/2 1/2 1/2], [1/2 -1/2 1/2], [0 0 1]
+const float G[4][3] = {
+    {1.0f, 0.0f, 0.0f},
+    {0.5f, 0.5f, 0.5f},
+    {0.5f, -0.5f, 0.5f},
+    {0.0f, 0.0f, 1.0f}
+};
+
+uint32_t get_pipe_tiles(uint32_t Ct, uint32_t Kt) {
+    // px, pw, pb, py: double buffered
+    // px_im: 16 * Ct, pv_im: 4 * Ct, py_im: 4 * Kt, pt_im: Kt
+    return 2 * Ct + 2 * Ct + 2 * Kt + 2 * Kt + 16 * Ct + 4 * Ct + 4 * Kt + Kt;
+}
+
+} // namespace
+
+//
+//    Conv2dWinogradBatch
+//
+
+Conv2dWinogradBatch::Conv2dWinogradBatch(
+        int N,
+        int H,
+        int W,
+        int C,
+        int P,
+        int Q,
+        int K,
+        int R,
+        int S,
+        int pad_h,
+        int pad_w,
+        int stride_h,
+        int stride_w,
+        int dilation_h,
+        int dilation_w,
+        const base::PostOpSpec &post_op,
+        int batch_size):
+            m_N(uint32_t(N)),
+            m_H(uint32_t(H)),
+            m_W(uint32_t(W)),
+            m_C(uint32_t(C)),
+            m_P(uint32_t(P)),
+            m_Q(uint32_t(Q)),
+            m_K(uint32_t(K)),
+            m_R(uint32_t(R)),
+            m_S(uint32_t(S)),
+            m_pad_h(uint32_t(pad_h)),
+            m_pad_w(uint32_t(pad_w)),
+            m_stride_h(uint32_t(stride_h)),
+            m_stride_w(uint32_t(stride_w)),
+            m_dilation_h(uint32_t(dilation_h)),
+            m_dilation_w(uint32_t(dilation_w)),
+            m_post_op(post_op),
+            m_batch_size(uint32_t(batch_size)) {
+    // these values are required to compute input/output volumes and shapes
+    m_C_arg = m_C;
+    m_K_arg = m_K;
+    m_C = u32_align(m_C, 32);
+    m_K = u32_align(m_K, 32);
+    m_P2 = (m_P + 1) / 2;
+    m_Q2 = (m_Q + 1) / 2;
+}
+
+Conv2dWinogradBatch::~Conv2dWinogradBatch() { }
+
+bool Conv2dWinogradBatch::is_supported(
+        int C,
+        int K,
+        int R,
+        int S,
+        int pad_h,
+        int pad_w,
+        int stride_h,
+        int stride_w,
+        int dilation_h,
+        int dilation_w,
+        bool fuse_add) {
+    if (R != 3 || S != 3) {
+        return false;
+    }
+    if (stride_h != 1 || stride_w != 1 || dilation_h != 1 || dilation_w != 1) {
+        return false;
+    }
+    // reader position terms assume pad_w * C <= delta_q
+    if (pad_h > 2 || pad_w > 2) {
+        return false;
+    }
+    // fused residual add is not yet implemented
+    if (fuse_add) {
+        return false;
+    }
+    uint32_t Ct = u32_align(uint32_t(C), 32) / 32;
+    uint32_t Kt = u32_align(uint32_t(K), 32) / 32;
+    return (get_pipe_tiles(Ct, Kt) * TILE_BYTES <= L1_PIPE_LIMIT);
+}
+
+void Conv2dWinogradBatch::init(
+        const core::Device &device,
+        const core::Global &gx,
+        const core::Global &gw,
+        const core::Global &gb,
+        const core::Global &gz,
+        const core::Global &gy) {
+    m_device = device;
+    m_gx = gx;
+    m_gw = gw;
+    m_gb = gb;
+    m_gz = gz;
+    m_gy = gy;
+
+    assert(m_batch_size < 8 || m_batch_size % 8 == 0);
+    // ACHTUNG: Temporary limit 64 is Wormhole-specific
+    assert(m_batch_size <= 64);
+    assert(m_N % m_batch_size == 0);
+
+    assert(m_C % 32 == 0);
+    assert(m_K % 32 == 0);
+
+    assert(is_supported(
+        m_C,
+        m_K,
+        m_R,
+        m_S,
+        m_pad_h,
+        m_pad_w,
+        m_stride_h,
+        m_stride_w,
+        m_dilation_h,
+        m_dilation_w,
+        !m_gz.is_null()));
+
+    m_program = core::Program(m_device);
+
+    uint32_t grid_x, grid_y;
+    compute_grid_dims(grid_x, grid_y);
+
+    m_x_start = 0;
+    m_y_start = 0;
+    m_x_end = grid_x - 1;
+    m_y_end = grid_y - 1;
+
+    m_grid = core::Grid(m_program, m_x_start, m_y_start, m_x_end, m_y_end);
+
+    uint32_t PQ2 = m_P2 * m_Q2;
+    m_zero_size = m_C;
+    m_mask_size = (PQ2 + 31) / 32;
+    m_mask_size *= 16;
+    m_ymask_size = (PQ2 + 31) / 32;
+    m_ymask_size *= 4;
+
+    // reader position terms: input tile of each output block
+    m_start_p = uint32_t(-int32_t(m_pad_h * m_W * m_C));
+    m_start_q = uint32_t(-int32_t(m_pad_w * m_C));
+    m_delta_p = 2 * m_W * m_C;
+    m_delta_q = 2 * m_C;
+    m_delta_r = m_W * m_C;
+    m_delta_s = m_C;
+    m_end_q = m_start_q + m_Q2 * m_delta_q;
+
+    m_metal_kernel_base_path = "op/conv/device/metal";
+    m_defines = {{"T", "bfloat16"}};
+
+    init_options();
+    validate_globals();
+
+    create_globals();
+    create_locals();
+    create_pipes();
+    create_kernels();
+
+    init_locals();
+}
+
+void Conv2dWinogradBatch::run() {
+    core::Queue queue(m_device, 0);
+    queue.enqueue_program(m_program, false);
+}
+
+int Conv2dWinogradBatch::input_volume(int index) {
+    switch (index) {
+    case 0:
+        return m_N * u32_align(m_H * m_W, 32) * m_C;
+    case 1:
+        return 16 * m_K * m_C;
+    case 2:
+        return m_K * 32;
+    case 3:
+        return m_N * u32_align(m_P * m_Q, 32) * m_K;
+    default:
+        assert(false);
+        return 0;
+    }
+}
+
+int Conv2dWinogradBatch::output_volume(int index) {
+    assert(index == 0);
+    return m_N * u32_align(m_P * m_Q, 32) * m_K;
+}
+
+std::vector<float> Conv2dWinogradBatch::transform_input(int index, const std::vector<float> &x) {
+    std::vector<float> y;
+    switch (index) {
+    case 0:
+        y = util::pad(x, m_N, m_H * m_W, m_C_arg, m_N, u32_align(m_H * m_W, 32), m_C);
+        break;
+    case 1:
+        y = util::pad(x, m_R * m_S, m_K_arg, m_C_arg, m_R * m_S, m_K, m_C);
+        y = transform_weights(y);
+        y = util::tilize(y, 16 * m_K, m_C);
+        y = util::make_faces(y);
+        break;
+    case 2:
+        y = util::pad(x, 1, m_K_arg, 32, m_K);
+        y = util::tilize(y, 32, m_K);
+        y = util::make_faces(y);
+        break;
+    case 3:
+        y = util::pad(x, m_N, m_P * m_Q, m_K_arg, m_N, u32_align(m_P * m_Q, 32), m_K);
+        break;
+    default:
+        assert(false);
+        break;
+    }
+    return y;
+}
+
+std::vector<float> Conv2dWinogradBatch::transform_output(int index, const std::vector<float> &x) {
+    assert(index == 0);
+    return util::unpad(x, m_N, u32_align(m_P * m_Q, 32), m_K, m_N, m_P * m_Q, m_K_arg);
+}
+
+void Conv2dWinogradBatch::init_options() {
+    m_options = 0;
+    if (!m_gb.is_null()) {
+        m_options |= OPT_BIAS;
+    }
+    base::PostOp op = m_post_op.op();
+    if (op != base::PostOp::NONE) {
+        m_options |= OPT_UNARY;
+    }
+}
+
+void Conv2dWinogradBatch::validate_globals() {
+    uint32_t item_bytes = get_item_bytes(T);
+    assert(!m_gx.is_null());
+    assert(!m_gw.is_null());
+    assert(!m_gy.is_null());
+    assert(m_gx.bytes() >= input_volume(0) * item_bytes);
+    assert(m_gw.bytes() == input_volume(1) * item_bytes);
+    if (!m_gb.is_null()) {
+        assert(m_gb.bytes() == input_volume(2) * item_bytes);
+    }
+    assert(m_gy.bytes() >= output_volume(0) * item_bytes);
+}
+
+void Conv2dWinogradBatch::create_globals() {
+    uint32_t log2_page_size = 10; // 2 ^ 10 = 1024 items
+    m_gzero = core::Global(m_device, T, m_zero_size, log2_page_size);
+    m_gmask = core::Global(m_device, core::DataFormat::UINT32, m_mask_size, log2_page_size);
+    m_gymask = core::Global(m_device, core::DataFormat::UINT32, m_ymask_size, log2_page_size);
+}
+
+void Conv2dWinogradBatch::create_locals() {
+    m_lzero = core::Local(m_program, m_grid, T, m_zero_size);
+    m_lmask = core::Local(m_program, m_grid, core::DataFormat::UINT32, m_mask_size);
+    m_lymask = core::Local(m_program, m_grid, core::DataFormat::UINT32, m_ymask_size);
+}
+
+void Conv2dWinogradBatch::create_pipes() {
+    uint32_t Ct = m_C / 32;
+    uint32_t Kt = m_K / 32;
+    m_px =
+        core::Pipe(
+            m_program,
+            m_grid,
+            core::PipeKind::INPUT,
+            T,
+            Ct * 2,
+            Ct);
+    m_pw =
+        core::Pipe(
+            m_program,
+            m_grid,
+            core::PipeKind::INPUT,
+            T,
+            Ct * 2,
+            Ct);
+    if (!m_gb.is_null()) {
+        m_pb =
+            core::Pipe(
+                m_program,
+                m_grid,
+                core::PipeKind::INPUT,
+                T,
+                Kt * 2,
+                Kt);
+    }
+    m_py =
+        core::Pipe(
+            m_program,
+            m_grid,
+            core::PipeKind::OUTPUT,
+            T,
+            Kt * 2,
+            Kt);
+    // all 16 input tile elements of one group of output blocks
+    m_px_im =
+        core::Pipe(
+            m_program,
+            m_grid,
+            core::PipeKind::INTERMED,
+            T,
+            Ct * 16,
+            Ct * 16);
+    // one row of transformed input tile
+    m_pv_im =
+        core::Pipe(
+            m_program,
+            m_grid,
+            core::PipeKind::INTERMED,
+            T,
+            Ct * 4,
+            Ct * 4);
+    // output block accumulators, one frame per output channel tile
+    m_py_im =
+        core::Pipe(
+            m_program,
+            m_grid,
+            core::PipeKind::INTERMED,
+            T,
+            Kt * 4,
+            4);
+    m_pt_im =
+        core::Pipe(
+            m_program,
+            m_grid,
+            core::PipeKind::INTERMED,
+            T,
+            Kt,
+            Kt);
+}
+
+void Conv2dWinogradBatch::create_kernels() {
+    uint32_t reader_options = m_options & OPT_BIAS;
+    uint32_t math_options = m_options;
+    if (reader_options == OPT_BIAS) {
+        create_bias_reader();
+    } else {
+        // not yet implemented
+        assert(false);
+    }
+    create_writer();
+    if (math_options == OPT_BIAS) {
+        create_bias_math();
+    } else if (math_options == (OPT_BIAS | OPT_UNARY)) {
+        create_bias_unary_math();
+    } else {
+        // not yet implemented
+        assert(false);
+    }
+}
+
+void Conv2dWinogradBatch::create_bias_reader() {
+    std::string path = m_metal_kernel_base_path + "/winograd_batch_bias_reader.cpp";
+    m_reader =
+        core::Kernel(
+            m_program,
+            m_grid,
+            core::KernelKind::READER,
+            core::KernelFormat::METAL,
+            path,
+            {},
+            m_defines);
+/*
+void kernel(
+        global<T> gx,
+        global<T> gb,
+        global<T> gzero,
+        global<uint32> gmask,
+        local<T> lzero,
+        local<uint32> lmask,
+        pipe<T> px,
+        pipe<T> pb,
+        uint32 N,
+        uint32 C,
+        uint32 K,
+        uint32 PQ,
+        uint32 start_p,
+        uint32 start_q,
+        uint32 delta_p,
+        uint32 delta_q,
+        uint32 delta_r,
+        uint32 delta_s,
+        uint32 end_q,
+        uint32 zero_size,
+        uint32 mask_size,
+        uint32 x_pos,
+        uint32 x_stride)
+*/
+    uint32_t HW_rnd = u32_align(m_H * m_W, 32);
+    uint32_t x_stride = m_batch_size * HW_rnd * m_C;
+    std::vector<core::KernelArg> args{
+        m_gx,
+        m_gb,
+        m_gzero,
+        m_gmask,
+        m_lzero,
+        m_lmask,
+        m_px,
+        m_pb,
+        m_N / m_batch_size,
+        m_C,
+        m_K,
+        m_P2 * m_Q2,
+        m_start_p,
+        m_start_q,
+        m_delta_p,
+        m_delta_q,
+        m_delta_r,
+        m_delta_s,
+        m_end_q,
+        m_zero_size,
+        m_mask_size,
+        uint32_t(0), // [21] x_pos
+        x_stride
+    };
+    uint32_t x_inc = HW_rnd * m_C;
+    uint32_t x_pos = 0;
+    for (uint32_t x = m_x_start; x <= m_x_end; x++) {
+        for (uint32_t y = m_y_start; y <= m_y_end; y++) {
+            args[21] = x_pos;
+            m_reader.set_args(x, y, args);
+            x_pos += x_inc;
+        }
+    }
+}
+
+void Conv2dWinogradBatch::create_writer() {
+    std::string path = m_metal_kernel_base_path + "/winograd_batch_writer.cpp";
+    m_writer =
+        core::Kernel(
+            m_program,
+            m_grid,
+            core::KernelKind::WRITER,
+            core::KernelFormat::METAL,
+            path,
+            {},
+            m_defines);
+/*
+void kernel(
+        global<T> gw,
+        global<T> gy,
+        global<uint32> gmask,
+        local<uint32> lmask,
+        pipe<T> pw,
+        pipe<T> py,
+        uint32 N,
+        uint32 C,
+        uint32 K,
+        uint32 PQ,
+        uint32 delta_p,
+        uint32 delta_q,
+        uint32 delta_u,
+        uint32 delta_v,
+        uint32 end_q,
+        uint32 mask_size,
+        uint32 y_pos,
+        uint32 y_stride)
+*/
+    uint32_t PQ_rnd = u32_align(m_P * m_Q, 32);
+    uint32_t y_stride = m_batch_size * PQ_rnd * m_K;
+    uint32_t delta_p = 2 * m_Q * m_K;
+    uint32_t delta_q = 2 * m_K;
+    uint32_t end_q = m_Q2 * delta_q;
+    std::vector<core::KernelArg> args{
+        m_gw,
+        m_gy,
+        m_gymask,
+        m_lymask,
+        m_pw,
+        m_py,
+        m_N / m_batch_size,
+        m_C,
+        m_K,
+        m_P2 * m_Q2,
+        delta_p,
+        delta_q,
+        m_Q * m_K,
+        m_K,
+        end_q,
+        m_ymask_size,
+        uint32_t(0), // [16] y_pos
+        y_stride
+    };
+    uint32_t y_inc = PQ_rnd * m_K;
+    uint32_t y_pos = 0;
+    for (uint32_t x = m_x_start; x <= m_x_end; x++) {
+        for (uint32_t y = m_y_start; y <= m_y_end; y++) {
+            args[16] = y_pos;
+            m_writer.set_args(x, y, args);
+            y_pos += y_inc;
+        }
+    }
+}
+
+void Conv2dWinogradBatch::create_bias_math() {
+    std::string path = m_metal_kernel_base_path + "/winograd_batch_bias_math.cpp";
+    m_math =
+        core::Kernel(
+            m_program,
+            m_grid,
+            core::KernelKind::MATH,
+            core::KernelFormat::METAL,
+            path,
+            {},
+            m_defines);
+/*
+void kernel(
+        pipe<T> px,
+        pipe<T> pw,
+        pipe<T> pb,
+        pipe<T> py,
+        pipe<T> px_im,
+        pipe<T> pv_im,
+        pipe<T> py_im,
+        pipe<T> pt_im,
+        uint32 N,
+        uint32 C,
+        uint32 K,
+        uint32 PQ)
+*/
+    std::vector<core::KernelArg> args{
+        m_px,
+        m_pw,
+        m_pb,
+        m_py,
+        m_px_im,
+        m_pv_im,
+        m_py_im,
+        m_pt_im,
+        m_N / m_batch_size,
+        m_C,
+        m_K,
+        m_P2 * m_Q2
+    };
+    m_math.set_args(m_grid, args);
+}
+
+void Conv2dWinogradBatch::create_bias_unary_math() {
+    std::string suffix = get_unary_kernel_suffix();
+    std::string path = m_metal_kernel_base_path + "/winograd_batch_bias_" + suffix + "_math.cpp";
+    m_math =
+        core::Kernel(
+            m_program,
+            m_grid,
+            core::KernelKind::MATH,
+            core::KernelFormat::METAL,
+            path,
+            {},
+            m_defines);
+/*
+void kernel(
+        pipe<T> px,
+        pipe<T> pw,
+        pipe<T> pb,
+        pipe<T> py,
+        pipe<T> px_im,
+        pipe<T> pv_im,
+        pipe<T> py_im,
+        pipe<T> pt_im,
+        uint32 N,
+        uint32 C,
+        uint32 K,
+        uint32 PQ,
+        uint32 unary_param0)
+*/
+    uint32_t unary_param0 = encode_unary_param0();
+    std::vector<core::KernelArg> args{
+        m_px,
+        m_pw,
+        m_pb,
+        m_py,
+        m_px_im,
+        m_pv_im,
+        m_py_im,
+        m_pt_im,
+        m_N / m_batch_size,
+        m_C,
+        m_K,
+        m_P2 * m_Q2,
+        unary_param0
+    };
+    m_math.set_args(m_grid, args);
+}
+
+void Conv2dWinogradBatch::init_locals() {
+    std::vector<uint32_t> vzero(m_gzero.bytes() / sizeof(uint32_t), 0);
+    std::vector<uint32_t> vmask(m_gmask.bytes() / sizeof(uint32_t), 0);
+    std::vector<uint32_t> vymask(m_gymask.bytes() / sizeof(uint32_t), 0);
+    compute_x_mask(vmask);
+    compute_y_mask(vymask);
+    core::Queue queue(m_device, 0);
+    queue.enqueue_write(m_gzero, vzero.data(), true);
+    queue.enqueue_write(m_gmask, vmask.data(), true);
+    queue.enqueue_write(m_gymask, vymask.data(), true);
+}
+
+void Conv2dWinogradBatch::compute_grid_dims(uint32_t &x, uint32_t &y) {
+    // ACHTUNG: Temporary limit 8 is Wormhole-specific
+    if (m_batch_size <= 8) {
+        x = m_batch_size;
+        y = 1;
+    } else {
+        x = 8;
+        y = m_batch_size / 8;
+    }
+}
+
+void Conv2dWinogradBatch::compute_x_mask(std::vector<uint32_t> &vmask) {
+    // valid elements of 4 x 4 input tile of each output block
+    int PQ2 = m_P2 * m_Q2;
+    int size = (PQ2 + 31) / 32;
+    size *= 16;
+    assert(size <= vmask.size());
+    int k = 0;
+    for (int pq_start = 0; pq_start < PQ2; pq_start += 32) {
+        for (int r = 0; r < 4; r++) {
+            for (int s = 0; s < 4; s++) {
+                uint32_t mask = 0;
+                uint32_t flag = 1;
+                for (int i = 0; i < 32; i++) {
+                    bool valid = true;
+                    int pq = pq_start + i;
+                    if (pq >= PQ2) {
+                        valid = false;
+                    } else {
+                        int p = pq / m_Q2;
+                        int q = pq - p * m_Q2;
+                        int h = 2 * p - m_pad_h + r;
+                        int w = 2 * q - m_pad_w + s;
+                        if (h < 0 || h >= int(m_H) || w < 0 || w >= int(m_W)) {
+                            valid = false;
+                        }
+                    }
+                    if (valid) {
+                        mask |= flag;
+                    }
+                    flag <<= 1;
+                }
+                vmask[k] = mask;
+                k++;
+            }
+        }
+    }
+}
+
+void Conv2dWinogradBatch::compute_y_mask(std::vector<uint32_t> &vmask) {
+    // valid elements of each 2 x 2 output block (P and Q may be odd)
+    int PQ2 = m_P2 * m_Q2;
+    int size = (PQ2 + 31) / 32;
+    size *= 4;
+    assert(size <= vmask.size());
+    int k = 0;
+    for (int pq_start = 0; pq_start < PQ2; pq_start += 32) {
+        for (int u = 0; u < 2; u++) {
+            for (int v = 0; v < 2; v++) {
+                uint32_t mask = 0;
+                uint32_t flag = 1;
+                for (int i = 0; i < 32; i++) {
+                    bool valid = true;
+                    int pq = pq_start + i;
+                    if (pq >= PQ2) {
+                        valid = false;
+                    } else {
+                        int p = pq / m_Q2;
+                        int q = pq - p * m_Q2;
+                        if (2 * p + u >= int(m_P) || 2 * q + v >= int(m_Q)) {
+                            valid = false;
+                        }
+                    }
+                    if (valid) {
+                        mask |= flag;
+                    }
+                    flag <<= 1;
+                }
+                vmask[k] = mask;
+                k++;
+            }
+        }
+    }
+}
+
+std::vector<float> Conv2dWinogradBatch::transform_weights(const std::vector<float> &x) {
+    // x: [R, S, K, C] => y: [4, 4, K, C], U = G g G^T
+    int KC = m_K * m_C;
+    std::vector<float> y(16 * KC, 0.0f);
+    for (int kc = 0; kc < KC; kc++) {
+        // t = G g
+        float t[4][3];
+        for (int i = 0; i < 4; i++) {
+            for (int s = 0; s < 3; s++) {
+                float acc = 0.0f;
+                for (int r = 0; r < 3; r++) {
+                    acc += G[i][r] * x[(r * 3 + s) * KC + kc];
+                }
+                t[i][s] = acc;
+            }
+        }
+        // u = t G^T
+        for (int i = 0; i < 4; i++) {
+            for (int j = 0; j < 4; j++) {
+                float acc = 0.0f;
+                for (int s = 0; s < 3; s++) {
+                    acc += t[i][s] * G[j][s];
+                }
+                y[(i * 4 + j) * KC + kc] = acc;
+            }
+        }
+    }
+    return y;
+}
+
+std::string Conv2dWinogradBatch::get_unary_kernel_suffix() {
+    base::PostOp op = m_post_op.op();
+    switch (op) {
+    case base::PostOp::RELU:
+        return "relu";
+    case base::PostOp::CLIP:
+        if (is_unary_relu6()) {
+            return "relu6";
+        }
+        // generic clip is not yet implemented
+        assert(false);
+        return "<?>";
+    default:
+        assert(false);
+        return "<?>";
+    }
+}
+
+uint32_t Conv2dWinogradBatch::encode_unary_param0() {
+    base::PostOp op = m_post_op.op();
+    switch (op) {
+    case base::PostOp::RELU:
+        return 0;
+    case base::PostOp::CLIP:
+        if (is_unary_relu6()) {
+            // param0 hardcoded in kernels
+            return 0;
+        }
+        // generic clip is not yet implemented
+        assert(false);
+        return 0;
+    default:
+        assert(false);
+        return 0;
+    }
+}
+
+bool Conv2dWinogradBatch::is_unary_relu6() {
+    return (m_post_op.alpha() == 0.0f && m_post_op.beta() == 6.0f);
+}
+
+} // namespace tanto
+} // namespace conv
+} // namespace op
+} // namespace ronin
+
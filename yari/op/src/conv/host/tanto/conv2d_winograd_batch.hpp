@@ -0,0 +1,164 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <map>
+
+#include "host/core/api.hpp"
+
+#include "host/base/post_op.hpp"
+
+namespace ronin {
+namespace op {
+namespace conv {
+namespace tanto {
+
+namespace core = ronin::tanto::host;
+namespace base = ronin::op::common::base;
+
+class Conv2dWinogradBatch {
+public:
+    Conv2dWinogradBatch(
+        int N,
+        int H,
+        int W,
+        int C,
+        int P,
+        int Q,
+        int K,
+        int R,
+        int S,
+        int pad_h,
+        int pad_w,
+        int stride_h,
+        int stride_w,
+        int dilation_h,
+        int dilation_w,
+        const base::PostOpSpec &post_op,
+        int batch_size);
+    ~Conv2dWinogradBatch();
+public:
+    static bool is_supported(
+        int C,
+        int K,
+        int R,
+        int S,
+        int pad_h,
+        int pad_w,
+        int stride_h,
+        int stride_w,
+        int dilation_h,
+        int dilation_w,
+        bool fuse_add);
+    void init(
+        const core::Device &device,
+        const core::Global &gx,
+        const core::Global &gw,
+        const core::Global &gb,
+        const core::Global &gz,
+        const core::Global &gy);
+    void run();
+    int input_volume(int index);
+    int output_volume(int index);
+    std::vector<float> transform_input(int index, const std::vector<float> &x);
+    std::vector<float> transform_output(int index, const std::vector<float> &x);
+private:
+    void init_options();
+    void validate_globals();
+    void create_globals();
+    void create_locals();
+    void create_pipes();
+    void create_kernels();
+    void create_bias_reader();
+    void create_writer();
+    void create_bias_math();
+    void create_bias_unary_math();
+    void init_locals();
+    void compute_grid_dims(uint32_t &x, uint32_t &y);
+    void compute_x_mask(std::vector<uint32_t> &vmask);
+    void compute_y_mask(std::vector<uint32_t> &vmask);
+    std::vector<float> transform_weights(const std::vector<float> &x);
+    std::string get_unary_kernel_suffix();
+    uint32_t encode_unary_param0();
+    bool is_unary_relu6();
+private:
+    static const core::DataFormat T = core::DataFormat::BFLOAT16;
+    static const uint32_t
+        OPT_BIAS = 0x1,
+        OPT_UNARY = 0x04;
+private:
+    core::Device m_device;
+    uint32_t m_batch_size = 0;
+    uint32_t m_N = 0;
+    uint32_t m_H = 0;
+    uint32_t m_W = 0;
+    uint32_t m_C = 0;
+    uint32_t m_P = 0;
+    uint32_t m_Q = 0;
+    uint32_t m_K = 0;
+    uint32_t m_R = 0;
+    uint32_t m_S = 0;
+    uint32_t m_pad_h = 0;
+    uint32_t m_pad_w = 0;
+    uint32_t m_stride_h = 0;
+    uint32_t m_stride_w = 0;
+    uint32_t m_dilation_h = 0;
+    uint32_t m_dilation_w = 0;
+    uint32_t m_P2 = 0;
+    uint32_t m_Q2 = 0;
+    core::Program m_program;
+    uint32_t m_x_start = 0;
+    uint32_t m_y_start = 0;
+    uint32_t m_x_end = 0;
+    uint32_t m_y_end = 0;
+    core::Grid m_grid;
+    core::Global m_gx;
+    core::Global m_gw;
+    core::Global m_gb;
+    core::Global m_gz;
+    core::Global m_gy;
+    core::Global m_gzero;
+    core::Global m_gmask;
+    core::Global m_gymask;
+    core::Local m_lzero;
+    core::Local m_lmask;
+    core::Local m_lymask;
+    core::Pipe m_px;
+    core::Pipe m_pw;
+    core::Pipe m_pb;
+    core::Pipe m_py;
+    core::Pipe m_px_im;
+    core::Pipe m_pv_im;
+    core::Pipe m_py_im;
+    core::Pipe m_pt_im;
+    core::Kernel m_reader;
+    core::Kernel m_writer;
+    core::Kernel m_math;
+    uint32_t m_C_arg = 0;
+    uint32_t m_K_arg = 0;
+    uint32_t m_zero_size = 0;
+    uint32_t m_mask_size = 0;
+    uint32_t m_ymask_size = 0;
+    uint32_t m_start_p = 0;
+    uint32_t m_start_q = 0;
+    uint32_t m_end_q = 0;
+    uint32_t m_delta_p = 0;
+    uint32_t m_delta_q = 0;
+    uint32_t m_delta_r = 0;
+    uint32_t m_delta_s = 0;
+    base::PostOpSpec m_post_op;
+    uint32_t m_options = 0;
+    std::string m_metal_kernel_base_path;
+    std::map<std::string, std::string> m_defines;
+};
+
+} // namespace tanto
+} // namespace conv
+} // namespace op
+} // namespace ronin
+
@@ -7,8 +7,10 @@
 #include <cstdlib>
 #include <cstring>
 #include <cassert>
+#include <cmath>
 #include <vector>
 #include <array>
+#include <algorithm>
 #include <unordered_map>
 #include <exception>
 
@@ -20,8 +22,10 @@
 #include "host/tanto/conv2d_basic_split.hpp"
 #include "host/tanto/conv2d_basic_spatial.hpp"
 #include "host/tanto/conv2d_image_batch.hpp"
+#include "host/tanto/conv2d_winograd_batch.hpp"
 
 #include "host/ref/conv2d_ref.hpp"
+#include "host/ref/conv2d_winograd_ref.hpp"
 
 #include "host/util/transform.hpp"
 
@@ -40,9 +44,15 @@ namespace base = ronin::op::common::base;
 
 enum class Algo {
     BASIC_BATCH,
+    BASIC_BATCH_BFP8,
+    BASIC_BATCH_BFP4,
     BASIC_SPLIT,
     BASIC_SPATIAL,
-    IMAGE_BATCH
+    BASIC_SPATIAL_HALO,
+    IMAGE_BATCH,
+    WINOGRAD_BATCH,
+    WINOGRAD_REF,
+    BFP_PACK
 };
 
 bool str_to_int(const char *s, int &v) {
@@ -174,6 +184,44 @@ std::vector<float> reorder_rskc_to_krsc(
     return y;
 }
 
+// forces halo input reader of Conv2dBasicSpatial where it fits
+bool prefer_halo_lx = false;
+
+// block float formats are supported by Conv2dBasicBatch only
+core::DataFormat weight_format = core::DataFormat::BFLOAT16;
+
+std::vector<uint8_t> encode_weights(const std::vector<float> &x) {
+    switch (weight_format) {
+    case core::DataFormat::BFP8_B:
+        return float_to_bfp8b(x);
+    case core::DataFormat::BFP4_B:
+        return float_to_bfp4b(x);
+    default:
+        {
+            std::vector<uint16_t> y = float_to_u16b(x);
+            std::vector<uint8_t> result(y.size() * sizeof(uint16_t));
+            memcpy(result.data(), y.data(), result.size());
+            return result;
+        }
+    }
+}
+
+template<typename SOLVER>
+void setup_solver(SOLVER &solver) { }
+
+template<typename SOLVER>
+void report_solver(SOLVER &solver) { }
+
+void setup_solver(tanto::Conv2dBasicSpatial &solver) {
+    solver.set_prefer_halo_lx(prefer_halo_lx);
+}
+
+void report_solver(tanto::Conv2dBasicSpatial &solver) {
+    if (prefer_halo_lx) {
+        printf("Halo reader: %s\n", solver.uses_halo_lx() ? "on" : "off");
+    }
+}
+
 template<typename SOLVER>
 void run_conv(
         const std::vector<float> &x,
@@ -206,8 +254,9 @@ void run_conv(
         dilation_w,
         opt.post_op,
         batch_size);
+    setup_solver(solver);
     std::vector<uint16_t> tx = float_to_u16b(solver.transform_input(0, x));
-    std::vector<uint16_t> tw = float_to_u16b(solver.transform_input(1, w));
+    std::vector<uint8_t> tw = encode_weights(solver.transform_input(1, w));
     std::vector<uint16_t> tb;
     if (opt.bias) {
         tb = float_to_u16b(solver.transform_input(2, b));
@@ -222,7 +271,7 @@ void run_conv(
     core::DataFormat T = core::DataFormat::BFLOAT16;
     uint32_t log2_page_size = 10; // 2 ^ 10 = 1024
     core::Global gx(device, T, solver.input_volume(0), log2_page_size);
-    core::Global gw(device, T, solver.input_volume(1), log2_page_size);
+    core::Global gw(device, weight_format, solver.input_volume(1), log2_page_size);
     core::Global gb;
     if (opt.bias) {
         gb = core::Global(device, T, solver.input_volume(2), log2_page_size);
@@ -239,6 +288,7 @@ void run_conv(
         gb,
         gz,
         gy);
+    report_solver(solver);
     core::Queue queue(device, 0);
     queue.enqueue_write(gx, tx.data(), false);
     queue.enqueue_write(gw, tw.data(), false);
@@ -327,6 +377,58 @@ void run_image_batch(
     run_conv<tanto::Conv2dImageBatch>(x, w2, b, z, y, opt, param, N, batch_size, repeat);
 }
 
+void run_winograd_batch(
+        const std::vector<float> &x,
+        const std::vector<float> &w,
+        const std::vector<float> &b,
+        const std::vector<float> &z,
+        std::vector<float> &y,
+        const ConvOpt &opt,
+        const ConvParam &param,
+        int N,
+        int batch_size,
+        int repeat) {
+    run_conv<tanto::Conv2dWinogradBatch>(x, w, b, z, y, opt, param, N, batch_size, repeat);
+}
+
+void run_winograd_ref(
+        const std::vector<float> &x,
+        const std::vector<float> &w,
+        const std::vector<float> &b,
+        const std::vector<float> &z,
+        std::vector<float> &y,
+        const ConvOpt &opt,
+        const ConvParam &param,
+        int N) {
+    y.resize(N * param.P * param.Q * param.K);
+    int dilation_h = 1;
+    int dilation_w = 1;
+    ref::Conv2dWinogradRef solver(
+        N,
+        param.H,
+        param.W,
+        param.C,
+        param.P,
+        param.Q,
+        param.K,
+        param.R,
+        param.S,
+        param.pad_h,
+        param.pad_w,
+        param.stride_h,
+        param.stride_w,
+        dilation_h,
+        dilation_w,
+        opt.post_op);
+    solver.init(
+        x.data(),
+        w.data(),
+        opt.bias ? b.data() : nullptr,
+        opt.add ? z.data() : nullptr,
+        y.data());
+    solver.run();
+}
+
 void run_ref(
         const std::vector<float> &x,
         const std::vector<float> &w,
@@ -379,17 +481,26 @@ void run_algo(
         int repeat) {
     switch (algo) {
     case Algo::BASIC_BATCH:
+    case Algo::BASIC_BATCH_BFP8:
+    case Algo::BASIC_BATCH_BFP4:
         run_basic_batch(x, w, b, z, y, opt, param, N, batch_size, repeat);
         break;
     case Algo::BASIC_SPLIT:
         run_basic_split(x, w, b, z, y, opt, param, N, batch_size, repeat);
         break;
     case Algo::BASIC_SPATIAL:
+    case Algo::BASIC_SPATIAL_HALO:
         run_basic_spatial(x, w, b, z, y, opt, param, N, batch_size, repeat);
         break;
     case Algo::IMAGE_BATCH:
         run_image_batch(x, w, b, z, y, opt, param, N, batch_size, repeat);
         break;
+    case Algo::WINOGRAD_BATCH:
+        run_winograd_batch(x, w, b, z, y, opt, param, N, batch_size, repeat);
+        break;
+    case Algo::WINOGRAD_REF:
+        run_winograd_ref(x, w, b, z, y, opt, param, N);
+        break;
     default:
         assert(false);
         break;
@@ -397,6 +508,13 @@ void run_algo(
 }
 
 void compare(const std::vector<float> &y, const std::vector<float> &yref) {
+    // block float weights lose precision: expected PCC is lower
+    float min_pcc = 0.9999f;
+    if (weight_format == core::DataFormat::BFP8_B) {
+        min_pcc = 0.999f;
+    } else if (weight_format == core::DataFormat::BFP4_B) {
+        min_pcc = 0.98f;
+    }
     float rtol = 1.0e-1f;
     float atol = 1.0e-3f;
     float rtol_delta = 0.0f;
@@ -417,7 +535,7 @@ void compare(const std::vector<float> &y, const std::vector<float> &yref) {
         atol_delta, rtol_delta, num_outliers, y.size());
 
     float pcc = util::comp_pcc(yref, y);
-    printf("Pcc = %s\n", (pcc >= 0.9999f) ? "OK" : "FAIL"); 
+    printf("Pcc = %s\n", (pcc >= min_pcc) ? "OK" : "FAIL"); 
     printf("PCC: %g\n", pcc);
 }
 
@@ -466,9 +584,15 @@ void run(
 
 std::unordered_map<std::string, Algo> str_algo_map = {
     {"basic_batch", Algo::BASIC_BATCH},
+    {"basic_batch_bfp8", Algo::BASIC_BATCH_BFP8},
+    {"basic_batch_bfp4", Algo::BASIC_BATCH_BFP4},
     {"basic_split", Algo::BASIC_SPLIT},
     {"basic_spatial", Algo::BASIC_SPATIAL},
-    {"image_batch", Algo::IMAGE_BATCH}
+    {"basic_spatial_halo", Algo::BASIC_SPATIAL_HALO},
+    {"image_batch", Algo::IMAGE_BATCH},
+    {"winograd_batch", Algo::WINOGRAD_BATCH},
+    {"winograd_ref", Algo::WINOGRAD_REF},
+    {"bfp_pack", Algo::BFP_PACK}
 };
 
 bool validate_args(Algo algo, int N, int batch_size) {
@@ -477,7 +601,12 @@ bool validate_args(Algo algo, int N, int batch_size) {
     }
     switch (algo) {
     case Algo::BASIC_BATCH:
+    case Algo::BASIC_BATCH_BFP8:
+    case Algo::BASIC_BATCH_BFP4:
     case Algo::IMAGE_BATCH:
+    case Algo::WINOGRAD_BATCH:
+    case Algo::WINOGRAD_REF:
+    case Algo::BFP_PACK:
         if (batch_size > 8 && 
                 batch_size != 16 && 
                 batch_size != 32 && 
@@ -491,6 +620,7 @@ bool validate_args(Algo algo, int N, int batch_size) {
         }
         break;
     case Algo::BASIC_SPATIAL:
+    case Algo::BASIC_SPATIAL_HALO:
         if (batch_size > 8 && batch_size != 16) {
             return false;
         }
@@ -535,9 +665,15 @@ bool parse_args(
     // N
     switch (algo) {
     case Algo::BASIC_BATCH:
+    case Algo::BASIC_BATCH_BFP8:
+    case Algo::BASIC_BATCH_BFP4:
     case Algo::BASIC_SPLIT:
     case Algo::BASIC_SPATIAL:
+    case Algo::BASIC_SPATIAL_HALO:
     case Algo::IMAGE_BATCH:
+    case Algo::WINOGRAD_BATCH:
+    case Algo::WINOGRAD_REF:
+    case Algo::BFP_PACK:
         N = 16;
         break;
     default:
@@ -553,11 +689,17 @@ bool parse_args(
     // batch_size
     switch (algo) {
     case Algo::BASIC_BATCH:
+    case Algo::BASIC_BATCH_BFP8:
+    case Algo::BASIC_BATCH_BFP4:
     case Algo::IMAGE_BATCH:
+    case Algo::WINOGRAD_BATCH:
+    case Algo::WINOGRAD_REF:
+    case Algo::BFP_PACK:
         batch_size = (N > 64) ? 64 : N;
         break;
     case Algo::BASIC_SPLIT:
     case Algo::BASIC_SPATIAL:
+    case Algo::BASIC_SPATIAL_HALO:
         batch_size = (N > 16) ? 16 : N;
         break;
     default:
@@ -581,9 +723,15 @@ void usage() {
     fprintf(stderr, "\n");
     fprintf(stderr, "<op> is one of\n");
     fprintf(stderr, "    basic_batch\n");
+    fprintf(stderr, "    basic_batch_bfp8\n");
+    fprintf(stderr, "    basic_batch_bfp4\n");
     fprintf(stderr, "    basic_split\n");
     fprintf(stderr, "    basic_spatial\n");
+    fprintf(stderr, "    basic_spatial_halo\n");
     fprintf(stderr, "    image_batch\n");
+    fprintf(stderr, "    winograd_batch\n");
+    fprintf(stderr, "    winograd_ref\n");
+    fprintf(stderr, "    bfp_pack\n");
     fprintf(stderr, "\n");
 }
 
@@ -606,6 +754,32 @@ printf("@@@ SKIP C %d K %d R %d S %d\n", param.C, param.K, param.R, param.S);
     }
 }
 
+void run_winograd(Algo algo, int N, int batch_size, int repeat) {
+    for (ConvOpt &opt: basic_opt_config) {
+        for (ConvParam &param: basic_param_config) {
+            int dilation_h = 1;
+            int dilation_w = 1;
+            bool supported =
+                tanto::Conv2dWinogradBatch::is_supported(
+                    param.C,
+                    param.K,
+                    param.R,
+                    param.S,
+                    param.pad_h,
+                    param.pad_w,
+                    param.stride_h,
+                    param.stride_w,
+                    dilation_h,
+                    dilation_w,
+                    opt.add);
+            if (!supported) {
+                continue;
+            }
+            run(algo, opt, param, N, batch_size, repeat);
+        }
+    }
+}
+
 void run_image(Algo algo, int N, int batch_size, int repeat) {
     for (ConvOpt &opt: image_opt_config) {
         for (ConvParam &param: image_param_config) {
@@ -614,6 +788,78 @@ void run_image(Algo algo, int N, int batch_size, int repeat) {
     }
 }
 
+//
+//    Block float pack / unpack round trip
+//
+
+// values with at most mant_bits significant bits below row maximum
+// are represented exactly
+std::vector<float> make_bfp_exact(int tiles, int mant_bits) {
+    std::vector<float> x(tiles * 1024);
+    int max_mant = (1 << mant_bits) - 1;
+    for (int r = 0; r < tiles * 64; r++) {
+        float scale = ldexpf(1.0f, r % 8 - 4 - (mant_bits - 1));
+        float *row = x.data() + r * 16;
+        for (int i = 0; i < 16; i++) {
+            int mant = (i == 0) ? max_mant : (r * 7 + i * 5) % (max_mant + 1);
+            float sign = ((r + i) % 3 == 0) ? -1.0f : 1.0f;
+            row[i] = sign * float(mant) * scale;
+        }
+    }
+    return x;
+}
+
+// rounding error must not exceed one unit of last place
+// at shared exponent of each row
+bool check_bfp_error(const std::vector<float> &x, const std::vector<float> &y, int mant_bits) {
+    if (x.size() != y.size()) {
+        return false;
+    }
+    int rows = int(x.size()) / 16;
+    for (int r = 0; r < rows; r++) {
+        const float *px = x.data() + r * 16;
+        const float *py = y.data() + r * 16;
+        int max_exp = -1000;
+        for (int i = 0; i < 16; i++) {
+            if (px[i] != 0.0f) {
+                int exp;
+                frexpf(px[i], &exp);
+                max_exp = std::max(max_exp, exp);
+            }
+        }
+        float ulp = ldexpf(1.0f, max_exp - mant_bits);
+        for (int i = 0; i < 16; i++) {
+            if (std::fabs(py[i] - px[i]) > ulp) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+void report(const char *check, bool ok) {
+    printf("%s = %s\n", check, ok ? "OK" : "FAIL");
+}
+
+void run_bfp_pack() {
+    int tiles = 16;
+    uint32_t items = uint32_t(tiles * 1024);
+    util::manual_seed(1234);
+    std::vector<float> x = util::normal(0.0f, 0.1f, tiles * 1024);
+    printf("---- BFP8_B\n");
+    std::vector<uint8_t> tx = float_to_bfp8b(x);
+    report("Size", (tx.size() == core::get_data_bytes(core::DataFormat::BFP8_B, items)));
+    report("Error", check_bfp_error(x, bfp8b_to_float(tx), 7));
+    std::vector<float> e = make_bfp_exact(tiles, 7);
+    report("Exact", (bfp8b_to_float(float_to_bfp8b(e)) == e));
+    printf("---- BFP4_B\n");
+    tx = float_to_bfp4b(x);
+    report("Size", (tx.size() == core::get_data_bytes(core::DataFormat::BFP4_B, items)));
+    report("Error", check_bfp_error(x, bfp4b_to_float(tx), 3));
+    e = make_bfp_exact(tiles, 3);
+    report("Exact", (bfp4b_to_float(float_to_bfp4b(e)) == e));
+}
+
 int main(int argc, char **argv) {
     Algo algo = Algo(0);
     int N = 0;
@@ -634,9 +880,28 @@ int main(int argc, char **argv) {
         case Algo::BASIC_SPATIAL:
             run_basic(algo, N, batch_size, repeat);
             break;
+        case Algo::BASIC_BATCH_BFP8:
+            weight_format = core::DataFormat::BFP8_B;
+            run_basic(algo, N, batch_size, repeat);
+            break;
+        case Algo::BASIC_BATCH_BFP4:
+            weight_format = core::DataFormat::BFP4_B;
+            run_basic(algo, N, batch_size, repeat);
+            break;
+        case Algo::BASIC_SPATIAL_HALO:
+            prefer_halo_lx = true;
+            run_basic(algo, N, batch_size, repeat);
+            break;
         case Algo::IMAGE_BATCH:
             run_image(algo, N, batch_size, repeat);
             break;
+        case Algo::WINOGRAD_BATCH:
+        case Algo::WINOGRAD_REF:
+            run_winograd(algo, N, batch_size, repeat);
+            break;
+        case Algo::BFP_PACK:
+            run_bfp_pack();
+            break;
         default:
             assert(false);
             break;
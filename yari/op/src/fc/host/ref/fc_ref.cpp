@@ -4,6 +4,9 @@
 
 #include <cassert>
 
+#include "host/base/ref_backend.hpp"
+#include "host/base/ref_gemm.hpp"
+
 #include "host/ref/fc_ref.hpp"
 
 namespace ronin {
@@ -11,6 +14,8 @@ namespace op {
 namespace fc {
 namespace ref {
 
+namespace base = ronin::op::common::base;
+
 //
 //    FCRef
 //
@@ -39,6 +44,14 @@ void FCRef::init(
 }
 
 void FCRef::run() {
+    if (base::is_ref_backend_fast()) {
+        run_fast();
+    } else {
+        run_naive();
+    }
+}
+
+void FCRef::run_naive() {
     // Y = X * Wt + B
     int NH = m_N * m_H;
     for (int nh = 0; nh < NH; nh++) {
@@ -55,6 +68,19 @@ void FCRef::run() {
     }
 }
 
+void FCRef::run_fast() {
+    // Y = X * Wt + B
+    int NH = m_N * m_H;
+    base::ref_sgemm_nt(NH, m_K, m_C, m_x, m_C, m_w, m_C, m_y, m_K);
+    if (m_b != nullptr) {
+        for (int nh = 0; nh < NH; nh++) {
+            for (int k = 0; k < m_K; k++) {
+                m_y[nh * m_K + k] += m_b[k];
+            }
+        }
+    }
+}
+
 int FCRef::input_volume(int index) {
     switch (index) {
     case 0:
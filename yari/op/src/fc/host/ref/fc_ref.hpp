@@ -26,6 +26,9 @@ public:
     void run();
     int input_volume(int index);
     int output_volume(int index);
+private:
+    void run_naive();
+    void run_fast();
 private:
     const float *m_x = nullptr;
     const float *m_w = nullptr;
@@ -5,6 +5,8 @@
 #include <cassert>
 
 #include "host/base/post_op.hpp"
+#include "host/base/ref_backend.hpp"
+#include "host/base/ref_gemm.hpp"
 
 #include "host/ref/group_conv2d_ref.hpp"
 
@@ -72,7 +74,16 @@ void GroupConv2dRef::init(
     m_y = y;
 }
 
-void GroupConv2dRef::run() { 
+void GroupConv2dRef::run() {
+    // fast version requires output distinct from residual input
+    if (base::is_ref_backend_fast() && m_z != m_y) {
+        run_fast();
+    } else {
+        run_naive();
+    }
+}
+
+void GroupConv2dRef::run_naive() { 
     int WC = m_W * m_C;
     int HWC = m_H * WC;
     int QK = m_Q * m_K;
@@ -124,6 +135,28 @@ void GroupConv2dRef::run() {
     } // n
 }
 
+void GroupConv2dRef::run_fast() {
+    base::RefConv2dShape shape = {
+        m_N,
+        m_H,
+        m_W,
+        m_C,
+        m_P,
+        m_Q,
+        m_K,
+        m_R,
+        m_S,
+        m_pad_h,
+        m_pad_w,
+        m_stride_h,
+        m_stride_w,
+        m_dilation_h,
+        m_dilation_w,
+        m_groups
+    };
+    base::ref_conv2d(shape, m_x, m_w, m_b, m_z, m_y, m_post_op);
+}
+
 int GroupConv2dRef::input_volume(int index) {
     switch (index) {
     case 0:
@@ -0,0 +1,26 @@
+#!/bin/bash
+
+# SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+#
+# SPDX-License-Identifier: Apache-2.0
+
+# NOTE: kernels in ./metal are currently written by hand following the
+# frontend output format; after regenerating them with this script,
+# run yari/op/jitte/prj/norm/run_test_tanto.sh to check results
+# against the reference implementation.
+
+FRONT=../../../../../tanto/bin/front/tanto
+
+TANTO=./tanto
+METAL=./metal
+
+mkdir -p $METAL
+
+$FRONT --mode=read -DT=bfloat16 $TANTO/norm_batch_layer_reader.cpp >$METAL/norm_batch_layer_reader.cpp
+$FRONT --mode=read -DT=bfloat16 $TANTO/norm_batch_rms_reader.cpp >$METAL/norm_batch_rms_reader.cpp
+
+$FRONT --mode=write -DT=bfloat16 $TANTO/norm_batch_writer.cpp >$METAL/norm_batch_writer.cpp
+
+$FRONT --mode=compute -DT=bfloat16 $TANTO/norm_batch_layer_math.cpp >$METAL/norm_batch_layer_math.cpp
+$FRONT --mode=compute -DT=bfloat16 $TANTO/norm_batch_rms_math.cpp >$METAL/norm_batch_rms_math.cpp
+
@@ -0,0 +1,129 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cassert>
+#include <cmath>
+
+#include "host/ref/norm_ref.hpp"
+
+namespace ronin {
+namespace op {
+namespace norm {
+namespace ref {
+
+//
+//    LayerNormRef
+//
+
+LayerNormRef::LayerNormRef(
+        int N,
+        int H,
+        int W,
+        float eps):
+            m_N(N),
+            m_H(H),
+            m_W(W),
+            m_eps(eps) { }
+
+LayerNormRef::~LayerNormRef() { }
+
+void LayerNormRef::init(
+        const float *x, 
+        const float *gamma, 
+        const float *beta, 
+        float *y) {
+    m_x = x;
+    m_gamma = gamma;
+    m_beta = beta;
+    m_y = y;
+}
+
+void LayerNormRef::run() {
+    int NH = m_N * m_H;
+    for (int nh = 0; nh < NH; nh++) {
+        const float *px = m_x + nh * m_W;
+        float *py = m_y + nh * m_W;
+        float sum = 0.0f;
+        for (int w = 0; w < m_W; w++) {
+            sum += px[w];
+        }
+        float mean = sum / float(m_W);
+        float sum2 = 0.0f;
+        for (int w = 0; w < m_W; w++) {
+            float d = px[w] - mean;
+            sum2 += d * d;
+        }
+        float inv = 1.0f / std::sqrt(sum2 / float(m_W) + m_eps);
+        for (int w = 0; w < m_W; w++) {
+            py[w] = (px[w] - mean) * inv * m_gamma[w] + m_beta[w];
+        }
+    }
+}
+
+int LayerNormRef::input_volume(int index) {
+    assert(index >= 0 && index <= 2);
+    return (index == 0) ? m_N * m_H * m_W : m_W;
+}
+
+int LayerNormRef::output_volume(int index) {
+    assert(index == 0);
+    return m_N * m_H * m_W;
+}
+
+//
+//    RMSNormRef
+//
+
+RMSNormRef::RMSNormRef(
+        int N,
+        int H,
+        int W,
+        float eps):
+            m_N(N),
+            m_H(H),
+            m_W(W),
+            m_eps(eps) { }
+
+RMSNormRef::~RMSNormRef() { }
+
+void RMSNormRef::init(
+        const float *x, 
+        const float *gamma, 
+        float *y) {
+    m_x = x;
+    m_gamma = gamma;
+    m_y = y;
+}
+
+void RMSNormRef::run() {
+    int NH = m_N * m_H;
+    for (int nh = 0; nh < NH; nh++) {
+        const float *px = m_x + nh * m_W;
+        float *py = m_y + nh * m_W;
+        float sum2 = 0.0f;
+        for (int w = 0; w < m_W; w++) {
+            sum2 += px[w] * px[w];
+        }
+        float inv = 1.0f / std::sqrt(sum2 / float(m_W) + m_eps);
+        for (int w = 0; w < m_W; w++) {
+            py[w] = px[w] * inv * m_gamma[w];
+        }
+    }
+}
+
+int RMSNormRef::input_volume(int index) {
+    assert(index == 0 || index == 1);
+    return (index == 0) ? m_N * m_H * m_W : m_W;
+}
+
+int RMSNormRef::output_volume(int index) {
+    assert(index == 0);
+    return m_N * m_H * m_W;
+}
+
+} // namespace ref
+} // namespace norm
+} // namespace op
+} // namespace ronin
+
@@ -0,0 +1,70 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+namespace ronin {
+namespace op {
+namespace norm {
+namespace ref {
+
+class LayerNormRef {
+public:
+    LayerNormRef(
+        int N,
+        int H,
+        int W,
+        float eps);
+    ~LayerNormRef();
+public:
+    void init(
+        const float *x, 
+        const float *gamma, 
+        const float *beta, 
+        float *y);
+    void run();
+    int input_volume(int index);
+    int output_volume(int index);
+private:
+    const float *m_x = nullptr;
+    const float *m_gamma = nullptr;
+    const float *m_beta = nullptr;
+    float *m_y = nullptr;
+    int m_N = 0;
+    int m_H = 0;
+    int m_W = 0;
+    float m_eps = 0.0f;
+};
+
+class RMSNormRef {
+public:
+    RMSNormRef(
+        int N,
+        int H,
+        int W,
+        float eps);
+    ~RMSNormRef();
+public:
+    void init(
+        const float *x, 
+        const float *gamma, 
+        float *y);
+    void run();
+    int input_volume(int index);
+    int output_volume(int index);
+private:
+    const float *m_x = nullptr;
+    const float *m_gamma = nullptr;
+    float *m_y = nullptr;
+    int m_N = 0;
+    int m_H = 0;
+    int m_W = 0;
+    float m_eps = 0.0f;
+};
+
+} // namespace ref
+} // namespace norm
+} // namespace op
+} // namespace ronin
+
@@ -0,0 +1,529 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdint>
+#include <cassert>
+#include <string>
+#include <vector>
+
+#include "host/core/api.hpp"
+
+#include "host/util/transform.hpp"
+
+#include "host/tanto/util.hpp"
+#include "host/tanto/norm_batch.hpp"
+
+namespace ronin {
+namespace op {
+namespace norm {
+namespace tanto {
+
+namespace core = ronin::tanto::host;
+namespace util = ronin::op::common::util;
+
+namespace {
+
+uint32_t float_as_u32(float x) {
+    union U32 {
+        float f;
+        uint32_t i;
+    } u32;
+    u32.f = x;
+    return u32.i;
+}
+
+uint16_t float_to_u16b(float x) {
+    return uint16_t(float_as_u32(x) >> 16);
+}
+
+} // namespace
+
+//
+//    NormBatch
+//
+
+NormBatch::NormBatch(
+        NormBatchOp op,
+        int N,
+        int H,
+        int W,
+        float eps,
+        int batch_size):
+            m_op(op),
+            m_N(N),
+            m_H(H),
+            m_W(W),
+            m_eps(eps),
+            m_batch_size(batch_size) { }
+
+NormBatch::~NormBatch() { }
+
+void NormBatch::init(
+        const core::Device &device,
+        const core::Global &gx,
+        const core::Global &gg,
+        const core::Global &gb,
+        const core::Global &gy) {
+    m_device = device;
+    m_gx = gx;
+    m_gg = gg;
+    m_gb = gb;
+    m_gy = gy;
+
+    assert(m_batch_size < 8 || m_batch_size % 8 == 0);
+    // ACHTUNG: Temporary limit 64 is Wormhole-specific
+    assert(m_batch_size <= 64);
+    assert(m_N % m_batch_size == 0);
+
+    assert(m_W % 32 == 0);
+
+    m_program = core::Program(m_device);
+
+    uint32_t grid_x, grid_y;
+    compute_grid_dims(grid_x, grid_y);
+
+    m_x_start = 0;
+    m_y_start = 0;
+    m_x_end = grid_x - 1;
+    m_y_end = grid_y - 1;
+
+    m_grid = core::Grid(m_program, m_x_start, m_y_start, m_x_end, m_y_end);
+
+    m_zero_size = m_W;
+
+    // all row pipes hold one block of 32 rows (W / 32 tiles)
+    m_row_frame_size = m_W / 32;
+
+    m_kernel_base_path = "op/norm/device/metal";
+    m_defines = {{"T", "bfloat16"}};
+
+    validate_globals();
+
+    create_globals();
+    create_locals();
+    create_pipes();
+    create_kernels();
+
+    init_locals();
+}
+
+void NormBatch::run() {
+    core::Queue queue(m_device, 0);
+    queue.enqueue_program(m_program, false);
+}
+
+int NormBatch::input_volume(int index) {
+    switch (index) {
+    case 0:
+        return m_N * u32_align(m_H, 32) * m_W;
+    case 1:
+        return 32 * m_W;
+    case 2:
+        assert(m_op == NormBatchOp::LAYER);
+        return 32 * m_W;
+    default:
+        assert(false);
+        return 0;
+    }
+}
+
+int NormBatch::output_volume(int index) {
+    assert(index == 0);
+    return m_N * u32_align(m_H, 32) * m_W;
+}
+
+std::vector<float> NormBatch::transform_input(int index, const std::vector<float> &x) {
+    std::vector<float> y;
+    switch (index) {
+    case 0:
+        y = util::pad(x, m_N, m_H, m_W, m_N, u32_align(m_H, 32), m_W);
+        break;
+    case 1:
+    case 2:
+        // row 0 of each tile is used for broadcast
+        assert(index == 1 || m_op == NormBatchOp::LAYER);
+        y = util::pad(x, 1, m_W, 32, m_W);
+        y = util::tilize(y, 32, m_W);
+        y = util::make_faces(y);
+        break;
+    default:
+        assert(false);
+        break;
+    }
+    return y;
+}
+
+std::vector<float> NormBatch::transform_output(int index, const std::vector<float> &x) {
+    assert(index == 0);
+    return util::unpad(x, m_N, u32_align(m_H, 32), m_W, m_N, m_H, m_W);
+}
+
+void NormBatch::validate_globals() {
+    uint32_t item_bytes = get_item_bytes(T);
+    assert(!m_gx.is_null());
+    assert(!m_gg.is_null());
+    assert(!m_gy.is_null());
+    assert(m_gx.bytes() >= input_volume(0) * item_bytes);
+    assert(m_gg.bytes() >= input_volume(1) * item_bytes);
+    if (m_op == NormBatchOp::LAYER) {
+        assert(!m_gb.is_null());
+        assert(m_gb.bytes() >= input_volume(2) * item_bytes);
+    }
+    assert(m_gy.bytes() >= output_volume(0) * item_bytes);
+}
+
+void NormBatch::create_globals() {
+    uint32_t log2_page_size = 10; // 2 ^ 10 = 1024
+    m_gs = core::Global(m_device, T, 1024, log2_page_size);
+    m_gzero = core::Global(m_device, T, m_zero_size, log2_page_size);
+}
+
+void NormBatch::create_locals() {
+    m_lzero = core::Local(m_program, m_grid, T, m_zero_size);
+}
+
+void NormBatch::create_pipes() {
+    m_px =
+        core::Pipe(
+            m_program,
+            m_grid,
+            core::PipeKind::INPUT,
+            T,
+            m_row_frame_size * 2,
+            m_row_frame_size);
+    // no double buffering for scale, gamma and beta
+    m_ps =
+        core::Pipe(
+            m_program,
+            m_grid,
+            core::PipeKind::INPUT,
+            T,
+            1,
+            1);
+    m_pg =
+        core::Pipe(
+            m_program,
+            m_grid,
+            core::PipeKind::INPUT,
+            T,
+            m_row_frame_size,
+            m_row_frame_size);
+    if (m_op == NormBatchOp::LAYER) {
+        m_pb =
+            core::Pipe(
+                m_program,
+                m_grid,
+                core::PipeKind::INPUT,
+                T,
+                m_row_frame_size,
+                m_row_frame_size);
+    }
+    m_py =
+        core::Pipe(
+            m_program,
+            m_grid,
+            core::PipeKind::OUTPUT,
+            T,
+            m_row_frame_size * 2,
+            m_row_frame_size);
+    m_px_im =
+        core::Pipe(
+            m_program,
+            m_grid,
+            core::PipeKind::INTERMED,
+            T,
+            m_row_frame_size,
+            m_row_frame_size);
+    if (m_op == NormBatchOp::LAYER) {
+        m_pxc =
+            core::Pipe(
+                m_program,
+                m_grid,
+                core::PipeKind::INTERMED,
+                T,
+                m_row_frame_size,
+                m_row_frame_size);
+    }
+    m_psq =
+        core::Pipe(
+            m_program,
+            m_grid,
+            core::PipeKind::INTERMED,
+            T,
+            m_row_frame_size,
+            m_row_frame_size);
+    m_pstat =
+        core::Pipe(
+            m_program,
+            m_grid,
+            core::PipeKind::INTERMED,
+            T,
+            1,
+            1);
+    m_py_im =
+        core::Pipe(
+            m_program,
+            m_grid,
+            core::PipeKind::INTERMED,
+            T,
+            m_row_frame_size,
+            m_row_frame_size);
+}
+
+void NormBatch::create_kernels() {
+    create_reader();
+    create_writer();
+    create_math();
+}
+
+void NormBatch::create_reader() {
+    std::string path = m_kernel_base_path + "/" + make_kernel_name("reader") + ".cpp";
+    m_reader = 
+        core::Kernel(
+            m_program, 
+            m_grid, 
+            core::KernelKind::READER, 
+            core::KernelFormat::METAL,
+            path, 
+            {}, 
+            m_defines);
+/*
+void kernel(
+        global<T> gx,
+        global<T> gs,
+        global<T> gg,
+        global<T> gb,      // LayerNorm only
+        global<T> gzero,
+        local<T> lzero,
+        pipe<T> px,
+        pipe<T> ps,
+        pipe<T> pg,
+        pipe<T> pb,        // LayerNorm only
+        uint32 N,
+        uint32 H,
+        uint32 W,
+        uint32 zero_size,
+        uint32 x_pos,
+        uint32 x_stride)
+*/
+    uint32_t H_rnd = u32_align(m_H, 32);
+    uint32_t x_stride = (m_batch_size - 1) * H_rnd * m_W;
+    std::vector<core::KernelArg> args;
+    if (m_op == NormBatchOp::LAYER) {
+        args = {
+            m_gx,
+            m_gs,
+            m_gg,
+            m_gb,
+            m_gzero,
+            m_lzero,
+            m_px,
+            m_ps,
+            m_pg,
+            m_pb
+        };
+    } else {
+        args = {
+            m_gx,
+            m_gs,
+            m_gg,
+            m_gzero,
+            m_lzero,
+            m_px,
+            m_ps,
+            m_pg
+        };
+    }
+    uint32_t x_pos_index = uint32_t(args.size()) + 4;
+    args.push_back(m_N / m_batch_size);
+    args.push_back(m_H);
+    args.push_back(m_W);
+    args.push_back(m_zero_size);
+    args.push_back(uint32_t(0)); // x_pos
+    args.push_back(x_stride);
+    uint32_t x_inc = H_rnd * m_W;
+    uint32_t x_pos = 0;
+    for (uint32_t x = m_x_start; x <= m_x_end; x++) {
+        for (uint32_t y = m_y_start; y <= m_y_end; y++) {
+            args[x_pos_index] = x_pos;
+            m_reader.set_args(x, y, args);
+            x_pos += x_inc;
+        }
+    }
+}
+
+void NormBatch::create_writer() {
+    std::string path = m_kernel_base_path + "/norm_batch_writer.cpp";
+    m_writer = 
+        core::Kernel(
+            m_program, 
+            m_grid, 
+            core::KernelKind::WRITER, 
+            core::KernelFormat::METAL,
+            path, 
+            {}, 
+            m_defines);
+/*
+void kernel(
+        global<T> gy,
+        pipe<T> py,
+        uint32 N,
+        uint32 H,
+        uint32 W,
+        uint32 y_pos,
+        uint32 y_stride)
+*/
+    uint32_t H_rnd = u32_align(m_H, 32);
+    uint32_t y_stride = (m_batch_size - 1) * H_rnd * m_W;
+    std::vector<core::KernelArg> args{
+        m_gy,
+        m_py,
+        m_N / m_batch_size,
+        H_rnd,
+        m_W,
+        uint32_t(0), // [5] y_pos
+        y_stride
+    };
+    uint32_t y_inc = H_rnd * m_W;
+    uint32_t y_pos = 0;
+    for (uint32_t x = m_x_start; x <= m_x_end; x++) {
+        for (uint32_t y = m_y_start; y <= m_y_end; y++) {
+            args[5] = y_pos;
+            m_writer.set_args(x, y, args);
+            y_pos += y_inc;
+        }
+    }
+}
+
+void NormBatch::create_math() {
+    std::string path = m_kernel_base_path + "/" + make_kernel_name("math") + ".cpp";
+    m_math = 
+        core::Kernel(
+            m_program, 
+            m_grid, 
+            core::KernelKind::MATH, 
+            core::KernelFormat::METAL,
+            path, 
+            {}, 
+            m_defines);
+/*
+void kernel(
+        pipe<T> px,
+        pipe<T> ps,
+        pipe<T> pg,
+        pipe<T> pb,        // LayerNorm only
+        pipe<T> py,
+        pipe<T> px_im,
+        pipe<T> pxc,       // LayerNorm only
+        pipe<T> psq,
+        pipe<T> pstat,
+        pipe<T> py_im,
+        uint32 N,
+        uint32 H,
+        uint32 W,
+        uint32 eps)
+*/
+    uint32_t H_rnd = u32_align(m_H, 32);
+    std::vector<core::KernelArg> args;
+    if (m_op == NormBatchOp::LAYER) {
+        args = {
+            m_px,
+            m_ps,
+            m_pg,
+            m_pb,
+            m_py,
+            m_px_im,
+            m_pxc,
+            m_psq,
+            m_pstat,
+            m_py_im
+        };
+    } else {
+        args = {
+            m_px,
+            m_ps,
+            m_pg,
+            m_py,
+            m_px_im,
+            m_psq,
+            m_pstat,
+            m_py_im
+        };
+    }
+    args.push_back(m_N / m_batch_size);
+    args.push_back(H_rnd);
+    args.push_back(m_W);
+    args.push_back(float_as_u32(m_eps));
+    m_math.set_args(m_grid, args);
+}
+
+void NormBatch::init_locals() {
+    std::vector<uint16_t> vscale(1024, float_to_u16b(1.0f / float(m_W)));
+    std::vector<uint32_t> vzero(m_gzero.bytes() / sizeof(uint32_t), 0);
+    core::Queue queue(m_device, 0);
+    queue.enqueue_write(m_gs, vscale.data(), true);
+    queue.enqueue_write(m_gzero, vzero.data(), true);
+}
+
+void NormBatch::compute_grid_dims(uint32_t &x, uint32_t &y) {
+    // ACHTUNG: Temporary limit 8 is Wormhole-specific
+    if (m_batch_size <= 8) {
+        x = m_batch_size;
+        y = 1;
+    } else {
+        x = 8;
+        y = m_batch_size / 8;
+    }
+}
+
+std::string NormBatch::make_kernel_name(const std::string &role) {
+    std::string str_op = (m_op == NormBatchOp::LAYER) ? "layer" : "rms";
+    return "norm_batch_" + str_op + "_" + role;
+}
+
+//
+//    LayerNormBatch
+//
+
+LayerNormBatch::LayerNormBatch(
+        int N,
+        int H,
+        int W,
+        float eps,
+        int batch_size):
+            NormBatch(
+                NormBatchOp::LAYER,
+                N,
+                H,
+                W,
+                eps,
+                batch_size) { }
+
+LayerNormBatch::~LayerNormBatch() { }
+
+//
+//    RMSNormBatch
+//
+
+RMSNormBatch::RMSNormBatch(
+        int N,
+        int H,
+        int W,
+        float eps,
+        int batch_size):
+            NormBatch(
+                NormBatchOp::RMS,
+                N,
+                H,
+                W,
+                eps,
+                batch_size) { }
+
+RMSNormBatch::~RMSNormBatch() { }
+
+} // namespace tanto
+} // namespace norm
+} // namespace op
+} // namespace ronin
+
@@ -0,0 +1,393 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <cassert>
+#include <vector>
+#include <array>
+#include <unordered_map>
+#include <exception>
+
+#include "host/core/api.hpp"
+
+#include "host/tanto/norm_batch.hpp"
+
+#include "host/ref/norm_ref.hpp"
+
+#include "host/util/transform.hpp"
+
+#include "test/util/gen.hpp"
+#include "test/util/comp.hpp"
+#include "test/util/timer.hpp"
+
+using namespace ronin::op::norm;
+using namespace ronin::op::common::util;
+using namespace ronin::op::common::test;
+
+namespace core = ronin::tanto::host;
+
+enum class Algo {
+    NORM_BATCH
+};
+
+bool str_to_int(const char *s, int &v) {
+    char *p;
+    long t = strtol(s, &p, 10);
+    if (*p != '\0') {
+        return false;
+    }
+    int r = int(t);
+    if (long(r) != t) {
+        return false;
+    }
+    if (r <= 0) {
+        return false;
+    }
+    v = r;
+    return true;
+}
+
+enum class NormOp {
+    LAYER,
+    RMS
+};
+
+const char *norm_op_str(NormOp op) {
+    switch (op) {
+    case NormOp::LAYER:
+        return "layer";
+    case NormOp::RMS:
+        return "rms";
+    default:
+        assert(false);
+        return "?";
+    }
+}
+
+struct NormParam {
+    int H;
+    int W;
+};
+
+std::vector<NormOp> op_config = {
+    NormOp::LAYER,
+    NormOp::RMS
+};
+
+std::vector<NormParam> param_config = {
+    // H, W
+    {7 * 7, 1024},
+    {197, 768}
+};
+
+float eps_config = 1.0e-5f;
+
+template<typename SOLVER>
+void run_norm(
+        const std::vector<float> &x,
+        const std::vector<float> &g,
+        const std::vector<float> &b,
+        std::vector<float> &y,
+        const NormParam &param,
+        int N,
+        int batch_size,
+        int repeat) {
+    SOLVER solver(N, param.H, param.W, eps_config, batch_size);
+    bool has_beta = !b.empty();
+    std::vector<uint16_t> tx = float_to_u16b(solver.transform_input(0, x));
+    std::vector<uint16_t> tg = float_to_u16b(solver.transform_input(1, g));
+    std::vector<uint16_t> tb;
+    if (has_beta) {
+        tb = float_to_u16b(solver.transform_input(2, b));
+    }
+    std::vector<uint16_t> ty(solver.output_volume(0));
+    core::Platform platform = core::Platform::get_default();
+    core::Device device(platform, 0);
+    core::DataFormat T = core::DataFormat::BFLOAT16;
+    uint32_t log2_page_size = 10; // 2 ^ 10 = 1024
+    core::Global gx(device, T, solver.input_volume(0), log2_page_size);
+    core::Global gg(device, T, solver.input_volume(1), log2_page_size);
+    core::Global gb;
+    if (has_beta) {
+        gb = core::Global(device, T, solver.input_volume(2), log2_page_size);
+    }
+    core::Global gy(device, T, solver.output_volume(0), log2_page_size);
+    solver.init(device, gx, gg, gb, gy);
+    core::Queue queue(device, 0);
+    queue.enqueue_write(gx, tx.data(), false);
+    queue.enqueue_write(gg, tg.data(), false);
+    if (has_beta) {
+        queue.enqueue_write(gb, tb.data(), false);
+    }
+    if (repeat <= 0) {
+        solver.run();
+    } else {
+        // warm up
+        solver.run();
+        queue.finish();
+        util::Timer timer;
+        timer.start();
+        for (int i = 0; i < repeat; i++) {
+            solver.run();
+            queue.finish();
+        }
+        timer.stop();
+        float t = timer.elapsed();
+        printf("Elapsed time %g ms / %d iterations = %g\n", t, repeat, t / float(repeat));
+    }
+    queue.enqueue_read(gy, ty.data(), false);
+    queue.finish();
+    device.close();
+    y = solver.transform_output(0, u16b_to_float(ty));
+}
+
+void run_norm_batch(
+        const std::vector<float> &x,
+        const std::vector<float> &g,
+        const std::vector<float> &b,
+        std::vector<float> &y,
+        NormOp op,
+        const NormParam &param,
+        int N,
+        int batch_size,
+        int repeat) {
+    if (op == NormOp::LAYER) {
+        run_norm<tanto::LayerNormBatch>(x, g, b, y, param, N, batch_size, repeat);
+    } else if (op == NormOp::RMS) {
+        run_norm<tanto::RMSNormBatch>(x, g, {}, y, param, N, batch_size, repeat);
+    } else {
+        assert(false);
+    }
+}
+
+void run_ref(
+        const std::vector<float> &x,
+        const std::vector<float> &g,
+        const std::vector<float> &b,
+        std::vector<float> &y,
+        NormOp op,
+        const NormParam &param,
+        int N) {
+    y.resize(N * param.H * param.W);
+    if (op == NormOp::LAYER) {
+        ref::LayerNormRef solver(N, param.H, param.W, eps_config);
+        solver.init(x.data(), g.data(), b.data(), y.data());
+        solver.run();
+    } else if (op == NormOp::RMS) {
+        ref::RMSNormRef solver(N, param.H, param.W, eps_config);
+        solver.init(x.data(), g.data(), y.data());
+        solver.run();
+    } else {
+        assert(false);
+    }
+}
+
+void run_algo(
+        Algo algo,
+        const std::vector<float> &x,
+        const std::vector<float> &g,
+        const std::vector<float> &b,
+        std::vector<float> &y,
+        NormOp op,
+        const NormParam &param,
+        int N,
+        int batch_size,
+        int repeat) {
+    switch (algo) {
+    case Algo::NORM_BATCH:
+        run_norm_batch(x, g, b, y, op, param, N, batch_size, repeat);
+        break;
+    default:
+        assert(false);
+        break;
+    }
+}
+
+bool compare(const std::vector<float> &y, const std::vector<float> &yref) {
+    float rtol = 1.0e-1f;
+    float atol = 1.0e-3f;
+    float rtol_delta = 0.0f;
+    float atol_delta = 0.0f;
+    int num_outliers = 0;
+
+    bool allclose = 
+        util::comp_allclose(
+            yref, 
+            y, 
+            rtol, 
+            atol, 
+            rtol_delta, 
+            atol_delta, 
+            num_outliers);
+    printf("All close = %s\n", allclose ? "OK" : "FAIL");
+    printf("Max ATOL delta: %g, max RTOL delta: %g, outliers: %d / %zd\n", 
+        atol_delta, rtol_delta, num_outliers, y.size());
+
+    float pcc = util::comp_pcc(yref, y);
+    bool pcc_ok = (pcc >= 0.9999f);
+    printf("Pcc = %s\n", pcc_ok ? "OK" : "FAIL"); 
+    printf("PCC: %g\n", pcc);
+
+    // exit status reflects PCC only (tolerances are too rigid for bfloat16)
+    return pcc_ok;
+}
+
+bool run(
+        Algo algo, 
+        NormOp op,
+        const NormParam &param, 
+        int N, 
+        int batch_size,
+        int repeat) {
+    printf(
+        "---- Batch [%d / %d] op [%s] HW [%d %d]\n",
+            N, batch_size, norm_op_str(op), param.H, param.W);
+
+    int xsize = N * param.H * param.W;
+
+    util::manual_seed(1234);
+    std::vector<float> x = util::normal(0.0f, 1.0f, xsize);
+    std::vector<float> g = util::normal(1.0f, 0.1f, param.W);
+    std::vector<float> b;
+    if (op == NormOp::LAYER) {
+        b = util::normal(0.0f, 0.1f, param.W);
+    }
+
+    std::vector<float> y;
+    std::vector<float> yref;
+
+    run_algo(algo, x, g, b, y, op, param, N, batch_size, repeat);
+    run_ref(x, g, b, yref, op, param, N);
+
+    return compare(y, yref);
+}
+
+std::unordered_map<std::string, Algo> str_algo_map = {
+    {"norm_batch", Algo::NORM_BATCH}
+};
+
+bool validate_args(Algo algo, int N, int batch_size) {
+    if (N % batch_size != 0) {
+        return false;
+    }
+    switch (algo) {
+    case Algo::NORM_BATCH:
+        if (batch_size != 8 && 
+                batch_size != 16 && 
+                batch_size != 32 && 
+                batch_size != 64) {
+            return false;
+        }
+        break;
+    default:
+        assert(false);
+        return false;
+    }
+    return true;
+}
+
+bool parse_args(
+        int argc, 
+        char **argv, 
+        Algo &algo, 
+        int &N, 
+        int &batch_size,
+        int &repeat) {
+    int argp = 1;
+    // repeat
+    repeat = 0;
+    if (argp < argc && !strcmp(argv[argp], "-r")) {
+        argp++;
+        if (argp >= argc) {
+            return false;
+        }
+        if (!str_to_int(argv[argp], repeat)) {
+            return false;
+        }
+        argp++;
+    }
+    // algo
+    if (argp >= argc) {
+        return false;
+    }
+    auto it = str_algo_map.find(argv[argp]);
+    if (it == str_algo_map.end()) {
+        return false;
+    }
+    algo = it->second;
+    argp++;
+    // N
+    switch (algo) {
+    case Algo::NORM_BATCH:
+        N = 16;
+        break;
+    default:
+        assert(false);
+        return false;
+    }
+    if (argp < argc) {
+        if (!str_to_int(argv[argp], N)) {
+            return false;
+        }
+        argp++;
+    }
+    // batch_size
+    switch (algo) {
+    case Algo::NORM_BATCH:
+        batch_size = (N > 64) ? 64 : N;
+        break;
+    default:
+        assert(false);
+        return false;
+    }
+    if (argp < argc) {
+        if (!str_to_int(argv[argp], batch_size)) {
+            return false;
+        }
+        argp++;
+    }
+    if (argp < argc) {
+        return false;
+    }
+    return true;
+}
+
+void usage() {
+    fprintf(stderr, "Usage: test_tanto [-r <repeat>] <op> [<N>] [<B>]\n");
+    fprintf(stderr, "\n");
+    fprintf(stderr, "<op> is one of\n");
+    fprintf(stderr, "    norm_batch\n");
+    fprintf(stderr, "\n");
+}
+
+int main(int argc, char **argv) {
+    Algo algo = Algo(0);
+    int N = 0;
+    int batch_size = 0;
+    int repeat = 0;
+    if (!parse_args(argc, argv, algo, N, batch_size, repeat)) {
+        usage();
+        return 1;
+    }
+    if (!validate_args(algo, N, batch_size)) {
+        fprintf(stderr, "Invalid combination of command line arguments\n");
+        return 1;
+    }
+    bool ok = true;
+    try {
+        for (NormOp op: op_config) {
+        for (NormParam &param: param_config) {
+            ok &= run(algo, op, param, N, batch_size, repeat);
+        }
+        }
+    } catch (std::exception &e) {
+        fprintf(stderr, "Error: %s\n", e.what());
+        return 1;
+    }
+    return ok ? 0 : 1;
+}
+
@@ -6,6 +6,8 @@
 #include <limits>
 #include <algorithm>
 
+#include "host/base/ref_backend.hpp"
+
 #include "host/ref/pool2d_ref.hpp"
 
 namespace ronin {
@@ -13,6 +15,8 @@ namespace op {
 namespace pool {
 namespace ref {
 
+namespace base = ronin::op::common::base;
+
 //
 //    AvgPool2dRef
 //
@@ -55,6 +59,20 @@ void AvgPool2dRef::init(const float *x, float *y) {
 }
 
 void AvgPool2dRef::run() {
+    if (base::is_ref_backend_fast()) {
+        base::ref_parallel_for(m_N * m_P, [this](int index) {
+            run_row(index / m_P, index % m_P);
+        });
+    } else {
+        for (int n = 0; n < m_N; n++) {
+            for (int p = 0; p < m_P; p++) {
+                run_row(n, p);
+            }
+        }
+    }
+}
+
+void AvgPool2dRef::run_row(int n, int p) {
     int WC = m_W * m_C;
     int HWC = m_H * WC;
     int SC = m_S * m_C;
@@ -64,8 +82,6 @@ void AvgPool2dRef::run() {
 
     float scale = 1.0f / float(m_R * m_S);
 
-    for (int n = 0; n < m_N; n++) {
-    for (int p = 0; p < m_P; p++) {
     for (int q = 0; q < m_Q; q++) {
     for (int c = 0; c < m_C; c++) { 
         float acc = 0.0f;
@@ -87,8 +103,6 @@ void AvgPool2dRef::run() {
         m_y[ypos] = acc * scale;
     } // c
     } // q
-    } // p
-    } // n
 }
 
 int AvgPool2dRef::input_volume(int index) {
@@ -143,6 +157,20 @@ void MaxPool2dRef::init(const float *x, float *y) {
 }
 
 void MaxPool2dRef::run() {
+    if (base::is_ref_backend_fast()) {
+        base::ref_parallel_for(m_N * m_P, [this](int index) {
+            run_row(index / m_P, index % m_P);
+        });
+    } else {
+        for (int n = 0; n < m_N; n++) {
+            for (int p = 0; p < m_P; p++) {
+                run_row(n, p);
+            }
+        }
+    }
+}
+
+void MaxPool2dRef::run_row(int n, int p) {
     int WC = m_W * m_C;
     int HWC = m_H * WC;
     int SC = m_S * m_C;
@@ -152,8 +180,6 @@ void MaxPool2dRef::run() {
 
     constexpr float init_acc = std::numeric_limits<float>::lowest();
 
-    for (int n = 0; n < m_N; n++) {
-    for (int p = 0; p < m_P; p++) {
     for (int q = 0; q < m_Q; q++) {
     for (int c = 0; c < m_C; c++) { 
         float acc = init_acc;
@@ -175,8 +201,6 @@ void MaxPool2dRef::run() {
         m_y[ypos] = acc;
     } // c
     } // q
-    } // p
-    } // n
 }
 
 int MaxPool2dRef::input_volume(int index) {
@@ -32,6 +32,8 @@ public:
     void run();
     int input_volume(int index);
     int output_volume(int index);
+private:
+    void run_row(int n, int p);
 private:
     const float *m_x = nullptr;
     float *m_y = nullptr;
@@ -74,6 +76,8 @@ public:
     void run();
     int input_volume(int index);
     int output_volume(int index);
+private:
+    void run_row(int n, int p);
 private:
     const float *m_x = nullptr;
     float *m_y = nullptr;
@@ -0,0 +1,26 @@
+#!/bin/bash
+
+# SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+#
+# SPDX-License-Identifier: Apache-2.0
+
+# NOTE: kernels in ./metal are currently written by hand following the
+# frontend output format; after regenerating them with this script,
+# run yari/op/jitte/prj/softmax/run_test_tanto.sh to check results
+# against the reference implementation.
+
+FRONT=../../../../../tanto/bin/front/tanto
+
+TANTO=./tanto
+METAL=./metal
+
+mkdir -p $METAL
+
+$FRONT --mode=read -DT=bfloat16 $TANTO/softmax_batch_reader.cpp >$METAL/softmax_batch_reader.cpp
+$FRONT --mode=read -DT=bfloat16 $TANTO/softmax_batch_mask_reader.cpp >$METAL/softmax_batch_mask_reader.cpp
+
+$FRONT --mode=write -DT=bfloat16 $TANTO/softmax_batch_writer.cpp >$METAL/softmax_batch_writer.cpp
+
+$FRONT --mode=compute -DT=bfloat16 $TANTO/softmax_batch_math.cpp >$METAL/softmax_batch_math.cpp
+$FRONT --mode=compute -DT=bfloat16 $TANTO/softmax_batch_mask_math.cpp >$METAL/softmax_batch_mask_math.cpp
+
@@ -0,0 +1,188 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "tanto/compute.h"
+
+#define T bfloat16
+
+namespace NAMESPACE {
+
+void kernel(Pipe px, Pipe ps, Pipe pm, Pipe py, Pipe px_im, Pipe pxs,
+            Pipe pxe, Pipe pstat, Pipe py_im, uint32 N, uint32 H, uint32 W,
+            uint32 scale) {
+  uint32 Ht = H / 32;
+  uint32 Wt = W / 32;
+  px.frame_size = Wt;
+  ps.frame_size = 1;
+  pm.frame_size = Wt;
+  py.frame_size = Wt;
+  px_im.frame_size = Wt;
+  pxs.frame_size = Wt;
+  pxe.frame_size = Wt;
+  pstat.frame_size = 1;
+  py_im.frame_size = Wt;
+  cb_wait_front(ps.cb_id, ps.frame_size);
+  for (uint32 n = 0; n < N; n++) {
+    for (uint32 h = 0; h < Ht; h++) {
+      // px_im = tilize(px)
+      cb_reserve_back(px_im.cb_id, px_im.frame_size);
+      cb_wait_front(px.cb_id, px.frame_size);
+      tanto_unpack_tilize_block_init(px.cb_id, Wt);
+      tanto_copy_init();
+      tanto_pack_init(px_im.cb_id);
+      tilize_block(px.cb_id, Wt, px_im.cb_id);
+      cb_pop_front(px.cb_id, px.frame_size);
+      cb_push_back(px_im.cb_id, px_im.frame_size);
+      // pxs = px_im * scale + pm
+      cb_wait_front(px_im.cb_id, px_im.frame_size);
+      cb_wait_front(pm.cb_id, pm.frame_size);
+      cb_reserve_back(pxs.cb_id, pxs.frame_size);
+      tanto_pack_init(pxs.cb_id);
+      for (uint32 w = 0; w < Wt; w++) {
+        tile_regs_acquire();
+        tile_regs_wait();
+        tanto_unpack_unary_init(px_im.cb_id);
+        tanto_copy_init();
+        copy_tile(px_im.cb_id, w, 0);
+        tanto_binary_scalar_init();
+        mul_unary_tile(0, scale);
+        tanto_unpack_unary_init(pm.cb_id);
+        tanto_copy_init();
+        copy_tile(pm.cb_id, w, 1);
+        tanto_add_dst_init();
+        add_binary_tile(0, 1);
+        pack_tile(0, pxs.cb_id);
+        tile_regs_commit();
+        tile_regs_release();
+      }
+      cb_push_back(pxs.cb_id, pxs.frame_size);
+      cb_pop_front(pm.cb_id, pm.frame_size);
+      cb_pop_front(px_im.cb_id, px_im.frame_size);
+      // pstat = max(pxs)
+      cb_wait_front(pxs.cb_id, pxs.frame_size);
+      {
+        tanto_unpack_reduce_rows_init(pxs.cb_id, ps.cb_id);
+        tanto_reduce_max_rows_init();
+        tanto_pack_row_init(pstat.cb_id);
+        tile_regs_acquire();
+        tile_regs_wait();
+        for (uint32 w = 0; w < Wt; w++) {
+          reduce_tile<PoolType::MAX, ReduceDim::REDUCE_ROW>(pxs.cb_id, ps.cb_id,
+                                                            w, 0, 0);
+        }
+        cb_reserve_back(pstat.cb_id, pstat.frame_size);
+        pack_tile(0, pstat.cb_id);
+        cb_push_back(pstat.cb_id, pstat.frame_size);
+        tile_regs_commit();
+        tile_regs_release();
+      }
+      // pxe = exp(pxs - pstat)
+      cb_wait_front(pstat.cb_id, pstat.frame_size);
+      cb_reserve_back(pxe.cb_id, pxe.frame_size);
+      tanto_unpack_bcast_cols_init(pxs.cb_id, pstat.cb_id);
+      tanto_sub_bcast_cols_init();
+      tanto_pack_init(pxe.cb_id);
+      for (uint32 w = 0; w < Wt; w++) {
+        tile_regs_acquire();
+        tile_regs_wait();
+        any_tiles_bcast<EltwiseBinaryType::ELWSUB, BroadcastType::COL>(
+            pxs.cb_id, pstat.cb_id, w, 0, 0);
+        tanto_exp_init();
+        exp_tile(0, FAST_AND_APPROX);
+        pack_tile(0, pxe.cb_id);
+        tile_regs_commit();
+        tile_regs_release();
+      }
+      cb_push_back(pxe.cb_id, pxe.frame_size);
+      cb_pop_front(pstat.cb_id, pstat.frame_size);
+      cb_pop_front(pxs.cb_id, pxs.frame_size);
+      // pstat = recip(sum(pxe))
+      cb_wait_front(pxe.cb_id, pxe.frame_size);
+      {
+        tanto_unpack_reduce_rows_init(pxe.cb_id, ps.cb_id);
+        tanto_reduce_sum_rows_init();
+        tanto_pack_row_init(pstat.cb_id);
+        tile_regs_acquire();
+        tile_regs_wait();
+        for (uint32 w = 0; w < Wt; w++) {
+          reduce_tile<PoolType::SUM, ReduceDim::REDUCE_ROW>(pxe.cb_id,
+                                                            ps.cb_id, w, 0, 0);
+        }
+        tanto_recip_init();
+        recip_tile(0);
+        cb_reserve_back(pstat.cb_id, pstat.frame_size);
+        pack_tile(0, pstat.cb_id);
+        cb_push_back(pstat.cb_id, pstat.frame_size);
+        tile_regs_commit();
+        tile_regs_release();
+      }
+      // py_im = pxe * pstat
+      cb_wait_front(pstat.cb_id, pstat.frame_size);
+      cb_reserve_back(py_im.cb_id, py_im.frame_size);
+      tanto_unpack_bcast_cols_init(pxe.cb_id, pstat.cb_id);
+      tanto_mul_bcast_cols_init();
+      tanto_pack_init(py_im.cb_id);
+      for (uint32 w = 0; w < Wt; w++) {
+        tile_regs_acquire();
+        tile_regs_wait();
+        any_tiles_bcast<EltwiseBinaryType::ELWMUL, BroadcastType::COL>(
+            pxe.cb_id, pstat.cb_id, w, 0, 0);
+        pack_tile(0, py_im.cb_id);
+        tile_regs_commit();
+        tile_regs_release();
+      }
+      cb_push_back(py_im.cb_id, py_im.frame_size);
+      cb_pop_front(pstat.cb_id, pstat.frame_size);
+      cb_pop_front(pxe.cb_id, pxe.frame_size);
+      // py = untilize(py_im)
+      cb_reserve_back(py.cb_id, py.frame_size);
+      cb_wait_front(py_im.cb_id, py_im.frame_size);
+      tanto_unpack_untilize_block_init(py_im.cb_id);
+      tanto_copy_init();
+      tanto_pack_init(py.cb_id);
+      untilize_block<1>(py_im.cb_id, Wt, py.cb_id);
+      cb_pop_front(py_im.cb_id, py_im.frame_size);
+      cb_push_back(py.cb_id, py.frame_size);
+    }
+  }
+  cb_pop_front(ps.cb_id, ps.frame_size);
+}
+
+void MAIN {
+  Pipe px;
+  px.cb_id = get_arg_val<uint32>(0);
+  px.frame_size = get_arg_val<uint32>(1);
+  Pipe ps;
+  ps.cb_id = get_arg_val<uint32>(2);
+  ps.frame_size = get_arg_val<uint32>(3);
+  Pipe pm;
+  pm.cb_id = get_arg_val<uint32>(4);
+  pm.frame_size = get_arg_val<uint32>(5);
+  Pipe py;
+  py.cb_id = get_arg_val<uint32>(6);
+  py.frame_size = get_arg_val<uint32>(7);
+  Pipe px_im;
+  px_im.cb_id = get_arg_val<uint32>(8);
+  px_im.frame_size = get_arg_val<uint32>(9);
+  Pipe pxs;
+  pxs.cb_id = get_arg_val<uint32>(10);
+  pxs.frame_size = get_arg_val<uint32>(11);
+  Pipe pxe;
+  pxe.cb_id = get_arg_val<uint32>(12);
+  pxe.frame_size = get_arg_val<uint32>(13);
+  Pipe pstat;
+  pstat.cb_id = get_arg_val<uint32>(14);
+  pstat.frame_size = get_arg_val<uint32>(15);
+  Pipe py_im;
+  py_im.cb_id = get_arg_val<uint32>(16);
+  py_im.frame_size = get_arg_val<uint32>(17);
+  uint32 N = get_arg_val<uint32>(18);
+  uint32 H = get_arg_val<uint32>(19);
+  uint32 W = get_arg_val<uint32>(20);
+  uint32 scale = get_arg_val<uint32>(21);
+  tanto_compute_init();
+  kernel(px, ps, pm, py, px_im, pxs, pxe, pstat, py_im, N, H, W, scale);
+}
+} // namespace NAMESPACE
+
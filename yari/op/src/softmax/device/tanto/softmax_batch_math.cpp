@@ -0,0 +1,92 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+void kernel(
+        pipe<T> px,
+        pipe<T> ps,
+        pipe<T> py,
+        pipe<T> px_im,
+        pipe<T> pxe,
+        pipe<T> pstat,
+        pipe<T> py_im,
+        uint32 N,
+        uint32 H,
+        uint32 W,
+        uint32 scale) {
+    uint32 Ht = H / 32;
+    uint32 Wt = W / 32;
+    px.set_frame(Wt);
+    ps.set_frame(1);
+    py.set_frame(Wt);
+    px_im.set_frame(Wt);
+    pxe.set_frame(Wt);
+    pstat.set_frame(1);
+    py_im.set_frame(Wt);
+    ps.wait_front();
+    for (uint32 n = 0; n < N; n++) {
+        for (uint32 h = 0; h < Ht; h++) {
+            // px_im = tilize(px)
+            px_im.reserve_back();
+            px.wait_front();
+            tilize_block(px, Wt, px_im);
+            px.pop_front();
+            px_im.push_back();
+            // pstat = max(px_im)
+            px_im.wait_front();
+            {
+                math<T> acc;
+                for (uint32 w = 0; w < Wt; w++) {
+                    acc.reduce_max_rows(px_im, ps, w, 0, 0);
+                }
+                pstat.reserve_back();
+                acc.pack_row(0, pstat);
+                pstat.push_back();
+            }
+            // pxe = exp((px_im - pstat) * scale)
+            pstat.wait_front();
+            pxe.reserve_back();
+            for (uint32 w = 0; w < Wt; w++) {
+                math<T> acc;
+                acc.sub_bcast_cols(px_im, pstat, w, 0, 0);
+                acc.mul_scalar(0, scale);
+                acc.exp(0);
+                acc.pack(0, pxe);
+            }
+            pxe.push_back();
+            pstat.pop_front();
+            px_im.pop_front();
+            // pstat = recip(sum(pxe))
+            pxe.wait_front();
+            {
+                math<T> acc;
+                for (uint32 w = 0; w < Wt; w++) {
+                    acc.reduce_sum_rows(pxe, ps, w, 0, 0);
+                }
+                acc.recip(0);
+                pstat.reserve_back();
+                acc.pack_row(0, pstat);
+                pstat.push_back();
+            }
+            // py_im = pxe * pstat
+            pstat.wait_front();
+            py_im.reserve_back();
+            for (uint32 w = 0; w < Wt; w++) {
+                math<T> acc;
+                acc.mul_bcast_cols(pxe, pstat, w, 0, 0);
+                acc.pack(0, py_im);
+            }
+            py_im.push_back();
+            pstat.pop_front();
+            pxe.pop_front();
+            // py = untilize(py_im)
+            py.reserve_back();
+            py_im.wait_front();
+            untilize_block(py_im, Wt, py);
+            py_im.pop_front();
+            py.push_back();
+        }
+    }
+    ps.pop_front();
+}
+
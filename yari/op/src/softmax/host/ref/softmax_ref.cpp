@@ -0,0 +1,82 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+#include "host/ref/softmax_ref.hpp"
+
+namespace ronin {
+namespace op {
+namespace softmax {
+namespace ref {
+
+//
+//    SoftmaxRef
+//
+
+SoftmaxRef::SoftmaxRef(
+        int N,
+        int H,
+        int W,
+        float scale):
+            m_N(N),
+            m_H(H),
+            m_W(W),
+            m_scale(scale) { }
+
+SoftmaxRef::~SoftmaxRef() { }
+
+void SoftmaxRef::init(const float *x, const float *mask, float *y) {
+    m_x = x;
+    m_mask = mask;
+    m_y = y;
+}
+
+void SoftmaxRef::run() {
+    for (int n = 0; n < m_N; n++) {
+        for (int h = 0; h < m_H; h++) {
+            const float *px = m_x + (n * m_H + h) * m_W;
+            const float *pm = (m_mask != nullptr) ? m_mask + h * m_W : nullptr;
+            float *py = m_y + (n * m_H + h) * m_W;
+            float vmax = std::numeric_limits<float>::lowest();
+            for (int w = 0; w < m_W; w++) {
+                float t = px[w] * m_scale;
+                if (pm != nullptr) {
+                    t += pm[w];
+                }
+                py[w] = t;
+                vmax = std::max(vmax, t);
+            }
+            float sum = 0.0f;
+            for (int w = 0; w < m_W; w++) {
+                float t = std::exp(py[w] - vmax);
+                py[w] = t;
+                sum += t;
+            }
+            float inv = 1.0f / sum;
+            for (int w = 0; w < m_W; w++) {
+                py[w] *= inv;
+            }
+        }
+    }
+}
+
+int SoftmaxRef::input_volume(int index) {
+    assert(index == 0 || index == 1);
+    return (index == 0) ? m_N * m_H * m_W : m_H * m_W;
+}
+
+int SoftmaxRef::output_volume(int index) {
+    assert(index == 0);
+    return m_N * m_H * m_W;
+}
+
+} // namespace ref
+} // namespace softmax
+} // namespace op
+} // namespace ronin
+
@@ -0,0 +1,40 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+namespace ronin {
+namespace op {
+namespace softmax {
+namespace ref {
+
+class SoftmaxRef {
+public:
+    SoftmaxRef(
+        int N,
+        int H,
+        int W,
+        float scale);
+    ~SoftmaxRef();
+public:
+    // mask [H, W] is optional (nullptr if not used)
+    void init(const float *x, const float *mask, float *y);
+    void run();
+    int input_volume(int index);
+    int output_volume(int index);
+private:
+    const float *m_x = nullptr;
+    const float *m_mask = nullptr;
+    float *m_y = nullptr;
+    int m_N = 0;
+    int m_H = 0;
+    int m_W = 0;
+    float m_scale = 0.0f;
+};
+
+} // namespace ref
+} // namespace softmax
+} // namespace op
+} // namespace ronin
+
@@ -0,0 +1,466 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdint>
+#include <cassert>
+#include <string>
+#include <vector>
+
+#include "host/core/api.hpp"
+
+#include "host/util/transform.hpp"
+
+#include "host/tanto/util.hpp"
+#include "host/tanto/softmax_batch.hpp"
+
+namespace ronin {
+namespace op {
+namespace softmax {
+namespace tanto {
+
+namespace core = ronin::tanto::host;
+namespace util = ronin::op::common::util;
+
+namespace {
+
+uint32_t float_as_u32(float x) {
+    union U32 {
+        float f;
+        uint32_t i;
+    } u32;
+    u32.f = x;
+    return u32.i;
+}
+
+uint16_t float_to_u16b(float x) {
+    return uint16_t(float_as_u32(x) >> 16);
+}
+
+} // namespace
+
+//
+//    SoftmaxBatch
+//
+
+SoftmaxBatch::SoftmaxBatch(
+        int N,
+        int H,
+        int W,
+        float scale,
+        bool mask,
+        int batch_size):
+            m_N(N),
+            m_H(H),
+            m_W(W),
+            m_scale(scale),
+            m_mask(mask),
+            m_batch_size(batch_size) { }
+
+SoftmaxBatch::~SoftmaxBatch() { }
+
+void SoftmaxBatch::init(
+        const core::Device &device,
+        const core::Global &gx,
+        const core::Global &gm,
+        const core::Global &gy) {
+    m_device = device;
+    m_gx = gx;
+    m_gm = gm;
+    m_gy = gy;
+
+    assert(m_batch_size < 8 || m_batch_size % 8 == 0);
+    // ACHTUNG: Temporary limit 64 is Wormhole-specific
+    assert(m_batch_size <= 64);
+    assert(m_N % m_batch_size == 0);
+
+    assert(m_W % 32 == 0);
+    // scaling is applied after max subtraction
+    assert(m_scale > 0.0f);
+
+    m_program = core::Program(m_device);
+
+    uint32_t grid_x, grid_y;
+    compute_grid_dims(grid_x, grid_y);
+
+    m_x_start = 0;
+    m_y_start = 0;
+    m_x_end = grid_x - 1;
+    m_y_end = grid_y - 1;
+
+    m_grid = core::Grid(m_program, m_x_start, m_y_start, m_x_end, m_y_end);
+
+    m_zero_size = m_W;
+
+    // all row pipes hold one block of 32 rows (W / 32 tiles)
+    m_row_frame_size = m_W / 32;
+
+    m_kernel_base_path = "op/softmax/device/metal";
+    m_defines = {{"T", "bfloat16"}};
+
+    validate_globals();
+
+    create_globals();
+    create_locals();
+    create_pipes();
+    create_kernels();
+
+    init_locals();
+}
+
+void SoftmaxBatch::run() {
+    core::Queue queue(m_device, 0);
+    queue.enqueue_program(m_program, false);
+}
+
+int SoftmaxBatch::input_volume(int index) {
+    switch (index) {
+    case 0:
+        return m_N * u32_align(m_H, 32) * m_W;
+    case 1:
+        assert(m_mask);
+        return u32_align(m_H, 32) * m_W;
+    default:
+        assert(false);
+        return 0;
+    }
+}
+
+int SoftmaxBatch::output_volume(int index) {
+    assert(index == 0);
+    return m_N * u32_align(m_H, 32) * m_W;
+}
+
+std::vector<float> SoftmaxBatch::transform_input(int index, const std::vector<float> &x) {
+    std::vector<float> y;
+    switch (index) {
+    case 0:
+        y = util::pad(x, m_N, m_H, m_W, m_N, u32_align(m_H, 32), m_W);
+        break;
+    case 1:
+        assert(m_mask);
+        y = util::pad(x, m_H, m_W, u32_align(m_H, 32), m_W);
+        y = util::tilize(y, u32_align(m_H, 32), m_W);
+        y = util::make_faces(y);
+        break;
+    default:
+        assert(false);
+        break;
+    }
+    return y;
+}
+
+std::vector<float> SoftmaxBatch::transform_output(int index, const std::vector<float> &x) {
+    assert(index == 0);
+    return util::unpad(x, m_N, u32_align(m_H, 32), m_W, m_N, m_H, m_W);
+}
+
+void SoftmaxBatch::validate_globals() {
+    uint32_t item_bytes = get_item_bytes(T);
+    assert(!m_gx.is_null());
+    assert(!m_gy.is_null());
+    assert(m_gx.bytes() >= input_volume(0) * item_bytes);
+    if (m_mask) {
+        assert(!m_gm.is_null());
+        assert(m_gm.bytes() >= input_volume(1) * item_bytes);
+    }
+    assert(m_gy.bytes() >= output_volume(0) * item_bytes);
+}
+
+void SoftmaxBatch::create_globals() {
+    uint32_t log2_page_size = 10; // 2 ^ 10 = 1024
+    m_gs = core::Global(m_device, T, 1024, log2_page_size);
+    m_gzero = core::Global(m_device, T, m_zero_size, log2_page_size);
+}
+
+void SoftmaxBatch::create_locals() {
+    m_lzero = core::Local(m_program, m_grid, T, m_zero_size);
+}
+
+void SoftmaxBatch::create_pipes() {
+    m_px =
+        core::Pipe(
+            m_program,
+            m_grid,
+            core::PipeKind::INPUT,
+            T,
+            m_row_frame_size * 2,
+            m_row_frame_size);
+    // no double buffering for scale
+    m_ps =
+        core::Pipe(
+            m_program,
+            m_grid,
+            core::PipeKind::INPUT,
+            T,
+            1,
+            1);
+    if (m_mask) {
+        m_pm =
+            core::Pipe(
+                m_program,
+                m_grid,
+                core::PipeKind::INPUT,
+                T,
+                m_row_frame_size * 2,
+                m_row_frame_size);
+    }
+    m_py =
+        core::Pipe(
+            m_program,
+            m_grid,
+            core::PipeKind::OUTPUT,
+            T,
+            m_row_frame_size * 2,
+            m_row_frame_size);
+    m_px_im =
+        core::Pipe(
+            m_program,
+            m_grid,
+            core::PipeKind::INTERMED,
+            T,
+            m_row_frame_size,
+            m_row_frame_size);
+    if (m_mask) {
+        m_pxs =
+            core::Pipe(
+                m_program,
+                m_grid,
+                core::PipeKind::INTERMED,
+                T,
+                m_row_frame_size,
+                m_row_frame_size);
+    }
+    m_pxe =
+        core::Pipe(
+            m_program,
+            m_grid,
+            core::PipeKind::INTERMED,
+            T,
+            m_row_frame_size,
+            m_row_frame_size);
+    m_pstat =
+        core::Pipe(
+            m_program,
+            m_grid,
+            core::PipeKind::INTERMED,
+            T,
+            1,
+            1);
+    m_py_im =
+        core::Pipe(
+            m_program,
+            m_grid,
+            core::PipeKind::INTERMED,
+            T,
+            m_row_frame_size,
+            m_row_frame_size);
+}
+
+void SoftmaxBatch::create_kernels() {
+    create_reader();
+    create_writer();
+    create_math();
+}
+
+void SoftmaxBatch::create_reader() {
+    std::string path = m_kernel_base_path + "/" + make_kernel_name("reader") + ".cpp";
+    m_reader = 
+        core::Kernel(
+            m_program, 
+            m_grid, 
+            core::KernelKind::READER, 
+            core::KernelFormat::METAL,
+            path, 
+            {}, 
+            m_defines);
+/*
+void kernel(
+        global<T> gx,
+        global<T> gs,
+        global<T> gm,      // mask only
+        global<T> gzero,
+        local<T> lzero,
+        pipe<T> px,
+        pipe<T> ps,
+        pipe<T> pm,        // mask only
+        uint32 N,
+        uint32 H,
+        uint32 W,
+        uint32 zero_size,
+        uint32 x_pos,
+        uint32 x_stride)
+*/
+    uint32_t H_rnd = u32_align(m_H, 32);
+    uint32_t x_stride = (m_batch_size - 1) * H_rnd * m_W;
+    std::vector<core::KernelArg> args;
+    if (m_mask) {
+        args = {
+            m_gx,
+            m_gs,
+            m_gm,
+            m_gzero,
+            m_lzero,
+            m_px,
+            m_ps,
+            m_pm
+        };
+    } else {
+        args = {
+            m_gx,
+            m_gs,
+            m_gzero,
+            m_lzero,
+            m_px,
+            m_ps
+        };
+    }
+    uint32_t x_pos_index = uint32_t(args.size()) + 4;
+    args.push_back(m_N / m_batch_size);
+    args.push_back(m_H);
+    args.push_back(m_W);
+    args.push_back(m_zero_size);
+    args.push_back(uint32_t(0)); // x_pos
+    args.push_back(x_stride);
+    uint32_t x_inc = H_rnd * m_W;
+    uint32_t x_pos = 0;
+    for (uint32_t x = m_x_start; x <= m_x_end; x++) {
+        for (uint32_t y = m_y_start; y <= m_y_end; y++) {
+            args[x_pos_index] = x_pos;
+            m_reader.set_args(x, y, args);
+            x_pos += x_inc;
+        }
+    }
+}
+
+void SoftmaxBatch::create_writer() {
+    std::string path = m_kernel_base_path + "/softmax_batch_writer.cpp";
+    m_writer = 
+        core::Kernel(
+            m_program, 
+            m_grid, 
+            core::KernelKind::WRITER, 
+            core::KernelFormat::METAL,
+            path, 
+            {}, 
+            m_defines);
+/*
+void kernel(
+        global<T> gy,
+        pipe<T> py,
+        uint32 N,
+        uint32 H,
+        uint32 W,
+        uint32 y_pos,
+        uint32 y_stride)
+*/
+    uint32_t H_rnd = u32_align(m_H, 32);
+    uint32_t y_stride = (m_batch_size - 1) * H_rnd * m_W;
+    std::vector<core::KernelArg> args{
+        m_gy,
+        m_py,
+        m_N / m_batch_size,
+        H_rnd,
+        m_W,
+        uint32_t(0), // [5] y_pos
+        y_stride
+    };
+    uint32_t y_inc = H_rnd * m_W;
+    uint32_t y_pos = 0;
+    for (uint32_t x = m_x_start; x <= m_x_end; x++) {
+        for (uint32_t y = m_y_start; y <= m_y_end; y++) {
+            args[5] = y_pos;
+            m_writer.set_args(x, y, args);
+            y_pos += y_inc;
+        }
+    }
+}
+
+void SoftmaxBatch::create_math() {
+    std::string path = m_kernel_base_path + "/" + make_kernel_name("math") + ".cpp";
+    m_math = 
+        core::Kernel(
+            m_program, 
+            m_grid, 
+            core::KernelKind::MATH, 
+            core::KernelFormat::METAL,
+            path, 
+            {}, 
+            m_defines);
+/*
+void kernel(
+        pipe<T> px,
+        pipe<T> ps,
+        pipe<T> pm,        // mask only
+        pipe<T> py,
+        pipe<T> px_im,
+        pipe<T> pxs,       // mask only
+        pipe<T> pxe,
+        pipe<T> pstat,
+        pipe<T> py_im,
+        uint32 N,
+        uint32 H,
+        uint32 W,
+        uint32 scale)
+*/
+    uint32_t H_rnd = u32_align(m_H, 32);
+    std::vector<core::KernelArg> args;
+    if (m_mask) {
+        args = {
+            m_px,
+            m_ps,
+            m_pm,
+            m_py,
+            m_px_im,
+            m_pxs,
+            m_pxe,
+            m_pstat,
+            m_py_im
+        };
+    } else {
+        args = {
+            m_px,
+            m_ps,
+            m_py,
+            m_px_im,
+            m_pxe,
+            m_pstat,
+            m_py_im
+        };
+    }
+    args.push_back(m_N / m_batch_size);
+    args.push_back(H_rnd);
+    args.push_back(m_W);
+    args.push_back(float_as_u32(m_scale));
+    m_math.set_args(m_grid, args);
+}
+
+void SoftmaxBatch::init_locals() {
+    // same unit scaler is used for max and sum reductions
+    std::vector<uint16_t> vscale(1024, float_to_u16b(1.0f));
+    std::vector<uint32_t> vzero(m_gzero.bytes() / sizeof(uint32_t), 0);
+    core::Queue queue(m_device, 0);
+    queue.enqueue_write(m_gs, vscale.data(), true);
+    queue.enqueue_write(m_gzero, vzero.data(), true);
+}
+
+void SoftmaxBatch::compute_grid_dims(uint32_t &x, uint32_t &y) {
+    // ACHTUNG: Temporary limit 8 is Wormhole-specific
+    if (m_batch_size <= 8) {
+        x = m_batch_size;
+        y = 1;
+    } else {
+        x = 8;
+        y = m_batch_size / 8;
+    }
+}
+
+std::string SoftmaxBatch::make_kernel_name(const std::string &role) {
+    return m_mask ? "softmax_batch_mask_" + role : "softmax_batch_" + role;
+}
+
+} // namespace tanto
+} // namespace softmax
+} // namespace op
+} // namespace ronin
+
@@ -0,0 +1,111 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <map>
+
+#include "host/core/api.hpp"
+
+namespace ronin {
+namespace op {
+namespace softmax {
+namespace tanto {
+
+namespace core = ronin::tanto::host;
+
+//
+//    Softmax over the innermost dimension W of [N, H, W] tensor
+//
+//        y = softmax(x * scale + mask)
+//
+//    Scale must be positive. Optional additive mask has shape [H, W] 
+//    and is shared by all N. Each core processes blocks of 32 rows:
+//    max, exp, sum and normalization are fused in one pass.
+//    Input indices:
+//        0: x [N, H, W]
+//        1: mask [H, W] (if enabled)
+//
+
+class SoftmaxBatch {
+public:
+    SoftmaxBatch(
+        int N,
+        int H,
+        int W,
+        float scale,
+        bool mask,
+        int batch_size);
+    ~SoftmaxBatch();
+public:
+    void init(
+        const core::Device &device,
+        const core::Global &gx,
+        const core::Global &gm,
+        const core::Global &gy);
+    void run();
+    int input_volume(int index);
+    int output_volume(int index);
+    std::vector<float> transform_input(int index, const std::vector<float> &x);
+    std::vector<float> transform_output(int index, const std::vector<float> &x);
+private:
+    void validate_globals();
+    void create_globals();
+    void create_locals();
+    void create_pipes();
+    void create_kernels();
+    void create_reader();
+    void create_writer();
+    void create_math();
+    void init_locals();
+    void compute_grid_dims(uint32_t &x, uint32_t &y);
+    std::string make_kernel_name(const std::string &role);
+private:
+    static const core::DataFormat T = core::DataFormat::BFLOAT16;
+private:
+    core::Device m_device;
+    uint32_t m_batch_size = 0;
+    uint32_t m_N = 0;
+    uint32_t m_H = 0;
+    uint32_t m_W = 0;
+    float m_scale = 0.0f;
+    bool m_mask = false;
+    core::Program m_program;
+    uint32_t m_x_start = 0;
+    uint32_t m_y_start = 0;
+    uint32_t m_x_end = 0;
+    uint32_t m_y_end = 0;
+    core::Grid m_grid;
+    core::Global m_gx;
+    core::Global m_gs;
+    core::Global m_gm;
+    core::Global m_gy;
+    core::Global m_gzero;
+    core::Local m_lzero;
+    core::Pipe m_px;
+    core::Pipe m_ps;
+    core::Pipe m_pm;
+    core::Pipe m_py;
+    core::Pipe m_px_im;
+    core::Pipe m_pxs;
+    core::Pipe m_pxe;
+    core::Pipe m_pstat;
+    core::Pipe m_py_im;
+    core::Kernel m_reader;
+    core::Kernel m_writer;
+    core::Kernel m_math;
+    uint32_t m_zero_size = 0;
+    uint32_t m_row_frame_size = 0;
+    std::string m_kernel_base_path;
+    std::map<std::string, std::string> m_defines;
+};
+
+} // namespace tanto
+} // namespace softmax
+} // namespace op
+} // namespace ronin
+